@@ -50,6 +50,7 @@ SOFTWARE.
 #include "ranges.h"
 #include "type_traits.h"
 #include "utility.h"
+#include "private/algorithm_simd.h"
 
 #include <stdint.h>
 #include <string.h>
@@ -391,35 +392,216 @@ namespace etl
     }
   }
 
-  //***************************************************************************
-  // lower_bound
-  //***************************************************************************
-  template <typename TIterator, typename TValue, typename TCompare>
-  ETL_NODISCARD ETL_CONSTEXPR14 TIterator lower_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
+  namespace private_algorithm
   {
-    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+    //*********************************
+    /// Selects the branchless form of lower_bound and upper_bound.
+    /// Random access iterators to types that are cheap to compare.
+    //*********************************
+    template <typename TIterator>
+    struct is_branchless_search_candidate
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      static ETL_CONSTANT bool value = etl::is_random_access_iterator<TIterator>::value
+                                    && (etl::is_arithmetic<value_type>::value || etl::is_pointer<value_type>::value || etl::is_enum<value_type>::value);
+    };
+
+    template <typename TIterator>
+    ETL_CONSTANT bool is_branchless_search_candidate<TIterator>::value;
+
+    //*********************************
+    /// Prefetches a candidate for the next probe of a branchless search.
+    /// Only enabled if ETL_BINARY_SEARCH_USE_PREFETCH is defined.
+    //*********************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 void search_prefetch(TIterator itr)
+    {
+#if defined(ETL_BINARY_SEARCH_USE_PREFETCH) && (ETL_USING_BUILTIN_PREFETCH == 1) && (ETL_USING_CPP23 || (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1))
+      if (!etl::is_constant_evaluated())
+      {
+        __builtin_prefetch(&*itr);
+      }
+#else
+      (void)itr;
+#endif
+    }
+
+    //*********************************
+    template <typename TIterator, typename TValue, typename TCompare>
+    ETL_CONSTEXPR14 TIterator lower_bound_branchy(TIterator first, TIterator last, const TValue& value, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      difference_t count = etl::distance(first, last);
+
+      while (count > 0)
+      {
+        TIterator    itr  = first;
+        difference_t step = count / 2;
+
+        etl::advance(itr, step);
+
+        if (compare(*itr, value))
+        {
+          first = ++itr;
+          count -= step + 1;
+        }
+        else
+        {
+          count = step;
+        }
+      }
+
+      return first;
+    }
+
+    //*********************************
+    template <typename TIterator, typename TValue, typename TCompare>
+    ETL_CONSTEXPR14 TIterator upper_bound_branchy(TIterator first, TIterator last, const TValue& value, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      difference_t count = etl::distance(first, last);
+
+      while (count > 0)
+      {
+        TIterator    itr  = first;
+        difference_t step = count / 2;
+
+        etl::advance(itr, step);
+
+        if (!compare(value, *itr))
+        {
+          first = ++itr;
+          count -= step + 1;
+        }
+        else
+        {
+          count = step;
+        }
+      }
+
+      return first;
+    }
+
+    //*********************************
+    /// Branchless lower_bound.
+    /// The loop trip count depends only on the length of the range and the
+    /// probe result selects the next base, allowing a conditional move.
+    //*********************************
+    template <typename TIterator, typename TValue, typename TCompare>
+    ETL_CONSTEXPR14 TIterator lower_bound_branchless(TIterator first, TIterator last, const TValue& value, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      difference_t length = etl::distance(first, last);
+
+      if (length == 0)
+      {
+        return first;
+      }
+
+      while (length > 1)
+      {
+        const difference_t half = length / 2;
+        length -= half;
+
+        // Both possible probes of the next iteration.
+        search_prefetch(etl::next(first, length / 2));
+        search_prefetch(etl::next(first, half + (length / 2)));
+
+        etl::advance(first, compare(*etl::next(first, half), value) ? half : difference_t(0));
+      }
+
+      return etl::next(first, compare(*first, value) ? difference_t(1) : difference_t(0));
+    }
+
+    //*********************************
+    /// Branchless upper_bound.
+    //*********************************
+    template <typename TIterator, typename TValue, typename TCompare>
+    ETL_CONSTEXPR14 TIterator upper_bound_branchless(TIterator first, TIterator last, const TValue& value, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      difference_t length = etl::distance(first, last);
+
+      if (length == 0)
+      {
+        return first;
+      }
+
+      while (length > 1)
+      {
+        const difference_t half = length / 2;
+        length -= half;
+
+        // Both possible probes of the next iteration.
+        search_prefetch(etl::next(first, length / 2));
+        search_prefetch(etl::next(first, half + (length / 2)));
+
+        etl::advance(first, compare(value, *etl::next(first, half)) ? difference_t(0) : half);
+      }
+
+      return etl::next(first, compare(value, *first) ? difference_t(0) : difference_t(1));
+    }
 
-    difference_t count = etl::distance(first, last);
+    //*********************************
+    template <typename TIterator, typename TValue, typename TCompare>
+    ETL_CONSTEXPR14 TIterator lower_bound_impl(TIterator first, TIterator last, const TValue& value, TCompare compare, etl::false_type /*branchless*/)
+    {
+      return lower_bound_branchy(first, last, value, compare);
+    }
 
-    while (count > 0)
+    //*********************************
+    template <typename TIterator, typename TValue, typename TCompare>
+    ETL_CONSTEXPR14 TIterator lower_bound_impl(TIterator first, TIterator last, const TValue& value, TCompare compare, etl::true_type /*branchless*/)
     {
-      TIterator    itr  = first;
-      difference_t step = count / 2;
+      if (etl::is_constant_evaluated())
+      {
+        return lower_bound_branchy(first, last, value, compare);
+      }
+      else
+      {
+        return lower_bound_branchless(first, last, value, compare);
+      }
+    }
 
-      etl::advance(itr, step);
+    //*********************************
+    template <typename TIterator, typename TValue, typename TCompare>
+    ETL_CONSTEXPR14 TIterator upper_bound_impl(TIterator first, TIterator last, const TValue& value, TCompare compare, etl::false_type /*branchless*/)
+    {
+      return upper_bound_branchy(first, last, value, compare);
+    }
 
-      if (compare(*itr, value))
+    //*********************************
+    template <typename TIterator, typename TValue, typename TCompare>
+    ETL_CONSTEXPR14 TIterator upper_bound_impl(TIterator first, TIterator last, const TValue& value, TCompare compare, etl::true_type /*branchless*/)
+    {
+      if (etl::is_constant_evaluated())
       {
-        first = ++itr;
-        count -= step + 1;
+        return upper_bound_branchy(first, last, value, compare);
       }
       else
       {
-        count = step;
+        return upper_bound_branchless(first, last, value, compare);
       }
     }
+  } // namespace private_algorithm
 
-    return first;
+  //***************************************************************************
+  // lower_bound
+  /// Random access iterators to arithmetic, pointer or enum types use a
+  /// branchless search outside of constant evaluation.
+  /// Define ETL_BINARY_SEARCH_USE_PREFETCH to prefetch the candidate probes.
+  //***************************************************************************
+  template <typename TIterator, typename TValue, typename TCompare>
+  ETL_NODISCARD ETL_CONSTEXPR14 TIterator lower_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
+  {
+    typedef etl::integral_constant<bool, private_algorithm::is_branchless_search_candidate<TIterator>::value> branchless;
+
+    return private_algorithm::lower_bound_impl(first, last, value, compare, branchless());
   }
 
   template <typename TIterator, typename TValue>
@@ -432,33 +614,15 @@ namespace etl
 
   //***************************************************************************
   // upper_bound
+  /// Random access iterators to arithmetic, pointer or enum types use a
+  /// branchless search outside of constant evaluation.
   //***************************************************************************
   template <typename TIterator, typename TValue, typename TCompare>
   ETL_NODISCARD ETL_CONSTEXPR14 TIterator upper_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
   {
-    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
-
-    difference_t count = etl::distance(first, last);
-
-    while (count > 0)
-    {
-      TIterator    itr  = first;
-      difference_t step = count / 2;
-
-      etl::advance(itr, step);
+    typedef etl::integral_constant<bool, private_algorithm::is_branchless_search_candidate<TIterator>::value> branchless;
 
-      if (!compare(value, *itr))
-      {
-        first = ++itr;
-        count -= step + 1;
-      }
-      else
-      {
-        count = step;
-      }
-    }
-
-    return first;
+    return private_algorithm::upper_bound_impl(first, last, value, compare, branchless());
   }
 
   template <typename TIterator, typename TValue>
@@ -471,11 +635,14 @@ namespace etl
 
   //***************************************************************************
   // equal_range
+  /// The upper bound is searched for in the range that starts at the lower bound.
   //***************************************************************************
   template <typename TIterator, typename TValue, typename TCompare>
   ETL_NODISCARD ETL_CONSTEXPR14 ETL_OR_STD::pair<TIterator, TIterator> equal_range(TIterator first, TIterator last, const TValue& value, TCompare compare)
   {
-    return ETL_OR_STD::make_pair(etl::lower_bound(first, last, value, compare), etl::upper_bound(first, last, value, compare));
+    TIterator lower = etl::lower_bound(first, last, value, compare);
+
+    return ETL_OR_STD::make_pair(lower, etl::upper_bound(lower, last, value, compare));
   }
 
   template <typename TIterator, typename TValue>
@@ -484,7 +651,7 @@ namespace etl
   {
     typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
 
-    return ETL_OR_STD::make_pair(etl::lower_bound(first, last, value, compare()), etl::upper_bound(first, last, value, compare()));
+    return etl::equal_range(first, last, value, compare());
   }
 
   //***************************************************************************
@@ -525,23 +692,49 @@ namespace etl
     return last;
   }
 
-  //***************************************************************************
-  // find
-  //***************************************************************************
-  template <typename TIterator, typename T>
-  ETL_NODISCARD ETL_CONSTEXPR14 TIterator find(TIterator first, TIterator last, const T& value)
+  namespace private_algorithm
   {
-    while (first != last)
+    //*********************************
+    template <typename TIterator, typename T>
+    ETL_CONSTEXPR14 TIterator find_impl(TIterator first, TIterator last, const T& value, etl::false_type /*use_kernel*/)
     {
-      if (*first == value)
+      while (first != last)
       {
-        return first;
+        if (*first == value)
+        {
+          return first;
+        }
+
+        ++first;
       }
 
-      ++first;
+      return last;
     }
 
-    return last;
+    //*********************************
+    template <typename TIterator, typename T>
+    ETL_CONSTEXPR14 TIterator find_impl(TIterator first, TIterator last, const T& value, etl::true_type /*use_kernel*/)
+    {
+      if (etl::is_constant_evaluated())
+      {
+        return find_impl(first, last, value, etl::false_type());
+      }
+      else
+      {
+        return first + (private_algorithm_simd::find(first, last, value) - first);
+      }
+    }
+  } // namespace private_algorithm
+
+  //***************************************************************************
+  // find
+  /// Pointers to arithmetic types use the kernels in private/algorithm_simd.h
+  /// if ETL_ALGORITHM_USE_SIMD is defined.
+  //***************************************************************************
+  template <typename TIterator, typename T>
+  ETL_NODISCARD ETL_CONSTEXPR14 TIterator find(TIterator first, TIterator last, const T& value)
+  {
+    return private_algorithm::find_impl(first, last, value, private_algorithm_simd::use_compare_kernel<TIterator, T>());
   }
 
   //***************************************************************************
@@ -553,14 +746,38 @@ namespace etl
     std::fill(first, last, value);
   }
 #else
-  template <typename TIterator, typename TValue>
-  ETL_CONSTEXPR14 void fill(TIterator first, TIterator last, const TValue& value)
+  namespace private_algorithm
   {
-    while (first != last)
+    //*********************************
+    template <typename TIterator, typename TValue>
+    ETL_CONSTEXPR14 void fill_impl(TIterator first, TIterator last, const TValue& value, etl::false_type /*use_kernel*/)
     {
-      *first = value;
-      ++first;
+      while (first != last)
+      {
+        *first = value;
+        ++first;
+      }
     }
+
+    //*********************************
+    template <typename TIterator, typename TValue>
+    ETL_CONSTEXPR14 void fill_impl(TIterator first, TIterator last, const TValue& value, etl::true_type /*use_kernel*/)
+    {
+      if (etl::is_constant_evaluated())
+      {
+        fill_impl(first, last, value, etl::false_type());
+      }
+      else
+      {
+        private_algorithm_simd::fill(first, last, value);
+      }
+    }
+  } // namespace private_algorithm
+
+  template <typename TIterator, typename TValue>
+  ETL_CONSTEXPR14 void fill(TIterator first, TIterator last, const TValue& value)
+  {
+    private_algorithm::fill_impl(first, last, value, private_algorithm_simd::use_compare_kernel<TIterator, TValue>());
   }
 #endif
 
@@ -586,25 +803,55 @@ namespace etl
   }
 #endif
 
-  //***************************************************************************
-  // count
-  //***************************************************************************
-  template <typename TIterator, typename T>
-  ETL_NODISCARD ETL_CONSTEXPR14 typename etl::iterator_traits<TIterator>::difference_type count(TIterator first, TIterator last, const T& value)
+  namespace private_algorithm
   {
-    typename iterator_traits<TIterator>::difference_type n = 0;
-
-    while (first != last)
+    //*********************************
+    template <typename TIterator, typename T>
+    ETL_CONSTEXPR14 typename etl::iterator_traits<TIterator>::difference_type count_impl(TIterator first, TIterator last, const T& value,
+                                                                                         etl::false_type /*use_kernel*/)
     {
-      if (*first == value)
+      typename iterator_traits<TIterator>::difference_type n = 0;
+
+      while (first != last)
       {
-        ++n;
+        if (*first == value)
+        {
+          ++n;
+        }
+
+        ++first;
       }
 
-      ++first;
+      return n;
     }
 
-    return n;
+    //*********************************
+    template <typename TIterator, typename T>
+    ETL_CONSTEXPR14 typename etl::iterator_traits<TIterator>::difference_type count_impl(TIterator first, TIterator last, const T& value,
+                                                                                         etl::true_type /*use_kernel*/)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      if (etl::is_constant_evaluated())
+      {
+        return count_impl(first, last, value, etl::false_type());
+      }
+      else
+      {
+        return static_cast<difference_t>(private_algorithm_simd::count(first, last, value));
+      }
+    }
+  } // namespace private_algorithm
+
+  //***************************************************************************
+  // count
+  /// Pointers to arithmetic types use the kernels in private/algorithm_simd.h
+  /// if ETL_ALGORITHM_USE_SIMD is defined.
+  //***************************************************************************
+  template <typename TIterator, typename T>
+  ETL_NODISCARD ETL_CONSTEXPR14 typename etl::iterator_traits<TIterator>::difference_type count(TIterator first, TIterator last, const T& value)
+  {
+    return private_algorithm::count_impl(first, last, value, private_algorithm_simd::use_compare_kernel<TIterator, T>());
   }
 
   //***************************************************************************
@@ -665,21 +912,47 @@ namespace etl
 
 #else
 
-  template <typename TIterator1, typename TIterator2>
-  ETL_NODISCARD ETL_CONSTEXPR14 bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2)
+  namespace private_algorithm
   {
-    while (first1 != last1)
+    //*********************************
+    template <typename TIterator1, typename TIterator2>
+    ETL_CONSTEXPR14 bool equal_impl(TIterator1 first1, TIterator1 last1, TIterator2 first2, etl::false_type /*use_kernel*/)
     {
-      if (*first1 != *first2)
+      while (first1 != last1)
       {
-        return false;
+        if (*first1 != *first2)
+        {
+          return false;
+        }
+
+        ++first1;
+        ++first2;
       }
 
-      ++first1;
-      ++first2;
+      return true;
     }
 
-    return true;
+    //*********************************
+    template <typename TIterator1, typename TIterator2>
+    ETL_CONSTEXPR14 bool equal_impl(TIterator1 first1, TIterator1 last1, TIterator2 first2, etl::true_type /*use_kernel*/)
+    {
+      if (etl::is_constant_evaluated())
+      {
+        return equal_impl(first1, last1, first2, etl::false_type());
+      }
+      else
+      {
+        return private_algorithm_simd::equal(first1, last1, first2);
+      }
+    }
+  } // namespace private_algorithm
+
+  template <typename TIterator1, typename TIterator2>
+  ETL_NODISCARD ETL_CONSTEXPR14 bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2)
+  {
+    typedef typename private_algorithm_simd::pointer_value<TIterator2>::type value2_t;
+
+    return private_algorithm::equal_impl(first1, last1, first2, private_algorithm_simd::use_integral_kernel<TIterator1, value2_t>());
   }
 
   // Predicate
@@ -1074,8 +1347,171 @@ namespace etl
     }
   }
 
+  namespace private_algorithm
+  {
+    //*********************************************************
+    /// Orders the three referenced elements.
+    //*********************************************************
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14 void sort3(TIterator a, TIterator b, TIterator c, TCompare compare)
+    {
+      using ETL_OR_STD::swap;
+
+      if (compare(*b, *a))
+      {
+        swap(*a, *b);
+      }
+
+      if (compare(*c, *b))
+      {
+        swap(*b, *c);
+
+        if (compare(*b, *a))
+        {
+          swap(*a, *b);
+        }
+      }
+    }
+
+    //*********************************************************
+    /// Three way partition around the value at 'pivot'.
+    /// On exit [first, lower) < pivot, [lower, upper) == pivot and
+    /// [upper, last) > pivot. Runs of equal values are never revisited,
+    /// so inputs with many duplicates stay linear.
+    //*********************************************************
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14 void partition3(TIterator first, TIterator last, TIterator pivot, TIterator& lower, TIterator& upper, TCompare compare)
+    {
+      using ETL_OR_STD::swap;
+
+      swap(*first, *pivot);
+
+      // '*lower' is always the first element of the equal range, so the pivot is never copied.
+      lower        = first;
+      upper        = last;
+      TIterator it = etl::next(first);
+
+      while (it != upper)
+      {
+        if (compare(*it, *lower))
+        {
+          swap(*lower, *it);
+          ++lower;
+          ++it;
+        }
+        else if (compare(*lower, *it))
+        {
+          --upper;
+          swap(*it, *upper);
+        }
+        else
+        {
+          ++it;
+        }
+      }
+    }
+
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14 void introselect(TIterator first, TIterator nth, TIterator last, TCompare compare);
+
+    //*********************************************************
+    /// Median of medians pivot selection.
+    /// Sorts groups of five, gathers their medians at the front of the
+    /// range and selects the median of those.
+    //*********************************************************
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14 TIterator median_of_medians(TIterator first, TIterator last, TCompare compare)
+    {
+      using ETL_OR_STD::swap;
+
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      TIterator medians = first;
+      TIterator group   = first;
+
+      while (etl::distance(group, last) >= difference_t(5))
+      {
+        TIterator group_end = etl::next(group, 5);
+
+        etl::insertion_sort(group, group_end, compare);
+        swap(*medians, *etl::next(group, 2));
+        ++medians;
+
+        group = group_end;
+      }
+
+      TIterator median = etl::next(first, etl::distance(first, medians) / 2);
+
+      private_algorithm::introselect(first, median, medians, compare);
+
+      return median;
+    }
+
+    //*********************************************************
+    /// Introselect.
+    /// Quickselect with a median of three pivot. If a partition fails to
+    /// discard at least a quarter of the range, the next pivot is chosen by
+    /// median of medians, which bounds the worst case to O(N).
+    //*********************************************************
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14 void introselect(TIterator first, TIterator nth, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      // Ranges at or below this length are finished with an insertion sort.
+      const difference_t Insertion_Sort_Threshold = 16;
+
+      bool use_median_of_medians = false;
+
+      difference_t length = etl::distance(first, last);
+
+      while (length > Insertion_Sort_Threshold)
+      {
+        TIterator pivot = first;
+
+        if (use_median_of_medians)
+        {
+          pivot = private_algorithm::median_of_medians(first, last, compare);
+        }
+        else
+        {
+          pivot = etl::next(first, length / 2);
+          private_algorithm::sort3(first, pivot, etl::prev(last), compare);
+        }
+
+        TIterator lower = first;
+        TIterator upper = last;
+
+        private_algorithm::partition3(first, last, pivot, lower, upper, compare);
+
+        if (etl::distance(nth, lower) > 0)
+        {
+          last = lower;
+        }
+        else if (etl::distance(upper, nth) >= 0)
+        {
+          first = upper;
+        }
+        else
+        {
+          // 'nth' is within the range of values equal to the pivot.
+          return;
+        }
+
+        const difference_t previous_length = length;
+
+        length                = etl::distance(first, last);
+        use_median_of_medians = (length > (previous_length - (previous_length / 4)));
+      }
+
+      etl::insertion_sort(first, last, compare);
+    }
+  } // namespace private_algorithm
+
   //***************************************************************************
   /// partial_sort
+  /// Heap selects when the sorted prefix is small compared to the range.
+  /// Otherwise selects the prefix with introselect and sorts only that.
   ///\ingroup algorithm
   ///< a href="http://en.cppreference.com/w/cpp/algorithm/partial_sort"></a>
   //***************************************************************************
@@ -1090,6 +1526,31 @@ namespace etl
     typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
     typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
 
+    // Introselect swaps elements, which std::swap does not allow in a constant expression before C++20.
+#if ETL_NOT_USING_CPP14 || ETL_USING_CPP20 || ETL_NOT_USING_STL
+    const bool can_select = true;
+#elif (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1)
+    const bool can_select = !etl::is_constant_evaluated();
+#else
+    const bool can_select = false;
+#endif
+
+    const difference_t k = etl::distance(first, middle);
+    const difference_t n = etl::distance(first, last);
+
+    if (can_select && (middle != last) && (k > (n / 8)))
+    {
+      // Everything before '*(middle - 1)' is then no greater than it, and it is already in its sorted position.
+      TIterator prefix_last = etl::prev(middle);
+
+      private_algorithm::introselect(first, prefix_last, last, compare);
+
+      etl::make_heap(first, prefix_last, compare);
+      etl::sort_heap(first, prefix_last, compare);
+
+      return;
+    }
+
     etl::make_heap(first, middle, compare);
 
     for (TIterator i = middle; i != last; ++i)
@@ -1486,20 +1947,46 @@ namespace etl
       }
     }
 
-    return minimum;
-  }
-
-  //***************************************************************************
-  /// min_element
-  ///\ingroup algorithm
-  ///< a href="http://en.cppreference.com/w/cpp/algorithm/min_element"></a>
-  //***************************************************************************
+    return minimum;
+  }
+
+  //***************************************************************************
+  /// min_element
+  ///\ingroup algorithm
+  ///< a href="http://en.cppreference.com/w/cpp/algorithm/min_element"></a>
+  //***************************************************************************
+  namespace private_algorithm
+  {
+    //*********************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 TIterator min_element_impl(TIterator begin, TIterator end, etl::false_type /*use_kernel*/)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      return etl::min_element(begin, end, etl::less<value_t>());
+    }
+
+    //*********************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 TIterator min_element_impl(TIterator begin, TIterator end, etl::true_type /*use_kernel*/)
+    {
+      if (etl::is_constant_evaluated())
+      {
+        return min_element_impl(begin, end, etl::false_type());
+      }
+      else
+      {
+        return begin + (private_algorithm_simd::min_element(begin, end) - begin);
+      }
+    }
+  } // namespace private_algorithm
+
   template <typename TIterator>
   ETL_NODISCARD ETL_CONSTEXPR14 TIterator min_element(TIterator begin, TIterator end)
   {
     typedef typename etl::iterator_traits<TIterator>::value_type value_t;
 
-    return etl::min_element(begin, end, etl::less<value_t>());
+    return private_algorithm::min_element_impl(begin, end, private_algorithm_simd::use_compare_kernel<TIterator, value_t>());
   }
 
   //***************************************************************************
@@ -1535,12 +2022,38 @@ namespace etl
   ///\ingroup algorithm
   ///< a href="http://en.cppreference.com/w/cpp/algorithm/max_element"></a>
   //***************************************************************************
+  namespace private_algorithm
+  {
+    //*********************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 TIterator max_element_impl(TIterator begin, TIterator end, etl::false_type /*use_kernel*/)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      return etl::max_element(begin, end, etl::less<value_t>());
+    }
+
+    //*********************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 TIterator max_element_impl(TIterator begin, TIterator end, etl::true_type /*use_kernel*/)
+    {
+      if (etl::is_constant_evaluated())
+      {
+        return max_element_impl(begin, end, etl::false_type());
+      }
+      else
+      {
+        return begin + (private_algorithm_simd::max_element(begin, end) - begin);
+      }
+    }
+  } // namespace private_algorithm
+
   template <typename TIterator>
   ETL_NODISCARD ETL_CONSTEXPR14 TIterator max_element(TIterator begin, TIterator end)
   {
     typedef typename etl::iterator_traits<TIterator>::value_type value_t;
 
-    return etl::max_element(begin, end, etl::less<value_t>());
+    return private_algorithm::max_element_impl(begin, end, private_algorithm_simd::use_compare_kernel<TIterator, value_t>());
   }
 
   //***************************************************************************
@@ -1582,12 +2095,45 @@ namespace etl
   ///\ingroup algorithm
   ///< a href="http://en.cppreference.com/w/cpp/algorithm/minmax_element"></a>
   //***************************************************************************
+  namespace private_algorithm
+  {
+    //*********************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 ETL_OR_STD::pair<TIterator, TIterator> minmax_element_impl(TIterator begin, TIterator end, etl::false_type /*use_kernel*/)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      return etl::minmax_element(begin, end, etl::less<value_t>());
+    }
+
+    //*********************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 ETL_OR_STD::pair<TIterator, TIterator> minmax_element_impl(TIterator begin, TIterator end, etl::true_type /*use_kernel*/)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+
+      if (etl::is_constant_evaluated())
+      {
+        return minmax_element_impl(begin, end, etl::false_type());
+      }
+      else
+      {
+        const value_t* minimum = end;
+        const value_t* maximum = end;
+
+        private_algorithm_simd::minmax_element(begin, end, minimum, maximum);
+
+        return ETL_OR_STD::pair<TIterator, TIterator>(begin + (minimum - begin), begin + (maximum - begin));
+      }
+    }
+  } // namespace private_algorithm
+
   template <typename TIterator>
   ETL_NODISCARD ETL_CONSTEXPR14 ETL_OR_STD::pair<TIterator, TIterator> minmax_element(TIterator begin, TIterator end)
   {
     typedef typename etl::iterator_traits<TIterator>::value_type value_t;
 
-    return etl::minmax_element(begin, end, etl::less<value_t>());
+    return private_algorithm::minmax_element_impl(begin, end, private_algorithm_simd::use_compare_kernel<TIterator, value_t>());
   }
 
   //***************************************************************************
@@ -2280,16 +2826,40 @@ namespace etl
   /// Accumulates values.
   ///\ingroup algorithm
   //***************************************************************************
-  template <typename TIterator, typename T>
-  ETL_CONSTEXPR14 T accumulate(TIterator first, TIterator last, T sum)
+  namespace private_algorithm
   {
-    while (first != last)
+    //*********************************
+    template <typename TIterator, typename T>
+    ETL_CONSTEXPR14 T accumulate_impl(TIterator first, TIterator last, T sum, etl::false_type /*use_kernel*/)
     {
-      sum = static_cast<T>(ETL_MOVE(sum) + static_cast<T>(*first));
-      ++first;
+      while (first != last)
+      {
+        sum = static_cast<T>(ETL_MOVE(sum) + static_cast<T>(*first));
+        ++first;
+      }
+
+      return sum;
     }
 
-    return sum;
+    //*********************************
+    template <typename TIterator, typename T>
+    ETL_CONSTEXPR14 T accumulate_impl(TIterator first, TIterator last, T sum, etl::true_type /*use_kernel*/)
+    {
+      if (etl::is_constant_evaluated())
+      {
+        return accumulate_impl(first, last, sum, etl::false_type());
+      }
+      else
+      {
+        return private_algorithm_simd::accumulate(first, last, sum);
+      }
+    }
+  } // namespace private_algorithm
+
+  template <typename TIterator, typename T>
+  ETL_CONSTEXPR14 T accumulate(TIterator first, TIterator last, T sum)
+  {
+    return private_algorithm::accumulate_impl(first, last, sum, private_algorithm_simd::use_integral_kernel<TIterator, T>());
   }
 
   //***************************************************************************
@@ -2496,9 +3066,153 @@ namespace etl
     return ++d_first;
   }
 
+  namespace private_algorithm
+  {
+    //*********************************************************
+    /// Exponential search for the first element not less than 'value'.
+    /// Probes 1, 2, 4, 8... elements ahead and then binary searches the
+    /// bracketed run, so the cost is O(log d), where d is the distance
+    /// from 'first' to the result, rather than O(log N).
+    //*********************************************************
+    template <typename TIterator, typename T, typename TCompare>
+    ETL_CONSTEXPR14 TIterator gallop_lower_bound(TIterator first, TIterator last, const T& value, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      const difference_t length = etl::distance(first, last);
+
+      difference_t bound = 1;
+
+      while ((bound <= length) && compare(*etl::next(first, bound - 1), value))
+      {
+        bound *= 2;
+      }
+
+      // [first, first + bound / 2) are known to be less than 'value'.
+      TIterator lower = etl::next(first, bound / 2);
+      TIterator upper = (bound <= length) ? etl::next(first, bound - 1) : last;
+
+      return etl::lower_bound(lower, upper, value, compare);
+    }
+
+    //*********************************************************
+    /// Exponential search for the first element greater than 'value'.
+    //*********************************************************
+    template <typename TIterator, typename T, typename TCompare>
+    ETL_CONSTEXPR14 TIterator gallop_upper_bound(TIterator first, TIterator last, const T& value, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      const difference_t length = etl::distance(first, last);
+
+      difference_t bound = 1;
+
+      while ((bound <= length) && !compare(value, *etl::next(first, bound - 1)))
+      {
+        bound *= 2;
+      }
+
+      // [first, first + bound / 2) are known to be not greater than 'value'.
+      TIterator lower = etl::next(first, bound / 2);
+      TIterator upper = (bound <= length) ? etl::next(first, bound - 1) : last;
+
+      return etl::upper_bound(lower, upper, value, compare);
+    }
+
+    //*********************************************************
+    /// Element by element merge.
+    //*********************************************************
+    template <typename TInputIterator1, typename TInputIterator2, typename TOutputIterator, typename TCompare>
+    ETL_CONSTEXPR14 TOutputIterator merge_impl(TInputIterator1 first1, TInputIterator1 last1, TInputIterator2 first2, TInputIterator2 last2,
+                                               TOutputIterator d_first, TCompare compare, etl::false_type /*gallop*/)
+    {
+      while ((first1 != last1) && (first2 != last2))
+      {
+        if (compare(*first2, *first1))
+        {
+          *d_first = *first2;
+          ++first2;
+        }
+        else
+        {
+          *d_first = *first1;
+          ++first1;
+        }
+        ++d_first;
+      }
+
+      d_first = etl::copy(first1, last1, d_first);
+      d_first = etl::copy(first2, last2, d_first);
+
+      return d_first;
+    }
+
+    //*********************************************************
+    /// Adaptive merge for random access inputs.
+    /// Merges element by element until one side supplies Min_Gallop
+    /// elements in a row, then finds the end of that side's run with an
+    /// exponential search and copies it as a block.
+    /// Skewed inputs cost O(M log(N / M)) comparisons rather than O(N + M).
+    //*********************************************************
+    template <typename TInputIterator1, typename TInputIterator2, typename TOutputIterator, typename TCompare>
+    ETL_CONSTEXPR14 TOutputIterator merge_impl(TInputIterator1 first1, TInputIterator1 last1, TInputIterator2 first2, TInputIterator2 last2,
+                                               TOutputIterator d_first, TCompare compare, etl::true_type /*gallop*/)
+    {
+      const int Min_Gallop = 7;
+
+      int wins1 = 0;
+      int wins2 = 0;
+
+      while ((first1 != last1) && (first2 != last2))
+      {
+        if (wins1 >= Min_Gallop)
+        {
+          // Everything in the first range up to and including values equal to '*first2' comes first.
+          TInputIterator1 run_end = private_algorithm::gallop_upper_bound(first1, last1, *first2, compare);
+
+          d_first = etl::copy(first1, run_end, d_first);
+          first1  = run_end;
+          wins1   = 0;
+        }
+        else if (wins2 >= Min_Gallop)
+        {
+          // Everything in the second range less than '*first1' comes first.
+          TInputIterator2 run_end = private_algorithm::gallop_lower_bound(first2, last2, *first1, compare);
+
+          d_first = etl::copy(first2, run_end, d_first);
+          first2  = run_end;
+          wins2   = 0;
+        }
+        else if (compare(*first2, *first1))
+        {
+          *d_first = *first2;
+          ++first2;
+          ++d_first;
+          ++wins2;
+          wins1 = 0;
+        }
+        else
+        {
+          *d_first = *first1;
+          ++first1;
+          ++d_first;
+          ++wins1;
+          wins2 = 0;
+        }
+      }
+
+      d_first = etl::copy(first1, last1, d_first);
+      d_first = etl::copy(first2, last2, d_first);
+
+      return d_first;
+    }
+  } // namespace private_algorithm
+
   //***************************************************************************
   /// merge
   /// Merges two sorted ranges into one sorted range.
+  /// Random access inputs switch to galloping when one side wins several
+  /// comparisons in a row.
   /// see https://en.cppreference.com/w/cpp/algorithm/merge
   ///\ingroup algorithm
   //***************************************************************************
@@ -2506,25 +3220,10 @@ namespace etl
   ETL_CONSTEXPR14 TOutputIterator merge(TInputIterator1 first1, TInputIterator1 last1, TInputIterator2 first2, TInputIterator2 last2,
                                   TOutputIterator d_first, TCompare compare)
   {
-    while ((first1 != last1) && (first2 != last2))
-    {
-      if (compare(*first2, *first1))
-      {
-        *d_first = *first2;
-        ++first2;
-      }
-      else
-      {
-        *d_first = *first1;
-        ++first1;
-      }
-      ++d_first;
-    }
+    typedef etl::integral_constant<bool, etl::is_random_access_iterator<TInputIterator1>::value && etl::is_random_access_iterator<TInputIterator2>::value>
+      gallop;
 
-    d_first = etl::copy(first1, last1, d_first);
-    d_first = etl::copy(first2, last2, d_first);
-
-    return d_first;
+    return private_algorithm::merge_impl(first1, last1, first2, last2, d_first, compare, gallop());
   }
 
   //***************************************************************************
@@ -2550,6 +3249,8 @@ namespace etl
   /// Uses an iterative rotate-based algorithm that requires no additional
   /// memory, no recursion and no explicit stack, making it safe for deeply
   /// embedded targets with constrained stack sizes.
+  /// Block boundaries are found by galloping, so each step costs
+  /// comparisons in proportion to the log of the block length.
   /// Complexity: O(N log N) comparisons, O(N log N) element moves.
   /// see https://en.cppreference.com/w/cpp/algorithm/inplace_merge
   ///\ingroup algorithm
@@ -2567,7 +3268,7 @@ namespace etl
       // Find where the first element of the right half belongs in the left
       // half. All elements in [first, cut1) are <= *middle, so they are already
       // in place.
-      TBidirectionalIterator cut1   = etl::upper_bound(first, middle, *middle, compare);
+      TBidirectionalIterator cut1   = private_algorithm::gallop_upper_bound(first, middle, *middle, compare);
       difference_type        prefix = etl::distance(first, cut1);
       len1 -= prefix;
 
@@ -2583,7 +3284,7 @@ namespace etl
       // Find where the first element of the (remaining) left half belongs in
       // the right half.  All elements in [middle, cut2) are < *first, so they
       // need to be moved before *first.
-      TBidirectionalIterator cut2 = etl::lower_bound(middle, last, *first, compare);
+      TBidirectionalIterator cut2 = private_algorithm::gallop_lower_bound(middle, last, *first, compare);
       difference_type        run  = etl::distance(middle, cut2);
       len2 -= run;
 
@@ -3544,42 +4245,9 @@ namespace etl
     return first;
   }
 
-  //*********************************************************
-  namespace private_algorithm
-  {
-    using ETL_OR_STD::swap;
-
-    template <typename TIterator, typename TCompare>
-#if (ETL_USING_CPP20 && ETL_USING_STL) || (ETL_USING_CPP14 && ETL_NOT_USING_STL && !defined(ETL_IN_UNIT_TEST))
-    constexpr
-#endif
-      TIterator
-      nth_partition(TIterator first, TIterator last, TCompare compare)
-    {
-      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
-
-      value_type pivot_value = ETL_MOVE(*last);
-
-      TIterator i = first;
-
-      for (TIterator j = first; j < last; ++j)
-      {
-        if (!compare(pivot_value, *j)) // Hack to get '*j <= pivot_value' in
-                                       // terms of 'pivot_value < *j'
-        {
-          swap(*i, *j);
-          ++i;
-        }
-      }
-
-      swap(*i, *last);
-
-      return i;
-    }
-  } // namespace private_algorithm
-
   //*********************************************************
   /// nth_element
+  /// Introselect; O(N) in the worst case.
   /// see https://en.cppreference.com/w/cpp/algorithm/nth_element
   //*********************************************************
 #if ETL_USING_CPP11
@@ -3590,77 +4258,142 @@ namespace etl
     typename etl::enable_if< etl::is_random_access_iterator_concept<TIterator>::value, void>::type
     nth_element(TIterator first, TIterator nth, TIterator last, TCompare compare = TCompare())
   {
-    if (first == last)
+    if ((first == last) || (nth == last))
     {
       return;
     }
 
-    // 'last' must point to the actual last value.
-    --last;
+    private_algorithm::introselect(first, nth, last, compare);
+  }
+
+#else
 
-    while (first <= last)
+  //*********************************************************
+  template <typename TIterator, typename TCompare>
+  typename etl::enable_if< etl::is_random_access_iterator_concept<TIterator>::value, void>::type nth_element(TIterator first, TIterator nth,
+                                                                                                             TIterator last, TCompare compare)
+  {
+    if ((first == last) || (nth == last))
     {
-      TIterator p = private_algorithm::nth_partition(first, last, compare);
+      return;
+    }
+
+    private_algorithm::introselect(first, nth, last, compare);
+  }
+
+  //*********************************************************
+  template <typename TIterator>
+  typename etl::enable_if< etl::is_random_access_iterator_concept<TIterator>::value, void>::type nth_element(TIterator first, TIterator nth,
+                                                                                                             TIterator last)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare_t;
+
+    nth_element(first, nth, last, compare_t());
+  }
+#endif
+
+  //***************************************************************************
+  /// set_intersection_gallop
+  /// Writes the elements common to two sorted ranges, as set_intersection.
+  /// Whichever side is behind skips ahead with an exponential search, so
+  /// intersecting M elements with N costs O(M log(N / M)) comparisons
+  /// when M is much smaller than N.
+  /// There is currently no STL equivalent.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+  ETL_CONSTEXPR14 TOutputIterator set_intersection_gallop(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TOutputIterator d_first,
+                                                          TCompare compare)
+  {
+    ETL_STATIC_ASSERT(etl::is_random_access_iterator<TIterator1>::value && etl::is_random_access_iterator<TIterator2>::value,
+                      "set_intersection_gallop requires random access iterators");
 
-      if (p == nth)
+    while ((first1 != last1) && (first2 != last2))
+    {
+      if (compare(*first1, *first2))
       {
-        return;
+        first1 = private_algorithm::gallop_lower_bound(first1, last1, *first2, compare);
       }
-      else if (p > nth)
+      else if (compare(*first2, *first1))
       {
-        last = p - 1;
+        first2 = private_algorithm::gallop_lower_bound(first2, last2, *first1, compare);
       }
       else
       {
-        first = p + 1;
+        *d_first = *first1;
+        ++d_first;
+        ++first1;
+        ++first2;
       }
     }
-  }
 
-#else
+    return d_first;
+  }
 
-  //*********************************************************
-  template <typename TIterator, typename TCompare>
-  typename etl::enable_if< etl::is_random_access_iterator_concept<TIterator>::value, void>::type nth_element(TIterator first, TIterator nth,
-                                                                                                             TIterator last, TCompare compare)
+  //***************************************************************************
+  /// set_intersection_gallop
+  /// Uses operator< for comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator>
+  ETL_CONSTEXPR14 TOutputIterator set_intersection_gallop(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TOutputIterator d_first)
   {
-    if (first == last)
-    {
-      return;
-    }
+    typedef etl::less<typename etl::iterator_traits<TIterator1>::value_type> compare;
 
-    // 'last' must point to the actual last value.
-    --last;
+    return etl::set_intersection_gallop(first1, last1, first2, last2, d_first, compare());
+  }
 
-    while (first <= last)
-    {
-      TIterator p = private_algorithm::nth_partition(first, last, compare);
+  //***************************************************************************
+  /// set_difference_gallop
+  /// Writes the elements of the first sorted range that are not in the
+  /// second, as set_difference. Runs of either range that cannot match are
+  /// found with an exponential search; runs from the first range are then
+  /// copied as blocks.
+  /// There is currently no STL equivalent.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+  ETL_CONSTEXPR14 TOutputIterator set_difference_gallop(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TOutputIterator d_first,
+                                                        TCompare compare)
+  {
+    ETL_STATIC_ASSERT(etl::is_random_access_iterator<TIterator1>::value && etl::is_random_access_iterator<TIterator2>::value,
+                      "set_difference_gallop requires random access iterators");
 
-      if (p == nth)
+    while ((first1 != last1) && (first2 != last2))
+    {
+      if (compare(*first1, *first2))
       {
-        return;
+        TIterator1 run_end = private_algorithm::gallop_lower_bound(first1, last1, *first2, compare);
+
+        d_first = etl::copy(first1, run_end, d_first);
+        first1  = run_end;
       }
-      else if (p > nth)
+      else if (compare(*first2, *first1))
       {
-        last = p - 1;
+        first2 = private_algorithm::gallop_lower_bound(first2, last2, *first1, compare);
       }
       else
       {
-        first = p + 1;
+        ++first1;
+        ++first2;
       }
     }
+
+    return etl::copy(first1, last1, d_first);
   }
 
-  //*********************************************************
-  template <typename TIterator>
-  typename etl::enable_if< etl::is_random_access_iterator_concept<TIterator>::value, void>::type nth_element(TIterator first, TIterator nth,
-                                                                                                             TIterator last)
+  //***************************************************************************
+  /// set_difference_gallop
+  /// Uses operator< for comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator>
+  ETL_CONSTEXPR14 TOutputIterator set_difference_gallop(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TOutputIterator d_first)
   {
-    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare_t;
+    typedef etl::less<typename etl::iterator_traits<TIterator1>::value_type> compare;
 
-    nth_element(first, nth, last, compare_t());
+    return etl::set_difference_gallop(first1, last1, first2, last2, d_first, compare());
   }
-#endif
 
 #if ETL_USING_CPP17
 
@@ -83,6 +83,242 @@ namespace etl
     }
   };
 
+  namespace private_bip_buffer_spsc_atomic
+  {
+    //*************************************************************************
+    /// The read, write and wrap point indices of a bip buffer.
+    //*************************************************************************
+    template <typename TSize>
+    struct bip_indices
+    {
+      bip_indices()
+        : read(0)
+        , write(0)
+        , last(0)
+      {
+      }
+
+      etl::atomic<TSize> read;
+      etl::atomic<TSize> write;
+      etl::atomic<TSize> last;
+    };
+
+    //*************************************************************************
+    /// The reserve and commit logic of a bip buffer.
+    /// TIndices is any type with atomic 'read', 'write' and 'last' members,
+    /// so that the indices may be held by the buffer or by a shared region.
+    //*************************************************************************
+    template <typename TSize>
+    struct logic
+    {
+      //***********************************************************************
+      /// Returns the total used size, which may be split in two blocks.
+      //***********************************************************************
+      template <typename TIndices>
+      static TSize size(const TIndices& indices)
+      {
+        TSize write_index = indices.write.load(etl::memory_order_acquire);
+        TSize read_index  = indices.read.load(etl::memory_order_acquire);
+
+        // no wraparound
+        if (write_index >= read_index)
+        {
+          // size is distance between read and write
+          return write_index - read_index;
+        }
+        else
+        {
+          TSize last_index = indices.last.load(etl::memory_order_acquire);
+
+          // size is distance between beginning and write, plus read and last
+          return (write_index - 0) + (last_index - read_index);
+        }
+      }
+
+      //***********************************************************************
+      /// Returns the largest contiguous available block size.
+      //***********************************************************************
+      template <typename TIndices>
+      static TSize available(const TIndices& indices, TSize capacity)
+      {
+        TSize write_index = indices.write.load(etl::memory_order_acquire);
+        TSize read_index  = indices.read.load(etl::memory_order_acquire);
+
+        // no wraparound
+        if (write_index >= read_index)
+        {
+          TSize forward_size = capacity - write_index;
+
+          // check if there's more space if wrapping around
+          if (read_index > (forward_size + 1))
+          {
+            return read_index - 1;
+          }
+          else
+          {
+            return forward_size;
+          }
+        }
+        else // read_index > write_index
+        {
+          return read_index - write_index - 1;
+        }
+      }
+
+      //***********************************************************************
+      template <typename TIndices>
+      static void reset(TIndices& indices)
+      {
+        indices.read.store(0, etl::memory_order_release);
+        indices.write.store(0, etl::memory_order_release);
+        indices.last.store(0, etl::memory_order_release);
+      }
+
+      //***********************************************************************
+      template <typename TIndices>
+      static TSize get_write_reserve(TIndices& indices, TSize capacity, TSize* psize, TSize fallback_size)
+      {
+        TSize write_index = indices.write.load(etl::memory_order_relaxed);
+        TSize read_index  = indices.read.load(etl::memory_order_acquire);
+
+        // No wraparound
+        if (write_index >= read_index)
+        {
+          TSize forward_size = capacity - write_index;
+
+          // We still fit in linearly
+          if (*psize <= forward_size)
+          {
+            return write_index;
+          }
+          // There isn't more space even when wrapping around,
+          // or the linear size is good enough as fallback
+          else if ((read_index <= (forward_size + 1)) || (fallback_size <= forward_size))
+          {
+            *psize = forward_size;
+            return write_index;
+          }
+          // Better wrap around now
+          else
+          {
+            // Check if size fits.
+            // When wrapping, the write index cannot reach read index,
+            // then we'd not be able to distinguish wrapped situation from linear.
+            if (*psize >= read_index)
+            {
+              if (read_index > 0)
+              {
+                *psize = read_index - 1;
+              }
+              else
+              {
+                *psize = 0;
+              }
+            }
+
+            return 0;
+          }
+        }
+        else // read_index > write_index
+        {
+          // Doesn't fit
+          if (*psize >= read_index - write_index)
+          {
+            *psize = read_index - write_index - 1;
+          }
+
+          return write_index;
+        }
+      }
+
+      //***********************************************************************
+      template <typename TIndices>
+      static void apply_write_reserve(TIndices& indices, TSize capacity, TSize windex, TSize wsize)
+      {
+        if (wsize > 0)
+        {
+          TSize write_index = indices.write.load(etl::memory_order_relaxed);
+          TSize read_index  = indices.read.load(etl::memory_order_acquire);
+
+          // Wrapped around already
+          if (write_index < read_index)
+          {
+            ETL_ASSERT_OR_RETURN((windex == write_index) && ((wsize + 1) <= read_index), ETL_ERROR(bip_buffer_reserve_invalid));
+          }
+          // No wraparound so far, also not wrapping around with this block
+          else if (windex == write_index)
+          {
+            ETL_ASSERT_OR_RETURN(wsize <= (capacity - write_index), ETL_ERROR(bip_buffer_reserve_invalid));
+
+            // Move both indexes forward
+            indices.last.store(windex + wsize, etl::memory_order_release);
+          }
+          // Wrapping around now
+          else
+          {
+            ETL_ASSERT_OR_RETURN((windex == 0) && ((wsize + 1) <= read_index), ETL_ERROR(bip_buffer_reserve_invalid));
+
+            // Correct wrapping point
+            indices.last.store(write_index, etl::memory_order_release);
+          }
+
+          // Always update write index
+          indices.write.store(windex + wsize, etl::memory_order_release);
+        }
+      }
+
+      //***********************************************************************
+      template <typename TIndices>
+      static TSize get_read_reserve(TIndices& indices, TSize* psize)
+      {
+        TSize read_index  = indices.read.load(etl::memory_order_relaxed);
+        TSize write_index = indices.write.load(etl::memory_order_acquire);
+
+        if (read_index > write_index)
+        {
+          // Writer has wrapped around
+          TSize last_index = indices.last.load(etl::memory_order_relaxed);
+
+          if (read_index == last_index)
+          {
+            // Reader reached the end, start read from 0
+            read_index = 0;
+          }
+          else // (read_index < last_index)
+          {
+            // Use the remaining buffer at the end
+            write_index = last_index;
+          }
+        }
+        else
+        {
+          // No wraparound, nothing to adjust
+        }
+
+        // Limit to max available size
+        if ((write_index - read_index) < *psize)
+        {
+          *psize = write_index - read_index;
+        }
+
+        return read_index;
+      }
+
+      //***********************************************************************
+      template <typename TIndices>
+      static void apply_read_reserve(TIndices& indices, TSize rindex, TSize rsize)
+      {
+        if (rsize > 0)
+        {
+          TSize rsize_checker = rsize;
+          ETL_ASSERT_OR_RETURN((rindex == get_read_reserve(indices, &rsize_checker)) && (rsize == rsize_checker), ETL_ERROR(bip_buffer_reserve_invalid));
+
+          indices.read.store(rindex + rsize, etl::memory_order_release);
+        }
+      }
+    };
+  } // namespace private_bip_buffer_spsc_atomic
+
   //***************************************************************************
   /// The common base for a bip_buffer_spsc_atomic_base.
   //***************************************************************************
@@ -116,22 +352,7 @@ namespace etl
     //*************************************************************************
     size_type size() const
     {
-      size_type write_index = write.load(etl::memory_order_acquire);
-      size_type read_index  = read.load(etl::memory_order_acquire);
-
-      // no wraparound
-      if (write_index >= read_index)
-      {
-        // size is distance between read and write
-        return write_index - read_index;
-      }
-      else
-      {
-        size_type last_index = last.load(etl::memory_order_acquire);
-
-        // size is distance between beginning and write, plus read and last
-        return (write_index - 0) + (last_index - read_index);
-      }
+      return logic_t::size(indices);
     }
 
     //*************************************************************************
@@ -139,28 +360,7 @@ namespace etl
     //*************************************************************************
     size_type available() const
     {
-      size_type write_index = write.load(etl::memory_order_acquire);
-      size_type read_index  = read.load(etl::memory_order_acquire);
-
-      // no wraparound
-      if (write_index >= read_index)
-      {
-        size_type forward_size = capacity() - write_index;
-
-        // check if there's more space if wrapping around
-        if (read_index > (forward_size + 1))
-        {
-          return read_index - 1;
-        }
-        else
-        {
-          return forward_size;
-        }
-      }
-      else // read_index > write_index
-      {
-        return read_index - write_index - 1;
-      }
+      return logic_t::available(indices, capacity());
     }
 
     //*************************************************************************
@@ -185,9 +385,7 @@ namespace etl
     /// Constructs the buffer.
     //*************************************************************************
     bip_buffer_spsc_atomic_base(size_type reserved_)
-      : read(0)
-      , write(0)
-      , last(0)
+      : indices()
       , Reserved(reserved_)
     {
     }
@@ -195,156 +393,39 @@ namespace etl
     //*************************************************************************
     void reset()
     {
-      read.store(0, etl::memory_order_release);
-      write.store(0, etl::memory_order_release);
-      last.store(0, etl::memory_order_release);
+      logic_t::reset(indices);
     }
 
     //*************************************************************************
     size_type get_write_reserve(size_type* psize, size_type fallback_size = numeric_limits<size_type>::max())
     {
-      size_type write_index = write.load(etl::memory_order_relaxed);
-      size_type read_index  = read.load(etl::memory_order_acquire);
-
-      // No wraparound
-      if (write_index >= read_index)
-      {
-        size_type forward_size = capacity() - write_index;
-
-        // We still fit in linearly
-        if (*psize <= forward_size)
-        {
-          return write_index;
-        }
-        // There isn't more space even when wrapping around,
-        // or the linear size is good enough as fallback
-        else if ((read_index <= (forward_size + 1)) || (fallback_size <= forward_size))
-        {
-          *psize = forward_size;
-          return write_index;
-        }
-        // Better wrap around now
-        else
-        {
-          // Check if size fits.
-          // When wrapping, the write index cannot reach read index,
-          // then we'd not be able to distinguish wrapped situation from linear.
-          if (*psize >= read_index)
-          {
-            if (read_index > 0)
-            {
-              *psize = read_index - 1;
-            }
-            else
-            {
-              *psize = 0;
-            }
-          }
-
-          return 0;
-        }
-      }
-      else // read_index > write_index
-      {
-        // Doesn't fit
-        if (*psize >= read_index - write_index)
-        {
-          *psize = read_index - write_index - 1;
-        }
-
-        return write_index;
-      }
+      return logic_t::get_write_reserve(indices, capacity(), psize, fallback_size);
     }
 
     //*************************************************************************
     void apply_write_reserve(size_type windex, size_type wsize)
     {
-      if (wsize > 0)
-      {
-        size_type write_index = write.load(etl::memory_order_relaxed);
-        size_type read_index  = read.load(etl::memory_order_acquire);
-
-        // Wrapped around already
-        if (write_index < read_index)
-        {
-          ETL_ASSERT_OR_RETURN((windex == write_index) && ((wsize + 1) <= read_index), ETL_ERROR(bip_buffer_reserve_invalid));
-        }
-        // No wraparound so far, also not wrapping around with this block
-        else if (windex == write_index)
-        {
-          ETL_ASSERT_OR_RETURN(wsize <= (capacity() - write_index), ETL_ERROR(bip_buffer_reserve_invalid));
-
-          // Move both indexes forward
-          last.store(windex + wsize, etl::memory_order_release);
-        }
-        // Wrapping around now
-        else
-        {
-          ETL_ASSERT_OR_RETURN((windex == 0) && ((wsize + 1) <= read_index), ETL_ERROR(bip_buffer_reserve_invalid));
-
-          // Correct wrapping point
-          last.store(write_index, etl::memory_order_release);
-        }
-
-        // Always update write index
-        write.store(windex + wsize, etl::memory_order_release);
-      }
+      logic_t::apply_write_reserve(indices, capacity(), windex, wsize);
     }
 
     //*************************************************************************
     size_type get_read_reserve(size_type* psize)
     {
-      size_type read_index  = read.load(etl::memory_order_relaxed);
-      size_type write_index = write.load(etl::memory_order_acquire);
-
-      if (read_index > write_index)
-      {
-        // Writer has wrapped around
-        size_type last_index = last.load(etl::memory_order_relaxed);
-
-        if (read_index == last_index)
-        {
-          // Reader reached the end, start read from 0
-          read_index = 0;
-        }
-        else // (read_index < last_index)
-        {
-          // Use the remaining buffer at the end
-          write_index = last_index;
-        }
-      }
-      else
-      {
-        // No wraparound, nothing to adjust
-      }
-
-      // Limit to max available size
-      if ((write_index - read_index) < *psize)
-      {
-        *psize = write_index - read_index;
-      }
-
-      return read_index;
+      return logic_t::get_read_reserve(indices, psize);
     }
 
     //*************************************************************************
     void apply_read_reserve(size_type rindex, size_type rsize)
     {
-      if (rsize > 0)
-      {
-        size_type rsize_checker = rsize;
-        ETL_ASSERT_OR_RETURN((rindex == get_read_reserve(&rsize_checker)) && (rsize == rsize_checker), ETL_ERROR(bip_buffer_reserve_invalid));
-
-        read.store(rindex + rsize, etl::memory_order_release);
-      }
+      logic_t::apply_read_reserve(indices, rindex, rsize);
     }
 
   private:
 
-    etl::atomic<size_type> read;
-    etl::atomic<size_type> write;
-    etl::atomic<size_type> last;
-    const size_type        Reserved;
+    typedef private_bip_buffer_spsc_atomic::logic<size_type> logic_t;
+
+    private_bip_buffer_spsc_atomic::bip_indices<size_type> indices;
+    const size_type                                        Reserved;
 
   #if defined(ETL_POLYMORPHIC_SPSC_BIP_BUFFER_ATOMIC) || defined(ETL_POLYMORPHIC_CONTAINERS)
 
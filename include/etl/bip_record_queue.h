@@ -0,0 +1,332 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BIP_RECORD_QUEUE_INCLUDED
+#define ETL_BIP_RECORD_QUEUE_INCLUDED
+
+#include "platform.h"
+#include "alignment.h"
+#include "bip_buffer_spsc_atomic.h"
+#include "integral_limits.h"
+#include "power.h"
+#include "span.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+///\defgroup bip_record_queue bip_record_queue
+/// A single producer, single consumer queue of variable length byte records,
+/// framed on a bip_buffer_spsc_atomic.
+/// Each record is one contiguous block, preceded by its length, and never
+/// straddles the wrap point. Records are written and read in place.
+/// As a record must fit in one of the two free regions of the bip buffer,
+/// the largest record is about half of the buffer.
+///\ingroup containers
+
+#if ETL_HAS_ATOMIC && ETL_USING_CPP11
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup bip_record_queue
+  /// A queue of variable length records.
+  /// Supports one producer and one consumer.
+  ///\code
+  /// etl::bip_record_queue<1024> queue;
+  ///
+  /// // Producer
+  /// etl::span<unsigned char> record = queue.emplace_record(length);
+  /// if (!record.empty())
+  /// {
+  ///   encode(record);
+  ///   queue.commit();
+  /// }
+  ///
+  /// // Consumer
+  /// queue.for_each_record(16U, [](etl::span<const unsigned char> record) { decode(record); });
+  ///\endcode
+  ///\tparam Size         The buffer size in bytes. Rounded up to a multiple of Alignment.
+  ///\tparam Alignment    The alignment of each record's length and payload. A power of 2, at least 4.
+  ///\tparam Memory_Model The memory model of the underlying bip buffer.
+  //***************************************************************************
+  template <size_t Size, size_t Alignment = etl::alignment_of<uint64_t>::value, size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
+  class bip_record_queue
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_power_of_2<Alignment>::value && (Alignment >= sizeof(uint32_t)), "Alignment must be a power of 2 and at least 4");
+
+    typedef size_t size_type;
+
+    static ETL_CONSTANT size_t Block_Size    = Alignment;
+    static ETL_CONSTANT size_t Header_Blocks = (sizeof(uint32_t) + Alignment - 1U) / Alignment;
+    static ETL_CONSTANT size_t Blocks        = (Size + Alignment - 1U) / Alignment;
+
+    ETL_STATIC_ASSERT((Blocks / 2U) > Header_Blocks, "Size too small for a record");
+
+    /// The size of the largest record that can be queued.
+    /// When the queue is empty the free space may be split either side of the
+    /// indices, so only half of the blocks are sure to be contiguous.
+    static ETL_CONSTANT size_t Max_Record_Size = ((Blocks / 2U) - Header_Blocks) * Block_Size;
+
+    //*************************************************************************
+    /// Constructs an empty queue.
+    //*************************************************************************
+    bip_record_queue()
+      : pending()
+      , pending_length(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Reserves a contiguous area of 'size' bytes for a record.
+    /// Call from the producer only.
+    /// Returns an empty span if there is no room. A second call before
+    /// commit() replaces the earlier reservation.
+    //*************************************************************************
+    etl::span<unsigned char> emplace_record(size_t size)
+    {
+      pending = etl::span<block_type>();
+
+      if (size <= Max_Record_Size)
+      {
+        const block_size_type blocks = block_size_type(Header_Blocks + ((size + Block_Size - 1U) / Block_Size));
+
+        etl::span<block_type> reserve = buffer.write_reserve(blocks);
+
+        if (reserve.size() == blocks)
+        {
+          pending        = reserve;
+          pending_length = static_cast<uint32_t>(size);
+
+          return etl::span<unsigned char>(payload(reserve.data()), size);
+        }
+      }
+
+      return etl::span<unsigned char>();
+    }
+
+    //*************************************************************************
+    /// Publishes the record reserved by emplace_record().
+    /// Call from the producer only.
+    //*************************************************************************
+    void commit()
+    {
+      commit(pending_length);
+    }
+
+    //*************************************************************************
+    /// Publishes the first 'size' bytes of the record reserved by emplace_record().
+    /// 'size' must not exceed the reserved size.
+    /// Call from the producer only.
+    //*************************************************************************
+    void commit(size_t size)
+    {
+      ETL_ASSERT_OR_RETURN(!pending.empty() && (size <= pending_length), ETL_ERROR(bip_buffer_reserve_invalid));
+
+      const uint32_t length = static_cast<uint32_t>(size);
+      memcpy(static_cast<void*>(pending.data()), &length, sizeof(length));
+
+      buffer.write_commit(pending.first(Header_Blocks + ((size + Block_Size - 1U) / Block_Size)));
+
+      pending = etl::span<block_type>();
+    }
+
+    //*************************************************************************
+    /// Copies a record into the queue.
+    /// Returns false if there is no room.
+    /// Call from the producer only.
+    //*************************************************************************
+    bool push_record(const void* data, size_t size)
+    {
+      etl::span<unsigned char> record = emplace_record(size);
+
+      if (pending.empty())
+      {
+        return false;
+      }
+
+      if (size != 0U)
+      {
+        memcpy(record.data(), data, size);
+      }
+
+      commit();
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Calls 'f(etl::span<const unsigned char>)' for up to 'max_records'
+    /// records, oldest first, then releases them with one read commit.
+    /// Records are taken from one contiguous region, so a batch stops at
+    /// the wrap point; the next call continues from the start of the buffer.
+    /// If 'f' throws, the records before the one that threw are released
+    /// and the one that threw stays at the front of the queue.
+    /// Returns the number of records processed.
+    /// Call from the consumer only.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t for_each_record(size_t max_records, TFunction f)
+    {
+      etl::span<block_type> reserve = buffer.read_reserve();
+
+      size_t records = 0U;
+      size_t index   = 0U;
+
+  #if ETL_USING_EXCEPTIONS
+      try
+      {
+  #endif
+        while ((records < max_records) && (index < reserve.size()))
+        {
+          uint32_t length;
+          memcpy(&length, static_cast<const void*>(reserve.data() + index), sizeof(length));
+
+          f(etl::span<const unsigned char>(payload(reserve.data() + index), length));
+
+          index += Header_Blocks + ((length + Block_Size - 1U) / Block_Size);
+          ++records;
+        }
+  #if ETL_USING_EXCEPTIONS
+      }
+      catch (...)
+      {
+        buffer.read_commit(reserve.first(index));
+        throw;
+      }
+  #endif
+
+      buffer.read_commit(reserve.first(index));
+
+      return records;
+    }
+
+    //*************************************************************************
+    /// Calls 'f(etl::span<const unsigned char>)' for every record currently
+    /// in the queue, across the wrap point.
+    /// Returns the number of records processed.
+    /// Call from the consumer only.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t drain(TFunction f)
+    {
+      size_t records = for_each_record(etl::integral_limits<size_t>::max, f);
+
+      // Continue after the wrap point.
+      records += for_each_record(etl::integral_limits<size_t>::max, f);
+
+      return records;
+    }
+
+    //*************************************************************************
+    /// Returns true if there are no records.
+    //*************************************************************************
+    bool empty() const
+    {
+      return buffer.empty();
+    }
+
+    //*************************************************************************
+    /// Returns the number of bytes in use, including framing.
+    //*************************************************************************
+    size_t size_bytes() const
+    {
+      return buffer.size() * Block_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the size of the largest record that could be reserved now.
+    //*************************************************************************
+    size_t available() const
+    {
+      const size_t blocks = buffer.available();
+      const size_t bytes  = (blocks > Header_Blocks) ? (blocks - Header_Blocks) * Block_Size : 0U;
+
+      return (bytes < Max_Record_Size) ? bytes : Max_Record_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the buffer size in bytes.
+    //*************************************************************************
+    size_t capacity_bytes() const
+    {
+      return Blocks * Block_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the size of the largest record that can be queued.
+    //*************************************************************************
+    size_t max_record_size() const
+    {
+      return Max_Record_Size;
+    }
+
+  private:
+
+    typedef typename etl::aligned_storage<Alignment, Alignment>::type     block_type;
+    typedef etl::bip_buffer_spsc_atomic<block_type, Blocks, Memory_Model> buffer_type;
+    typedef typename buffer_type::size_type                               block_size_type;
+
+    ETL_STATIC_ASSERT(sizeof(block_type) == Alignment, "Unexpected block padding");
+
+    //*************************************************************************
+    static unsigned char* payload(block_type* p_header)
+    {
+      return reinterpret_cast<unsigned char*>(p_header + Header_Blocks);
+    }
+
+    // Disable copy construction and assignment.
+    bip_record_queue(const bip_record_queue&)            = delete;
+    bip_record_queue& operator=(const bip_record_queue&) = delete;
+
+    buffer_type           buffer;
+    etl::span<block_type> pending;        ///< The producer's reservation.
+    uint32_t              pending_length; ///< The reserved record length.
+  };
+
+  template <size_t Size, size_t Alignment, size_t Memory_Model>
+  ETL_CONSTANT size_t bip_record_queue<Size, Alignment, Memory_Model>::Block_Size;
+
+  template <size_t Size, size_t Alignment, size_t Memory_Model>
+  ETL_CONSTANT size_t bip_record_queue<Size, Alignment, Memory_Model>::Header_Blocks;
+
+  template <size_t Size, size_t Alignment, size_t Memory_Model>
+  ETL_CONSTANT size_t bip_record_queue<Size, Alignment, Memory_Model>::Blocks;
+
+  template <size_t Size, size_t Alignment, size_t Memory_Model>
+  ETL_CONSTANT size_t bip_record_queue<Size, Alignment, Memory_Model>::Max_Record_Size;
+} // namespace etl
+
+#endif /* ETL_HAS_ATOMIC && ETL_USING_CPP11 */
+
+#endif
@@ -0,0 +1,249 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BIQUAD_CASCADE_INCLUDED
+#define ETL_BIQUAD_CASCADE_INCLUDED
+
+#include "platform.h"
+#include "span.h"
+#include "static_assert.h"
+#include "private/filter_arithmetic.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// A cascade of second order IIR sections, for one or more interleaved
+  /// channels. Each section is computed in direct form I.
+  ///
+  /// y[n] = b0x[n] + b1x[n-1] + b2x[n-2] - a1y[n-1] - a2y[n-2]
+  ///
+  /// The coefficients of each section are {b0, b1, b2, a1, a2}, normalised so
+  /// that a0 is 1, as produced by most filter design tools.
+  /// int16_t and int32_t samples are Q15 and Q31 fixed point. Their
+  /// coefficients have one less fraction bit, giving the range [-2, 2), and
+  /// should be made with coefficient(). Each section is accumulated in 64 bits,
+  /// then rounded and saturated. For Q31 the magnitudes of a section's five
+  /// coefficients must sum to less than 4; otherwise the 64 bit sum may
+  /// overflow, and wraps around rather than saturating.
+  ///\tparam T        The sample and coefficient type.
+  ///\tparam Stages   The number of second order sections.
+  ///\tparam Channels The number of interleaved channels. Default 1.
+  //***************************************************************************
+  template <typename T, size_t Stages, size_t Channels = 1U>
+  class biquad_cascade
+  {
+  private:
+
+    typedef etl::private_filter::arithmetic<T>        arithmetic_t;
+    typedef typename arithmetic_t::accumulator_type accumulator_type;
+
+    static ETL_CONSTANT int Shift = arithmetic_t::Fraction_Bits - 1;
+
+  public:
+
+    ETL_STATIC_ASSERT(Stages > 0U, "Stages must be greater than zero");
+    ETL_STATIC_ASSERT(Channels > 0U, "Channels must be greater than zero");
+
+    typedef T value_type;
+
+    static ETL_CONSTANT size_t STAGES                 = Stages;
+    static ETL_CONSTANT size_t CHANNELS               = Channels;
+    static ETL_CONSTANT size_t COEFFICIENTS_PER_STAGE = 5U;
+
+    //*************************************************************************
+    /// Converts a coefficient to the filter's format.
+    /// For Q15 and Q31 the value must be in the range [-2, 2).
+    //*************************************************************************
+    static T coefficient(double value)
+    {
+      return arithmetic_t::template to_coefficient<Shift>(value);
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param coefficients_ 5 * Stages coefficients, {b0, b1, b2, a1, a2} for each stage.
+    //*************************************************************************
+    explicit biquad_cascade(const T* coefficients_)
+    {
+      set_coefficients(coefficients_);
+      reset();
+    }
+
+    //*************************************************************************
+    /// Sets the coefficients. The state is unchanged.
+    /// \param coefficients_ 5 * Stages coefficients, {b0, b1, b2, a1, a2} for each stage.
+    //*************************************************************************
+    void set_coefficients(const T* coefficients_)
+    {
+      for (size_t s = 0U; s < Stages; ++s)
+      {
+        stages[s].b0 = *coefficients_++;
+        stages[s].b1 = *coefficients_++;
+        stages[s].b2 = *coefficients_++;
+        stages[s].a1 = *coefficients_++;
+        stages[s].a2 = *coefficients_++;
+      }
+    }
+
+    //*************************************************************************
+    /// Clears the state.
+    //*************************************************************************
+    void reset()
+    {
+      for (size_t c = 0U; c < Channels; ++c)
+      {
+        for (size_t s = 0U; s < Stages; ++s)
+        {
+          state[c][s].x1 = T(0);
+          state[c][s].x2 = T(0);
+          state[c][s].y1 = T(0);
+          state[c][s].y2 = T(0);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Filters one sample of a channel.
+    /// Asserts etl::filter_channel_out_of_range if 'channel' is not less than Channels.
+    /// \return The output sample.
+    //*************************************************************************
+    T process(T sample, size_t channel = 0U)
+    {
+      ETL_ASSERT(channel < Channels, ETL_ERROR(filter_channel_out_of_range));
+
+      section_state* p_state = state[channel];
+
+      for (size_t s = 0U; s < Stages; ++s)
+      {
+        const section& k = stages[s];
+        section_state& z = p_state[s];
+
+        accumulator_type acc = arithmetic_t::product(k.b0, sample);
+        acc                  = arithmetic_t::add(acc, arithmetic_t::product(k.b1, z.x1));
+        acc                  = arithmetic_t::add(acc, arithmetic_t::product(k.b2, z.x2));
+        acc                  = arithmetic_t::subtract(acc, arithmetic_t::product(k.a1, z.y1));
+        acc                  = arithmetic_t::subtract(acc, arithmetic_t::product(k.a2, z.y2));
+
+        const T result = arithmetic_t::template to_sample<Shift>(acc);
+
+        z.x2 = z.x1;
+        z.x1 = sample;
+        z.y2 = z.y1;
+        z.y1 = result;
+
+        sample = result;
+      }
+
+      return sample;
+    }
+
+    //*************************************************************************
+    /// Filters one sample of channel 0.
+    //*************************************************************************
+    T operator()(T sample)
+    {
+      return process(sample);
+    }
+
+    //*************************************************************************
+    /// Filters a block of interleaved samples.
+    /// Processes the whole frames in the shorter span and returns the number
+    /// of samples processed.
+    /// 'output' may be the same as 'input'.
+    //*************************************************************************
+    size_t apply(etl::span<const T> input, etl::span<T> output)
+    {
+      size_t n = (input.size() < output.size()) ? input.size() : output.size();
+      n -= n % Channels;
+
+      const T* p_input  = input.data();
+      T*       p_output = output.data();
+
+      for (size_t i = 0U; i < n; i += Channels)
+      {
+        for (size_t c = 0U; c < Channels; ++c)
+        {
+          p_output[i + c] = process(p_input[i + c], c);
+        }
+      }
+
+      return n;
+    }
+
+  private:
+
+    struct section
+    {
+      T b0;
+      T b1;
+      T b2;
+      T a1;
+      T a2;
+    };
+
+    struct section_state
+    {
+      T x1;
+      T x2;
+      T y1;
+      T y2;
+    };
+
+    section       stages[Stages];
+    section_state state[Channels][Stages];
+  };
+
+  template <typename T, size_t Stages, size_t Channels>
+  ETL_CONSTANT int biquad_cascade<T, Stages, Channels>::Shift;
+
+  template <typename T, size_t Stages, size_t Channels>
+  ETL_CONSTANT size_t biquad_cascade<T, Stages, Channels>::STAGES;
+
+  template <typename T, size_t Stages, size_t Channels>
+  ETL_CONSTANT size_t biquad_cascade<T, Stages, Channels>::CHANNELS;
+
+  template <typename T, size_t Stages, size_t Channels>
+  ETL_CONSTANT size_t biquad_cascade<T, Stages, Channels>::COEFFICIENTS_PER_STAGE;
+
+#if ETL_USING_CPP11
+  //***************************************************************************
+  /// Q15 and Q31 fixed point biquad cascades.
+  //***************************************************************************
+  template <size_t Stages, size_t Channels = 1U>
+  using biquad_cascade_q15 = etl::biquad_cascade<int16_t, Stages, Channels>;
+
+  template <size_t Stages, size_t Channels = 1U>
+  using biquad_cascade_q31 = etl::biquad_cascade<int32_t, Stages, Channels>;
+#endif
+} // namespace etl
+
+#endif
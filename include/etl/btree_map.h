@@ -0,0 +1,342 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_MAP_INCLUDED
+#define ETL_BTREE_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "error_handler.h"
+#include "functional.h"
+#include "initializer_list.h"
+#include "pool.h"
+#include "utility.h"
+
+#include "private/btree_base.h"
+
+//*****************************************************************************
+///\defgroup btree_map btree_map
+/// An ordered map held in a B+ tree, with the capacity defined at compile time.
+/// Keys are packed into cache line sized nodes, so a lookup touches far fewer
+/// cache lines than in etl::map, and the linked leaves make range scans
+/// sequential. Insertion and erasure are O(log n) without moving the other
+/// values, unlike etl::flat_map.
+/// Inserting or erasing invalidates all iterators.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for btree_maps of a fanout.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t Fanout, typename TKeyCompare = etl::less<TKey> >
+  class ibtree_map
+    : public etl::ibtree<TKey, ETL_OR_STD::pair<const TKey, TMapped>, etl::private_btree::select_first<TKey, ETL_OR_STD::pair<const TKey, TMapped> >, Fanout,
+                         TKeyCompare>
+  {
+  private:
+
+    typedef etl::ibtree<TKey, ETL_OR_STD::pair<const TKey, TMapped>, etl::private_btree::select_first<TKey, ETL_OR_STD::pair<const TKey, TMapped> >, Fanout,
+                        TKeyCompare>
+      base_t;
+
+  public:
+
+    typedef TMapped                              mapped_type;
+    typedef typename base_t::key_type            key_type;
+    typedef typename base_t::value_type          value_type;
+    typedef typename base_t::key_compare         key_compare;
+    typedef typename base_t::const_key_reference const_key_reference;
+    typedef mapped_type&                         mapped_reference;
+    typedef const mapped_type&                   const_mapped_reference;
+    typedef typename base_t::iterator            iterator;
+    typedef typename base_t::const_iterator      const_iterator;
+
+    //*************************************************************************
+    /// Compares values by key.
+    //*************************************************************************
+    class value_compare
+    {
+    public:
+
+      bool operator()(const value_type& lhs, const value_type& rhs) const
+      {
+        return kcompare(lhs.first, rhs.first);
+      }
+
+    private:
+
+      key_compare kcompare;
+    };
+
+    //*************************************************************************
+    /// Returns a reference to the value with the key, inserting a default
+    /// constructed value if the key is not present.
+    /// If asserts or exceptions are enabled, emits btree_full if the key is
+    /// not present and the map is full.
+    //*************************************************************************
+    mapped_reference operator[](const_key_reference key)
+    {
+      iterator i_element = this->find(key);
+
+      if (i_element == this->end())
+      {
+        i_element = this->insert(value_type(key, mapped_type())).first;
+      }
+
+      return i_element->second;
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the value with the key.
+    /// If asserts or exceptions are enabled, emits btree_out_of_bounds if the
+    /// key is not in the map.
+    //*************************************************************************
+    mapped_reference at(const_key_reference key)
+    {
+      iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != this->end(), ETL_ERROR(btree_out_of_bounds));
+
+      return i_element->second;
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the value with the key.
+    /// If asserts or exceptions are enabled, emits btree_out_of_bounds if the
+    /// key is not in the map.
+    //*************************************************************************
+    const_mapped_reference at(const_key_reference key) const
+    {
+      const_iterator i_element = this->find(key);
+
+      ETL_ASSERT(i_element != this->end(), ETL_ERROR(btree_out_of_bounds));
+
+      return i_element->second;
+    }
+
+    //*************************************************************************
+    /// Gets the value comparison function.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return value_compare();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ibtree_map(etl::ipool& leaf_pool, etl::ipool& internal_pool, size_t max_size_)
+      : base_t(leaf_pool, internal_pool, max_size_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction.
+    ibtree_map(const ibtree_map&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_BTREE_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+
+  public:
+
+    virtual ~ibtree_map() {}
+#else
+
+  protected:
+
+    ~ibtree_map() {}
+#endif
+  };
+
+  //***************************************************************************
+  /// A btree_map with the capacity defined at compile time.
+  ///\tparam MAX_SIZE_ The maximum number of values.
+  ///\tparam Fanout    The number of values in a leaf and children of an
+  ///                  internal node. By default, as many keys as fit in
+  ///                  ETL_BTREE_CACHE_LINE_SIZE bytes.
+  /// Nodes are only guaranteed to be half full, so the pools are sized for
+  /// twice MAX_SIZE_ values.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, const size_t Fanout = etl::private_btree::default_fanout<TKey>::value,
+            typename TKeyCompare = etl::less<TKey> >
+  class btree_map : public etl::ibtree_map<TKey, TMapped, Fanout, TKeyCompare>
+  {
+  private:
+
+    typedef etl::ibtree_map<TKey, TMapped, Fanout, TKeyCompare> base_t;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    btree_map()
+      : base_t(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    btree_map(const btree_map& other)
+      : base_t(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      this->assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    btree_map(btree_map&& other)
+      : base_t(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      move_from(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    /// A sorted range is bulk loaded.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_map(TIterator first, TIterator last)
+      : base_t(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    btree_map(std::initializer_list<typename base_t::value_type> init)
+      : base_t(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_map()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_map& operator=(const btree_map& rhs)
+    {
+      if (this != &rhs)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    btree_map& operator=(btree_map&& rhs)
+    {
+      if (this != &rhs)
+      {
+        this->clear();
+        move_from(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves the values from the other map, which is left empty.
+    //*************************************************************************
+    void move_from(btree_map& other)
+    {
+      for (typename base_t::iterator i_element = other.begin(); i_element != other.end(); ++i_element)
+      {
+        this->insert(etl::move(*i_element));
+      }
+
+      other.clear();
+    }
+#endif
+
+    /// The pools of nodes used by the map.
+    etl::pool<typename base_t::leaf_node, etl::private_btree::leaf_nodes<MAX_SIZE_, Fanout>::value>         leaf_pool;
+    etl::pool<typename base_t::internal_node, etl::private_btree::internal_nodes<MAX_SIZE_, Fanout>::value> internal_pool;
+  };
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, const size_t Fanout, typename TKeyCompare>
+  ETL_CONSTANT size_t btree_map<TKey, TMapped, MAX_SIZE_, Fanout, TKeyCompare>::MAX_SIZE;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t Fanout, typename TKeyCompare>
+  bool operator==(const etl::ibtree_map<TKey, TMapped, Fanout, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, Fanout, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\ingroup btree_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t Fanout, typename TKeyCompare>
+  bool operator!=(const etl::ibtree_map<TKey, TMapped, Fanout, TKeyCompare>& lhs, const etl::ibtree_map<TKey, TMapped, Fanout, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+} // namespace etl
+
+#endif
@@ -0,0 +1,262 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_SET_INCLUDED
+#define ETL_BTREE_SET_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "initializer_list.h"
+#include "pool.h"
+#include "utility.h"
+
+#include "private/btree_base.h"
+
+//*****************************************************************************
+///\defgroup btree_set btree_set
+/// An ordered set held in a B+ tree, with the capacity defined at compile time.
+/// See etl::btree_map.
+/// Inserting or erasing invalidates all iterators.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for btree_sets of a fanout.
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, const size_t Fanout, typename TKeyCompare = etl::less<TKey> >
+  class ibtree_set : public etl::ibtree<TKey, TKey, etl::private_btree::select_self<TKey>, Fanout, TKeyCompare>
+  {
+  private:
+
+    typedef etl::ibtree<TKey, TKey, etl::private_btree::select_self<TKey>, Fanout, TKeyCompare> base_t;
+
+  public:
+
+    typedef typename base_t::key_compare value_compare;
+
+    //*************************************************************************
+    /// Gets the value comparison function.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return this->key_comp();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ibtree_set(etl::ipool& leaf_pool, etl::ipool& internal_pool, size_t max_size_)
+      : base_t(leaf_pool, internal_pool, max_size_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction.
+    ibtree_set(const ibtree_set&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_BTREE_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+
+  public:
+
+    virtual ~ibtree_set() {}
+#else
+
+  protected:
+
+    ~ibtree_set() {}
+#endif
+  };
+
+  //***************************************************************************
+  /// A btree_set with the capacity defined at compile time.
+  ///\tparam MAX_SIZE_ The maximum number of values.
+  ///\tparam Fanout    The number of values in a leaf and children of an
+  ///                  internal node. By default, as many keys as fit in
+  ///                  ETL_BTREE_CACHE_LINE_SIZE bytes.
+  /// Nodes are only guaranteed to be half full, so the pools are sized for
+  /// twice MAX_SIZE_ values.
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, const size_t MAX_SIZE_, const size_t Fanout = etl::private_btree::default_fanout<TKey>::value, typename TKeyCompare = etl::less<TKey> >
+  class btree_set : public etl::ibtree_set<TKey, Fanout, TKeyCompare>
+  {
+  private:
+
+    typedef etl::ibtree_set<TKey, Fanout, TKeyCompare> base_t;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    btree_set()
+      : base_t(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    btree_set(const btree_set& other)
+      : base_t(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      this->assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    btree_set(btree_set&& other)
+      : base_t(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      move_from(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    /// A sorted range is bulk loaded.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_set(TIterator first, TIterator last)
+      : base_t(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    btree_set(std::initializer_list<typename base_t::value_type> init)
+      : base_t(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_set()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_set& operator=(const btree_set& rhs)
+    {
+      if (this != &rhs)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    btree_set& operator=(btree_set&& rhs)
+    {
+      if (this != &rhs)
+      {
+        this->clear();
+        move_from(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves the values from the other set, which is left empty.
+    //*************************************************************************
+    void move_from(btree_set& other)
+    {
+      for (typename base_t::iterator i_element = other.begin(); i_element != other.end(); ++i_element)
+      {
+        this->insert(etl::move(*i_element));
+      }
+
+      other.clear();
+    }
+#endif
+
+    /// The pools of nodes used by the set.
+    etl::pool<typename base_t::leaf_node, etl::private_btree::leaf_nodes<MAX_SIZE_, Fanout>::value>         leaf_pool;
+    etl::pool<typename base_t::internal_node, etl::private_btree::internal_nodes<MAX_SIZE_, Fanout>::value> internal_pool;
+  };
+
+  template <typename TKey, const size_t MAX_SIZE_, const size_t Fanout, typename TKeyCompare>
+  ETL_CONSTANT size_t btree_set<TKey, MAX_SIZE_, Fanout, TKeyCompare>::MAX_SIZE;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, const size_t Fanout, typename TKeyCompare>
+  bool operator==(const etl::ibtree_set<TKey, Fanout, TKeyCompare>& lhs, const etl::ibtree_set<TKey, Fanout, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, const size_t Fanout, typename TKeyCompare>
+  bool operator!=(const etl::ibtree_set<TKey, Fanout, TKeyCompare>& lhs, const etl::ibtree_set<TKey, Fanout, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+} // namespace etl
+
+#endif
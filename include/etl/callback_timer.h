@@ -39,6 +39,7 @@ SOFTWARE.
 #include "placement_new.h"
 #include "static_assert.h"
 #include "timer.h"
+#include "trace_hooks.h"
 
 #include <stdint.h>
 
@@ -281,6 +282,8 @@ namespace etl
 
               if (timer.p_callback != ETL_NULLPTR)
               {
+                ETL_TRACE_SCOPE(etl::trace_category::Timer, timer.id, 0U);
+
                 if (timer.cbk_type == timer_data::C_CALLBACK)
                 {
                   // Call the C callback.
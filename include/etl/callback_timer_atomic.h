@@ -38,6 +38,7 @@ SOFTWARE.
 #include "placement_new.h"
 #include "static_assert.h"
 #include "timer.h"
+#include "trace_hooks.h"
 
 #include <stdint.h>
 
@@ -178,6 +179,8 @@ namespace etl
 
               if (timer.callback.is_valid())
               {
+                ETL_TRACE_SCOPE(etl::trace_category::Timer, timer.id, 0U);
+
                 // Call the delegate callback.
                 timer.callback();
               }
@@ -37,6 +37,7 @@ SOFTWARE.
 #include "placement_new.h"
 #include "static_assert.h"
 #include "timer.h"
+#include "trace_hooks.h"
 
 #include <stdint.h>
 
@@ -731,6 +732,8 @@ namespace etl
 
               if (timer.callback.is_valid())
               {
+                ETL_TRACE_SCOPE(etl::trace_category::Timer, timer.id, 0U);
+
                 timer.callback();
               }
 
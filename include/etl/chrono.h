@@ -73,6 +73,7 @@ namespace etl
 #include "private/chrono/duration.h"
 #include "private/chrono/time_point.h"
 #include "private/chrono/clocks.h"
+#include "private/chrono/tsc_clock.h"
 #include "private/chrono/day.h"
 #include "private/chrono/weekday.h"
 #include "private/chrono/month.h"
@@ -85,6 +86,7 @@ namespace etl
 #include "private/chrono/hh_mm_ss.h"
 #include "private/chrono/operators.h"
 #include "private/chrono/time_zone.h"
+#include "private/chrono/iso8601.h"
 // clang-format on
 
 namespace etl
@@ -0,0 +1,829 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CONCURRENT_UNORDERED_MAP_INCLUDED
+#define ETL_CONCURRENT_UNORDERED_MAP_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "mutex.h"
+
+#if ETL_HAS_MUTEX && ETL_HAS_ATOMIC
+
+  #include "alignment.h"
+  #include "error_handler.h"
+  #include "exception.h"
+  #include "file_error_numbers.h"
+  #include "functional.h"
+  #include "hash.h"
+  #include "log.h"
+  #include "placement_new.h"
+  #include "power.h"
+  #include "static_assert.h"
+  #include "utility.h"
+
+  #include <stddef.h>
+  #include <stdint.h>
+
+//*****************************************************************************
+///\defgroup concurrent_unordered_map concurrent_unordered_map
+/// A hash map with the capacity defined at compile time that may be shared
+/// between threads.
+/// The buckets are divided between a number of stripes, each with its own
+/// mutex, so threads that use keys in different stripes do not wait for each
+/// other. Values are copied out under the lock, as a reference would not be
+/// safe once the lock is released.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the concurrent unordered maps.
+  ///\ingroup concurrent_unordered_map
+  //***************************************************************************
+  class concurrent_unordered_map_exception : public etl::exception
+  {
+  public:
+
+    concurrent_unordered_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the concurrent unordered maps.
+  ///\ingroup concurrent_unordered_map
+  //***************************************************************************
+  class concurrent_unordered_map_full : public etl::concurrent_unordered_map_exception
+  {
+  public:
+
+    concurrent_unordered_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::concurrent_unordered_map_exception(ETL_ERROR_TEXT("concurrent_unordered_map:full", ETL_CONCURRENT_UNORDERED_MAP_FILE_ID"A"), file_name_,
+                                                line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for all concurrent unordered maps.
+  ///\ingroup concurrent_unordered_map
+  //***************************************************************************
+  class concurrent_unordered_map_base
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// Gets the number of values.
+    /// Only a guide while other threads are changing the map.
+    //*************************************************************************
+    size_type size() const
+    {
+      size_type n = 0U;
+
+      for (size_t i = 0U; i < STRIPES; ++i)
+      {
+        n += p_stripes[i].count.load(etl::memory_order_relaxed);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible number of values.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the map is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return max_size() - size();
+    }
+
+    //*************************************************************************
+    /// Returns the number of stripes, each with its own lock.
+    //*************************************************************************
+    size_t stripe_count() const
+    {
+      return STRIPES;
+    }
+
+  protected:
+
+    static ETL_CONSTANT size_t Cache_Line_Size = 64U;
+
+    //*************************************************************************
+    /// The lock for a stripe and the number of values in it.
+    //*************************************************************************
+    struct stripe_data
+    {
+      etl::mutex          mutex;
+      etl::atomic<size_t> count; ///< Only changed with the mutex locked.
+    };
+
+    //*************************************************************************
+    /// Each stripe is aligned and padded to a cache line, so that threads
+    /// locking different stripes do not contend for the same line.
+    /// Before C++11 the stripes are only padded.
+    //*************************************************************************
+  #if ETL_USING_CPP11
+    struct alignas(Cache_Line_Size) stripe : public stripe_data
+    {
+    };
+  #else
+    struct stripe : public stripe_data
+    {
+      char padding[Cache_Line_Size - (sizeof(stripe_data) % Cache_Line_Size)];
+    };
+  #endif
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    concurrent_unordered_map_base(stripe* p_stripes_, size_t stripe_count_, size_type max_size_)
+      : p_stripes(p_stripes_)
+      , STRIPES(stripe_count_)
+      , CAPACITY(max_size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~concurrent_unordered_map_base() {}
+
+    //*************************************************************************
+    /// Holds every stripe locked for the lifetime of the object.
+    /// The stripes are always locked in the same order, and other operations
+    /// lock only one, so this cannot deadlock.
+    //*************************************************************************
+    class all_locked
+    {
+    public:
+
+      explicit all_locked(const concurrent_unordered_map_base& map_)
+        : map(map_)
+      {
+        for (size_t i = 0U; i < map.STRIPES; ++i)
+        {
+          map.p_stripes[i].mutex.lock();
+        }
+      }
+
+      ~all_locked()
+      {
+        for (size_t i = map.STRIPES; i != 0U; --i)
+        {
+          map.p_stripes[i - 1U].mutex.unlock();
+        }
+      }
+
+    private:
+
+      all_locked(const all_locked&) ETL_DELETE;
+      all_locked& operator=(const all_locked&) ETL_DELETE;
+
+      const concurrent_unordered_map_base& map;
+    };
+
+    stripe* const   p_stripes; ///< The stripes.
+    const size_t    STRIPES;   ///< The number of stripes.
+    const size_type CAPACITY;  ///< The maximum number of values.
+  };
+
+  //***************************************************************************
+  /// A hash map that may be shared between threads.
+  /// Each operation locks only the stripe that holds the key. The values are
+  /// held in a fixed array of nodes, shared by all of the stripes through a
+  /// lock free list, so the map holds up to its capacity whatever the spread
+  /// of the keys.
+  ///\ingroup concurrent_unordered_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class iconcurrent_unordered_map : public etl::concurrent_unordered_map_base
+  {
+  public:
+
+    typedef TKey                                  key_type;
+    typedef TMapped                               mapped_type;
+    typedef ETL_OR_STD::pair<const TKey, TMapped> value_type;
+    typedef THash                                 hasher;
+    typedef TKeyEqual                             key_equal;
+    typedef mapped_type&                          reference;
+    typedef const mapped_type&                    const_reference;
+  #if ETL_USING_CPP11
+    typedef mapped_type&& rvalue_reference;
+  #endif
+    typedef size_t size_type;
+
+  protected:
+
+    typedef uint32_t index_type;
+
+    static ETL_CONSTANT index_type Npos = 0xFFFFFFFFUL;
+
+    //*************************************************************************
+    /// A node for a key and value.
+    /// A free node is linked into the free list through next_free.
+    //*************************************************************************
+    struct node
+    {
+      value_type& value()
+      {
+        return *reinterpret_cast<value_type*>(&storage);
+      }
+
+      const value_type& value() const
+      {
+        return *reinterpret_cast<const value_type*>(&storage);
+      }
+
+      index_type              next;      ///< The next node in the bucket.
+      etl::atomic<index_type> next_free; ///< The next node in the free list.
+
+      typename etl::aligned_storage_as<sizeof(value_type), value_type>::type storage;
+    };
+
+  public:
+
+    //*************************************************************************
+    /// Copies the value for the key.
+    ///\return true if the key was found.
+    //*************************************************************************
+    bool find(const key_type& key, reference value) const
+    {
+      const size_t hash = hash_of(key);
+
+      etl::lock_guard<etl::mutex> lock(stripe_of(hash).mutex);
+
+      const index_type index = find_index(bucket_of(hash), key);
+
+      if (index == Npos)
+      {
+        return false;
+      }
+
+      value = p_nodes[index].value().second;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Checks if the map contains the key.
+    //*************************************************************************
+    bool contains(const key_type& key) const
+    {
+      const size_t hash = hash_of(key);
+
+      etl::lock_guard<etl::mutex> lock(stripe_of(hash).mutex);
+
+      return find_index(bucket_of(hash), key) != Npos;
+    }
+
+    //*************************************************************************
+    /// Sets the value for the key, adding it if it is not in the map.
+    /// If the map is full, asserts an etl::concurrent_unordered_map_full.
+    ///\return true if the key was added.
+    //*************************************************************************
+    bool insert_or_assign(const key_type& key, const_reference value)
+    {
+      const size_t hash = hash_of(key);
+      stripe&      s    = stripe_of(hash);
+
+      etl::lock_guard<etl::mutex> lock(s.mutex);
+
+      index_type&      first = bucket_of(hash);
+      const index_type index = find_index(first, key);
+
+      if (index != Npos)
+      {
+        p_nodes[index].value().second = value;
+
+        return false;
+      }
+
+      const index_type new_index = allocate();
+
+      if (new_index == Npos)
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(concurrent_unordered_map_full));
+        return false;
+      }
+
+  #if ETL_USING_EXCEPTIONS
+      try
+      {
+  #endif
+        ::new (&p_nodes[new_index].storage) value_type(key, value);
+  #if ETL_USING_EXCEPTIONS
+      }
+      catch (...)
+      {
+        release(new_index);
+        throw;
+      }
+  #endif
+
+      link(s, first, new_index);
+
+      return true;
+    }
+
+  #if ETL_USING_CPP11
+    //*************************************************************************
+    /// Sets the value for the key, adding it if it is not in the map.
+    /// If the map is full, asserts an etl::concurrent_unordered_map_full.
+    ///\return true if the key was added.
+    //*************************************************************************
+    bool insert_or_assign(const key_type& key, rvalue_reference value)
+    {
+      const size_t hash = hash_of(key);
+      stripe&      s    = stripe_of(hash);
+
+      etl::lock_guard<etl::mutex> lock(s.mutex);
+
+      index_type&      first = bucket_of(hash);
+      const index_type index = find_index(first, key);
+
+      if (index != Npos)
+      {
+        p_nodes[index].value().second = etl::move(value);
+
+        return false;
+      }
+
+      const index_type new_index = allocate();
+
+      if (new_index == Npos)
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(concurrent_unordered_map_full));
+        return false;
+      }
+
+  #if ETL_USING_EXCEPTIONS
+      try
+      {
+  #endif
+        ::new (&p_nodes[new_index].storage) value_type(key, etl::move(value));
+  #if ETL_USING_EXCEPTIONS
+      }
+      catch (...)
+      {
+        release(new_index);
+        throw;
+      }
+  #endif
+
+      link(s, first, new_index);
+
+      return true;
+    }
+  #endif
+
+    //*************************************************************************
+    /// Calls 'function' with a reference to the value for the key, with the
+    /// stripe locked, so that the value can be read and changed in one step.
+    /// 'function' must not call back into the map.
+    ///\return true if the key was found.
+    //*************************************************************************
+    template <typename TFunction>
+    bool update(const key_type& key, TFunction function)
+    {
+      const size_t hash = hash_of(key);
+
+      etl::lock_guard<etl::mutex> lock(stripe_of(hash).mutex);
+
+      const index_type index = find_index(bucket_of(hash), key);
+
+      if (index == Npos)
+      {
+        return false;
+      }
+
+      function(p_nodes[index].value().second);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Removes the key.
+    ///\return The number of values removed, 0 or 1.
+    //*************************************************************************
+    size_t erase(const key_type& key)
+    {
+      const size_t hash = hash_of(key);
+      stripe&      s    = stripe_of(hash);
+
+      etl::lock_guard<etl::mutex> lock(s.mutex);
+
+      index_type* p_link = &bucket_of(hash);
+
+      while ((*p_link != Npos) && !key_equal_function(p_nodes[*p_link].value().first, key))
+      {
+        p_link = &p_nodes[*p_link].next;
+      }
+
+      if (*p_link == Npos)
+      {
+        return 0U;
+      }
+
+      const index_type index = *p_link;
+
+      *p_link = p_nodes[index].next;
+      p_nodes[index].value().~value_type();
+      release(index);
+      s.count.store(s.count.load(etl::memory_order_relaxed) - 1U, etl::memory_order_relaxed);
+
+      return 1U;
+    }
+
+    //*************************************************************************
+    /// Calls 'function' with each key and value, one stripe at a time.
+    /// Each stripe is locked while it is visited, so the values seen are not
+    /// a snapshot of the whole map if other threads are changing it.
+    /// 'function' must not call back into the map.
+    //*************************************************************************
+    template <typename TFunction>
+    void for_each(TFunction function) const
+    {
+      for (size_t i = 0U; i < STRIPES; ++i)
+      {
+        etl::lock_guard<etl::mutex> lock(p_stripes[i].mutex);
+
+        visit_stripe(i, function);
+      }
+    }
+
+    //*************************************************************************
+    /// Copies every key and value, as a value_type, to 'out'.
+    /// Every stripe is locked for the duration of the copy, so the values are
+    /// the contents of the map at one instant.
+    ///\return The output iterator, after the last value copied.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    TOutputIterator snapshot(TOutputIterator out) const
+    {
+      all_locked lock(*this);
+
+      for (size_t b = 0U; b < (STRIPES * buckets_per_stripe); ++b)
+      {
+        for (index_type index = p_buckets[b]; index != Npos; index = p_nodes[index].next)
+        {
+          *out = p_nodes[index].value();
+          ++out;
+        }
+      }
+
+      return out;
+    }
+
+    //*************************************************************************
+    /// Removes every value.
+    //*************************************************************************
+    void clear()
+    {
+      all_locked lock(*this);
+
+      for (size_t i = 0U; i < (STRIPES * buckets_per_stripe); ++i)
+      {
+        for (index_type index = p_buckets[i]; index != Npos; index = p_nodes[index].next)
+        {
+          p_nodes[index].value().~value_type();
+        }
+      }
+
+      // Every change to the nodes is made with a stripe locked, so the map
+      // can be reset while all of them are held.
+      initialise();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iconcurrent_unordered_map(node* p_nodes_, index_type* p_buckets_, stripe* p_stripes_, size_t stripe_count_, size_t stripe_shift_,
+                              size_t buckets_per_stripe_, size_t max_size_)
+      : concurrent_unordered_map_base(p_stripes_, stripe_count_, max_size_)
+      , p_nodes(p_nodes_)
+      , p_buckets(p_buckets_)
+      , stripe_mask(stripe_count_ - 1U)
+      , stripe_shift(stripe_shift_)
+      , buckets_per_stripe(buckets_per_stripe_)
+      , free_head(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Links every node into the free list and empties the buckets.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_t i = 0U; i < CAPACITY; ++i)
+      {
+        p_nodes[i].next_free.store(((i + 1U) == CAPACITY) ? Npos : static_cast<index_type>(i + 1U), etl::memory_order_relaxed);
+      }
+
+      for (size_t i = 0U; i < (STRIPES * buckets_per_stripe); ++i)
+      {
+        p_buckets[i] = Npos;
+      }
+
+      for (size_t i = 0U; i < STRIPES; ++i)
+      {
+        p_stripes[i].count.store(0U, etl::memory_order_relaxed);
+      }
+
+      // Keep the tag, so that a stale head cannot match after a clear.
+      const uint64_t head = free_head.load(etl::memory_order_relaxed);
+
+      free_head.store(next_tag(head), etl::memory_order_release);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Gets the hash of the key.
+    //*************************************************************************
+    size_t hash_of(const key_type& key) const
+    {
+      return static_cast<size_t>(hash_function(key));
+    }
+
+    //*************************************************************************
+    /// Gets the stripe for the hash. The low bits select the stripe.
+    //*************************************************************************
+    stripe& stripe_of(size_t hash) const
+    {
+      return p_stripes[hash & stripe_mask];
+    }
+
+    //*************************************************************************
+    /// Gets the first node in the bucket for the hash.
+    /// The buckets of each stripe are together, so that stripes do not share
+    /// cache lines of buckets.
+    //*************************************************************************
+    index_type& bucket_of(size_t hash) const
+    {
+      return p_buckets[((hash & stripe_mask) * buckets_per_stripe) + ((hash >> stripe_shift) & (buckets_per_stripe - 1U))];
+    }
+
+    //*************************************************************************
+    /// Finds the node holding the key in the bucket, or Npos.
+    //*************************************************************************
+    index_type find_index(index_type index, const key_type& key) const
+    {
+      while ((index != Npos) && !key_equal_function(p_nodes[index].value().first, key))
+      {
+        index = p_nodes[index].next;
+      }
+
+      return index;
+    }
+
+    //*************************************************************************
+    /// Links a new node at the front of the bucket.
+    //*************************************************************************
+    void link(stripe& s, index_type& first, index_type index)
+    {
+      p_nodes[index].next = first;
+      first               = index;
+      s.count.store(s.count.load(etl::memory_order_relaxed) + 1U, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Calls 'function' with each value in the stripe.
+    //*************************************************************************
+    template <typename TFunction>
+    void visit_stripe(size_t i, TFunction& function) const
+    {
+      const size_t first = i * buckets_per_stripe;
+      const size_t last  = first + buckets_per_stripe;
+
+      for (size_t b = first; b != last; ++b)
+      {
+        for (index_type index = p_buckets[b]; index != Npos; index = p_nodes[index].next)
+        {
+          const value_type& value = p_nodes[index].value();
+          function(value);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// The free list head is the index of the first free node in the low 32
+    /// bits and a tag in the high 32 bits. The tag changes on every update,
+    /// so a thread holding a stale head cannot succeed in swapping it.
+    //*************************************************************************
+    static index_type index_of(uint64_t head)
+    {
+      return static_cast<index_type>(head & 0xFFFFFFFFUL);
+    }
+
+    static uint64_t next_tag(uint64_t head)
+    {
+      return ((head >> 32U) + 1U) << 32U;
+    }
+
+    //*************************************************************************
+    /// Takes a node from the free list.
+    ///\return The index of the node, or Npos if there are none.
+    //*************************************************************************
+    index_type allocate()
+    {
+      uint64_t head = free_head.load(etl::memory_order_acquire);
+
+      while (true)
+      {
+        const index_type index = index_of(head);
+
+        if (index == Npos)
+        {
+          return Npos;
+        }
+
+        const index_type next = p_nodes[index].next_free.load(etl::memory_order_relaxed);
+
+        if (free_head.compare_exchange_weak(head, next_tag(head) | next, etl::memory_order_acquire, etl::memory_order_acquire))
+        {
+          return index;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Returns a node to the free list.
+    //*************************************************************************
+    void release(index_type index)
+    {
+      uint64_t head = free_head.load(etl::memory_order_relaxed);
+
+      do
+      {
+        p_nodes[index].next_free.store(index_of(head), etl::memory_order_relaxed);
+      } while (!free_head.compare_exchange_weak(head, next_tag(head) | index, etl::memory_order_release, etl::memory_order_relaxed));
+    }
+
+    // Disable copy construction and assignment.
+    iconcurrent_unordered_map(const iconcurrent_unordered_map&) ETL_DELETE;
+    iconcurrent_unordered_map& operator=(const iconcurrent_unordered_map&) ETL_DELETE;
+
+    node* const           p_nodes;            ///< The nodes.
+    index_type* const     p_buckets;          ///< The first node in each bucket, grouped by stripe.
+    const size_t          stripe_mask;        ///< The number of stripes - 1.
+    const size_t          stripe_shift;       ///< log2 of the number of stripes.
+    const size_t          buckets_per_stripe; ///< A power of 2.
+    etl::atomic<uint64_t> free_head;          ///< The tagged index of the first free node.
+    hasher                hash_function;      ///< The key hash function.
+    key_equal             key_equal_function; ///< The key equality function.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+  #if defined(ETL_POLYMORPHIC_CONCURRENT_UNORDERED_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+
+  public:
+
+    virtual ~iconcurrent_unordered_map() {}
+  #else
+
+  protected:
+
+    ~iconcurrent_unordered_map() {}
+  #endif
+  };
+
+  template <typename TKey, typename TMapped, typename THash, typename TKeyEqual>
+  ETL_CONSTANT typename iconcurrent_unordered_map<TKey, TMapped, THash, TKeyEqual>::index_type
+    iconcurrent_unordered_map<TKey, TMapped, THash, TKeyEqual>::Npos;
+
+  //***************************************************************************
+  /// A concurrent hash map with the capacity defined at compile time.
+  ///\ingroup concurrent_unordered_map
+  ///\tparam TKey      The type of the keys.
+  ///\tparam TMapped   The type of the values.
+  ///\tparam MAX_SIZE_ The maximum number of values.
+  ///\tparam STRIPES_  The number of locks. A power of 2.
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, const size_t STRIPES_ = 16U, typename THash = etl::hash<TKey>,
+            typename TKeyEqual = etl::equal_to<TKey> >
+  class concurrent_unordered_map : public etl::iconcurrent_unordered_map<TKey, TMapped, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iconcurrent_unordered_map<TKey, TMapped, THash, TKeyEqual> base_t;
+
+    static ETL_CONSTANT size_t Min_Bucket_Count = etl::power_of_2_round_up<MAX_SIZE_>::value;
+
+  public:
+
+    ETL_STATIC_ASSERT((MAX_SIZE_ > 0U), "Zero capacity maps are not valid");
+    ETL_STATIC_ASSERT((MAX_SIZE_ < 0xFFFFFFFFUL), "The capacity must fit in 32 bits");
+    ETL_STATIC_ASSERT(((STRIPES_ > 0U) && ((STRIPES_ & (STRIPES_ - 1U)) == 0U)), "The number of stripes must be a power of 2");
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+    static ETL_CONSTANT size_t STRIPES  = STRIPES_;
+
+    /// The number of hash buckets, at least one per value and one per stripe.
+    static ETL_CONSTANT size_t Bucket_Count = (Min_Bucket_Count > STRIPES_) ? Min_Bucket_Count : STRIPES_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    concurrent_unordered_map()
+      : base_t(nodes, buckets, stripes, STRIPES_, etl::log2<STRIPES_>::value, Bucket_Count / STRIPES_, MAX_SIZE_)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~concurrent_unordered_map()
+    {
+      this->clear();
+    }
+
+  private:
+
+    typename base_t::node       nodes[MAX_SIZE_];      ///< The nodes.
+    typename base_t::index_type buckets[Bucket_Count]; ///< The hash index, grouped by stripe.
+    typename base_t::stripe     stripes[STRIPES_];     ///< The locks.
+  };
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, const size_t STRIPES_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t concurrent_unordered_map<TKey, TMapped, MAX_SIZE_, STRIPES_, THash, TKeyEqual>::Min_Bucket_Count;
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, const size_t STRIPES_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t concurrent_unordered_map<TKey, TMapped, MAX_SIZE_, STRIPES_, THash, TKeyEqual>::MAX_SIZE;
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, const size_t STRIPES_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t concurrent_unordered_map<TKey, TMapped, MAX_SIZE_, STRIPES_, THash, TKeyEqual>::STRIPES;
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, const size_t STRIPES_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t concurrent_unordered_map<TKey, TMapped, MAX_SIZE_, STRIPES_, THash, TKeyEqual>::Bucket_Count;
+} // namespace etl
+
+#endif
+#endif
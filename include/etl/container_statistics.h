@@ -0,0 +1,474 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CONTAINER_STATISTICS_INCLUDED
+#define ETL_CONTAINER_STATISTICS_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "nullptr.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup container_statistics container statistics
+/// Occupancy profile for fixed capacity containers.
+/// Define ETL_CONTAINER_STATISTICS to enable. When not defined, the hooks
+/// expand to nothing and the containers are unchanged.
+///\ingroup utilities
+
+#if defined(ETL_CONTAINER_STATISTICS)
+
+  #define ETL_DECLARE_CONTAINER_STATISTICS                  etl::container_statistics etl_container_statistics
+  #define ETL_CONTAINER_STATISTICS_INITIALISE(type_name, n) this->etl_container_statistics.initialise((type_name), (n))
+  #define ETL_CONTAINER_STATISTICS_SIZE(n)                  this->etl_container_statistics.record_size(n)
+  #define ETL_CONTAINER_STATISTICS_REJECT                   this->etl_container_statistics.record_rejection()
+  #define ETL_CONTAINER_STATISTICS_REJECT_IF(b)             this->etl_container_statistics.record_rejection_if(b)
+  #define ETL_CONTAINER_STATISTICS_PROBE_BEGIN              size_t etl_container_statistics_probe_length = 0U
+  #define ETL_CONTAINER_STATISTICS_PROBE_STEP               ++etl_container_statistics_probe_length
+  #define ETL_CONTAINER_STATISTICS_PROBE_END                this->etl_container_statistics.record_probe(etl_container_statistics_probe_length)
+
+namespace etl
+{
+  //***************************************************************************
+  /// Occupancy statistics for one container instance.
+  /// Records the high water mark, the number of insertions rejected because
+  /// the container was full and, for hashed containers, the distribution of
+  /// bucket probe lengths.
+  /// Each instance links itself into etl::container_statistics_registry for
+  /// its lifetime. The registry is guarded by a spin lock if ETL_HAS_ATOMIC,
+  /// so containers may be created and destroyed on different threads.
+  /// The counters belong to the container and are written by its modifiers
+  /// only, so they are as thread safe as the container itself.
+  ///\ingroup container_statistics
+  //***************************************************************************
+  class container_statistics
+  {
+  public:
+
+    /// Probe lengths 0 to Probe_Histogram_Size - 2 have their own bin.
+    /// The last bin counts everything longer.
+    static ETL_CONSTANT size_t Probe_Histogram_Size = 8U;
+
+    //*************************************************************************
+    /// Constructor. Registers the instance.
+    //*************************************************************************
+    container_statistics()
+    {
+      clear_identity();
+      reset();
+      link();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    /// The copy is a new instance; it is registered with fresh counters.
+    //*************************************************************************
+    container_statistics(const container_statistics&)
+    {
+      clear_identity();
+      reset();
+      link();
+    }
+
+    //*************************************************************************
+    /// Assignment does not transfer statistics between instances.
+    //*************************************************************************
+    container_statistics& operator=(const container_statistics&)
+    {
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Destructor. Unregisters the instance.
+    //*************************************************************************
+    ~container_statistics()
+    {
+      unlink();
+    }
+
+    //*************************************************************************
+    /// Sets a user supplied name for reports.
+    //*************************************************************************
+    void set_name(const char* name_)
+    {
+      user_name = name_;
+    }
+
+    //*************************************************************************
+    /// The user supplied name, or null.
+    //*************************************************************************
+    const char* name() const
+    {
+      return user_name;
+    }
+
+    //*************************************************************************
+    /// The kind of container, such as "vector".
+    //*************************************************************************
+    const char* type_name() const
+    {
+      return container_type_name;
+    }
+
+    //*************************************************************************
+    /// The capacity of the container.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return container_capacity;
+    }
+
+    //*************************************************************************
+    /// The largest recorded size.
+    //*************************************************************************
+    size_t high_water_mark() const
+    {
+      return high_water;
+    }
+
+    //*************************************************************************
+    /// The number of insertions attempted while the container was full.
+    //*************************************************************************
+    size_t rejections() const
+    {
+      return rejected;
+    }
+
+    //*************************************************************************
+    /// The number of recorded probes.
+    //*************************************************************************
+    size_t probe_count() const
+    {
+      return probes;
+    }
+
+    //*************************************************************************
+    /// The sum of all recorded probe lengths.
+    //*************************************************************************
+    size_t probe_length_total() const
+    {
+      return probe_total;
+    }
+
+    //*************************************************************************
+    /// The longest recorded probe.
+    //*************************************************************************
+    size_t probe_length_max() const
+    {
+      return probe_max;
+    }
+
+    //*************************************************************************
+    /// The number of probes in histogram bin 'i'.
+    //*************************************************************************
+    size_t probe_histogram(size_t i) const
+    {
+      return (i < Probe_Histogram_Size) ? histogram[i] : 0U;
+    }
+
+    //*************************************************************************
+    /// Restarts the counters.
+    //*************************************************************************
+    void reset()
+    {
+      high_water  = 0U;
+      rejected    = 0U;
+      probes      = 0U;
+      probe_total = 0U;
+      probe_max   = 0U;
+
+      for (size_t i = 0U; i < Probe_Histogram_Size; ++i)
+      {
+        histogram[i] = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// The next registered instance, or null.
+    //*************************************************************************
+    container_statistics* next()
+    {
+      return p_next;
+    }
+
+    //*************************************************************************
+    /// The next registered instance, or null.
+    //*************************************************************************
+    const container_statistics* next() const
+    {
+      return p_next;
+    }
+
+    //*************************************************************************
+    // Hooks called by the containers.
+    //*************************************************************************
+    void initialise(const char* type_name_, size_t capacity_)
+    {
+      container_type_name = type_name_;
+      container_capacity  = capacity_;
+    }
+
+    void record_size(size_t n)
+    {
+      if (n > high_water)
+      {
+        high_water = n;
+      }
+    }
+
+    void record_rejection()
+    {
+      ++rejected;
+    }
+
+    void record_rejection_if(bool is_full)
+    {
+      if (is_full)
+      {
+        ++rejected;
+      }
+    }
+
+    void record_probe(size_t length)
+    {
+      ++probes;
+      probe_total += length;
+
+      if (length > probe_max)
+      {
+        probe_max = length;
+      }
+
+      ++histogram[(length < (Probe_Histogram_Size - 1U)) ? length : (Probe_Histogram_Size - 1U)];
+    }
+
+  private:
+
+    friend class container_statistics_registry;
+
+    //*************************************************************************
+    void clear_identity()
+    {
+      user_name           = ETL_NULLPTR;
+      container_type_name = "";
+      container_capacity  = 0U;
+    }
+
+    //*************************************************************************
+    /// The head of the registry list.
+    //*************************************************************************
+    static container_statistics*& head()
+    {
+      static container_statistics* p_head = ETL_NULLPTR;
+
+      return p_head;
+    }
+
+    //*************************************************************************
+    /// Serialises changes to, and walks of, the registry list.
+    /// A spin lock, as the list operations are a few pointer updates.
+    //*************************************************************************
+    class registry_lock
+    {
+    public:
+
+      registry_lock()
+      {
+#if ETL_HAS_ATOMIC
+        while (locked().exchange(true, etl::memory_order_acquire))
+        {
+        }
+#endif
+      }
+
+      ~registry_lock()
+      {
+#if ETL_HAS_ATOMIC
+        locked().store(false, etl::memory_order_release);
+#endif
+      }
+
+    private:
+
+#if ETL_HAS_ATOMIC
+      static etl::atomic<bool>& locked()
+      {
+        static etl::atomic<bool> flag(false);
+
+        return flag;
+      }
+#endif
+
+      registry_lock(const registry_lock&);
+      registry_lock& operator=(const registry_lock&);
+    };
+
+    //*************************************************************************
+    void link()
+    {
+      registry_lock lock;
+
+      container_statistics*& p_head = head();
+
+      p_previous = ETL_NULLPTR;
+      p_next     = p_head;
+
+      if (p_head != ETL_NULLPTR)
+      {
+        p_head->p_previous = this;
+      }
+
+      // The destructor unlinks the instance, so the registry never holds the
+      // address of a destroyed container.
+#include "private/diagnostic_dangling_pointer_push.h"
+      p_head = this;
+#include "private/diagnostic_pop.h"
+    }
+
+    //*************************************************************************
+    void unlink()
+    {
+      registry_lock lock;
+
+      if (p_previous != ETL_NULLPTR)
+      {
+        p_previous->p_next = p_next;
+      }
+      else
+      {
+        head() = p_next;
+      }
+
+      if (p_next != ETL_NULLPTR)
+      {
+        p_next->p_previous = p_previous;
+      }
+    }
+
+    const char*           user_name;
+    const char*           container_type_name;
+    size_t                container_capacity;
+    size_t                high_water;
+    size_t                rejected;
+    size_t                probes;
+    size_t                probe_total;
+    size_t                probe_max;
+    size_t                histogram[Probe_Histogram_Size];
+    container_statistics* p_previous;
+    container_statistics* p_next;
+  };
+
+  //***************************************************************************
+  /// The list of live container_statistics instances.
+  ///\ingroup container_statistics
+  //***************************************************************************
+  class container_statistics_registry
+  {
+  public:
+
+    //*************************************************************************
+    /// The most recently registered instance, or null.
+    /// Iterate the rest with container_statistics::next(). The list is not
+    /// locked, so only walk it this way while no instrumented container is
+    /// being created or destroyed. for_each locks it.
+    //*************************************************************************
+    static container_statistics* first()
+    {
+      return container_statistics::head();
+    }
+
+    //*************************************************************************
+    /// The number of registered instances.
+    //*************************************************************************
+    static size_t size()
+    {
+      container_statistics::registry_lock lock;
+
+      size_t count = 0U;
+
+      for (const container_statistics* p = first(); p != ETL_NULLPTR; p = p->next())
+      {
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Calls 'function' with each registered instance, for example to dump a report.
+    /// The registry is locked for the walk, so 'function' must not create or
+    /// destroy instrumented containers.
+    //*************************************************************************
+    template <typename TFunction>
+    static TFunction for_each(TFunction function)
+    {
+      container_statistics::registry_lock lock;
+
+      for (container_statistics* p = first(); p != ETL_NULLPTR; p = p->next())
+      {
+        function(*p);
+      }
+
+      return function;
+    }
+
+    //*************************************************************************
+    /// Resets the counters of every registered instance.
+    /// The counters are not synchronised, so the containers must be idle.
+    //*************************************************************************
+    static void reset_all()
+    {
+      container_statistics::registry_lock lock;
+
+      for (container_statistics* p = first(); p != ETL_NULLPTR; p = p->next())
+      {
+        p->reset();
+      }
+    }
+  };
+} // namespace etl
+
+#else
+  #define ETL_DECLARE_CONTAINER_STATISTICS      \
+    enum                                        \
+    {                                           \
+      etl_container_statistics_suppressed__ = 0 \
+    }
+  #define ETL_CONTAINER_STATISTICS_INITIALISE(type_name, n) ((void)0)
+  #define ETL_CONTAINER_STATISTICS_SIZE(n)                  ((void)0)
+  #define ETL_CONTAINER_STATISTICS_REJECT                   ((void)0)
+  #define ETL_CONTAINER_STATISTICS_REJECT_IF(b)             ((void)0)
+  #define ETL_CONTAINER_STATISTICS_PROBE_BEGIN              ((void)0)
+  #define ETL_CONTAINER_STATISTICS_PROBE_STEP               ((void)0)
+  #define ETL_CONTAINER_STATISTICS_PROBE_END                ((void)0)
+#endif // ETL_CONTAINER_STATISTICS
+
+#endif
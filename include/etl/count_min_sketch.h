@@ -0,0 +1,224 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_COUNT_MIN_SKETCH_INCLUDED
+#define ETL_COUNT_MIN_SKETCH_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "private/sketch_common.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup count_min_sketch count_min_sketch
+/// Estimates how often each value occurs in a stream, in fixed memory.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// A Count-Min sketch.
+  /// Holds Depth rows of Width counters. Each value increments one counter
+  /// in each row, and its estimate is the smallest of them. An estimate is
+  /// never less than the true count, and with probability 1 - e^-Depth
+  /// exceeds it by no more than e / Width of the total count.
+  /// Updates are conservative: only the counters that hold the current
+  /// minimum are raised, which reduces the over estimate considerably.
+  /// Sketches of the same type may be merged, so each thread can count its
+  /// own part of a stream. A merged estimate is still never less than the
+  /// true count.
+  /// Counters stop at the largest value of TCount rather than wrapping.
+  ///\tparam Width  The number of counters in each row.
+  ///\tparam Depth  The number of rows.
+  ///\tparam TCount The counter type.
+  ///\ingroup count_min_sketch
+  //***************************************************************************
+  template <size_t Width, size_t Depth, typename TCount = uint32_t>
+  class count_min_sketch
+  {
+  public:
+
+    ETL_STATIC_ASSERT((Width > 0U), "Width must be greater than zero");
+    ETL_STATIC_ASSERT(((Depth > 0U) && (Depth <= 32U)), "Depth must be from 1 to 32");
+    ETL_STATIC_ASSERT((etl::is_integral<TCount>::value && etl::is_unsigned<TCount>::value), "The count must be an unsigned integral type");
+
+    typedef TCount count_type;
+
+    static ETL_CONSTANT size_t WIDTH = Width;
+    static ETL_CONSTANT size_t DEPTH = Depth;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    count_min_sketch()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Forgets every value.
+    //*************************************************************************
+    void clear()
+    {
+      etl::fill_n(counters, Width * Depth, count_type(0U));
+      total_count = 0U;
+    }
+
+    //*************************************************************************
+    /// Adds 'count' occurrences of a value, hashed with etl::hash.
+    ///\return The new estimate for the value.
+    //*************************************************************************
+    template <typename T>
+    count_type add(const T& value, count_type count = 1U)
+    {
+      return add_hash(etl::private_sketch::hash_of(value), count);
+    }
+
+    //*************************************************************************
+    /// Adds 'count' occurrences of a value by its 64 bit hash.
+    ///\return The new estimate for the value.
+    //*************************************************************************
+    count_type add_hash(uint64_t hash, count_type count = 1U)
+    {
+      size_t indexes[Depth];
+
+      count_type minimum = etl::integral_limits<count_type>::max;
+
+      for (size_t row = 0U; row < Depth; ++row)
+      {
+        indexes[row] = index_of(hash, row);
+        minimum      = etl::min(minimum, counters[indexes[row]]);
+      }
+
+      const count_type target = etl::private_sketch::saturating_add(minimum, count);
+
+      // Conservative update: no counter needs to be more than the new estimate.
+      for (size_t row = 0U; row < Depth; ++row)
+      {
+        counters[indexes[row]] = etl::max(counters[indexes[row]], target);
+      }
+
+      total_count += count;
+
+      return target;
+    }
+
+    //*************************************************************************
+    /// Estimates the number of occurrences of a value, hashed with etl::hash.
+    //*************************************************************************
+    template <typename T>
+    count_type estimate(const T& value) const
+    {
+      return estimate_hash(etl::private_sketch::hash_of(value));
+    }
+
+    //*************************************************************************
+    /// Estimates the number of occurrences of a value by its 64 bit hash.
+    //*************************************************************************
+    count_type estimate_hash(uint64_t hash) const
+    {
+      count_type minimum = etl::integral_limits<count_type>::max;
+
+      for (size_t row = 0U; row < Depth; ++row)
+      {
+        minimum = etl::min(minimum, counters[index_of(hash, row)]);
+      }
+
+      return minimum;
+    }
+
+    //*************************************************************************
+    /// Adds the counts of another sketch.
+    //*************************************************************************
+    void merge(const count_min_sketch& other)
+    {
+      for (size_t i = 0U; i < (Width * Depth); ++i)
+      {
+        counters[i] = etl::private_sketch::saturating_add(counters[i], other.counters[i]);
+      }
+
+      total_count += other.total_count;
+    }
+
+    //*************************************************************************
+    /// The total of all of the counts added.
+    //*************************************************************************
+    uint64_t total() const
+    {
+      return total_count;
+    }
+
+    //*************************************************************************
+    /// The number of counters in each row.
+    //*************************************************************************
+    size_t width() const
+    {
+      return Width;
+    }
+
+    //*************************************************************************
+    /// The number of rows.
+    //*************************************************************************
+    size_t depth() const
+    {
+      return Depth;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Gets the counter for the hash in the row.
+    /// The rows use the hashes h1 + row * h2, formed from the two halves of
+    /// the hash, which are as good as independent hashes for this purpose.
+    //*************************************************************************
+    static size_t index_of(uint64_t hash, size_t row)
+    {
+      const uint64_t h1 = hash & 0xFFFFFFFFUL;
+      const uint64_t h2 = (hash >> 32U) | 1U;
+
+      return (row * Width) + static_cast<size_t>((h1 + (row * h2)) % Width);
+    }
+
+    count_type counters[Width * Depth]; ///< The rows, one after the other.
+    uint64_t   total_count;             ///< The total of all of the counts added.
+  };
+
+  template <size_t Width, size_t Depth, typename TCount>
+  ETL_CONSTANT size_t count_min_sketch<Width, Depth, TCount>::WIDTH;
+
+  template <size_t Width, size_t Depth, typename TCount>
+  ETL_CONSTANT size_t count_min_sketch<Width, Depth, TCount>::DEPTH;
+} // namespace etl
+
+#endif
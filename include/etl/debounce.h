@@ -32,6 +32,8 @@ SOFTWARE.
 #define ETL_DEBOUNCE_INCLUDED
 
 #include "platform.h"
+#include "log.h"
+#include "smallest.h"
 #include "static_assert.h"
 
 #include <stdint.h>
@@ -569,6 +571,154 @@ namespace etl
     count_t hold_count;
     count_t repeat_count;
   };
+
+  //***************************************************************************
+  /// Debounces a bank of up to 64 signals packed into one word, one bit per
+  /// channel, with the same per channel behaviour as etl::debounce<Valid_Count>.
+  /// Each channel's count of consecutive equal samples is held as a bit sliced
+  /// vertical counter, so a tick updates every channel with a few word operations.
+  ///\tparam Width       The number of channels.
+  ///\tparam Valid_Count The number of consecutive equal samples needed to change state.
+  //***************************************************************************
+  template <size_t Width, uint16_t Valid_Count>
+  class debounce_bank
+  {
+  public:
+
+    ETL_STATIC_ASSERT((Width > 0U) && (Width <= 64U), "Width must be 1 to 64");
+    ETL_STATIC_ASSERT(Valid_Count > 0U, "Valid_Count must be greater than 0");
+
+    /// The word holding one bit per channel.
+    typedef typename etl::smallest_uint_for_bits<Width>::type value_type;
+
+    static ETL_CONSTANT size_t WIDTH        = Width;
+    static ETL_CONSTANT size_t Counter_Bits = etl::log2<Valid_Count>::value + 1U;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param initial_state The initial state of each channel.
+    //*************************************************************************
+    debounce_bank(value_type initial_state = 0U)
+    {
+      clear(initial_state);
+    }
+
+    //*************************************************************************
+    /// Resets every channel.
+    ///\param initial_state The initial state of each channel.
+    //*************************************************************************
+    void clear(value_type initial_state = 0U)
+    {
+      state       = initial_state;
+      last_sample = 0U;
+      change      = 0U;
+
+      for (size_t i = 0U; i < Counter_Bits; ++i)
+      {
+        count[i] = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a new sample for every channel.
+    ///\param samples The new samples, one bit per channel.
+    ///\return The mask of channels that changed state.
+    //*************************************************************************
+    value_type add(value_type samples)
+    {
+      const value_type restart = static_cast<value_type>(samples ^ last_sample);
+      last_sample              = samples;
+
+      // Count up the channels that are stable and not yet at Valid_Count.
+      value_type carry = static_cast<value_type>(~(restart | at_valid_count()));
+
+      for (size_t i = 0U; i < Counter_Bits; ++i)
+      {
+        const value_type next_carry = static_cast<value_type>(count[i] & carry);
+        count[i]                    = static_cast<value_type>(count[i] ^ carry);
+        carry                       = next_carry;
+      }
+
+      // Channels whose sample changed restart at a count of 1.
+      count[0] = static_cast<value_type>(count[0] | restart);
+
+      for (size_t i = 1U; i < Counter_Bits; ++i)
+      {
+        count[i] = static_cast<value_type>(count[i] & ~restart);
+      }
+
+      // Channels at Valid_Count follow their sample.
+      const value_type valid = at_valid_count();
+      const value_type next  = static_cast<value_type>((state & ~valid) | (samples & valid));
+
+      change = static_cast<value_type>(next ^ state);
+      state  = next;
+
+      return change;
+    }
+
+    //*************************************************************************
+    /// Gets the state of every channel.
+    //*************************************************************************
+    value_type get_state() const
+    {
+      return state;
+    }
+
+    //*************************************************************************
+    /// Gets the mask of channels that changed state on the last add().
+    //*************************************************************************
+    value_type get_change() const
+    {
+      return change;
+    }
+
+    //*************************************************************************
+    /// Gets the state of a channel.
+    ///\return 'true' if the channel is in the true state.
+    //*************************************************************************
+    bool is_set(size_t channel) const
+    {
+      return ((state >> channel) & 1U) != 0U;
+    }
+
+    //*************************************************************************
+    /// Gets the change state of a channel.
+    ///\return 'true' if the channel changed state on the last add().
+    //*************************************************************************
+    bool has_changed(size_t channel) const
+    {
+      return ((change >> channel) & 1U) != 0U;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The mask of channels whose count equals Valid_Count.
+    //*************************************************************************
+    value_type at_valid_count() const
+    {
+      value_type result = static_cast<value_type>(~value_type(0U));
+
+      for (size_t i = 0U; i < Counter_Bits; ++i)
+      {
+        result = static_cast<value_type>(result & ((((Valid_Count >> i) & 1U) != 0U) ? count[i] : static_cast<value_type>(~count[i])));
+      }
+
+      return result;
+    }
+
+    value_type count[Counter_Bits]; ///< Bit i of each channel's count, saturating at Valid_Count.
+    value_type last_sample;
+    value_type state;
+    value_type change;
+  };
+
+  template <size_t Width, uint16_t Valid_Count>
+  ETL_CONSTANT size_t debounce_bank<Width, Valid_Count>::WIDTH;
+
+  template <size_t Width, uint16_t Valid_Count>
+  ETL_CONSTANT size_t debounce_bank<Width, Valid_Count>::Counter_Bits;
 } // namespace etl
 
 #endif
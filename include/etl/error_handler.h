@@ -289,6 +289,48 @@ namespace etl
 } // namespace etl
 #endif
 
+#if !defined(ETL_NO_CHECKS)
+namespace etl
+{
+  namespace private_error_handler
+  {
+  #if defined(ETL_USE_ASSERT_FUNCTION)
+    //*************************************************************************
+    /// Sends the error to the assert function.
+    /// Kept out of line and cold so that a check costs the caller no more
+    /// than a compare and a call.
+    //*************************************************************************
+    inline ETL_COLD ETL_NOINLINE void raise_error(const etl::exception& e)
+    {
+      etl::private_error_handler::assert_handler<0>::assert_function_ptr(e);
+    }
+  #elif ETL_USING_EXCEPTIONS && ETL_USING_CPP11
+    //*************************************************************************
+    /// Logs the error, if enabled, and throws it.
+    /// One out of line, cold instantiation per exception type. The file name
+    /// and line travel in the exception object.
+    //*************************************************************************
+    template <typename TException>
+    ETL_NORETURN ETL_COLD ETL_NOINLINE void raise_error(const TException& e)
+    {
+    #if defined(ETL_LOG_ERRORS)
+      etl::error_handler::error(e);
+    #endif
+      throw e;
+    }
+  #elif defined(ETL_LOG_ERRORS) && !ETL_USING_EXCEPTIONS
+    //*************************************************************************
+    /// Sends the error to the error handler.
+    //*************************************************************************
+    inline ETL_COLD ETL_NOINLINE void raise_error(const etl::exception& e)
+    {
+      etl::error_handler::error(e);
+    }
+  #endif
+  } // namespace private_error_handler
+} // namespace etl
+#endif
+
 //***************************************************************************
 /// Asserts a condition.
 /// Versions of the macro that return a constant value of 'true' will allow the
@@ -311,170 +353,132 @@ namespace etl
   #define ETL_ASSERT_FAIL_AND_RETURN(e)          ETL_DO_NOTHING // Does nothing.
   #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v) ETL_DO_NOTHING // Does nothing.
 #elif defined(ETL_USE_ASSERT_FUNCTION)
-  #define ETL_ASSERT(b, e)                                                       \
-    do {                                                                         \
-      if (!(b)) ETL_UNLIKELY                                                     \
-      {                                                                          \
-        etl::private_error_handler::assert_handler<0>::assert_function_ptr((e)); \
-      }                                                                          \
+  #define ETL_ASSERT(b, e)                            \
+    do {                                              \
+      if (!(b)) ETL_UNLIKELY                          \
+      {                                               \
+        etl::private_error_handler::raise_error((e)); \
+      }                                               \
     } while (false) // If the condition fails, calls the assert function
-  #define ETL_ASSERT_OR_RETURN(b, e)                                             \
-    do {                                                                         \
-      if (!(b)) ETL_UNLIKELY                                                     \
-      {                                                                          \
-        etl::private_error_handler::assert_handler<0>::assert_function_ptr((e)); \
-        return;                                                                  \
-      }                                                                          \
+  #define ETL_ASSERT_OR_RETURN(b, e)                  \
+    do {                                              \
+      if (!(b)) ETL_UNLIKELY                          \
+      {                                               \
+        etl::private_error_handler::raise_error((e)); \
+        return;                                       \
+      }                                               \
     } while (false) // If the condition fails, calls the assert function and return
-  #define ETL_ASSERT_OR_RETURN_VALUE(b, e, v)                                    \
-    do {                                                                         \
-      if (!(b)) ETL_UNLIKELY                                                     \
-      {                                                                          \
-        etl::private_error_handler::assert_handler<0>::assert_function_ptr((e)); \
-        return (v);                                                              \
-      }                                                                          \
+  #define ETL_ASSERT_OR_RETURN_VALUE(b, e, v)         \
+    do {                                              \
+      if (!(b)) ETL_UNLIKELY                          \
+      {                                               \
+        etl::private_error_handler::raise_error((e)); \
+        return (v);                                   \
+      }                                               \
     } while (false) // If the condition fails, calls the assert function and
                     // return a value
 
-  #define ETL_ASSERT_FAIL(e)                                                   \
-    do {                                                                       \
-      etl::private_error_handler::assert_handler<0>::assert_function_ptr((e)); \
+  #define ETL_ASSERT_FAIL(e)                        \
+    do {                                            \
+      etl::private_error_handler::raise_error((e)); \
     } while (false) // Calls the assert function
-  #define ETL_ASSERT_FAIL_AND_RETURN(e)                                        \
-    do {                                                                       \
-      etl::private_error_handler::assert_handler<0>::assert_function_ptr((e)); \
-      return;                                                                  \
+  #define ETL_ASSERT_FAIL_AND_RETURN(e)             \
+    do {                                            \
+      etl::private_error_handler::raise_error((e)); \
+      return;                                       \
     } while (false) // Calls the assert function and return
-  #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v)                               \
-    do {                                                                       \
-      etl::private_error_handler::assert_handler<0>::assert_function_ptr((e)); \
-      return (v);                                                              \
+  #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v)    \
+    do {                                            \
+      etl::private_error_handler::raise_error((e)); \
+      return (v);                                   \
     } while (false) // Calls the assert function and return a value
 #elif ETL_USING_EXCEPTIONS
-  #if defined(ETL_LOG_ERRORS)
-    #define ETL_ASSERT(b, e)              \
-      do {                                \
-        if (!(b)) ETL_UNLIKELY            \
-        {                                 \
-          etl::error_handler::error((e)); \
-          throw((e));                     \
-        }                                 \
-      } while (false) // If the condition fails, calls the error handler then
-                      // throws an exception.
-    #define ETL_ASSERT_OR_RETURN(b, e)    \
-      do {                                \
-        if (!(b)) ETL_UNLIKELY            \
-        {                                 \
-          etl::error_handler::error((e)); \
-          throw((e));                     \
-          return;                         \
-        }                                 \
-      } while (false) // If the condition fails, calls the error handler then
-                      // throws an exception.
-    #define ETL_ASSERT_OR_RETURN_VALUE(b, e, v) \
-      do {                                      \
-        if (!(b)) ETL_UNLIKELY                  \
-        {                                       \
-          etl::error_handler::error((e));       \
-          throw((e));                           \
-          return (v);                           \
-        }                                       \
-      } while (false) // If the condition fails, calls the error handler then
-                      // throws an exception.
-
-    #define ETL_ASSERT_FAIL(e)          \
-      do {                              \
-        etl::error_handler::error((e)); \
-        throw((e));                     \
-      } while (false) // Calls the error handler then throws an exception.
-    #define ETL_ASSERT_FAIL_AND_RETURN(e) \
-      do {                                \
-        etl::error_handler::error((e));   \
-        throw((e));                       \
-        return;                           \
-      } while (false) // Calls the error handler then throws an exception.
-    #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v) \
-      do {                                         \
-        etl::error_handler::error((e));            \
-        throw((e));                                \
-        return (v);                                \
-      } while (false) // Calls the error handler then throws an exception.
+  #if ETL_USING_CPP11
+    #define ETL_RAISE_ERROR(e) etl::private_error_handler::raise_error((e)) // Calls the error handler, if logging, then throws. Out of line.
+  #elif defined(ETL_LOG_ERRORS)
+    #define ETL_RAISE_ERROR(e) (etl::error_handler::error((e)), throw((e))) // Calls the error handler then throws.
   #else
-    #define ETL_ASSERT(b, e)   \
-      do {                     \
-        if (!(b)) ETL_UNLIKELY \
-        {                      \
-          throw((e));          \
-        }                      \
-      } while (false) // If the condition fails, throws an exception.
-    #define ETL_ASSERT_OR_RETURN(b, e) \
-      do {                             \
-        if (!(b)) ETL_UNLIKELY         \
-        {                              \
-          throw((e));                  \
-        }                              \
-      } while (false) // If the condition fails, throws an exception.
-    #define ETL_ASSERT_OR_RETURN_VALUE(b, e, v) \
-      do {                                      \
-        if (!(b)) ETL_UNLIKELY                  \
-        {                                       \
-          throw((e));                           \
-        }                                       \
-      } while (false) // If the condition fails, throws an exception.
-
-    #define ETL_ASSERT_FAIL(e) \
-      do {                     \
-        throw((e));            \
-      } while (false) // Throws an exception.
-    #define ETL_ASSERT_FAIL_AND_RETURN(e) \
-      do {                                \
-        throw((e));                       \
-      } while (false) // Throws an exception.
-    #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v) \
-      do {                                         \
-        throw((e));                                \
-      } while (false) // Throws an exception.
+    #define ETL_RAISE_ERROR(e) throw((e)) // Throws.
   #endif
+
+  #define ETL_ASSERT(b, e)    \
+    do {                      \
+      if (!(b)) ETL_UNLIKELY  \
+      {                       \
+        ETL_RAISE_ERROR((e)); \
+      }                       \
+    } while (false) // If the condition fails, calls the error handler, if logging, then throws an exception.
+  #define ETL_ASSERT_OR_RETURN(b, e) \
+    do {                             \
+      if (!(b)) ETL_UNLIKELY         \
+      {                              \
+        ETL_RAISE_ERROR((e));        \
+        return;                      \
+      }                              \
+    } while (false) // If the condition fails, calls the error handler, if logging, then throws an exception.
+  #define ETL_ASSERT_OR_RETURN_VALUE(b, e, v) \
+    do {                                      \
+      if (!(b)) ETL_UNLIKELY                  \
+      {                                       \
+        ETL_RAISE_ERROR((e));                 \
+        return (v);                           \
+      }                                       \
+    } while (false) // If the condition fails, calls the error handler, if logging, then throws an exception.
+
+  #define ETL_ASSERT_FAIL(e) \
+    do {                     \
+      ETL_RAISE_ERROR((e));  \
+    } while (false) // Calls the error handler, if logging, then throws an exception.
+  #define ETL_ASSERT_FAIL_AND_RETURN(e) \
+    do {                                \
+      ETL_RAISE_ERROR((e));             \
+      return;                           \
+    } while (false) // Calls the error handler, if logging, then throws an exception.
+  #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v) \
+    do {                                         \
+      ETL_RAISE_ERROR((e));                      \
+      return (v);                                \
+    } while (false) // Calls the error handler, if logging, then throws an exception.
 #else
   #if defined(ETL_LOG_ERRORS)
-    #define ETL_ASSERT(b, e)              \
-      do {                                \
-        if (!(b)) ETL_UNLIKELY            \
-        {                                 \
-          etl::error_handler::error((e)); \
-        }                                 \
+    #define ETL_ASSERT(b, e)                            \
+      do {                                              \
+        if (!(b)) ETL_UNLIKELY                          \
+        {                                               \
+          etl::private_error_handler::raise_error((e)); \
+        }                                               \
       } while (false) // If the condition fails, calls the error handler
-    #define ETL_ASSERT_OR_RETURN(b, e)    \
-      do {                                \
-        if (!(b)) ETL_UNLIKELY            \
-        {                                 \
-          etl::error_handler::error((e)); \
-          return;                         \
-        }                                 \
+    #define ETL_ASSERT_OR_RETURN(b, e)                  \
+      do {                                              \
+        if (!(b)) ETL_UNLIKELY                          \
+        {                                               \
+          etl::private_error_handler::raise_error((e)); \
+          return;                                       \
+        }                                               \
       } while (false) // If the condition fails, calls the error handler and return
-    #define ETL_ASSERT_OR_RETURN_VALUE(b, e, v) \
-      do {                                      \
-        if (!(b)) ETL_UNLIKELY                  \
-        {                                       \
-          etl::error_handler::error((e));       \
-          return (v);                           \
-        }                                       \
+    #define ETL_ASSERT_OR_RETURN_VALUE(b, e, v)         \
+      do {                                              \
+        if (!(b)) ETL_UNLIKELY                          \
+        {                                               \
+          etl::private_error_handler::raise_error((e)); \
+          return (v);                                   \
+        }                                               \
       } while (false) // If the condition fails, calls the error handler and
                       // return a value
 
-    #define ETL_ASSERT_FAIL(e)          \
-      do {                              \
-        etl::error_handler::error((e)); \
+    #define ETL_ASSERT_FAIL(e)                        \
+      do {                                            \
+        etl::private_error_handler::raise_error((e)); \
       } while (false) // Calls the error handler
-    #define ETL_ASSERT_FAIL_AND_RETURN(e) \
-      do {                                \
-        etl::error_handler::error((e));   \
-        return;                           \
+    #define ETL_ASSERT_FAIL_AND_RETURN(e)             \
+      do {                                            \
+        etl::private_error_handler::raise_error((e)); \
+        return;                                       \
       } while (false) // Calls the error handler and return
-    #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v) \
-      do {                                         \
-        etl::error_handler::error((e));            \
-        return (v);                                \
+    #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v)    \
+      do {                                            \
+        etl::private_error_handler::raise_error((e)); \
+        return (v);                                   \
       } while (false) // Calls the error handler and return a value
   #else
     #if ETL_IS_DEBUG_BUILD
@@ -0,0 +1,542 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FAST_MATH_INCLUDED
+#define ETL_FAST_MATH_INCLUDED
+
+#include "platform.h"
+#include "limits.h"
+#include "span.h"
+#include "static_assert.h"
+#include "private/algorithm_simd.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+///\defgroup fast_math fast_math
+/// Fast approximations of floating point functions.
+///\ingroup maths
+
+//*****************************************************************************
+// The functions take and return float and are accurate to a few ULP over the
+// documented domain, at a fraction of the cost of the <math.h> functions.
+// They do not handle NaN, infinities or values outside the domain.
+//
+// Each function has a span overload that processes the length of the shorter
+// span and returns it. The span overloads use the GCC/Clang vector extensions
+// if ETL_ALGORITHM_USE_SIMD is defined. See private/algorithm_simd.h.
+//*****************************************************************************
+
+#if (ETL_USING_ALGORITHM_SIMD == 1) && (ETL_ALGORITHM_SIMD_VECTOR_BYTES > 0) && (ETL_ALGORITHM_SIMD_HAS_CONVERT == 1)
+  #define ETL_USING_FAST_MATH_VECTORS 1
+#else
+  #define ETL_USING_FAST_MATH_VECTORS 0
+#endif
+
+namespace etl
+{
+  namespace private_fast_math
+  {
+    ETL_STATIC_ASSERT((sizeof(float) == sizeof(int32_t)) && (etl::numeric_limits<float>::digits == 24), "fast_math requires IEEE 754 single precision float");
+
+    //*************************************************************************
+    /// Operations on one float.
+    //*************************************************************************
+    struct scalar_lanes
+    {
+      typedef float   float_type;
+      typedef int32_t int_type;
+
+      static int_type bits(float_type value)
+      {
+        int_type result;
+        memcpy(&result, &value, sizeof(result));
+
+        return result;
+      }
+
+      static float_type from_bits(int_type value)
+      {
+        float_type result;
+        memcpy(&result, &value, sizeof(result));
+
+        return result;
+      }
+
+      static float_type broadcast(float value)
+      {
+        return value;
+      }
+
+      static float_type to_float(int_type value)
+      {
+        return static_cast<float_type>(value);
+      }
+
+      static int_type round_to_int(float_type value)
+      {
+        return static_cast<int_type>(value + ((value < 0.0f) ? -0.5f : 0.5f));
+      }
+
+      static int_type floor_to_int(float_type value)
+      {
+        const int_type result = static_cast<int_type>(value);
+
+        return (static_cast<float_type>(result) > value) ? result - 1 : result;
+      }
+
+      static float_type select(bool mask, float_type a, float_type b)
+      {
+        return mask ? a : b;
+      }
+    };
+
+#if ETL_USING_FAST_MATH_VECTORS == 1
+    //*************************************************************************
+    /// Operations on a vector of floats.
+    //*************************************************************************
+    struct vector_lanes
+    {
+      typedef etl::private_algorithm_simd::vector_ops<float>::vector_type float_type;
+      typedef int32_t int_type __attribute__((vector_size(ETL_ALGORITHM_SIMD_VECTOR_BYTES)));
+
+      static int_type bits(float_type value)
+      {
+        return (int_type)value;
+      }
+
+      static float_type from_bits(int_type value)
+      {
+        return (float_type)value;
+      }
+
+      static float_type broadcast(float value)
+      {
+        return etl::private_algorithm_simd::vector_ops<float>::broadcast(value);
+      }
+
+      static float_type to_float(int_type value)
+      {
+        return __builtin_convertvector(value, float_type);
+      }
+
+      static int_type round_to_int(float_type value)
+      {
+        return __builtin_convertvector(value + select(value < 0.0f, broadcast(-0.5f), broadcast(0.5f)), int_type);
+      }
+
+      static int_type floor_to_int(float_type value)
+      {
+        const int_type result = __builtin_convertvector(value, int_type);
+
+        // The mask is -1 where the conversion rounded up.
+        return result + (to_float(result) > value);
+      }
+
+      static float_type select(int_type mask, float_type a, float_type b)
+      {
+        return (float_type)((((int_type)a) & mask) | (((int_type)b) & ~mask));
+      }
+    };
+#endif
+
+    //*************************************************************************
+    /// log2 for positive normal values.
+    /// log(m) = 2atanh(s), where s = (m - 1) / (m + 1) and m is in [sqrt(0.5), sqrt(2)).
+    //*************************************************************************
+    template <typename TLanes>
+    typename TLanes::float_type log2(typename TLanes::float_type x)
+    {
+      typedef typename TLanes::float_type float_type;
+      typedef typename TLanes::int_type   int_type;
+
+      const int_type bits = TLanes::bits(x);
+
+      float_type exponent = TLanes::to_float(((bits >> 23) & 0xFF) - 127);
+      float_type m        = TLanes::from_bits((bits & 0x007FFFFF) | 0x3F800000);
+
+      exponent = exponent + TLanes::select(m > 1.41421356f, TLanes::broadcast(1.0f), TLanes::broadcast(0.0f));
+      m        = TLanes::select(m > 1.41421356f, m * 0.5f, m);
+
+      const float_type s = (m - 1.0f) / (m + 1.0f);
+      const float_type u = s * s;
+      const float_type p = ((0.149621952f * u + 0.199874253f) * u + 0.333334077f) * u + 1.0f;
+
+      // 2 / ln(2)
+      return exponent + (s * p) * 2.88539008f;
+    }
+
+    //*************************************************************************
+    /// exp2, saturating outside [-126, 128].
+    /// 2^x = 2^k * 2^f, where k = floor(x) and f is in [0, 1).
+    //*************************************************************************
+    template <typename TLanes>
+    typename TLanes::float_type exp2(typename TLanes::float_type x)
+    {
+      typedef typename TLanes::float_type float_type;
+      typedef typename TLanes::int_type   int_type;
+
+      x = TLanes::select(x < -126.0f, TLanes::broadcast(-126.0f), x);
+      x = TLanes::select(x > 128.0f, TLanes::broadcast(128.0f), x);
+
+      const int_type   k = TLanes::floor_to_int(x);
+      const float_type f = x - TLanes::to_float(k);
+
+      const float_type p = (((((0.000218657848f * f + 0.00123913318f) * f + 0.00968418631f) * f + 0.0554806302f) * f + 0.240230454f) * f + 0.693146933f) * f + 1.0f;
+
+      return p * TLanes::from_bits((k + 127) << 23);
+    }
+
+    //*************************************************************************
+    /// 1 / sqrt(x) for positive normal values.
+    /// An estimate from the exponent, then two Newton-Raphson steps.
+    //*************************************************************************
+    template <typename TLanes>
+    typename TLanes::float_type inv_sqrt(typename TLanes::float_type x)
+    {
+      typedef typename TLanes::float_type float_type;
+
+      const float_type half_x = x * 0.5f;
+
+      float_type y = TLanes::from_bits(0x5F375A86 - (TLanes::bits(x) >> 1));
+
+      y = y * (1.5f - half_x * y * y);
+      y = y * (1.5f - half_x * y * y);
+
+      return y;
+    }
+
+    //*************************************************************************
+    /// atan2.
+    /// Reduces to atan(a), a in [0, 1], then to atan(t), |t| <= tan(pi/8).
+    //*************************************************************************
+    template <typename TLanes>
+    typename TLanes::float_type atan2(typename TLanes::float_type y, typename TLanes::float_type x)
+    {
+      typedef typename TLanes::float_type float_type;
+
+      const int32_t Sign = etl::numeric_limits<int32_t>::min();
+
+      const float_type ax = TLanes::from_bits(TLanes::bits(x) & ~Sign);
+      const float_type ay = TLanes::from_bits(TLanes::bits(y) & ~Sign);
+
+      const float_type numerator   = TLanes::select(ay > ax, ax, ay);
+      float_type       denominator = TLanes::select(ay > ax, ay, ax);
+      denominator                  = TLanes::select(denominator > 0.0f, denominator, TLanes::broadcast(1.0f));
+
+      const float_type a = numerator / denominator;
+      const float_type t = TLanes::select(a > 0.414213562f, (a - 1.0f) / (a + 1.0f), a);
+      const float_type u = t * t;
+      const float_type p = (((0.0797629181f * u - 0.138484902f) * u + 0.199740824f) * u - 0.333327858f) * u + 1.0f;
+
+      float_type r = t * p + TLanes::select(a > 0.414213562f, TLanes::broadcast(0.785398163f), TLanes::broadcast(0.0f));
+
+      r = TLanes::select(ay > ax, 1.57079633f - r, r);
+      r = TLanes::select(TLanes::bits(x) < 0, 3.14159265f - r, r);
+
+      return TLanes::from_bits(TLanes::bits(r) | (TLanes::bits(y) & Sign));
+    }
+
+    //*************************************************************************
+    /// sin(x + quadrant * pi/2).
+    /// x = k * pi/2 + r, where |r| <= pi/4. pi/2 is split in to three parts
+    /// so that k * pi/2 is subtracted exactly for |k| < 2^15.
+    //*************************************************************************
+    template <typename TLanes>
+    typename TLanes::float_type sin_quadrant(typename TLanes::float_type x, int quadrant)
+    {
+      typedef typename TLanes::float_type float_type;
+      typedef typename TLanes::int_type   int_type;
+
+      // 2 / pi
+      const int_type   k  = TLanes::round_to_int(x * 0.636619772f);
+      const float_type kf = TLanes::to_float(k);
+      const float_type r  = ((x - kf * 1.5703125f) - kf * 4.83751296997070312e-4f) - kf * 7.54978995489188216e-8f;
+      const float_type u  = r * r;
+
+      const float_type s = r * (((-0.000195039043f * u + 0.00833203579f) * u - 0.166666507f) * u + 1.0f);
+      const float_type c = (((0.0000243798312f * u - 0.0013886618f) * u + 0.0416666167f) * u - 0.5f) * u + 1.0f;
+
+      const int_type q = k + quadrant;
+
+      const float_type v = TLanes::select((q & 1) != 0, c, s);
+
+      return TLanes::select((q & 2) != 0, -v, v);
+    }
+  } // namespace private_fast_math
+
+  namespace fast_math
+  {
+    //*************************************************************************
+    /// log2(x) for positive normal x.
+    /// Max error 4 ULP.
+    //*************************************************************************
+    inline float log2(float x)
+    {
+      return private_fast_math::log2<private_fast_math::scalar_lanes>(x);
+    }
+
+    //*************************************************************************
+    /// 2^x for x in [-126, 128]. Saturates outside.
+    /// Max error 2 ULP.
+    //*************************************************************************
+    inline float exp2(float x)
+    {
+      return private_fast_math::exp2<private_fast_math::scalar_lanes>(x);
+    }
+
+    //*************************************************************************
+    /// x^y for positive normal x, as exp2(y * log2(x)).
+    /// Max relative error 2.4e-7 * (1 + |y * log2(x)|).
+    //*************************************************************************
+    inline float pow(float x, float y)
+    {
+      return exp2(y * log2(x));
+    }
+
+    //*************************************************************************
+    /// 1 / sqrt(x) for positive normal x.
+    /// Max relative error 5e-6.
+    //*************************************************************************
+    inline float inv_sqrt(float x)
+    {
+      return private_fast_math::inv_sqrt<private_fast_math::scalar_lanes>(x);
+    }
+
+    //*************************************************************************
+    /// atan2(y, x), in [-pi, pi]. atan2(0, 0) is 0 or pi.
+    /// Max error 4e-7 radians.
+    //*************************************************************************
+    inline float atan2(float y, float x)
+    {
+      return private_fast_math::atan2<private_fast_math::scalar_lanes>(y, x);
+    }
+
+    //*************************************************************************
+    /// sin(x) for |x| <= 16384.
+    /// Max error 4e-7 absolute.
+    //*************************************************************************
+    inline float sin(float x)
+    {
+      return private_fast_math::sin_quadrant<private_fast_math::scalar_lanes>(x, 0);
+    }
+
+    //*************************************************************************
+    /// cos(x) for |x| <= 16384.
+    /// Max error 4e-7 absolute.
+    //*************************************************************************
+    inline float cos(float x)
+    {
+      return private_fast_math::sin_quadrant<private_fast_math::scalar_lanes>(x, 1);
+    }
+  } // namespace fast_math
+
+  namespace private_fast_math
+  {
+    //*************************************************************************
+    /// The functions, for each lane type.
+    //*************************************************************************
+    struct log2_function
+    {
+      template <typename TLanes>
+      static typename TLanes::float_type apply(typename TLanes::float_type x, typename TLanes::float_type)
+      {
+        return log2<TLanes>(x);
+      }
+    };
+
+    struct exp2_function
+    {
+      template <typename TLanes>
+      static typename TLanes::float_type apply(typename TLanes::float_type x, typename TLanes::float_type)
+      {
+        return exp2<TLanes>(x);
+      }
+    };
+
+    struct pow_function
+    {
+      template <typename TLanes>
+      static typename TLanes::float_type apply(typename TLanes::float_type x, typename TLanes::float_type y)
+      {
+        return exp2<TLanes>(y * log2<TLanes>(x));
+      }
+    };
+
+    struct inv_sqrt_function
+    {
+      template <typename TLanes>
+      static typename TLanes::float_type apply(typename TLanes::float_type x, typename TLanes::float_type)
+      {
+        return inv_sqrt<TLanes>(x);
+      }
+    };
+
+    struct atan2_function
+    {
+      template <typename TLanes>
+      static typename TLanes::float_type apply(typename TLanes::float_type y, typename TLanes::float_type x)
+      {
+        return atan2<TLanes>(y, x);
+      }
+    };
+
+    struct sin_function
+    {
+      template <typename TLanes>
+      static typename TLanes::float_type apply(typename TLanes::float_type x, typename TLanes::float_type)
+      {
+        return sin_quadrant<TLanes>(x, 0);
+      }
+    };
+
+    struct cos_function
+    {
+      template <typename TLanes>
+      static typename TLanes::float_type apply(typename TLanes::float_type x, typename TLanes::float_type)
+      {
+        return sin_quadrant<TLanes>(x, 1);
+      }
+    };
+
+    //*************************************************************************
+    /// Applies a function to 'n' values of 'a' and either 'b' or 'b_value'.
+    //*************************************************************************
+    template <typename TFunction>
+    void transform(const float* a, const float* b, float b_value, float* output, size_t n)
+    {
+#if ETL_USING_FAST_MATH_VECTORS == 1
+      typedef etl::private_algorithm_simd::vector_ops<float> ops;
+
+      const ops::vector_type vb_value = ops::broadcast(b_value);
+
+      while (n >= ops::Lanes)
+      {
+        const ops::vector_type vb = (b != ETL_NULLPTR) ? ops::load(b) : vb_value;
+
+        ops::store(output, TFunction::template apply<vector_lanes>(ops::load(a), vb));
+
+        a += ops::Lanes;
+        b = (b != ETL_NULLPTR) ? b + ops::Lanes : b;
+        output += ops::Lanes;
+        n -= ops::Lanes;
+      }
+#endif
+
+      while (n != 0U)
+      {
+        *output++ = TFunction::template apply<scalar_lanes>(*a++, (b != ETL_NULLPTR) ? *b++ : b_value);
+        --n;
+      }
+    }
+
+    //*************************************************************************
+    template <typename TFunction>
+    size_t transform(etl::span<const float> input, etl::span<float> output)
+    {
+      const size_t n = (input.size() < output.size()) ? input.size() : output.size();
+
+      transform<TFunction>(input.data(), ETL_NULLPTR, 0.0f, output.data(), n);
+
+      return n;
+    }
+  } // namespace private_fast_math
+
+  namespace fast_math
+  {
+    //*************************************************************************
+    /// log2 of each value of 'input', into 'output'.
+    //*************************************************************************
+    inline size_t log2(etl::span<const float> input, etl::span<float> output)
+    {
+      return private_fast_math::transform<private_fast_math::log2_function>(input, output);
+    }
+
+    //*************************************************************************
+    /// exp2 of each value of 'input', into 'output'.
+    //*************************************************************************
+    inline size_t exp2(etl::span<const float> input, etl::span<float> output)
+    {
+      return private_fast_math::transform<private_fast_math::exp2_function>(input, output);
+    }
+
+    //*************************************************************************
+    /// Each value of 'input' to the power of 'exponent', into 'output'.
+    //*************************************************************************
+    inline size_t pow(etl::span<const float> input, float exponent, etl::span<float> output)
+    {
+      const size_t n = (input.size() < output.size()) ? input.size() : output.size();
+
+      private_fast_math::transform<private_fast_math::pow_function>(input.data(), ETL_NULLPTR, exponent, output.data(), n);
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// inv_sqrt of each value of 'input', into 'output'.
+    //*************************************************************************
+    inline size_t inv_sqrt(etl::span<const float> input, etl::span<float> output)
+    {
+      return private_fast_math::transform<private_fast_math::inv_sqrt_function>(input, output);
+    }
+
+    //*************************************************************************
+    /// atan2 of each pair of values of 'y' and 'x', into 'output'.
+    //*************************************************************************
+    inline size_t atan2(etl::span<const float> y, etl::span<const float> x, etl::span<float> output)
+    {
+      size_t n = (y.size() < x.size()) ? y.size() : x.size();
+      n        = (n < output.size()) ? n : output.size();
+
+      private_fast_math::transform<private_fast_math::atan2_function>(y.data(), x.data(), 0.0f, output.data(), n);
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// sin of each value of 'input', into 'output'.
+    //*************************************************************************
+    inline size_t sin(etl::span<const float> input, etl::span<float> output)
+    {
+      return private_fast_math::transform<private_fast_math::sin_function>(input, output);
+    }
+
+    //*************************************************************************
+    /// cos of each value of 'input', into 'output'.
+    //*************************************************************************
+    inline size_t cos(etl::span<const float> input, etl::span<float> output)
+    {
+      return private_fast_math::transform<private_fast_math::cos_function>(input, output);
+    }
+  } // namespace fast_math
+} // namespace etl
+
+#endif
@@ -112,4 +112,8 @@ SOFTWARE.
 #define ETL_FORMAT_FILE_ID                         "79"
 #define ETL_INPLACE_FUNCTION_FILE_ID               "80"
 #define ETL_INTRUSIVE_AVL_TREE_FILE_ID             "81"
+#define ETL_BTREE_FILE_ID                          "82"
+#define ETL_RADIX_TREE_FILE_ID                     "83"
+#define ETL_CONCURRENT_UNORDERED_MAP_FILE_ID       "84"
+#define ETL_FILTER_FILE_ID                         "85"
 #endif
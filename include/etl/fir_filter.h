@@ -0,0 +1,202 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FIR_FILTER_INCLUDED
+#define ETL_FIR_FILTER_INCLUDED
+
+#include "platform.h"
+#include "span.h"
+#include "static_assert.h"
+#include "private/filter_arithmetic.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// A finite impulse response filter, for one or more interleaved channels.
+  ///
+  /// y[n] = h[0]x[n] + h[1]x[n-1] + ... + h[Taps-1]x[n-Taps+1]
+  ///
+  /// Each channel's delay line is stored twice, end to end, so the most recent
+  /// Taps samples are always contiguous and the inner loop needs no modulo.
+  ///
+  /// float and double samples use the dot product kernel in
+  /// private/algorithm_simd.h if ETL_ALGORITHM_USE_SIMD is defined.
+  /// int16_t and int32_t samples and coefficients are Q15 and Q31 fixed point.
+  /// They are accumulated in 64 bits, then rounded and saturated. For Q31 the
+  /// input must have log2(Taps) bits of headroom; without it the 64 bit sum
+  /// may overflow, and wraps around rather than saturating.
+  ///\tparam T        The sample and coefficient type.
+  ///\tparam Taps     The number of coefficients.
+  ///\tparam Channels The number of interleaved channels. Default 1.
+  //***************************************************************************
+  template <typename T, size_t Taps, size_t Channels = 1U>
+  class fir_filter
+  {
+  private:
+
+    typedef etl::private_filter::arithmetic<T> arithmetic_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(Taps > 0U, "Taps must be greater than zero");
+    ETL_STATIC_ASSERT(Channels > 0U, "Channels must be greater than zero");
+
+    typedef T value_type;
+
+    static ETL_CONSTANT size_t TAPS     = Taps;
+    static ETL_CONSTANT size_t CHANNELS = Channels;
+
+    //*************************************************************************
+    /// Converts a coefficient to the filter's format.
+    /// For Q15 and Q31 the value must be in the range [-1, 1).
+    //*************************************************************************
+    static T coefficient(double value)
+    {
+      return arithmetic_t::template to_coefficient<arithmetic_t::Fraction_Bits>(value);
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param coefficients_ Taps coefficients, h[0] first.
+    //*************************************************************************
+    explicit fir_filter(const T* coefficients_)
+    {
+      set_coefficients(coefficients_);
+      reset();
+    }
+
+    //*************************************************************************
+    /// Sets the coefficients. The delay lines are unchanged.
+    /// \param coefficients_ Taps coefficients, h[0] first.
+    //*************************************************************************
+    void set_coefficients(const T* coefficients_)
+    {
+      for (size_t i = 0U; i < Taps; ++i)
+      {
+        coefficients[i] = coefficients_[i];
+      }
+    }
+
+    //*************************************************************************
+    /// Clears the delay lines.
+    //*************************************************************************
+    void reset()
+    {
+      for (size_t c = 0U; c < Channels; ++c)
+      {
+        for (size_t i = 0U; i < (2U * Taps); ++i)
+        {
+          delay[c][i] = T(0);
+        }
+
+        position[c] = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// Filters one sample of a channel.
+    /// Asserts etl::filter_channel_out_of_range if 'channel' is not less than Channels.
+    /// \return The output sample.
+    //*************************************************************************
+    T process(T sample, size_t channel = 0U)
+    {
+      ETL_ASSERT(channel < Channels, ETL_ERROR(filter_channel_out_of_range));
+
+      size_t& p = position[channel];
+
+      p = (p == 0U) ? (Taps - 1U) : (p - 1U);
+
+      delay[channel][p]        = sample;
+      delay[channel][p + Taps] = sample;
+
+      return arithmetic_t::template to_sample<arithmetic_t::Fraction_Bits>(arithmetic_t::dot(coefficients, &delay[channel][p], Taps));
+    }
+
+    //*************************************************************************
+    /// Filters one sample of channel 0.
+    //*************************************************************************
+    T operator()(T sample)
+    {
+      return process(sample);
+    }
+
+    //*************************************************************************
+    /// Filters a block of interleaved samples.
+    /// Processes the whole frames in the shorter span and returns the number
+    /// of samples processed.
+    /// 'output' may be the same as 'input'.
+    //*************************************************************************
+    size_t apply(etl::span<const T> input, etl::span<T> output)
+    {
+      size_t n = (input.size() < output.size()) ? input.size() : output.size();
+      n -= n % Channels;
+
+      const T* p_input  = input.data();
+      T*       p_output = output.data();
+
+      for (size_t i = 0U; i < n; i += Channels)
+      {
+        for (size_t c = 0U; c < Channels; ++c)
+        {
+          p_output[i + c] = process(p_input[i + c], c);
+        }
+      }
+
+      return n;
+    }
+
+  private:
+
+    T      coefficients[Taps];
+    T      delay[Channels][2U * Taps]; ///< Each delay line, mirrored. The newest sample is at 'position'.
+    size_t position[Channels];
+  };
+
+  template <typename T, size_t Taps, size_t Channels>
+  ETL_CONSTANT size_t fir_filter<T, Taps, Channels>::TAPS;
+
+  template <typename T, size_t Taps, size_t Channels>
+  ETL_CONSTANT size_t fir_filter<T, Taps, Channels>::CHANNELS;
+
+#if ETL_USING_CPP11
+  //***************************************************************************
+  /// Q15 and Q31 fixed point FIR filters.
+  //***************************************************************************
+  template <size_t Taps, size_t Channels = 1U>
+  using fir_filter_q15 = etl::fir_filter<int16_t, Taps, Channels>;
+
+  template <size_t Taps, size_t Channels = 1U>
+  using fir_filter_q31 = etl::fir_filter<int32_t, Taps, Channels>;
+#endif
+} // namespace etl
+
+#endif
@@ -33,6 +33,7 @@ SOFTWARE.
 
 #include "platform.h"
 #include "alignment.h"
+#include "container_statistics.h"
 #include "generic_pool.h"
 #include "imemory_block_allocator.h"
 
@@ -54,7 +55,31 @@ namespace etl
     //*************************************************************************
     /// Default constructor
     //*************************************************************************
-    fixed_sized_memory_block_allocator() {}
+    fixed_sized_memory_block_allocator()
+    {
+#if defined(ETL_CONTAINER_STATISTICS)
+      pool.statistics().initialise("fixed_sized_memory_block_allocator", Size);
+#endif
+    }
+
+#if defined(ETL_CONTAINER_STATISTICS)
+    //*************************************************************************
+    /// Returns the occupancy statistics of the block pool.
+    /// Requests that fail because every block is in use count as rejections.
+    //*************************************************************************
+    etl::container_statistics& statistics()
+    {
+      return pool.statistics();
+    }
+
+    //*************************************************************************
+    /// Returns the occupancy statistics of the block pool.
+    //*************************************************************************
+    const etl::container_statistics& statistics() const
+    {
+      return pool.statistics();
+    }
+#endif
 
   protected:
 
@@ -63,14 +88,19 @@ namespace etl
     //*************************************************************************
     virtual void* allocate_block(size_t required_size, size_t required_alignment) ETL_OVERRIDE
     {
-      if ((required_alignment <= Alignment) && (required_size <= Block_Size) && !pool.full())
-      {
-        return pool.template allocate<block>();
-      }
-      else
+      if ((required_alignment <= Alignment) && (required_size <= Block_Size))
       {
-        return ETL_NULLPTR;
+#if defined(ETL_CONTAINER_STATISTICS)
+        pool.statistics().record_rejection_if(pool.full());
+#endif
+
+        if (!pool.full())
+        {
+          return pool.template allocate<block>();
+        }
       }
+
+      return ETL_NULLPTR;
     }
 
     //*************************************************************************
@@ -533,6 +533,8 @@ namespace etl
     {
       private_fsm::fsm_reentrancy_guard transition_lock(is_processing_state_change);
 
+      ETL_TRACE_SCOPE(etl::trace_category::Fsm, get_message_router_id(), message.get_message_id());
+
       if (is_started())
       {
         etl::fsm_state_id_t next_state_id = p_state->process_event(message);
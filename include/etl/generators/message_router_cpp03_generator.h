@@ -103,6 +103,8 @@ SOFTWARE.
     cog.outl("  {")
     cog.outl("    const etl::message_id_t id = msg.get_message_id();")
     cog.outl("")
+    cog.outl("    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), id);")
+    cog.outl("")
     cog.outl("#include \"etl/private/diagnostic_array_bounds_push.h\"")
     cog.outl("    switch (id)")
     cog.outl("    {")
@@ -133,6 +135,8 @@ SOFTWARE.
     cog.outl("T%s>::value, void>::type" % int(Handlers))
     cog.outl("    receive(const TMessage& msg)")
     cog.outl("  {")
+    cog.outl("    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), TMessage::ID);")
+    cog.outl("")
     cog.outl("#include \"etl/private/diagnostic_array_bounds_push.h\"")
     cog.outl("    static_cast<TDerived*>(this)->on_receive(msg);")
     cog.outl("#include \"etl/private/diagnostic_pop.h\"")
@@ -288,6 +292,8 @@ SOFTWARE.
         cog.outl("  {")
         cog.outl("    const etl::message_id_t id = msg.get_message_id();")
         cog.outl("")
+        cog.outl("    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), id);")
+        cog.outl("")
         cog.outl("#include \"etl/private/diagnostic_array_bounds_push.h\"")
         cog.outl("    switch (id)")
         cog.outl("    {")
@@ -318,6 +324,8 @@ SOFTWARE.
         cog.outl("T%s>::value, void>::type" % n)
         cog.outl("    receive(const TMessage& msg)")
         cog.outl("  {")
+        cog.outl("    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), TMessage::ID);")
+        cog.outl("")
         cog.outl("#include \"etl/private/diagnostic_array_bounds_push.h\"")
         cog.outl("    static_cast<TDerived*>(this)->on_receive(msg);")
         cog.outl("#include \"etl/private/diagnostic_pop.h\"")
@@ -0,0 +1,267 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_HYPERLOGLOG_INCLUDED
+#define ETL_HYPERLOGLOG_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "binary.h"
+#include "static_assert.h"
+#include "private/sketch_common.h"
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup hyperloglog hyperloglog
+/// Estimates the number of distinct values in a stream, in fixed memory.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// A HyperLogLog distinct value counter.
+  /// Holds 2^Precision one byte registers. The standard error of the
+  /// estimate is about 1.04 / sqrt(2^Precision), so a precision of 14 gives
+  /// about 0.8% in 16KB, whatever the number of distinct values.
+  /// Sketches with the same precision may be merged, so each thread can
+  /// count its own part of a stream, and the sketches combined afterwards.
+  /// Values are hashed with etl::hash, or a hash may be added directly.
+  ///\tparam Precision The number of index bits, from 4 to 18.
+  ///\ingroup hyperloglog
+  //***************************************************************************
+  template <size_t Precision>
+  class hyperloglog
+  {
+  public:
+
+    ETL_STATIC_ASSERT(((Precision >= 4U) && (Precision <= 18U)), "Precision must be from 4 to 18");
+
+    static ETL_CONSTANT size_t PRECISION = Precision;
+
+    /// The number of registers.
+    static ETL_CONSTANT size_t Register_Count = size_t(1U) << Precision;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    hyperloglog()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Forgets every value.
+    //*************************************************************************
+    void clear()
+    {
+      etl::fill_n(registers, Register_Count, uint8_t(0U));
+    }
+
+    //*************************************************************************
+    /// Adds a value, hashed with etl::hash.
+    //*************************************************************************
+    template <typename T>
+    void add(const T& value)
+    {
+      add_hash(etl::private_sketch::hash_of(value));
+    }
+
+    //*************************************************************************
+    /// Adds a value by its 64 bit hash. The bits of the hash must be well
+    /// mixed, as the top bits select the register.
+    //*************************************************************************
+    void add_hash(uint64_t hash)
+    {
+      const size_t index = static_cast<size_t>(hash >> (64U - Precision));
+
+      // The guard bit limits the rank when the remaining bits are all zero.
+      const uint64_t remainder = (hash << Precision) | (uint64_t(1U) << (Precision - 1U));
+      const uint8_t  rank      = static_cast<uint8_t>(etl::count_leading_zeros(remainder) + 1U);
+
+      if (rank > registers[index])
+      {
+        registers[index] = rank;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds the values counted by another sketch.
+    /// The result is the same as if every value had been added to this one.
+    //*************************************************************************
+    void merge(const hyperloglog& other)
+    {
+      // A simple element-wise maximum, which compilers vectorise.
+      for (size_t i = 0U; i < Register_Count; ++i)
+      {
+        registers[i] = (other.registers[i] > registers[i]) ? other.registers[i] : registers[i];
+      }
+    }
+
+    //*************************************************************************
+    /// Estimates the number of distinct values added.
+    //*************************************************************************
+    double estimate() const
+    {
+      // A histogram of the register values turns the harmonic sum into one
+      // term per rank. Counting is a load and an increment per register,
+      // with no variable shifts, which keeps it fast on targets without a
+      // vector unit, and the sum is exact.
+      uint32_t histogram[Max_Rank + 1U] = {};
+
+      for (size_t i = 0U; i < Register_Count; ++i)
+      {
+        ++histogram[registers[i]];
+      }
+
+      // Smallest terms first, to limit rounding.
+      double sum = 0.0;
+
+      for (size_t rank = Max_Rank + 1U; rank-- > 0U;)
+      {
+        sum += ::ldexp(static_cast<double>(histogram[rank]), -static_cast<int>(rank));
+      }
+
+      const size_t zeros = histogram[0];
+
+      const double m   = static_cast<double>(Register_Count);
+      const double raw = alpha() * m * m / sum;
+
+      // Linear counting is more accurate while there are empty registers.
+      if ((raw <= (2.5 * m)) && (zeros != 0U))
+      {
+        return m * ::log(m / static_cast<double>(zeros));
+      }
+
+      return raw;
+    }
+
+    //*************************************************************************
+    /// Checks if no value has been added.
+    //*************************************************************************
+    bool empty() const
+    {
+      return etl::find_if(registers, registers + Register_Count, non_zero) == (registers + Register_Count);
+    }
+
+    //*************************************************************************
+    /// The expected relative standard error of the estimate.
+    //*************************************************************************
+    double standard_error() const
+    {
+      return 1.04 / ::sqrt(static_cast<double>(Register_Count));
+    }
+
+    //*************************************************************************
+    /// The number of registers.
+    //*************************************************************************
+    size_t size() const
+    {
+      return Register_Count;
+    }
+
+    //*************************************************************************
+    /// The registers, for storing or sending a sketch.
+    /// A sketch may be restored with load().
+    //*************************************************************************
+    const uint8_t* data() const
+    {
+      return registers;
+    }
+
+    //*************************************************************************
+    /// Restores a sketch from registers copied from data().
+    /// The sketch is unchanged if 'length' is not size(), or if any register
+    /// is larger than a sketch of this precision can hold.
+    ///\return true if the sketch was loaded.
+    //*************************************************************************
+    bool load(const uint8_t* p_data, size_t length)
+    {
+      if (length != Register_Count)
+      {
+        return false;
+      }
+
+      for (size_t i = 0U; i < Register_Count; ++i)
+      {
+        if (p_data[i] > Max_Rank)
+        {
+          return false;
+        }
+      }
+
+      etl::copy_n(p_data, Register_Count, registers);
+
+      return true;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The bias correction for the number of registers.
+    //*************************************************************************
+    static double alpha()
+    {
+      switch (Register_Count)
+      {
+        case 16U:
+          return 0.673;
+        case 32U:
+          return 0.697;
+        case 64U:
+          return 0.709;
+        default:
+          return 0.7213 / (1.0 + (1.079 / static_cast<double>(Register_Count)));
+      }
+    }
+
+    /// The largest rank a register can hold.
+    static ETL_CONSTANT size_t Max_Rank = 64U - Precision + 1U;
+
+    static bool non_zero(uint8_t value)
+    {
+      return value != 0U;
+    }
+
+    uint8_t registers[Register_Count];
+  };
+
+  template <size_t Precision>
+  ETL_CONSTANT size_t hyperloglog<Precision>::PRECISION;
+
+  template <size_t Precision>
+  ETL_CONSTANT size_t hyperloglog<Precision>::Register_Count;
+
+  template <size_t Precision>
+  ETL_CONSTANT size_t hyperloglog<Precision>::Max_Rank;
+} // namespace etl
+
+#endif
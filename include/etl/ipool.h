@@ -32,6 +32,7 @@ SOFTWARE.
 #define ETL_IPOOL_INCLUDED
 
 #include "platform.h"
+#include "container_statistics.h"
 #include "error_handler.h"
 #include "exception.h"
 #include "iterator.h"
@@ -542,6 +543,24 @@ namespace etl
       return items_allocated == Max_Size;
     }
 
+#if defined(ETL_CONTAINER_STATISTICS)
+    //*************************************************************************
+    /// Returns the occupancy statistics.
+    //*************************************************************************
+    etl::container_statistics& statistics()
+    {
+      return etl_container_statistics;
+    }
+
+    //*************************************************************************
+    /// Returns the occupancy statistics.
+    //*************************************************************************
+    const etl::container_statistics& statistics() const
+    {
+      return etl_container_statistics;
+    }
+#endif
+
   protected:
 
     //*************************************************************************
@@ -555,6 +574,7 @@ namespace etl
       , Item_Size(item_size_)
       , Max_Size(max_size_)
     {
+      ETL_CONTAINER_STATISTICS_INITIALISE("pool", max_size_);
     }
 
   private:
@@ -584,6 +604,8 @@ namespace etl
         p_value = p_next;
 
         ++items_allocated;
+        ETL_CONTAINER_STATISTICS_SIZE(items_allocated);
+
         if (items_allocated < Max_Size)
         {
           // Set up the pointer to the next free item
@@ -602,6 +624,7 @@ namespace etl
       }
       else
       {
+        ETL_CONTAINER_STATISTICS_REJECT;
         ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
       }
 
@@ -665,6 +688,8 @@ namespace etl
     const uint32_t Item_Size; ///< The size of allocated items.
     const uint32_t Max_Size;  ///< The maximum number of objects that can be allocated.
 
+    ETL_DECLARE_CONTAINER_STATISTICS; ///< Occupancy profile.
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -0,0 +1,955 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_LRU_CACHE_INCLUDED
+#define ETL_LRU_CACHE_INCLUDED
+
+#include "platform.h"
+#include "alignment.h"
+#include "delegate.h"
+#include "functional.h"
+#include "hash.h"
+#include "integral_limits.h"
+#include "nullptr.h"
+#include "placement_new.h"
+#include "power.h"
+#include "static_assert.h"
+#include "utility.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup lru_cache lru_cache
+/// A cache of a fixed number of values, indexed by key, in front of a slower
+/// store. When the cache is full, the value chosen by the replacement policy
+/// is evicted to make room.
+/// An optional read function loads missing values from the store. An optional
+/// write function saves changed values to the store, either as soon as they
+/// change (write through) or when they are evicted or flushed (write back).
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Evicts the least recently used value.
+  /// Every hit moves the value to the front of the recency list.
+  ///\ingroup lru_cache
+  //***************************************************************************
+  struct lru_replacement
+  {
+  };
+
+  //***************************************************************************
+  /// Evicts a value that has not been used since the clock hand last passed
+  /// it, approximating least recently used. A hit only sets a flag, so there
+  /// is no list to update on a hit.
+  ///\ingroup lru_cache
+  //***************************************************************************
+  struct clock_replacement
+  {
+  };
+
+  //***************************************************************************
+  /// The base class for all caches.
+  ///\ingroup lru_cache
+  //***************************************************************************
+  class lru_cache_base
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// Gets the number of values.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible number of values.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the cache is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the cache is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return max_size() - size();
+    }
+
+    //*************************************************************************
+    /// The number of lookups that found the value in the cache.
+    //*************************************************************************
+    size_t hits() const
+    {
+      return hit_count;
+    }
+
+    //*************************************************************************
+    /// The number of lookups that did not find the value in the cache.
+    //*************************************************************************
+    size_t misses() const
+    {
+      return miss_count;
+    }
+
+    //*************************************************************************
+    /// The number of values evicted to make room for others.
+    //*************************************************************************
+    size_t evictions() const
+    {
+      return eviction_count;
+    }
+
+    //*************************************************************************
+    /// Restarts the hit, miss and eviction counts.
+    //*************************************************************************
+    void reset_statistics()
+    {
+      hit_count      = 0U;
+      miss_count     = 0U;
+      eviction_count = 0U;
+    }
+
+    //*************************************************************************
+    /// Returns true if changed values are written to the store immediately.
+    //*************************************************************************
+    bool is_write_through() const
+    {
+      return write_through;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    /// By default, 'write_through' is set to true.
+    //*************************************************************************
+    explicit lru_cache_base(size_type max_size_)
+      : current_size(0U)
+      , CAPACITY(max_size_)
+      , hit_count(0U)
+      , miss_count(0U)
+      , eviction_count(0U)
+      , write_through(true)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~lru_cache_base() {}
+
+    size_type       current_size;   ///< The number of values.
+    const size_type CAPACITY;       ///< The maximum number of values.
+    size_t          hit_count;      ///< The number of lookups that hit.
+    size_t          miss_count;     ///< The number of lookups that missed.
+    size_t          eviction_count; ///< The number of values evicted.
+    bool            write_through;  ///< Write changed values immediately, rather than on eviction or flush.
+  };
+
+  //***************************************************************************
+  /// A cache of values indexed by key.
+  /// Values are held in a fixed array of slots, indexed by a chained hash
+  /// table of slot numbers, so get and put are O(1) on average.
+  /// Pointers to values remain valid until the value is evicted or erased.
+  ///\ingroup lru_cache
+  //***************************************************************************
+  template <typename TKey, typename TValue, typename TReplacement = etl::lru_replacement, typename THash = etl::hash<TKey>,
+            typename TKeyEqual = etl::equal_to<TKey> >
+  class ilru_cache : public etl::lru_cache_base
+  {
+  public:
+
+    typedef TKey              key_type;
+    typedef TValue            value_type;
+    typedef TValue            mapped_type;
+    typedef TReplacement      replacement_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&& rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    //*************************************************************************
+    /// The key and the value to read it into, passed to the read function.
+    //*************************************************************************
+    struct key_value
+    {
+      key_value(const key_type& key_, value_type& value_)
+        : key(key_)
+        , value(value_)
+      {
+      }
+
+      const key_type& key;
+      value_type&     value;
+    };
+
+    //*************************************************************************
+    /// The key and the value to write, passed to the write function.
+    //*************************************************************************
+    struct const_key_value
+    {
+      const_key_value(const key_type& key_, const value_type& value_)
+        : key(key_)
+        , value(value_)
+      {
+      }
+
+      const key_type&   key;
+      const value_type& value;
+    };
+
+    /// Reads the value for the key from the store. Returns false if the store
+    /// does not have it.
+    typedef etl::delegate<bool(const key_value&)> read_function_type;
+
+    /// Writes the value for the key to the store.
+    typedef etl::delegate<void(const const_key_value&)> write_function_type;
+
+  protected:
+
+    static ETL_CONSTANT size_t Npos = etl::integral_limits<size_t>::max;
+
+    //*************************************************************************
+    /// A slot for a key and value.
+    /// A free slot is linked into the free list through next_in_bucket.
+    //*************************************************************************
+    struct entry
+    {
+      key_type& key()
+      {
+        return *reinterpret_cast<key_type*>(&key_storage);
+      }
+
+      const key_type& key() const
+      {
+        return *reinterpret_cast<const key_type*>(&key_storage);
+      }
+
+      value_type& value()
+      {
+        return *reinterpret_cast<value_type*>(&value_storage);
+      }
+
+      const value_type& value() const
+      {
+        return *reinterpret_cast<const value_type*>(&value_storage);
+      }
+
+      size_t next_in_bucket;
+      size_t previous;
+      size_t next;
+      bool   used;
+      bool   dirty;
+      bool   referenced;
+
+      typename etl::aligned_storage_as<sizeof(key_type), key_type>::type     key_storage;
+      typename etl::aligned_storage_as<sizeof(value_type), value_type>::type value_storage;
+    };
+
+  public:
+
+    //*************************************************************************
+    /// Sets the function that reads missing values from the store.
+    //*************************************************************************
+    void set_read_function(read_function_type reader_)
+    {
+      reader = reader_;
+    }
+
+    //*************************************************************************
+    /// Sets the function that writes changed values to the store.
+    //*************************************************************************
+    void set_write_function(write_function_type writer_)
+    {
+      writer = writer_;
+    }
+
+    //*************************************************************************
+    /// Sets the 'write through' flag.
+    /// Changed values held back while it was clear are written now.
+    //*************************************************************************
+    void set_write_through(bool write_through_)
+    {
+      write_through = write_through_;
+
+      if (write_through)
+      {
+        flush();
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the value for the key, and marks it as used.
+    /// On a miss, the value is loaded with the read function, if there is one,
+    /// evicting another value if the cache is full.
+    ///\return A pointer to the value, or null if it is not in the cache or
+    /// the store.
+    //*************************************************************************
+    pointer get(const key_type& key)
+    {
+      size_t index = find_index(key);
+
+      if (index != Npos)
+      {
+        ++hit_count;
+        touch(index, replacement_type());
+
+        return &p_entries[index].value();
+      }
+
+      ++miss_count;
+
+      if (reader.is_valid())
+      {
+        value_type value = value_type();
+
+        if (reader(key_value(key, value)))
+        {
+          index = insert_new(key, ETL_MOVE(value));
+
+          return &p_entries[index].value();
+        }
+      }
+
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Gets the value for the key, without loading it, marking it as used,
+    /// or counting a hit or miss.
+    ///\return A pointer to the value, or null if it is not in the cache.
+    //*************************************************************************
+    pointer peek(const key_type& key)
+    {
+      const size_t index = find_index(key);
+
+      return (index == Npos) ? ETL_NULLPTR : &p_entries[index].value();
+    }
+
+    //*************************************************************************
+    /// Gets the value for the key, without loading it, marking it as used,
+    /// or counting a hit or miss.
+    ///\return A pointer to the value, or null if it is not in the cache.
+    //*************************************************************************
+    const_pointer peek(const key_type& key) const
+    {
+      const size_t index = find_index(key);
+
+      return (index == Npos) ? ETL_NULLPTR : &p_entries[index].value();
+    }
+
+    //*************************************************************************
+    /// Checks if the value for the key is in the cache.
+    //*************************************************************************
+    bool contains(const key_type& key) const
+    {
+      return find_index(key) != Npos;
+    }
+
+    //*************************************************************************
+    /// Sets the value for the key, and marks it as used.
+    /// The value is written to the store now if write through is set,
+    /// otherwise when it is evicted or flushed.
+    //*************************************************************************
+    void put(const key_type& key, const_reference value)
+    {
+      size_t index = find_index(key);
+
+      if (index == Npos)
+      {
+        index = insert_new(key, value);
+      }
+      else
+      {
+        p_entries[index].value() = value;
+        touch(index, replacement_type());
+      }
+
+      changed(index);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Sets the value for the key, and marks it as used.
+    /// The value is written to the store now if write through is set,
+    /// otherwise when it is evicted or flushed.
+    //*************************************************************************
+    void put(const key_type& key, rvalue_reference value)
+    {
+      size_t index = find_index(key);
+
+      if (index == Npos)
+      {
+        index = insert_new(key, etl::move(value));
+      }
+      else
+      {
+        p_entries[index].value() = etl::move(value);
+        touch(index, replacement_type());
+      }
+
+      changed(index);
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes the value for the key, writing it to the store first if it
+    /// has changed.
+    ///\return true if the value was in the cache.
+    //*************************************************************************
+    bool erase(const key_type& key)
+    {
+      const size_t index = find_index(key);
+
+      if (index == Npos)
+      {
+        return false;
+      }
+
+      write_back(index);
+      remove(index);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Writes every changed value to the store.
+    //*************************************************************************
+    void flush()
+    {
+      for (size_t i = 0U; i < CAPACITY; ++i)
+      {
+        if (p_entries[i].used)
+        {
+          write_back(i);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Removes every value, without writing changed values to the store.
+    /// Call flush() first to keep them.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < CAPACITY; ++i)
+      {
+        if (p_entries[i].used)
+        {
+          p_entries[i].key().~key_type();
+          p_entries[i].value().~value_type();
+        }
+      }
+
+      initialise();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ilru_cache(entry* p_entries_, size_t* p_buckets_, size_t bucket_count_, size_t max_size_)
+      : etl::lru_cache_base(max_size_)
+      , p_entries(p_entries_)
+      , p_buckets(p_buckets_)
+      , bucket_mask(bucket_count_ - 1U)
+      , head(Npos)
+      , tail(Npos)
+      , free_head(Npos)
+      , hand(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Links every slot into the free list and empties the index.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_t i = 0U; i < CAPACITY; ++i)
+      {
+        p_entries[i].used           = false;
+        p_entries[i].next_in_bucket = ((i + 1U) == CAPACITY) ? Npos : i + 1U;
+      }
+
+      for (size_t i = 0U; i <= bucket_mask; ++i)
+      {
+        p_buckets[i] = Npos;
+      }
+
+      current_size = 0U;
+      head         = Npos;
+      tail         = Npos;
+      free_head    = 0U;
+      hand         = 0U;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Gets the bucket for the key.
+    //*************************************************************************
+    size_t bucket_of(const key_type& key) const
+    {
+      return static_cast<size_t>(hash_function(key)) & bucket_mask;
+    }
+
+    //*************************************************************************
+    /// Finds the slot holding the key, or Npos.
+    //*************************************************************************
+    size_t find_index(const key_type& key) const
+    {
+      size_t index = p_buckets[bucket_of(key)];
+
+      while ((index != Npos) && !key_equal_function(p_entries[index].key(), key))
+      {
+        index = p_entries[index].next_in_bucket;
+      }
+
+      return index;
+    }
+
+    //*************************************************************************
+    /// Takes a free slot, evicting a value if there is none.
+    /// The slot is not linked into the index until link_new() is called.
+    //*************************************************************************
+    size_t allocate()
+    {
+      if (full())
+      {
+        const size_t victim = select_victim(replacement_type());
+
+        write_back(victim);
+        remove(victim);
+        ++eviction_count;
+      }
+
+      const size_t index = free_head;
+
+      free_head = p_entries[index].next_in_bucket;
+
+      return index;
+    }
+
+    //*************************************************************************
+    /// Returns an unlinked slot to the free list.
+    //*************************************************************************
+    void deallocate(size_t index)
+    {
+      p_entries[index].next_in_bucket = free_head;
+      free_head                       = index;
+    }
+
+    //*************************************************************************
+    /// Constructs the key in a slot that holds a value, and links the slot
+    /// into the index. If the key's constructor throws, the value is
+    /// destroyed and the slot is freed.
+    //*************************************************************************
+    void link_new(size_t index, const key_type& key)
+    {
+      entry& e = p_entries[index];
+
+#if ETL_USING_EXCEPTIONS
+      try
+      {
+#endif
+        ::new (&e.key_storage) key_type(key);
+#if ETL_USING_EXCEPTIONS
+      }
+      catch (...)
+      {
+        e.value().~value_type();
+        deallocate(index);
+        throw;
+      }
+#endif
+
+      e.used       = true;
+      e.dirty      = false;
+      e.referenced = false;
+
+      const size_t bucket = bucket_of(key);
+
+      e.next_in_bucket  = p_buckets[bucket];
+      p_buckets[bucket] = index;
+
+      link_front(index, replacement_type());
+      ++current_size;
+    }
+
+    //*************************************************************************
+    /// Adds a new value for the key.
+    /// The value is constructed before the slot is linked, so if its
+    /// constructor throws the slot is freed and the cache is unchanged,
+    /// apart from any value evicted to make room.
+    //*************************************************************************
+    size_t insert_new(const key_type& key, const_reference value)
+    {
+      const size_t index = allocate();
+
+#if ETL_USING_EXCEPTIONS
+      try
+      {
+#endif
+        ::new (&p_entries[index].value_storage) value_type(value);
+#if ETL_USING_EXCEPTIONS
+      }
+      catch (...)
+      {
+        deallocate(index);
+        throw;
+      }
+#endif
+
+      link_new(index, key);
+
+      return index;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Adds a new value for the key.
+    /// The value is constructed before the slot is linked, so if its
+    /// constructor throws the slot is freed and the cache is unchanged,
+    /// apart from any value evicted to make room.
+    //*************************************************************************
+    size_t insert_new(const key_type& key, rvalue_reference value)
+    {
+      const size_t index = allocate();
+
+  #if ETL_USING_EXCEPTIONS
+      try
+      {
+  #endif
+        ::new (&p_entries[index].value_storage) value_type(etl::move(value));
+  #if ETL_USING_EXCEPTIONS
+      }
+      catch (...)
+      {
+        deallocate(index);
+        throw;
+      }
+  #endif
+
+      link_new(index, key);
+
+      return index;
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes the value in the slot and returns the slot to the free list.
+    //*************************************************************************
+    void remove(size_t index)
+    {
+      entry& e = p_entries[index];
+
+      size_t* p_link = &p_buckets[bucket_of(e.key())];
+
+      while (*p_link != index)
+      {
+        p_link = &p_entries[*p_link].next_in_bucket;
+      }
+
+      *p_link = e.next_in_bucket;
+
+      unlink(index, replacement_type());
+
+      e.key().~key_type();
+      e.value().~value_type();
+      e.used = false;
+
+      deallocate(index);
+      --current_size;
+    }
+
+    //*************************************************************************
+    /// Records that the value in the slot has changed.
+    //*************************************************************************
+    void changed(size_t index)
+    {
+      p_entries[index].dirty = true;
+
+      if (write_through)
+      {
+        write_back(index);
+      }
+    }
+
+    //*************************************************************************
+    /// Writes the value in the slot to the store if it has changed.
+    //*************************************************************************
+    void write_back(size_t index)
+    {
+      entry& e = p_entries[index];
+
+      if (e.dirty && writer.is_valid())
+      {
+        writer(const_key_value(e.key(), e.value()));
+        e.dirty = false;
+      }
+    }
+
+    //*************************************************************************
+    /// LRU: the slot moves to the front of the recency list.
+    //*************************************************************************
+    void touch(size_t index, etl::lru_replacement)
+    {
+      if (index != head)
+      {
+        unlink(index, etl::lru_replacement());
+        link_front(index, etl::lru_replacement());
+      }
+    }
+
+    //*************************************************************************
+    /// LRU: links the slot at the front of the recency list.
+    //*************************************************************************
+    void link_front(size_t index, etl::lru_replacement)
+    {
+      entry& e = p_entries[index];
+
+      e.previous = Npos;
+      e.next     = head;
+
+      if (head == Npos)
+      {
+        tail = index;
+      }
+      else
+      {
+        p_entries[head].previous = index;
+      }
+
+      head = index;
+    }
+
+    //*************************************************************************
+    /// LRU: unlinks the slot from the recency list.
+    //*************************************************************************
+    void unlink(size_t index, etl::lru_replacement)
+    {
+      entry& e = p_entries[index];
+
+      if (e.previous == Npos)
+      {
+        head = e.next;
+      }
+      else
+      {
+        p_entries[e.previous].next = e.next;
+      }
+
+      if (e.next == Npos)
+      {
+        tail = e.previous;
+      }
+      else
+      {
+        p_entries[e.next].previous = e.previous;
+      }
+    }
+
+    //*************************************************************************
+    /// LRU: the victim is at the back of the recency list.
+    //*************************************************************************
+    size_t select_victim(etl::lru_replacement) const
+    {
+      return tail;
+    }
+
+    //*************************************************************************
+    /// CLOCK: a hit sets the slot's reference flag.
+    //*************************************************************************
+    void touch(size_t index, etl::clock_replacement)
+    {
+      p_entries[index].referenced = true;
+    }
+
+    //*************************************************************************
+    /// CLOCK: there is no list.
+    //*************************************************************************
+    void link_front(size_t, etl::clock_replacement) {}
+
+    void unlink(size_t, etl::clock_replacement) {}
+
+    //*************************************************************************
+    /// CLOCK: the hand clears reference flags until it finds a slot without
+    /// one. Only called when the cache is full, so every slot is in use.
+    //*************************************************************************
+    size_t select_victim(etl::clock_replacement)
+    {
+      while (true)
+      {
+        const size_t index = hand;
+
+        hand = ((hand + 1U) == CAPACITY) ? 0U : hand + 1U;
+
+        if (!p_entries[index].referenced)
+        {
+          return index;
+        }
+
+        p_entries[index].referenced = false;
+      }
+    }
+
+    // Disable copy construction and assignment.
+    ilru_cache(const ilru_cache&) ETL_DELETE;
+    ilru_cache& operator=(const ilru_cache&) ETL_DELETE;
+
+    entry*              p_entries;          ///< The slots.
+    size_t*             p_buckets;          ///< The first slot in each bucket.
+    const size_t        bucket_mask;        ///< The number of buckets - 1.
+    size_t              head;               ///< LRU: the most recently used slot.
+    size_t              tail;               ///< LRU: the least recently used slot.
+    size_t              free_head;          ///< The first free slot.
+    size_t              hand;               ///< CLOCK: the next slot to consider for eviction.
+    hasher              hash_function;      ///< The key hash function.
+    key_equal           key_equal_function; ///< The key equality function.
+    read_function_type  reader;             ///< Reads missing values from the store.
+    write_function_type writer;             ///< Writes changed values to the store.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_LRU_CACHE) || defined(ETL_POLYMORPHIC_CONTAINERS)
+
+  public:
+
+    virtual ~ilru_cache() {}
+#else
+
+  protected:
+
+    ~ilru_cache() {}
+#endif
+  };
+
+  template <typename TKey, typename TValue, typename TReplacement, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t ilru_cache<TKey, TValue, TReplacement, THash, TKeyEqual>::Npos;
+
+  //***************************************************************************
+  /// A cache with the capacity defined at compile time.
+  ///\ingroup lru_cache
+  ///\tparam TKey         The type of the keys.
+  ///\tparam TValue       The type of the values.
+  ///\tparam MAX_SIZE_    The maximum number of values.
+  ///\tparam TReplacement etl::lru_replacement or etl::clock_replacement.
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TReplacement = etl::lru_replacement, typename THash = etl::hash<TKey>,
+            typename TKeyEqual = etl::equal_to<TKey> >
+  class lru_cache : public etl::ilru_cache<TKey, TValue, TReplacement, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::ilru_cache<TKey, TValue, TReplacement, THash, TKeyEqual> base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT((MAX_SIZE_ > 0U), "Zero capacity caches are not valid");
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    /// The number of hash buckets, at least one per value.
+    static ETL_CONSTANT size_t Bucket_Count = etl::power_of_2_round_up<MAX_SIZE_>::value;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    lru_cache()
+      : base_t(entries, buckets, Bucket_Count, MAX_SIZE)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Writes changed values to the store.
+    //*************************************************************************
+    ~lru_cache()
+    {
+      this->flush();
+      this->clear();
+    }
+
+  private:
+
+    typename base_t::entry entries[MAX_SIZE_];    ///< The slots.
+    size_t                 buckets[Bucket_Count]; ///< The hash index.
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TReplacement, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t lru_cache<TKey, TValue, MAX_SIZE_, TReplacement, THash, TKeyEqual>::MAX_SIZE;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TReplacement, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t lru_cache<TKey, TValue, MAX_SIZE_, TReplacement, THash, TKeyEqual>::Bucket_Count;
+} // namespace etl
+
+#endif
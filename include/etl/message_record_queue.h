@@ -0,0 +1,380 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MESSAGE_RECORD_QUEUE_INCLUDED
+#define ETL_MESSAGE_RECORD_QUEUE_INCLUDED
+
+#include "platform.h"
+#include "bip_record_queue.h"
+#include "error_handler.h"
+#include "integral_limits.h"
+#include "largest.h"
+#include "message.h"
+#include "placement_new.h"
+#include "type_list.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#include <stddef.h>
+#include <string.h>
+
+///\defgroup message_record_queue message_record_queue
+/// A single producer, single consumer queue of messages, each stored at its
+/// own size rather than the size of the largest message type.
+///\ingroup containers
+
+#if ETL_HAS_ATOMIC && ETL_USING_CPP11
+
+namespace etl
+{
+  namespace private_message_record_queue
+  {
+    //*************************************************************************
+    /// Applies an operation to the message type with a run time id.
+    //*************************************************************************
+    template <typename... TMessageTypes>
+    struct dispatcher;
+
+    template <>
+    struct dispatcher<>
+    {
+      static bool copy(void*, size_t, const etl::imessage&)
+      {
+        return false;
+      }
+
+      static size_t size_of(etl::message_id_t)
+      {
+        return 0U;
+      }
+
+      template <typename TRouter>
+      static void receive(etl::message_id_t, void*, TRouter&)
+      {
+      }
+
+      static void destroy(etl::message_id_t, void*)
+      {
+      }
+    };
+
+    template <typename TMessage, typename... TRest>
+    struct dispatcher<TMessage, TRest...>
+    {
+      //***********************************
+      /// The size of the message with the id, or 0 if it is not in the list.
+      static size_t size_of(etl::message_id_t id)
+      {
+        return (id == TMessage::ID) ? sizeof(TMessage) : dispatcher<TRest...>::size_of(id);
+      }
+
+      //***********************************
+      /// Copy constructs the message at 'p'.
+      static bool copy(void* p, size_t id_size, const etl::imessage& msg)
+      {
+        if (msg.get_message_id() == TMessage::ID)
+        {
+          ::new (static_cast<char*>(p) + id_size) TMessage(static_cast<const TMessage&>(msg));
+          return true;
+        }
+
+        return dispatcher<TRest...>::copy(p, id_size, msg);
+      }
+
+      //***********************************
+      /// Passes the message at 'p' to the router as its own type, then destroys it.
+      template <typename TRouter>
+      static void receive(etl::message_id_t id, void* p, TRouter& router)
+      {
+        if (id == TMessage::ID)
+        {
+          TMessage& msg = *static_cast<TMessage*>(p);
+
+          router.receive(static_cast<const TMessage&>(msg));
+          msg.~TMessage();
+        }
+        else
+        {
+          dispatcher<TRest...>::receive(id, p, router);
+        }
+      }
+
+      //***********************************
+      /// Destroys the message at 'p'.
+      static void destroy(etl::message_id_t id, void* p)
+      {
+        if (id == TMessage::ID)
+        {
+          static_cast<TMessage*>(p)->~TMessage();
+        }
+        else
+        {
+          dispatcher<TRest...>::destroy(id, p);
+        }
+      }
+    };
+  } // namespace private_message_record_queue
+
+  //***************************************************************************
+  ///\ingroup message_record_queue
+  /// A queue of messages of the listed types, each stored as [size, id, message]
+  /// at the message's own size. Messages are constructed in place and are passed
+  /// to a router by reference from the queue's storage, as their own type.
+  /// Supports one producer and one consumer.
+  ///\code
+  /// etl::message_record_queue<4096, Heartbeat, Bulk> queue;
+  ///
+  /// queue.emplace<Heartbeat>(node);   // Producer
+  /// queue.receive(router);            // Consumer
+  ///\endcode
+  ///\tparam Size          The buffer size in bytes.
+  ///\tparam TMessageTypes The message types that may be queued.
+  //***************************************************************************
+  template <size_t Size, typename... TMessageTypes>
+  class message_record_queue
+  {
+  private:
+
+    static ETL_CONSTANT size_t Message_Alignment = etl::largest_alignment<TMessageTypes...>::value;
+
+  public:
+
+    ETL_STATIC_ASSERT(sizeof...(TMessageTypes) > 0U, "At least one message type is required");
+    ETL_STATIC_ASSERT((etl::conjunction<etl::is_message_type<TMessageTypes>...>::value), "Not all types are messages");
+
+    typedef etl::type_list<TMessageTypes...> message_types;
+
+    /// The alignment of the stored messages.
+    static ETL_CONSTANT size_t Alignment = (Message_Alignment > sizeof(uint32_t)) ? Message_Alignment : sizeof(uint32_t);
+
+    /// The bytes in front of each message holding its id.
+    static ETL_CONSTANT size_t Id_Size = ((sizeof(etl::message_id_t) + Alignment - 1U) / Alignment) * Alignment;
+
+    //*************************************************************************
+    /// Destroys any messages still in the queue.
+    /// Neither the producer nor the consumer may be using the queue.
+    //*************************************************************************
+    ~message_record_queue()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Constructs a message in the queue.
+    /// Returns false if there is no room.
+    /// Call from the producer only.
+    //*************************************************************************
+    template <typename TMessage, typename... TArgs>
+    bool emplace(TArgs&&... args)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<TMessage, TMessageTypes...>::value), "Message not in the queue's type list");
+
+      etl::span<unsigned char> record = records.emplace_record(Id_Size + sizeof(TMessage));
+
+      if (record.empty())
+      {
+        return false;
+      }
+
+      write_id(record.data(), TMessage::ID);
+      ::new (record.data() + Id_Size) TMessage(etl::forward<TArgs>(args)...);
+
+      records.commit();
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Copies or moves a message of a listed type into the queue.
+    /// Returns false if there is no room.
+    /// Call from the producer only.
+    //*************************************************************************
+    template <typename TMessage, typename = typename etl::enable_if<etl::is_one_of<typename etl::remove_cvref<TMessage>::type, TMessageTypes...>::value>::type>
+    bool push(TMessage&& msg)
+    {
+      return emplace<typename etl::remove_cvref<TMessage>::type>(etl::forward<TMessage>(msg));
+    }
+
+    //*************************************************************************
+    /// Copies a message into the queue.
+    /// Returns false if there is no room.
+    /// Asserts etl::unhandled_message_exception if the message is not a listed type.
+    /// Call from the producer only.
+    //*************************************************************************
+    bool push(const etl::imessage& msg)
+    {
+      const size_t size = dispatcher_t::size_of(msg.get_message_id());
+
+      ETL_ASSERT_OR_RETURN_VALUE(size != 0U, ETL_ERROR(unhandled_message_exception), false);
+
+      etl::span<unsigned char> record = records.emplace_record(Id_Size + size);
+
+      if (record.empty())
+      {
+        return false;
+      }
+
+      write_id(record.data(), msg.get_message_id());
+      dispatcher_t::copy(record.data(), Id_Size, msg);
+
+      records.commit();
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Passes up to 'max_messages' messages to 'router.receive(msg)', where
+    /// 'msg' is a const reference to the message's own type, then destroys
+    /// them and releases their space.
+    /// If the router throws, the messages before the one that threw have been
+    /// destroyed and released, and the one that threw stays in the queue.
+    /// Returns the number of messages received.
+    /// Call from the consumer only.
+    //*************************************************************************
+    template <typename TRouter>
+    size_t receive(TRouter& router, size_t max_messages = etl::integral_limits<size_t>::max)
+    {
+      receiver<TRouter> r(router);
+
+      size_t count = records.for_each_record(max_messages, r);
+
+      if (count < max_messages)
+      {
+        // Continue after the wrap point.
+        count += records.for_each_record(max_messages - count, r);
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Destroys all of the messages in the queue.
+    /// Call from the consumer only.
+    //*************************************************************************
+    void clear()
+    {
+      records.drain(destroyer());
+    }
+
+    //*************************************************************************
+    /// Returns true if there are no messages.
+    //*************************************************************************
+    bool empty() const
+    {
+      return records.empty();
+    }
+
+    //*************************************************************************
+    /// Returns the number of bytes in use, including framing.
+    //*************************************************************************
+    size_t size_bytes() const
+    {
+      return records.size_bytes();
+    }
+
+    //*************************************************************************
+    /// Returns the buffer size in bytes.
+    //*************************************************************************
+    size_t capacity_bytes() const
+    {
+      return records.capacity_bytes();
+    }
+
+    //*************************************************************************
+    /// Returns the number of bytes used to store a message of type TMessage,
+    /// including framing.
+    //*************************************************************************
+    template <typename TMessage>
+    static ETL_CONSTEXPR size_t record_size()
+    {
+      return record_queue_t::Header_Blocks * Alignment + Id_Size + (((sizeof(TMessage) + Alignment - 1U) / Alignment) * Alignment);
+    }
+
+  private:
+
+    typedef private_message_record_queue::dispatcher<TMessageTypes...> dispatcher_t;
+    typedef etl::bip_record_queue<Size, Alignment>                     record_queue_t;
+
+    ETL_STATIC_ASSERT((Id_Size + etl::largest_type<TMessageTypes...>::size) <= record_queue_t::Max_Record_Size, "Size too small for the largest message");
+
+    //*************************************************************************
+    template <typename TRouter>
+    struct receiver
+    {
+      explicit receiver(TRouter& router_)
+        : router(router_)
+      {
+      }
+
+      void operator()(etl::span<const unsigned char> record)
+      {
+        etl::message_id_t id;
+        memcpy(&id, record.data(), sizeof(id));
+
+        dispatcher_t::receive(id, const_cast<unsigned char*>(record.data()) + Id_Size, router);
+      }
+
+      TRouter& router;
+    };
+
+    //*************************************************************************
+    struct destroyer
+    {
+      void operator()(etl::span<const unsigned char> record) const
+      {
+        etl::message_id_t id;
+        memcpy(&id, record.data(), sizeof(id));
+
+        dispatcher_t::destroy(id, const_cast<unsigned char*>(record.data()) + Id_Size);
+      }
+    };
+
+    //*************************************************************************
+    static void write_id(unsigned char* p, etl::message_id_t id)
+    {
+      memcpy(p, &id, sizeof(id));
+    }
+
+    record_queue_t records;
+  };
+
+  template <size_t Size, typename... TMessageTypes>
+  ETL_CONSTANT size_t message_record_queue<Size, TMessageTypes...>::Message_Alignment;
+
+  template <size_t Size, typename... TMessageTypes>
+  ETL_CONSTANT size_t message_record_queue<Size, TMessageTypes...>::Alignment;
+
+  template <size_t Size, typename... TMessageTypes>
+  ETL_CONSTANT size_t message_record_queue<Size, TMessageTypes...>::Id_Size;
+} // namespace etl
+
+#endif /* ETL_HAS_ATOMIC && ETL_USING_CPP11 */
+
+#endif
@@ -42,6 +42,7 @@ SOFTWARE.
 #include "placement_new.h"
 #include "shared_message.h"
 #include "successor.h"
+#include "trace_hooks.h"
 #include "type_list.h"
 #include "type_traits.h"
 
@@ -491,6 +492,8 @@ namespace etl
     {
       const etl::message_id_t id = msg.get_message_id();
 
+      ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), id);
+
       // The IDs are sorted, so an ID less than the first is not handled by this
       // router.
       if (id >= Message_Id_Start)
@@ -528,6 +531,8 @@ namespace etl
     template < typename TMessage, typename etl::enable_if<etl::is_one_of<TMessage, TMessageTypes...>::value, int>::type = 0>
     void receive(const TMessage& msg)
     {
+      ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), TMessage::ID);
+
   #include "etl/private/diagnostic_array_bounds_push.h"
       static_cast<TDerived*>(this)->on_receive(msg);
   #include "etl/private/diagnostic_pop.h"
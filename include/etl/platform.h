@@ -481,6 +481,19 @@ SOFTWARE.
   #define ETL_CONSTEXPR20_STL
 #endif
 
+//*************************************
+// Function attributes for rarely executed code.
+#if ETL_USING_GCC_COMPILER || ETL_USING_CLANG_COMPILER
+  #define ETL_COLD     __attribute__((cold))
+  #define ETL_NOINLINE __attribute__((noinline))
+#elif ETL_USING_MICROSOFT_COMPILER
+  #define ETL_COLD
+  #define ETL_NOINLINE __declspec(noinline)
+#else
+  #define ETL_COLD
+  #define ETL_NOINLINE
+#endif
+
 //*************************************
 // C++23
 #if ETL_USING_CPP23
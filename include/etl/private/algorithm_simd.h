@@ -0,0 +1,1082 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ALGORITHM_SIMD_INCLUDED
+#define ETL_ALGORITHM_SIMD_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+//*****************************************************************************
+// Kernels for the arithmetic fast paths of the ETL algorithms.
+//
+// Enabled by defining ETL_ALGORITHM_USE_SIMD.
+// Only used for pointers to arithmetic types and never during constant
+// evaluation, so they are only enabled if the compiler can detect it.
+// find, count, fill, min_element, max_element and minmax_element handle
+// integral, float and double lanes. equal and accumulate handle integral
+// lanes only, as float equality is not bitwise and float sums depend on
+// the order of the additions.
+//
+// The vector kernels are written with the GCC/Clang vector extensions and are
+// lowered to AVX2, SSE2 or NEON according to the target options.
+// The vector width may be overridden by defining ETL_ALGORITHM_SIMD_VECTOR_BYTES.
+// A value of 0 selects the scalar kernels, which use SWAR for byte sized types.
+//*****************************************************************************
+#if defined(ETL_ALGORITHM_USE_SIMD) && (ETL_USING_CPP23 || (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1) || !ETL_USING_CPP14)
+  #define ETL_USING_ALGORITHM_SIMD     1
+  #define ETL_NOT_USING_ALGORITHM_SIMD 0
+#else
+  #define ETL_USING_ALGORITHM_SIMD     0
+  #define ETL_NOT_USING_ALGORITHM_SIMD 1
+#endif
+
+#if !defined(ETL_ALGORITHM_SIMD_VECTOR_BYTES)
+  #if (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && defined(__AVX2__)
+    #define ETL_ALGORITHM_SIMD_VECTOR_BYTES 32
+  #elif (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (defined(__SSE2__) || defined(__ARM_NEON) || defined(__ARM_NEON__))
+    #define ETL_ALGORITHM_SIMD_VECTOR_BYTES 16
+  #else
+    #define ETL_ALGORITHM_SIMD_VECTOR_BYTES 0
+  #endif
+#endif
+
+// Lane type conversions, used by the rescale kernel.
+#if !defined(ETL_ALGORITHM_SIMD_HAS_CONVERT)
+  #if defined(__has_builtin) && (ETL_ALGORITHM_SIMD_VECTOR_BYTES > 0)
+    #if __has_builtin(__builtin_convertvector)
+      #define ETL_ALGORITHM_SIMD_HAS_CONVERT 1
+    #endif
+  #endif
+#endif
+
+#if !defined(ETL_ALGORITHM_SIMD_HAS_CONVERT)
+  #define ETL_ALGORITHM_SIMD_HAS_CONVERT 0
+#endif
+
+#include "diagnostic_float_equal_push.h"
+
+namespace etl
+{
+  namespace private_algorithm_simd
+  {
+    //*************************************************************************
+    /// Integral types that the kernels handle. bool is excluded.
+    //*************************************************************************
+    template <typename T>
+    struct is_integral_lane : etl::integral_constant<bool, etl::is_integral<T>::value && !etl::is_same<T, bool>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// Types that the kernels can compare for equality.
+    //*************************************************************************
+    template <typename T>
+    struct is_compare_lane : etl::integral_constant<bool, is_integral_lane<T>::value || etl::is_same<T, float>::value || etl::is_same<T, double>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// The non-cv value type of a pointer iterator, or void.
+    //*************************************************************************
+    template <typename TIterator>
+    struct pointer_value
+    {
+      typedef void type;
+    };
+
+    template <typename T>
+    struct pointer_value<T*>
+    {
+      typedef typename etl::remove_cv<T>::type type;
+    };
+
+    //*************************************************************************
+    /// Selects the kernel for an algorithm over the pointer range, if any.
+    //*************************************************************************
+    template <typename TIterator, typename T>
+    struct use_compare_kernel
+      : etl::integral_constant<bool, (ETL_USING_ALGORITHM_SIMD == 1) && is_compare_lane<typename pointer_value<TIterator>::type>::value
+                                       && etl::is_same<typename pointer_value<TIterator>::type, T>::value>
+    {
+    };
+
+    template <typename TIterator, typename T>
+    struct use_integral_kernel
+      : etl::integral_constant<bool, (ETL_USING_ALGORITHM_SIMD == 1) && is_integral_lane<typename pointer_value<TIterator>::type>::value
+                                       && etl::is_same<typename pointer_value<TIterator>::type, T>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// Unsigned integral type of a lane size.
+    //*************************************************************************
+    template <size_t Size>
+    struct unsigned_lane;
+
+    template <>
+    struct unsigned_lane<1>
+    {
+      typedef uint8_t type;
+    };
+
+    template <>
+    struct unsigned_lane<2>
+    {
+      typedef uint16_t type;
+    };
+
+    template <>
+    struct unsigned_lane<4>
+    {
+      typedef uint32_t type;
+    };
+
+#if ETL_USING_64BIT_TYPES
+    template <>
+    struct unsigned_lane<8>
+    {
+      typedef uint64_t type;
+    };
+#endif
+
+    //*************************************************************************
+    /// SWAR helpers for byte sized lanes.
+    //*************************************************************************
+    struct swar
+    {
+#if ETL_USING_64BIT_TYPES
+      typedef uint64_t word_type;
+#else
+      typedef uint32_t word_type;
+#endif
+
+      static ETL_CONSTANT word_type Low_Bits = static_cast<word_type>(~word_type(0)) / 0xFFU;
+      static ETL_CONSTANT word_type Low_7    = Low_Bits * 0x7FU;
+
+      //*********************************
+      static word_type load(const void* p)
+      {
+        word_type word;
+        memcpy(&word, p, sizeof(word));
+
+        return word;
+      }
+
+      //*********************************
+      /// Sets the top bit of each byte that is zero. Exact; no false positives.
+      //*********************************
+      static word_type zero_bytes(word_type word)
+      {
+        return ~(((word & Low_7) + Low_7) | word | Low_7);
+      }
+
+      //*********************************
+      static size_t count_high_bits(word_type bits)
+      {
+        return static_cast<size_t>(((bits >> 7U) * Low_Bits) >> ((sizeof(word_type) - 1U) * 8U));
+      }
+    };
+
+    //*************************************************************************
+    /// Scalar kernels. Byte sized lanes are processed a word at a time.
+    //*************************************************************************
+    template <typename T>
+    const T* swar_find(const T* first, const T* last, T value)
+    {
+      if (sizeof(T) == 1U)
+      {
+        const swar::word_type pattern = swar::Low_Bits * static_cast<uint8_t>(value);
+
+        while (size_t(last - first) >= sizeof(swar::word_type))
+        {
+          if (swar::zero_bytes(swar::load(first) ^ pattern) != 0U)
+          {
+            break;
+          }
+
+          first += sizeof(swar::word_type);
+        }
+      }
+
+      while ((first != last) && !(*first == value))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    //*********************************
+    template <typename T>
+    size_t swar_count(const T* first, const T* last, T value)
+    {
+      size_t n = 0U;
+
+      if (sizeof(T) == 1U)
+      {
+        const swar::word_type pattern = swar::Low_Bits * static_cast<uint8_t>(value);
+
+        while (size_t(last - first) >= sizeof(swar::word_type))
+        {
+          n += swar::count_high_bits(swar::zero_bytes(swar::load(first) ^ pattern));
+          first += sizeof(swar::word_type);
+        }
+      }
+
+      while (first != last)
+      {
+        n += (*first == value) ? 1U : 0U;
+        ++first;
+      }
+
+      return n;
+    }
+
+#if ETL_ALGORITHM_SIMD_VECTOR_BYTES > 0
+    //*************************************************************************
+    /// Vector operations for lanes of type T.
+    //*************************************************************************
+    template <typename T>
+    struct vector_ops
+    {
+      typedef T vector_type __attribute__((vector_size(ETL_ALGORITHM_SIMD_VECTOR_BYTES)));
+      typedef typename unsigned_lane<sizeof(T)>::type unsigned_type;
+      typedef unsigned_type unsigned_vector_type __attribute__((vector_size(ETL_ALGORITHM_SIMD_VECTOR_BYTES)));
+
+      static ETL_CONSTANT size_t Lanes = ETL_ALGORITHM_SIMD_VECTOR_BYTES / sizeof(T);
+
+      //*********************************
+      static vector_type load(const T* p)
+      {
+        vector_type v;
+        memcpy(&v, p, sizeof(v));
+
+        return v;
+      }
+
+      //*********************************
+      static void store(T* p, const vector_type& v)
+      {
+        memcpy(p, &v, sizeof(v));
+      }
+
+      //*********************************
+      static vector_type broadcast(T value)
+      {
+        T lanes[Lanes];
+
+        for (size_t i = 0U; i < Lanes; ++i)
+        {
+          lanes[i] = value;
+        }
+
+        return load(lanes);
+      }
+
+      //*********************************
+      /// True if any lane of the comparison mask is set.
+      //*********************************
+      template <typename TMask>
+      static bool any(const TMask& mask)
+      {
+        uint32_t words[ETL_ALGORITHM_SIMD_VECTOR_BYTES / sizeof(uint32_t)];
+        memcpy(words, &mask, sizeof(words));
+
+        uint32_t result = 0U;
+
+        for (size_t i = 0U; i < (ETL_ALGORITHM_SIMD_VECTOR_BYTES / sizeof(uint32_t)); ++i)
+        {
+          result |= words[i];
+        }
+
+        return result != 0U;
+      }
+
+      //*********************************
+      /// Lane-wise 'mask ? a : b', where 'mask' is the result of a comparison.
+      /// Any lane type.
+      //*********************************
+      template <typename TMask>
+      static vector_type select(const TMask& mask, const vector_type& a, const vector_type& b)
+      {
+        const unsigned_vector_type m = (unsigned_vector_type)mask;
+
+        return (vector_type)((((unsigned_vector_type)a) & m) | (((unsigned_vector_type)b) & ~m));
+      }
+
+      //*********************************
+      /// The sum of the lanes, reinterpreted as unsigned.
+      //*********************************
+      template <typename TVector>
+      static size_t reduce_unsigned(const TVector& v)
+      {
+        unsigned_type lanes[Lanes];
+        memcpy(lanes, &v, sizeof(lanes));
+
+        size_t result = 0U;
+
+        for (size_t i = 0U; i < Lanes; ++i)
+        {
+          result += static_cast<size_t>(lanes[i]);
+        }
+
+        return result;
+      }
+    };
+
+    template <typename T>
+    ETL_CONSTANT size_t vector_ops<T>::Lanes;
+#endif
+
+    //*************************************************************************
+    /// find
+    //*************************************************************************
+    template <typename T>
+    const T* find(const T* first, const T* last, T value)
+    {
+#if ETL_ALGORITHM_SIMD_VECTOR_BYTES > 0
+      typedef vector_ops<T> ops;
+
+      const typename ops::vector_type pattern = ops::broadcast(value);
+
+      while (size_t(last - first) >= ops::Lanes)
+      {
+        if (ops::any(ops::load(first) == pattern))
+        {
+          break;
+        }
+
+        first += ops::Lanes;
+      }
+
+      // Finish the matching block or the tail.
+      while ((first != last) && !(*first == value))
+      {
+        ++first;
+      }
+
+      return first;
+#else
+      return swar_find(first, last, value);
+#endif
+    }
+
+    //*************************************************************************
+    /// count
+    //*************************************************************************
+    template <typename T>
+    size_t count(const T* first, const T* last, T value)
+    {
+#if ETL_ALGORITHM_SIMD_VECTOR_BYTES > 0
+      typedef vector_ops<T> ops;
+      typedef typename ops::unsigned_vector_type counter_type;
+
+      // Each lane counter may be incremented this many times before it is flushed.
+      const size_t Max_Blocks = (sizeof(T) >= sizeof(size_t)) ? ~size_t(0) : ((size_t(1) << (sizeof(T) * 8U)) - 1U);
+
+      const typename ops::vector_type pattern = ops::broadcast(value);
+
+      size_t n = 0U;
+
+      while (size_t(last - first) >= ops::Lanes)
+      {
+        counter_type counters;
+        memset(&counters, 0, sizeof(counters));
+
+        size_t blocks = 0U;
+
+        while ((size_t(last - first) >= ops::Lanes) && (blocks < Max_Blocks))
+        {
+          // Matching lanes are all ones, so subtracting increments the counter.
+          counters -= (counter_type)(ops::load(first) == pattern);
+          first += ops::Lanes;
+          ++blocks;
+        }
+
+        n += ops::reduce_unsigned(counters);
+      }
+
+      while (first != last)
+      {
+        n += (*first == value) ? 1U : 0U;
+        ++first;
+      }
+
+      return n;
+#else
+      return swar_count(first, last, value);
+#endif
+    }
+
+    //*************************************************************************
+    /// The element that an extreme_tracker looks for.
+    //*************************************************************************
+    struct extreme
+    {
+      enum enum_type
+      {
+        Min_First, ///< The first smallest.
+        Max_First, ///< The first largest.
+        Max_Last,  ///< The last largest.
+        None
+      };
+    };
+
+    //*************************************************************************
+    /// Tracks the position of an extreme element while a range is scanned,
+    /// first a chunk of vector blocks at a time, then an element at a time.
+    /// Each lane keeps its extreme and the number of the block that it was
+    /// found in, so the position is known without a second pass.
+    //*************************************************************************
+    template <int Kind, typename T>
+    struct extreme_tracker
+    {
+      //*********************************
+      /// True if 'value' replaces the extreme 'best' found before it.
+      //*********************************
+      static bool replaces(T value, T best)
+      {
+        return (Kind == extreme::Min_First) ? (value < best) : ((Kind == extreme::Max_First) ? (best < value) : !(value < best));
+      }
+
+      //*********************************
+      void start(const T* first)
+      {
+        best = first;
+      }
+
+      //*********************************
+      void add(const T* p)
+      {
+        best = replaces(*p, *best) ? p : best;
+      }
+
+#if ETL_ALGORITHM_SIMD_VECTOR_BYTES > 0
+      typedef vector_ops<T>                        ops;
+      typedef typename ops::vector_type            vector_type;
+      typedef typename ops::unsigned_type          unsigned_type;
+      typedef typename ops::unsigned_vector_type   block_vector_type;
+
+      //*********************************
+      void start_chunk(const vector_type& v)
+      {
+        vbest = v;
+        memset(&vblock, 0, sizeof(vblock));
+      }
+
+      //*********************************
+      void add_block(const vector_type& v, const block_vector_type& vcurrent)
+      {
+        block_vector_type mask;
+
+        if (Kind == extreme::Min_First)
+        {
+          mask = (block_vector_type)(v < vbest);
+        }
+        else if (Kind == extreme::Max_First)
+        {
+          mask = (block_vector_type)(vbest < v);
+        }
+        else
+        {
+          // Equivalent to !(v < vbest), as NaNs are handled by the caller.
+          mask = (block_vector_type)(v >= vbest);
+        }
+
+        vbest  = ops::select(mask, v, vbest);
+        vblock = (vcurrent & mask) | (vblock & ~mask);
+      }
+
+      //*********************************
+      /// Reduces the lanes to the extreme of the chunk starting at 'chunk'.
+      /// Equal lane extremes are ordered by their positions.
+      //*********************************
+      void end_chunk(const T* chunk)
+      {
+        T             values[ops::Lanes];
+        unsigned_type blocks[ops::Lanes];
+        memcpy(values, &vbest, sizeof(values));
+        memcpy(blocks, &vblock, sizeof(blocks));
+
+        size_t position = static_cast<size_t>(blocks[0]) * ops::Lanes;
+
+        for (size_t lane = 1U; lane < ops::Lanes; ++lane)
+        {
+          const size_t lane_position = (static_cast<size_t>(blocks[lane]) * ops::Lanes) + lane;
+          const T      value         = values[lane];
+          const T      current       = chunk[position];
+
+          const bool better = (Kind == extreme::Min_First) ? (value < current) : (current < value);
+          const bool equal  = !(value < current) && !(current < value);
+          const bool later  = lane_position > position;
+
+          if (better || (equal && ((Kind == extreme::Max_Last) == later)))
+          {
+            position = lane_position;
+          }
+        }
+
+        // Every earlier chunk came before this one.
+        add(chunk + position);
+      }
+
+      vector_type       vbest;
+      block_vector_type vblock;
+#endif
+
+      const T* best;
+    };
+
+    //*************************************************************************
+    /// Used when only one extreme is wanted.
+    //*************************************************************************
+    template <typename T>
+    struct extreme_tracker<extreme::None, T>
+    {
+      void start(const T*) {}
+
+      void add(const T*) {}
+
+#if ETL_ALGORITHM_SIMD_VECTOR_BYTES > 0
+      template <typename TVector>
+      void start_chunk(const TVector&)
+      {
+      }
+
+      template <typename TVector, typename TBlockVector>
+      void add_block(const TVector&, const TBlockVector&)
+      {
+      }
+
+      void end_chunk(const T*) {}
+#endif
+    };
+
+    //*************************************************************************
+    /// Finds the extremes of a non-empty range in one pass.
+    /// Block numbers are held in lanes of the element's width, so the lanes
+    /// are reduced every Max_Blocks blocks. A NaN does not order, so floating
+    /// point ranges that contain one are rescanned an element at a time.
+    //*************************************************************************
+    template <typename TMinimum, typename TMaximum, typename T>
+    void extreme_elements(const T* first, const T* last, TMinimum& minimum, TMaximum& maximum)
+    {
+      const T* const begin = first;
+
+      minimum.start(first);
+      maximum.start(first);
+
+#if ETL_ALGORITHM_SIMD_VECTOR_BYTES > 0
+      typedef vector_ops<T>                                                ops;
+      typedef typename ops::vector_type                                    vector_type;
+      typedef typename ops::unsigned_vector_type                           block_vector_type;
+      typedef vector_ops<typename ops::unsigned_type>                      block_ops;
+
+      const size_t Max_Blocks = (sizeof(T) >= sizeof(size_t)) ? ~size_t(0) : ((size_t(1) << (sizeof(T) * 8U)) - 1U);
+
+      const block_vector_type one = block_ops::broadcast(1U);
+
+      block_vector_type nan;
+      memset(&nan, 0, sizeof(nan));
+
+      while (size_t(last - first) >= ops::Lanes)
+      {
+        const T* const chunk = first;
+
+        vector_type v = ops::load(first);
+        nan |= (block_vector_type)(v != v);
+        minimum.start_chunk(v);
+        maximum.start_chunk(v);
+        first += ops::Lanes;
+
+        block_vector_type vcurrent;
+        memset(&vcurrent, 0, sizeof(vcurrent));
+
+        size_t blocks = 1U;
+
+        while ((size_t(last - first) >= ops::Lanes) && (blocks < Max_Blocks))
+        {
+          v = ops::load(first);
+          nan |= (block_vector_type)(v != v);
+          vcurrent += one;
+          minimum.add_block(v, vcurrent);
+          maximum.add_block(v, vcurrent);
+          first += ops::Lanes;
+          ++blocks;
+        }
+
+        minimum.end_chunk(chunk);
+        maximum.end_chunk(chunk);
+      }
+
+      if (ops::any(nan))
+      {
+        first = begin;
+        minimum.start(first);
+        maximum.start(first);
+      }
+#endif
+
+      if (first == begin)
+      {
+        ++first;
+      }
+
+      while (first != last)
+      {
+        minimum.add(first);
+        maximum.add(first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// min_element. Returns the first smallest element.
+    //*************************************************************************
+    template <typename T>
+    const T* min_element(const T* first, const T* last)
+    {
+      if (first == last)
+      {
+        return last;
+      }
+
+      extreme_tracker<extreme::Min_First, T> minimum;
+      extreme_tracker<extreme::None, T>      none;
+      extreme_elements(first, last, minimum, none);
+
+      return minimum.best;
+    }
+
+    //*************************************************************************
+    /// max_element. Returns the first largest element.
+    //*************************************************************************
+    template <typename T>
+    const T* max_element(const T* first, const T* last)
+    {
+      if (first == last)
+      {
+        return last;
+      }
+
+      extreme_tracker<extreme::None, T>      none;
+      extreme_tracker<extreme::Max_First, T> maximum;
+      extreme_elements(first, last, none, maximum);
+
+      return maximum.best;
+    }
+
+    //*************************************************************************
+    /// minmax_element. Returns the first smallest and the last largest element.
+    //*************************************************************************
+    template <typename T>
+    void minmax_element(const T* first, const T* last, const T*& minimum, const T*& maximum)
+    {
+      if (first == last)
+      {
+        minimum = last;
+        maximum = last;
+        return;
+      }
+
+      extreme_tracker<extreme::Min_First, T> min_tracker;
+      extreme_tracker<extreme::Max_Last, T>  max_tracker;
+      extreme_elements(first, last, min_tracker, max_tracker);
+
+      minimum = min_tracker.best;
+      maximum = max_tracker.best;
+    }
+
+    //*************************************************************************
+    /// equal. Integral lanes only, as bitwise equality is value equality.
+    //*************************************************************************
+    template <typename T>
+    bool equal(const T* first1, const T* last1, const T* first2)
+    {
+      return (first1 == last1) || (memcmp(first1, first2, size_t(last1 - first1) * sizeof(T)) == 0);
+    }
+
+    //*************************************************************************
+    /// accumulate. Integral lanes only. Wraps modulo 2^N, as the scalar loop does.
+    /// Floating point sums depend on the order of the additions, so they keep
+    /// the generic loop.
+    //*************************************************************************
+    template <typename T>
+    T accumulate(const T* first, const T* last, T sum)
+    {
+      typedef typename unsigned_lane<sizeof(T)>::type unsigned_type;
+
+      unsigned_type total = static_cast<unsigned_type>(sum);
+
+#if ETL_ALGORITHM_SIMD_VECTOR_BYTES > 0
+      typedef vector_ops<T> ops;
+      typedef typename ops::unsigned_vector_type accumulator_type;
+
+      if (size_t(last - first) >= ops::Lanes)
+      {
+        accumulator_type accumulator;
+        memset(&accumulator, 0, sizeof(accumulator));
+
+        while (size_t(last - first) >= ops::Lanes)
+        {
+          accumulator += (accumulator_type)ops::load(first);
+          first += ops::Lanes;
+        }
+
+        unsigned_type lanes[ops::Lanes];
+        memcpy(lanes, &accumulator, sizeof(lanes));
+
+        for (size_t i = 0U; i < ops::Lanes; ++i)
+        {
+          total = static_cast<unsigned_type>(total + lanes[i]);
+        }
+      }
+#endif
+
+      while (first != last)
+      {
+        total = static_cast<unsigned_type>(total + static_cast<unsigned_type>(*first));
+        ++first;
+      }
+
+      return static_cast<T>(total);
+    }
+
+    //*************************************************************************
+    /// fill
+    //*************************************************************************
+    template <typename T>
+    void fill(T* first, T* last, T value)
+    {
+      if (sizeof(T) == 1U)
+      {
+        memset(first, static_cast<uint8_t>(value), size_t(last - first));
+        return;
+      }
+
+#if ETL_ALGORITHM_SIMD_VECTOR_BYTES > 0
+      typedef vector_ops<T> ops;
+
+      const typename ops::vector_type pattern = ops::broadcast(value);
+
+      while (size_t(last - first) >= ops::Lanes)
+      {
+        ops::store(first, pattern);
+        first += ops::Lanes;
+      }
+#endif
+
+      while (first != last)
+      {
+        *first = value;
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Clamps each value to [lowest, highest], as etl::clamp.
+    /// 'output' may equal 'input'.
+    //*************************************************************************
+    template <typename T>
+    void clamp(const T* input, T* output, size_t n, T lowest, T highest)
+    {
+#if ETL_ALGORITHM_SIMD_VECTOR_BYTES > 0
+      typedef vector_ops<T> ops;
+
+      const typename ops::vector_type vlowest  = ops::broadcast(lowest);
+      const typename ops::vector_type vhighest = ops::broadcast(highest);
+
+      while (n >= ops::Lanes)
+      {
+        const typename ops::vector_type v = ops::load(input);
+
+        ops::store(output, ops::select(v < vlowest, vlowest, ops::select(vhighest < v, vhighest, v)));
+
+        input += ops::Lanes;
+        output += ops::Lanes;
+        n -= ops::Lanes;
+      }
+#endif
+
+      while (n != 0U)
+      {
+        const T value = *input++;
+        *output++     = (value < lowest) ? lowest : ((highest < value) ? highest : value);
+        --n;
+      }
+    }
+
+    //*************************************************************************
+    /// Replaces each value with 'true_value' if it is less than
+    /// 'threshold_value', otherwise with 'false_value'.
+    /// 'output' may equal 'input'.
+    //*************************************************************************
+    template <typename T>
+    void threshold(const T* input, T* output, size_t n, T threshold_value, T true_value, T false_value)
+    {
+#if ETL_ALGORITHM_SIMD_VECTOR_BYTES > 0
+      typedef vector_ops<T> ops;
+
+      const typename ops::vector_type vthreshold = ops::broadcast(threshold_value);
+      const typename ops::vector_type vtrue      = ops::broadcast(true_value);
+      const typename ops::vector_type vfalse     = ops::broadcast(false_value);
+
+      while (n >= ops::Lanes)
+      {
+        ops::store(output, ops::select(ops::load(input) < vthreshold, vtrue, vfalse));
+
+        input += ops::Lanes;
+        output += ops::Lanes;
+        n -= ops::Lanes;
+      }
+#endif
+
+      while (n != 0U)
+      {
+        const T value = *input++;
+        *output++     = (value < threshold_value) ? true_value : false_value;
+        --n;
+      }
+    }
+
+    //*************************************************************************
+    /// Replaces each value with quantizations[i], where i is the first index
+    /// for which the value is less than thresholds[i], or with
+    /// quantizations[n_levels] if there is none.
+    /// The vector path tests every threshold, last to first, without branches.
+    /// 'output' may equal 'input'.
+    //*************************************************************************
+    template <typename T>
+    void quantize(const T* input, T* output, size_t n, const T* thresholds, const T* quantizations, size_t n_levels)
+    {
+#if ETL_ALGORITHM_SIMD_VECTOR_BYTES > 0
+      typedef vector_ops<T> ops;
+
+      const typename ops::vector_type vlast = ops::broadcast(quantizations[n_levels]);
+
+      while (n >= ops::Lanes)
+      {
+        const typename ops::vector_type v      = ops::load(input);
+        typename ops::vector_type       result = vlast;
+
+        for (size_t i = n_levels; i-- != 0U;)
+        {
+          result = ops::select(v < ops::broadcast(thresholds[i]), ops::broadcast(quantizations[i]), result);
+        }
+
+        ops::store(output, result);
+
+        input += ops::Lanes;
+        output += ops::Lanes;
+        n -= ops::Lanes;
+      }
+#endif
+
+      while (n != 0U)
+      {
+        const T value = *input++;
+        size_t  i     = 0U;
+
+        while ((i < n_levels) && !(value < thresholds[i]))
+        {
+          ++i;
+        }
+
+        *output++ = quantizations[i];
+        --n;
+      }
+    }
+
+    //*************************************************************************
+    /// The type of 'value - minimum' for a TInput value, after promotion.
+    //*************************************************************************
+    template <typename TInput>
+    struct promoted_difference
+    {
+      typedef typename etl::conditional<etl::is_integral<TInput>::value && (sizeof(TInput) < sizeof(int)), int, TInput>::type type;
+    };
+
+    //*************************************************************************
+    /// Computes 'TOutput((value - input_minimum) * multiplier) + output_minimum'
+    /// for each value, with the same rounding as the scalar expression.
+    /// The vector path converts the lanes to double.
+    //*************************************************************************
+    template <typename TInput, typename TOutput>
+    void rescale(const TInput* input, TOutput* output, size_t n, TInput input_minimum, double multiplier, TOutput output_minimum)
+    {
+      typedef typename promoted_difference<TInput>::type difference_type;
+
+#if (ETL_ALGORITHM_SIMD_VECTOR_BYTES > 0) && (ETL_ALGORITHM_SIMD_HAS_CONVERT == 1)
+      static ETL_CONSTANT size_t Lanes = ETL_ALGORITHM_SIMD_VECTOR_BYTES / sizeof(double);
+
+      typedef TInput          input_vector_type __attribute__((vector_size(Lanes * sizeof(TInput))));
+      typedef difference_type difference_vector_type __attribute__((vector_size(Lanes * sizeof(difference_type))));
+      typedef double          double_vector_type __attribute__((vector_size(Lanes * sizeof(double))));
+      typedef TOutput         output_vector_type __attribute__((vector_size(Lanes * sizeof(TOutput))));
+
+      difference_vector_type vinput_minimum;
+      double_vector_type     vmultiplier;
+      output_vector_type     voutput_minimum;
+
+      for (size_t i = 0U; i < Lanes; ++i)
+      {
+        vinput_minimum[i]  = difference_type(input_minimum);
+        vmultiplier[i]     = multiplier;
+        voutput_minimum[i] = output_minimum;
+      }
+
+      while (n >= Lanes)
+      {
+        input_vector_type v;
+        memcpy(&v, input, sizeof(v));
+
+        const difference_vector_type difference = __builtin_convertvector(v, difference_vector_type) - vinput_minimum;
+        const double_vector_type     scaled     = __builtin_convertvector(difference, double_vector_type) * vmultiplier;
+        const output_vector_type     result     = __builtin_convertvector(scaled, output_vector_type) + voutput_minimum;
+
+        memcpy(output, &result, sizeof(result));
+
+        input += Lanes;
+        output += Lanes;
+        n -= Lanes;
+      }
+#endif
+
+      while (n != 0U)
+      {
+        *output++ = TOutput(TOutput(difference_type(*input++ - input_minimum) * multiplier) + output_minimum);
+        --n;
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the sum of 'a[i] * b[i]' for floating point lanes.
+    /// The vector path keeps a partial sum per lane, so the rounding may
+    /// differ from a sequential sum.
+    //*************************************************************************
+    template <typename T>
+    T dot(const T* a, const T* b, size_t n)
+    {
+      T sum = T(0);
+
+#if ETL_ALGORITHM_SIMD_VECTOR_BYTES > 0
+      typedef vector_ops<T> ops;
+
+      if (n >= ops::Lanes)
+      {
+        typename ops::vector_type partial = ops::broadcast(T(0));
+
+        while (n >= ops::Lanes)
+        {
+          partial += ops::load(a) * ops::load(b);
+
+          a += ops::Lanes;
+          b += ops::Lanes;
+          n -= ops::Lanes;
+        }
+
+        for (size_t i = 0U; i < ops::Lanes; ++i)
+        {
+          sum += partial[i];
+        }
+      }
+#endif
+
+      while (n != 0U)
+      {
+        sum += *a++ * *b++;
+        --n;
+      }
+
+      return sum;
+    }
+
+    //*************************************************************************
+    /// Reverses the bytes of each of the 'n' elements of Size bytes at 'data'.
+    /// 'data' need not be aligned.
+    //*************************************************************************
+    template <size_t Size>
+    void reverse_bytes_each(unsigned char* data, size_t n)
+    {
+      typedef typename unsigned_lane<Size>::type lane_type;
+
+      // Swap adjacent bytes, then adjacent byte pairs, then adjacent quads.
+      // The mask for each step selects the low half of every pair of units.
+#if ETL_ALGORITHM_SIMD_VECTOR_BYTES > 0
+      typedef vector_ops<lane_type> ops;
+
+      while (n >= ops::Lanes)
+      {
+        typename ops::vector_type v;
+        memcpy(&v, data, sizeof(v));
+
+        for (size_t shift = 8U; shift < (Size * 8U); shift *= 2U)
+        {
+          const lane_type                 lane_mask = static_cast<lane_type>(static_cast<lane_type>(~lane_type(0)) / ((lane_type(1) << shift) + 1U));
+          const typename ops::vector_type mask      = ops::broadcast(lane_mask);
+
+          v = ((v >> shift) & mask) | ((v & mask) << shift);
+        }
+
+        memcpy(data, &v, sizeof(v));
+        data += sizeof(v);
+        n -= ops::Lanes;
+      }
+#endif
+
+      while (n != 0U)
+      {
+        lane_type value;
+        memcpy(&value, data, Size);
+
+        for (size_t shift = 8U; shift < (Size * 8U); shift *= 2U)
+        {
+          const lane_type mask = static_cast<lane_type>(static_cast<lane_type>(~lane_type(0)) / ((lane_type(1) << shift) + 1U));
+
+          value = static_cast<lane_type>(((value >> shift) & mask) | ((value & mask) << shift));
+        }
+
+        memcpy(data, &value, Size);
+
+        data += Size;
+        --n;
+      }
+    }
+  } // namespace private_algorithm_simd
+} // namespace etl
+
+#include "diagnostic_pop.h"
+
+#endif
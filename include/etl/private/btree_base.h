@@ -0,0 +1,1840 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_BASE_INCLUDED
+#define ETL_BTREE_BASE_INCLUDED
+
+#include "../platform.h"
+#include "../alignment.h"
+#include "../debug_count.h"
+#include "../error_handler.h"
+#include "../exception.h"
+#include "../file_error_numbers.h"
+#include "../functional.h"
+#include "../integral_limits.h"
+#include "../iterator.h"
+#include "../nullptr.h"
+#include "../placement_new.h"
+#include "../pool.h"
+#include "../static_assert.h"
+#include "../type_traits.h"
+#include "../utility.h"
+
+#include <stddef.h>
+
+#include "minmax_push.h"
+
+//*****************************************************************************
+/// The number of bytes of keys that a default sized node holds.
+//*****************************************************************************
+#if !defined(ETL_BTREE_CACHE_LINE_SIZE)
+  #define ETL_BTREE_CACHE_LINE_SIZE 64
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the B+ trees.
+  ///\ingroup btree
+  //***************************************************************************
+  class btree_exception : public etl::exception
+  {
+  public:
+
+    btree_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the B+ trees.
+  ///\ingroup btree
+  //***************************************************************************
+  class btree_full : public etl::btree_exception
+  {
+  public:
+
+    btree_full(string_type file_name_, numeric_type line_number_)
+      : etl::btree_exception(ETL_ERROR_TEXT("btree:full", ETL_BTREE_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the B+ trees.
+  ///\ingroup btree
+  //***************************************************************************
+  class btree_out_of_bounds : public etl::btree_exception
+  {
+  public:
+
+    btree_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::btree_exception(ETL_ERROR_TEXT("btree:bounds", ETL_BTREE_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_btree
+  {
+    //*************************************************************************
+    /// The default fanout fits a node's keys in one cache line, with no fewer
+    /// than 4 and no more than 64 per node.
+    //*************************************************************************
+    template <typename TKey>
+    struct default_fanout
+    {
+      static ETL_CONSTANT size_t Keys  = ETL_BTREE_CACHE_LINE_SIZE / sizeof(TKey);
+      static ETL_CONSTANT size_t value = (Keys < 4U) ? 4U : ((Keys > 64U) ? 64U : Keys);
+    };
+
+    template <typename TKey>
+    ETL_CONSTANT size_t default_fanout<TKey>::Keys;
+
+    template <typename TKey>
+    ETL_CONSTANT size_t default_fanout<TKey>::value;
+
+    //*************************************************************************
+    /// The most leaves that Size values can occupy.
+    /// Every leaf apart from a lone root is at least half full.
+    //*************************************************************************
+    template <size_t Size, size_t Fanout>
+    struct leaf_nodes
+    {
+      static ETL_CONSTANT size_t value = (Size / (Fanout / 2U)) + 1U;
+    };
+
+    template <size_t Size, size_t Fanout>
+    ETL_CONSTANT size_t leaf_nodes<Size, Fanout>::value;
+
+    //*************************************************************************
+    /// The most internal nodes above Count children, when every node apart
+    /// from the root has at least Minimum children.
+    //*************************************************************************
+    template <size_t Count, size_t Minimum>
+    struct internal_nodes_above
+    {
+      static ETL_CONSTANT size_t Parents = (Count + Minimum - 1U) / Minimum;
+      static ETL_CONSTANT size_t value   = Parents + internal_nodes_above<Parents, Minimum>::value;
+    };
+
+    template <size_t Minimum>
+    struct internal_nodes_above<1U, Minimum>
+    {
+      static ETL_CONSTANT size_t value = 0U;
+    };
+
+    template <size_t Minimum>
+    struct internal_nodes_above<0U, Minimum>
+    {
+      static ETL_CONSTANT size_t value = 0U;
+    };
+
+    //*************************************************************************
+    /// The size of the internal node pool. Never zero.
+    //*************************************************************************
+    template <size_t Size, size_t Fanout>
+    struct internal_nodes
+    {
+      static ETL_CONSTANT size_t Count = internal_nodes_above<leaf_nodes<Size, Fanout>::value, Fanout / 2U>::value;
+      static ETL_CONSTANT size_t value = (Count == 0U) ? 1U : Count;
+    };
+
+    template <size_t Size, size_t Fanout>
+    ETL_CONSTANT size_t internal_nodes<Size, Fanout>::value;
+
+    //*************************************************************************
+    /// Gets the key of a map value.
+    //*************************************************************************
+    template <typename TKey, typename TValue>
+    struct select_first
+    {
+      static const TKey& key(const TValue& value)
+      {
+        return value.first;
+      }
+    };
+
+    //*************************************************************************
+    /// Gets the key of a set value.
+    //*************************************************************************
+    template <typename TKey>
+    struct select_self
+    {
+      static const TKey& key(const TKey& value)
+      {
+        return value;
+      }
+    };
+  } // namespace private_btree
+
+  //***************************************************************************
+  /// The base class for all B+ trees.
+  ///\ingroup btree
+  //***************************************************************************
+  class btree_base
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// Gets the number of values.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible number of values.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the tree is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the tree is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return max_size() - size();
+    }
+
+    //*************************************************************************
+    /// Returns the number of levels of internal nodes above the leaves.
+    //*************************************************************************
+    size_type height() const
+    {
+      return tree_height;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit btree_base(size_type max_size_)
+      : current_size(0U)
+      , CAPACITY(max_size_)
+      , tree_height(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_base() {}
+
+    size_type       current_size; ///< The number of values.
+    const size_type CAPACITY;     ///< The maximum number of values.
+    size_type       tree_height;  ///< The number of internal levels.
+    ETL_DECLARE_DEBUG_COUNT;
+  };
+
+  //***************************************************************************
+  /// A B+ tree of unique keys.
+  /// Values are held in leaves of up to Fanout values that are linked in key
+  /// order. Internal nodes hold up to Fanout - 1 keys in a contiguous array
+  /// that is searched linearly, and branch free, for arithmetic keys.
+  /// Inserting or erasing invalidates all iterators.
+  ///\ingroup btree
+  //***************************************************************************
+  template <typename TKey, typename TValue, typename TKeyOf, const size_t Fanout, typename TKeyCompare>
+  class ibtree : public etl::btree_base
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Fanout >= 4U, "Fanout must be at least 4");
+
+    typedef TKey              key_type;
+    typedef TValue            value_type;
+    typedef TKeyCompare       key_compare;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&& rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+    typedef const key_type&   const_key_reference;
+
+    static ETL_CONSTANT size_t FANOUT = Fanout;
+
+  protected:
+
+    static ETL_CONSTANT size_t Min_Leaf     = Fanout / 2U;
+    static ETL_CONSTANT size_t Min_Children = Fanout / 2U;
+
+    //*************************************************************************
+    /// A leaf. The spare slot holds the extra value before a split.
+    //*************************************************************************
+    struct leaf_node
+    {
+      leaf_node()
+        : count(0U)
+        , previous(ETL_NULLPTR)
+        , next(ETL_NULLPTR)
+      {
+      }
+
+      value_type* values()
+      {
+        return reinterpret_cast<value_type*>(&storage);
+      }
+
+      const value_type* values() const
+      {
+        return reinterpret_cast<const value_type*>(&storage);
+      }
+
+      size_t     count;
+      leaf_node* previous;
+      leaf_node* next;
+
+      typename etl::aligned_storage_as<sizeof(value_type) * (Fanout + 1U), value_type>::type storage;
+    };
+
+    //*************************************************************************
+    /// An internal node with count keys and count + 1 children.
+    /// The spare key and child hold the extra entry before a split.
+    //*************************************************************************
+    struct internal_node
+    {
+      internal_node()
+        : count(0U)
+      {
+      }
+
+      key_type* keys()
+      {
+        return reinterpret_cast<key_type*>(&storage);
+      }
+
+      const key_type* keys() const
+      {
+        return reinterpret_cast<const key_type*>(&storage);
+      }
+
+      size_t count;
+
+      typename etl::aligned_storage_as<sizeof(key_type) * Fanout, key_type>::type storage;
+
+      void* children[Fanout + 1U];
+    };
+
+  public:
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type>
+    {
+    public:
+
+      friend class ibtree;
+      friend class const_iterator;
+
+      iterator()
+        : p_tree(ETL_NULLPTR)
+        , p_leaf(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      iterator(ibtree& tree, leaf_node* p_leaf_, size_t index_)
+        : p_tree(&tree)
+        , p_leaf(p_leaf_)
+        , index(index_)
+      {
+      }
+
+      iterator& operator++()
+      {
+        if (++index == p_leaf->count)
+        {
+          p_leaf = p_leaf->next;
+          index  = 0U;
+        }
+
+        return *this;
+      }
+
+      iterator operator++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      iterator& operator--()
+      {
+        if (p_leaf == ETL_NULLPTR)
+        {
+          p_leaf = p_tree->p_last;
+          index  = p_leaf->count;
+        }
+        else if (index == 0U)
+        {
+          p_leaf = p_leaf->previous;
+          index  = p_leaf->count;
+        }
+
+        --index;
+
+        return *this;
+      }
+
+      iterator operator--(int)
+      {
+        iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      reference operator*() const
+      {
+        return p_leaf->values()[index];
+      }
+
+      pointer operator&() const
+      {
+        return &(p_leaf->values()[index]);
+      }
+
+      pointer operator->() const
+      {
+        return &(p_leaf->values()[index]);
+      }
+
+      friend bool operator==(const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.p_leaf == rhs.p_leaf) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator!=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      ibtree*    p_tree;
+      leaf_node* p_leaf;
+      size_t     index;
+    };
+
+    //*************************************************************************
+    /// const_iterator.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class ibtree;
+
+      const_iterator()
+        : p_tree(ETL_NULLPTR)
+        , p_leaf(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      const_iterator(const ibtree& tree, const leaf_node* p_leaf_, size_t index_)
+        : p_tree(&tree)
+        , p_leaf(p_leaf_)
+        , index(index_)
+      {
+      }
+
+      const_iterator(const typename ibtree::iterator& other)
+        : p_tree(other.p_tree)
+        , p_leaf(other.p_leaf)
+        , index(other.index)
+      {
+      }
+
+      const_iterator& operator++()
+      {
+        if (++index == p_leaf->count)
+        {
+          p_leaf = p_leaf->next;
+          index  = 0U;
+        }
+
+        return *this;
+      }
+
+      const_iterator operator++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const_iterator& operator--()
+      {
+        if (p_leaf == ETL_NULLPTR)
+        {
+          p_leaf = p_tree->p_last;
+          index  = p_leaf->count;
+        }
+        else if (index == 0U)
+        {
+          p_leaf = p_leaf->previous;
+          index  = p_leaf->count;
+        }
+
+        --index;
+
+        return *this;
+      }
+
+      const_iterator operator--(int)
+      {
+        const_iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      const_reference operator*() const
+      {
+        return p_leaf->values()[index];
+      }
+
+      const_pointer operator&() const
+      {
+        return &(p_leaf->values()[index]);
+      }
+
+      const_pointer operator->() const
+      {
+        return &(p_leaf->values()[index]);
+      }
+
+      friend bool operator==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.p_leaf == rhs.p_leaf) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const ibtree*    p_tree;
+      const leaf_node* p_leaf;
+      size_t           index;
+    };
+
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Gets the beginning of the tree.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(*this, p_first, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the tree.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(*this, p_first, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the tree.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(*this, ETL_NULLPTR, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the tree.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(*this, ETL_NULLPTR, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the tree.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(*this, p_first, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the tree.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(*this, ETL_NULLPTR, 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the tree.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the tree.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the tree.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the tree.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the tree.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the tree.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Assigns values to the tree.
+    /// A range that is sorted by strictly increasing key is bulk loaded in
+    /// O(n) into packed leaves. Otherwise the values are inserted one at a time.
+    /// If asserts or exceptions are enabled, emits btree_full if the tree does
+    /// not have enough free space.
+    //*************************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+
+      if (is_strictly_increasing(first, last))
+      {
+        bulk_load(first, last);
+      }
+      else
+      {
+        insert(first, last);
+      }
+    }
+
+    //*************************************************************************
+    /// Clears the tree.
+    //*************************************************************************
+    void clear()
+    {
+      if (p_root != ETL_NULLPTR)
+      {
+        release_subtree(p_root, tree_height);
+      }
+
+      p_root       = ETL_NULLPTR;
+      p_first      = ETL_NULLPTR;
+      p_last       = ETL_NULLPTR;
+      tree_height  = 0U;
+      current_size = 0U;
+      ETL_RESET_DEBUG_COUNT;
+    }
+
+    //*************************************************************************
+    /// Counts the number of values with the key.
+    ///\return 1 if found, otherwise 0.
+    //*************************************************************************
+    size_type count(const_key_reference key) const
+    {
+      return (find(key) == end()) ? 0U : 1U;
+    }
+
+    //*************************************************************************
+    /// Checks if the tree contains the key.
+    //*************************************************************************
+    bool contains(const_key_reference key) const
+    {
+      return find(key) != end();
+    }
+
+    //*************************************************************************
+    /// Finds a value.
+    ///\return An iterator to the value, or end() if not found.
+    //*************************************************************************
+    iterator find(const_key_reference key)
+    {
+      if (p_root != ETL_NULLPTR)
+      {
+        leaf_node*   p_leaf = descend(key, ETL_NULLPTR);
+        const size_t index  = leaf_lower_index(*p_leaf, key);
+
+        if ((index < p_leaf->count) && !kcompare(key, TKeyOf::key(p_leaf->values()[index])))
+        {
+          return iterator(*this, p_leaf, index);
+        }
+      }
+
+      return end();
+    }
+
+    //*************************************************************************
+    /// Finds a value.
+    ///\return An iterator to the value, or end() if not found.
+    //*************************************************************************
+    const_iterator find(const_key_reference key) const
+    {
+      return const_cast<ibtree*>(this)->find(key);
+    }
+
+    //*************************************************************************
+    /// Finds the first value with a key not less than the key.
+    //*************************************************************************
+    iterator lower_bound(const_key_reference key)
+    {
+      if (p_root == ETL_NULLPTR)
+      {
+        return end();
+      }
+
+      leaf_node* p_leaf = descend(key, ETL_NULLPTR);
+
+      return make_iterator(p_leaf, leaf_lower_index(*p_leaf, key));
+    }
+
+    //*************************************************************************
+    /// Finds the first value with a key not less than the key.
+    //*************************************************************************
+    const_iterator lower_bound(const_key_reference key) const
+    {
+      return const_cast<ibtree*>(this)->lower_bound(key);
+    }
+
+    //*************************************************************************
+    /// Finds the first value with a key greater than the key.
+    //*************************************************************************
+    iterator upper_bound(const_key_reference key)
+    {
+      if (p_root == ETL_NULLPTR)
+      {
+        return end();
+      }
+
+      leaf_node* p_leaf = descend(key, ETL_NULLPTR);
+
+      return make_iterator(p_leaf, leaf_upper_index(*p_leaf, key));
+    }
+
+    //*************************************************************************
+    /// Finds the first value with a key greater than the key.
+    //*************************************************************************
+    const_iterator upper_bound(const_key_reference key) const
+    {
+      return const_cast<ibtree*>(this)->upper_bound(key);
+    }
+
+    //*************************************************************************
+    /// Finds the range of values with the key.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const_key_reference key)
+    {
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Finds the range of values with the key.
+    //*************************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    {
+      return ETL_OR_STD::make_pair(lower_bound(key), upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Inserts a value, if its key is not already in the tree.
+    /// If asserts or exceptions are enabled, emits btree_full if the tree is
+    /// already full.
+    ///\return The position of the value with the key, and true if inserted.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      path_t     path;
+      leaf_node* p_leaf = ETL_NULLPTR;
+      size_t     index  = 0U;
+
+      if (locate(TKeyOf::key(value), path, p_leaf, index))
+      {
+        return ETL_OR_STD::make_pair(iterator(*this, p_leaf, index), false);
+      }
+
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(btree_full));
+        return ETL_OR_STD::make_pair(end(), false);
+      }
+
+      make_room(*p_leaf, index);
+      ::new (p_leaf->values() + index) value_type(value);
+
+      return ETL_OR_STD::make_pair(complete_insert(path, p_leaf, index), true);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Inserts a value, if its key is not already in the tree.
+    /// If asserts or exceptions are enabled, emits btree_full if the tree is
+    /// already full.
+    ///\return The position of the value with the key, and true if inserted.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      path_t     path;
+      leaf_node* p_leaf = ETL_NULLPTR;
+      size_t     index  = 0U;
+
+      if (locate(TKeyOf::key(value), path, p_leaf, index))
+      {
+        return ETL_OR_STD::make_pair(iterator(*this, p_leaf, index), false);
+      }
+
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(btree_full));
+        return ETL_OR_STD::make_pair(end(), false);
+      }
+
+      make_room(*p_leaf, index);
+      ::new (p_leaf->values() + index) value_type(etl::move(value));
+
+      return ETL_OR_STD::make_pair(complete_insert(path, p_leaf, index), true);
+    }
+#endif
+
+    //*************************************************************************
+    /// Inserts a range of values.
+    /// If asserts or exceptions are enabled, emits btree_full if the tree does
+    /// not have enough free space.
+    //*************************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Erases the value with the key.
+    ///\return The number of values erased, 0 or 1.
+    //*************************************************************************
+    size_type erase(const_key_reference key)
+    {
+      path_t     path;
+      leaf_node* p_leaf = ETL_NULLPTR;
+      size_t     index  = 0U;
+
+      if (!locate(key, path, p_leaf, index))
+      {
+        return 0U;
+      }
+
+      erase_at(path, *p_leaf, index);
+
+      return 1U;
+    }
+
+    //*************************************************************************
+    /// Erases the value at the position.
+    ///\return An iterator to the value after the one erased.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      leaf_node*   p_leaf = const_cast<leaf_node*>(position.p_leaf);
+      const size_t index  = position.index;
+
+      if ((tree_height == 0U) || (p_leaf->count > Min_Leaf))
+      {
+        // The leaf will not need rebalancing, so the next value stays put.
+        path_t path;
+        erase_at(path, *p_leaf, index);
+
+        return (p_root == ETL_NULLPTR) ? end() : make_iterator(p_leaf, index);
+      }
+      else
+      {
+        // Values may move between leaves. Find the next one again afterwards.
+        const key_type key(TKeyOf::key(p_leaf->values()[index]));
+
+        erase(key);
+
+        return lower_bound(key);
+      }
+    }
+
+    //*************************************************************************
+    /// Erases the values in the range.
+    ///\return An iterator to the value after the last one erased.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      if ((first == cbegin()) && (last == cend()))
+      {
+        clear();
+        return end();
+      }
+
+      if (last == cend())
+      {
+        while (first != cend())
+        {
+          first = erase(first);
+        }
+
+        return end();
+      }
+
+      // Erasing may move the value at last.
+      const key_type last_key(TKeyOf::key(*last));
+
+      iterator position = lower_bound(TKeyOf::key(*first));
+
+      while (kcompare(TKeyOf::key(*position), last_key))
+      {
+        position = erase(position);
+      }
+
+      return position;
+    }
+
+    //*************************************************************************
+    /// Gets the key comparison function.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return kcompare;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ibtree(etl::ipool& leaf_pool, etl::ipool& internal_pool, size_t max_size_)
+      : etl::btree_base(max_size_)
+      , p_leaf_pool(&leaf_pool)
+      , p_internal_pool(&internal_pool)
+      , p_root(ETL_NULLPTR)
+      , p_first(ETL_NULLPTR)
+      , p_last(ETL_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Initialise the tree.
+    //*************************************************************************
+    void initialise()
+    {
+      clear();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The internal nodes visited on the way down, with the child index taken
+    /// from each. Every internal node has at least two children, so the
+    /// height cannot exceed the number of bits in size_t.
+    //*************************************************************************
+    struct path_t
+    {
+      internal_node* nodes[etl::integral_limits<size_t>::bits];
+      size_t         indices[etl::integral_limits<size_t>::bits];
+    };
+
+    typedef etl::integral_constant<bool, etl::is_arithmetic<key_type>::value || etl::is_pointer<key_type>::value> use_linear_search;
+
+    //*************************************************************************
+    /// The number of keys less than or equal to the key.
+    /// Arithmetic keys are counted without branches.
+    //*************************************************************************
+    size_t child_index(const internal_node& node, const_key_reference key) const
+    {
+      return child_index(node, key, use_linear_search());
+    }
+
+    size_t child_index(const internal_node& node, const_key_reference key, etl::true_type) const
+    {
+      const key_type* keys   = node.keys();
+      size_t          result = 0U;
+
+      for (size_t i = 0U; i < node.count; ++i)
+      {
+        result += kcompare(key, keys[i]) ? 0U : 1U;
+      }
+
+      return result;
+    }
+
+    size_t child_index(const internal_node& node, const_key_reference key, etl::false_type) const
+    {
+      const key_type* keys = node.keys();
+      size_t          low  = 0U;
+      size_t          high = node.count;
+
+      while (low < high)
+      {
+        const size_t middle = low + ((high - low) / 2U);
+
+        if (kcompare(key, keys[middle]))
+        {
+          high = middle;
+        }
+        else
+        {
+          low = middle + 1U;
+        }
+      }
+
+      return low;
+    }
+
+    //*************************************************************************
+    /// The number of values in the leaf with a key less than the key.
+    //*************************************************************************
+    size_t leaf_lower_index(const leaf_node& leaf, const_key_reference key) const
+    {
+      return leaf_lower_index(leaf, key, use_linear_search());
+    }
+
+    size_t leaf_lower_index(const leaf_node& leaf, const_key_reference key, etl::true_type) const
+    {
+      const value_type* values = leaf.values();
+      size_t            result = 0U;
+
+      for (size_t i = 0U; i < leaf.count; ++i)
+      {
+        result += kcompare(TKeyOf::key(values[i]), key) ? 1U : 0U;
+      }
+
+      return result;
+    }
+
+    size_t leaf_lower_index(const leaf_node& leaf, const_key_reference key, etl::false_type) const
+    {
+      const value_type* values = leaf.values();
+      size_t            low    = 0U;
+      size_t            high   = leaf.count;
+
+      while (low < high)
+      {
+        const size_t middle = low + ((high - low) / 2U);
+
+        if (kcompare(TKeyOf::key(values[middle]), key))
+        {
+          low = middle + 1U;
+        }
+        else
+        {
+          high = middle;
+        }
+      }
+
+      return low;
+    }
+
+    //*************************************************************************
+    /// The number of values in the leaf with a key not greater than the key.
+    //*************************************************************************
+    size_t leaf_upper_index(const leaf_node& leaf, const_key_reference key) const
+    {
+      const size_t index = leaf_lower_index(leaf, key);
+
+      return ((index < leaf.count) && !kcompare(key, TKeyOf::key(leaf.values()[index]))) ? index + 1U : index;
+    }
+
+    //*************************************************************************
+    /// Follows the key down to a leaf, optionally recording the path.
+    //*************************************************************************
+    leaf_node* descend(const_key_reference key, path_t* p_path) const
+    {
+      void* p_node = p_root;
+
+      for (size_t level = 0U; level < tree_height; ++level)
+      {
+        internal_node* p_internal = static_cast<internal_node*>(p_node);
+        const size_t   index      = child_index(*p_internal, key);
+
+        if (p_path != ETL_NULLPTR)
+        {
+          p_path->nodes[level]   = p_internal;
+          p_path->indices[level] = index;
+        }
+
+        p_node = p_internal->children[index];
+      }
+
+      return static_cast<leaf_node*>(p_node);
+    }
+
+    //*************************************************************************
+    /// Finds where the key is, or would be inserted.
+    /// Creates the root leaf if the tree is empty.
+    ///\return true if the key was found.
+    //*************************************************************************
+    bool locate(const_key_reference key, path_t& path, leaf_node*& p_leaf, size_t& index)
+    {
+      if (p_root == ETL_NULLPTR)
+      {
+        p_leaf  = create_leaf();
+        p_root  = p_leaf;
+        p_first = p_leaf;
+        p_last  = p_leaf;
+        index   = 0U;
+
+        return false;
+      }
+
+      p_leaf = descend(key, &path);
+      index  = leaf_lower_index(*p_leaf, key);
+
+      return (index < p_leaf->count) && !kcompare(key, TKeyOf::key(p_leaf->values()[index]));
+    }
+
+    //*************************************************************************
+    /// An iterator to the index in the leaf, moving on to the next leaf if the
+    /// index is at the end.
+    //*************************************************************************
+    iterator make_iterator(leaf_node* p_leaf, size_t index)
+    {
+      if (index < p_leaf->count)
+      {
+        return iterator(*this, p_leaf, index);
+      }
+
+      return iterator(*this, p_leaf->next, 0U);
+    }
+
+    //*************************************************************************
+    /// Moves an object to uninitialised memory, destroying the original.
+    //*************************************************************************
+    template <typename T>
+    static void relocate(T* p_destination, T* p_source)
+    {
+      ::new (p_destination) T(ETL_MOVE(*p_source));
+      p_source->~T();
+    }
+
+    //*************************************************************************
+    /// Moves n objects to uninitialised memory, first to last.
+    //*************************************************************************
+    template <typename T>
+    static void relocate_forward(T* p_destination, T* p_source, size_t n)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        relocate(p_destination + i, p_source + i);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves n objects up by one, last to first.
+    //*************************************************************************
+    template <typename T>
+    static void shift_up(T* p, size_t n)
+    {
+      for (size_t i = n; i != 0U; --i)
+      {
+        relocate(p + i, p + i - 1U);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves n child pointers down or up by one.
+    //*************************************************************************
+    static void move_children(void** p_destination, void** p_source, size_t n)
+    {
+      if (p_destination < p_source)
+      {
+        for (size_t i = 0U; i < n; ++i)
+        {
+          p_destination[i] = p_source[i];
+        }
+      }
+      else
+      {
+        for (size_t i = n; i != 0U; --i)
+        {
+          p_destination[i - 1U] = p_source[i - 1U];
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Opens a gap at the index in the leaf.
+    //*************************************************************************
+    static void make_room(leaf_node& leaf, size_t index)
+    {
+      shift_up(leaf.values() + index, leaf.count - index);
+      ++leaf.count;
+    }
+
+    //*************************************************************************
+    /// Creates an empty leaf.
+    //*************************************************************************
+    leaf_node* create_leaf()
+    {
+      return p_leaf_pool->template create<leaf_node>();
+    }
+
+    //*************************************************************************
+    /// Creates an empty internal node.
+    //*************************************************************************
+    internal_node* create_internal()
+    {
+      return p_internal_pool->template create<internal_node>();
+    }
+
+    //*************************************************************************
+    /// Splits the leaf if the new value overfilled it.
+    ///\return The position of the new value.
+    //*************************************************************************
+    iterator complete_insert(path_t& path, leaf_node* p_leaf, size_t index)
+    {
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      if (p_leaf->count <= Fanout)
+      {
+        return iterator(*this, p_leaf, index);
+      }
+
+      const size_t left_count  = (Fanout + 1U) / 2U;
+      const size_t right_count = (Fanout + 1U) - left_count;
+
+      leaf_node* p_right = create_leaf();
+
+      relocate_forward(p_right->values(), p_leaf->values() + left_count, right_count);
+      p_leaf->count  = left_count;
+      p_right->count = right_count;
+
+      p_right->previous = p_leaf;
+      p_right->next     = p_leaf->next;
+
+      if (p_leaf->next != ETL_NULLPTR)
+      {
+        p_leaf->next->previous = p_right;
+      }
+      else
+      {
+        p_last = p_right;
+      }
+
+      p_leaf->next = p_right;
+
+      insert_child(path, tree_height, TKeyOf::key(p_right->values()[0]), p_right);
+
+      return (index < left_count) ? iterator(*this, p_leaf, index) : iterator(*this, p_right, index - left_count);
+    }
+
+    //*************************************************************************
+    /// Adds a child to the right of the node at the level that was split,
+    /// splitting the parents as required.
+    //*************************************************************************
+    void insert_child(path_t& path, size_t level, const_key_reference separator, void* p_child)
+    {
+      if (level == 0U)
+      {
+        // The root was split.
+        internal_node* p_new_root = create_internal();
+
+        ::new (p_new_root->keys()) key_type(separator);
+        p_new_root->children[0] = p_root;
+        p_new_root->children[1] = p_child;
+        p_new_root->count       = 1U;
+
+        p_root = p_new_root;
+        ++tree_height;
+
+        return;
+      }
+
+      internal_node& node  = *path.nodes[level - 1U];
+      const size_t   index = path.indices[level - 1U];
+
+      shift_up(node.keys() + index, node.count - index);
+      ::new (node.keys() + index) key_type(separator);
+      move_children(node.children + index + 2U, node.children + index + 1U, node.count - index);
+      node.children[index + 1U] = p_child;
+      ++node.count;
+
+      if (node.count < Fanout)
+      {
+        return;
+      }
+
+      // Split into left_children and the rest, promoting the key between them.
+      const size_t left_children  = (Fanout + 1U) / 2U;
+      const size_t right_children = (Fanout + 1U) - left_children;
+
+      internal_node* p_right = create_internal();
+
+      relocate_forward(p_right->keys(), node.keys() + left_children, right_children - 1U);
+      move_children(p_right->children, node.children + left_children, right_children);
+      p_right->count = right_children - 1U;
+
+      key_type* p_middle = node.keys() + left_children - 1U;
+      const key_type middle(ETL_MOVE(*p_middle));
+      p_middle->~key_type();
+      node.count = left_children - 1U;
+
+      insert_child(path, level - 1U, middle, p_right);
+    }
+
+    //*************************************************************************
+    /// Removes the key at the index and the child to its right.
+    //*************************************************************************
+    static void remove_key_and_right_child(internal_node& node, size_t index)
+    {
+      key_type* keys = node.keys();
+
+      keys[index].~key_type();
+      relocate_forward(keys + index, keys + index + 1U, node.count - index - 1U);
+      move_children(node.children + index + 1U, node.children + index + 2U, node.count - index - 1U);
+      --node.count;
+    }
+
+    //*************************************************************************
+    /// Erases the value at the index of the leaf, then restores the minimum
+    /// occupancy of the leaf and its parents.
+    //*************************************************************************
+    void erase_at(path_t& path, leaf_node& leaf, size_t index)
+    {
+      value_type* values = leaf.values();
+
+      values[index].~value_type();
+      relocate_forward(values + index, values + index + 1U, leaf.count - index - 1U);
+      --leaf.count;
+      --current_size;
+      ETL_DECREMENT_DEBUG_COUNT;
+
+      if (tree_height == 0U)
+      {
+        if (leaf.count == 0U)
+        {
+          p_leaf_pool->release(&leaf);
+          p_root  = ETL_NULLPTR;
+          p_first = ETL_NULLPTR;
+          p_last  = ETL_NULLPTR;
+        }
+      }
+      else if (leaf.count < Min_Leaf)
+      {
+        rebalance_leaf(path, leaf);
+      }
+    }
+
+    //*************************************************************************
+    /// Refills an under full leaf from a neighbour, or merges with it.
+    //*************************************************************************
+    void rebalance_leaf(path_t& path, leaf_node& leaf)
+    {
+      internal_node& parent = *path.nodes[tree_height - 1U];
+      const size_t   index  = path.indices[tree_height - 1U];
+
+      leaf_node* p_left  = (index > 0U) ? static_cast<leaf_node*>(parent.children[index - 1U]) : ETL_NULLPTR;
+      leaf_node* p_right = (index < parent.count) ? static_cast<leaf_node*>(parent.children[index + 1U]) : ETL_NULLPTR;
+
+      if ((p_left != ETL_NULLPTR) && (p_left->count > Min_Leaf))
+      {
+        // Take the largest from the left.
+        make_room(leaf, 0U);
+        --p_left->count;
+        relocate(leaf.values(), p_left->values() + p_left->count);
+        parent.keys()[index - 1U] = TKeyOf::key(leaf.values()[0]);
+      }
+      else if ((p_right != ETL_NULLPTR) && (p_right->count > Min_Leaf))
+      {
+        // Take the smallest from the right.
+        relocate(leaf.values() + leaf.count, p_right->values());
+        ++leaf.count;
+        relocate_forward(p_right->values(), p_right->values() + 1U, p_right->count - 1U);
+        --p_right->count;
+        parent.keys()[index] = TKeyOf::key(p_right->values()[0]);
+      }
+      else
+      {
+        if (p_left != ETL_NULLPTR)
+        {
+          merge_leaves(*p_left, leaf);
+          remove_key_and_right_child(parent, index - 1U);
+        }
+        else
+        {
+          merge_leaves(leaf, *p_right);
+          remove_key_and_right_child(parent, index);
+        }
+
+        rebalance_internal(path, tree_height - 1U);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the values of the right leaf to the left and releases it.
+    //*************************************************************************
+    void merge_leaves(leaf_node& left, leaf_node& right)
+    {
+      relocate_forward(left.values() + left.count, right.values(), right.count);
+      left.count += right.count;
+
+      left.next = right.next;
+
+      if (right.next != ETL_NULLPTR)
+      {
+        right.next->previous = &left;
+      }
+      else
+      {
+        p_last = &left;
+      }
+
+      p_leaf_pool->release(&right);
+    }
+
+    //*************************************************************************
+    /// Restores the minimum occupancy of the internal node at the level and
+    /// its parents, shrinking the tree if the root is left with one child.
+    //*************************************************************************
+    void rebalance_internal(path_t& path, size_t level)
+    {
+      while (true)
+      {
+        internal_node& node = *path.nodes[level];
+
+        if (level == 0U)
+        {
+          if (node.count == 0U)
+          {
+            p_root = node.children[0];
+            p_internal_pool->release(&node);
+            --tree_height;
+          }
+
+          return;
+        }
+
+        if ((node.count + 1U) >= Min_Children)
+        {
+          return;
+        }
+
+        internal_node& parent = *path.nodes[level - 1U];
+        const size_t   index  = path.indices[level - 1U];
+
+        internal_node* p_left  = (index > 0U) ? static_cast<internal_node*>(parent.children[index - 1U]) : ETL_NULLPTR;
+        internal_node* p_right = (index < parent.count) ? static_cast<internal_node*>(parent.children[index + 1U]) : ETL_NULLPTR;
+
+        if ((p_left != ETL_NULLPTR) && ((p_left->count + 1U) > Min_Children))
+        {
+          // Rotate the last child of the left through the parent.
+          key_type* left_keys = p_left->keys();
+
+          shift_up(node.keys(), node.count);
+          ::new (node.keys()) key_type(ETL_MOVE(parent.keys()[index - 1U]));
+          move_children(node.children + 1U, node.children, node.count + 1U);
+          node.children[0] = p_left->children[p_left->count];
+          ++node.count;
+
+          parent.keys()[index - 1U] = ETL_MOVE(left_keys[p_left->count - 1U]);
+          left_keys[p_left->count - 1U].~key_type();
+          --p_left->count;
+
+          return;
+        }
+
+        if ((p_right != ETL_NULLPTR) && ((p_right->count + 1U) > Min_Children))
+        {
+          // Rotate the first child of the right through the parent.
+          key_type* right_keys = p_right->keys();
+
+          ::new (node.keys() + node.count) key_type(ETL_MOVE(parent.keys()[index]));
+          node.children[node.count + 1U] = p_right->children[0];
+          ++node.count;
+
+          parent.keys()[index] = ETL_MOVE(right_keys[0]);
+          right_keys[0].~key_type();
+          relocate_forward(right_keys, right_keys + 1U, p_right->count - 1U);
+          move_children(p_right->children, p_right->children + 1U, p_right->count);
+          --p_right->count;
+
+          return;
+        }
+
+        if (p_left != ETL_NULLPTR)
+        {
+          merge_internal(*p_left, parent.keys()[index - 1U], node);
+          remove_key_and_right_child(parent, index - 1U);
+        }
+        else
+        {
+          merge_internal(node, parent.keys()[index], *p_right);
+          remove_key_and_right_child(parent, index);
+        }
+
+        --level;
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the separator and the contents of the right node to the left and
+    /// releases it.
+    //*************************************************************************
+    void merge_internal(internal_node& left, const_key_reference separator, internal_node& right)
+    {
+      ::new (left.keys() + left.count) key_type(separator);
+      relocate_forward(left.keys() + left.count + 1U, right.keys(), right.count);
+      move_children(left.children + left.count + 1U, right.children, right.count + 1U);
+      left.count += right.count + 1U;
+
+      p_internal_pool->release(&right);
+    }
+
+    //*************************************************************************
+    /// Destroys the values and keys below the node and releases the nodes.
+    //*************************************************************************
+    void release_subtree(void* p_node, size_t level)
+    {
+      if (level == 0U)
+      {
+        leaf_node* p_leaf = static_cast<leaf_node*>(p_node);
+
+        for (size_t i = 0U; i < p_leaf->count; ++i)
+        {
+          p_leaf->values()[i].~value_type();
+        }
+
+        p_leaf_pool->release(p_leaf);
+      }
+      else
+      {
+        internal_node* p_internal = static_cast<internal_node*>(p_node);
+
+        for (size_t i = 0U; i <= p_internal->count; ++i)
+        {
+          release_subtree(p_internal->children[i], level - 1U);
+        }
+
+        for (size_t i = 0U; i < p_internal->count; ++i)
+        {
+          p_internal->keys()[i].~key_type();
+        }
+
+        p_internal_pool->release(p_internal);
+      }
+    }
+
+    //*************************************************************************
+    /// Checks that each key is greater than the one before.
+    //*************************************************************************
+    template <typename TIterator>
+    bool is_strictly_increasing(TIterator first, TIterator last) const
+    {
+      if (first == last)
+      {
+        return true;
+      }
+
+      TIterator previous = first;
+
+      while (++first != last)
+      {
+        if (!kcompare(TKeyOf::key(*previous), TKeyOf::key(*first)))
+        {
+          return false;
+        }
+
+        previous = first;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// The size of group i of n, when total items are split into groups of
+    /// maximum, with the last two sharing evenly if the last would be smaller
+    /// than minimum.
+    //*************************************************************************
+    static size_t group_size(size_t i, size_t n, size_t total, size_t maximum, size_t minimum)
+    {
+      const size_t last = total - ((n - 1U) * maximum);
+
+      if ((n > 1U) && (last < minimum))
+      {
+        if (i == (n - 2U))
+        {
+          return (maximum + last + 1U) / 2U;
+        }
+
+        if (i == (n - 1U))
+        {
+          return (maximum + last) / 2U;
+        }
+      }
+
+      return (i == (n - 1U)) ? last : maximum;
+    }
+
+    //*************************************************************************
+    /// The smallest key below the node.
+    //*************************************************************************
+    static const key_type& smallest_key(void* p_node, size_t level)
+    {
+      for (; level != 0U; --level)
+      {
+        p_node = static_cast<internal_node*>(p_node)->children[0];
+      }
+
+      return TKeyOf::key(static_cast<leaf_node*>(p_node)->values()[0]);
+    }
+
+    //*************************************************************************
+    /// The next node along the level. While bulk loading, internal nodes are
+    /// chained through their spare child pointer.
+    //*************************************************************************
+    static void* next_along(void* p_node, size_t level)
+    {
+      if (level == 0U)
+      {
+        return static_cast<leaf_node*>(p_node)->next;
+      }
+
+      return static_cast<internal_node*>(p_node)->children[Fanout];
+    }
+
+    //*************************************************************************
+    /// Builds the tree from the bottom up from strictly increasing values.
+    /// Leaves and internal nodes are filled, apart from the last two on each
+    /// level, which share their contents to keep the minimum occupancy.
+    //*************************************************************************
+    template <typename TIterator>
+    void bulk_load(TIterator first, TIterator last)
+    {
+      const size_t n = static_cast<size_t>(etl::distance(first, last));
+
+      if (n > CAPACITY)
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(btree_full));
+        return;
+      }
+
+      if (n == 0U)
+      {
+        return;
+      }
+
+      // The leaves.
+      const size_t leaves     = (n + Fanout - 1U) / Fanout;
+      leaf_node*   p_previous = ETL_NULLPTR;
+
+      for (size_t i = 0U; i < leaves; ++i)
+      {
+        leaf_node*   p_leaf = create_leaf();
+        const size_t count  = group_size(i, leaves, n, Fanout, Min_Leaf);
+
+        for (size_t j = 0U; j < count; ++j)
+        {
+          ::new (p_leaf->values() + j) value_type(*first);
+          ++first;
+        }
+
+        p_leaf->count    = count;
+        p_leaf->previous = p_previous;
+
+        if (p_previous == ETL_NULLPTR)
+        {
+          p_first = p_leaf;
+        }
+        else
+        {
+          p_previous->next = p_leaf;
+        }
+
+        p_previous = p_leaf;
+      }
+
+      p_last       = p_previous;
+      current_size = n;
+      ETL_ADD_DEBUG_COUNT(n);
+
+      // The internal levels.
+      void*  p_level_first = p_first;
+      size_t level_count   = leaves;
+      size_t level         = 0U;
+
+      while (level_count > 1U)
+      {
+        const size_t   parents          = (level_count + Fanout - 1U) / Fanout;
+        void*          p_child          = p_level_first;
+        internal_node* p_previous_node  = ETL_NULLPTR;
+
+        for (size_t i = 0U; i < parents; ++i)
+        {
+          internal_node* p_node   = create_internal();
+          const size_t   children = group_size(i, parents, level_count, Fanout, Min_Children);
+
+          for (size_t c = 0U; c < children; ++c)
+          {
+            if (c != 0U)
+            {
+              ::new (p_node->keys() + c - 1U) key_type(smallest_key(p_child, level));
+            }
+
+            p_node->children[c] = p_child;
+            p_child             = next_along(p_child, level);
+          }
+
+          p_node->count            = children - 1U;
+          p_node->children[Fanout] = ETL_NULLPTR;
+
+          if (p_previous_node == ETL_NULLPTR)
+          {
+            p_level_first = p_node;
+          }
+          else
+          {
+            p_previous_node->children[Fanout] = p_node;
+          }
+
+          p_previous_node = p_node;
+        }
+
+        level_count = parents;
+        ++level;
+      }
+
+      p_root      = p_level_first;
+      tree_height = level;
+    }
+
+    // Disable copy construction.
+    ibtree(const ibtree&);
+
+    etl::ipool*  p_leaf_pool;     ///< The pool of leaves.
+    etl::ipool*  p_internal_pool; ///< The pool of internal nodes.
+    void*        p_root;          ///< The root. A leaf when the height is zero.
+    leaf_node*   p_first;         ///< The leaf with the smallest keys.
+    leaf_node*   p_last;          ///< The leaf with the largest keys.
+    key_compare  kcompare;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_BTREE) || defined(ETL_POLYMORPHIC_CONTAINERS)
+
+  public:
+
+    virtual ~ibtree() {}
+#else
+
+  protected:
+
+    ~ibtree() {}
+#endif
+  };
+
+  template <typename TKey, typename TValue, typename TKeyOf, const size_t Fanout, typename TKeyCompare>
+  ETL_CONSTANT size_t ibtree<TKey, TValue, TKeyOf, Fanout, TKeyCompare>::FANOUT;
+
+  template <typename TKey, typename TValue, typename TKeyOf, const size_t Fanout, typename TKeyCompare>
+  ETL_CONSTANT size_t ibtree<TKey, TValue, TKeyOf, Fanout, TKeyCompare>::Min_Leaf;
+
+  template <typename TKey, typename TValue, typename TKeyOf, const size_t Fanout, typename TKeyCompare>
+  ETL_CONSTANT size_t ibtree<TKey, TValue, TKeyOf, Fanout, TKeyCompare>::Min_Children;
+} // namespace etl
+
+#include "minmax_pop.h"
+
+#endif
@@ -0,0 +1,490 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_IN_CHRONO_H
+  #error DO NOT DIRECTLY INCLUDE THIS FILE. USE CHRONO.H
+#endif
+
+#if ETL_USING_64BIT_TYPES
+
+  #include "../../span.h"
+
+namespace etl
+{
+  namespace chrono
+  {
+    namespace private_chrono
+    {
+      //*************************************************************************
+      /// The two digit decimal representations of 0 to 99.
+      //*************************************************************************
+      template <typename TDummy = void>
+      struct iso8601_tables
+      {
+        static const char digit_pairs[200];
+      };
+
+      template <typename TDummy>
+      const char iso8601_tables<TDummy>::digit_pairs[200] = {
+        '0', '0', '0', '1', '0', '2', '0', '3', '0', '4', '0', '5', '0', '6', '0', '7', '0', '8', '0', '9', '1', '0', '1', '1', '1', '2', '1',
+        '3', '1', '4', '1', '5', '1', '6', '1', '7', '1', '8', '1', '9', '2', '0', '2', '1', '2', '2', '2', '3', '2', '4', '2', '5', '2', '6',
+        '2', '7', '2', '8', '2', '9', '3', '0', '3', '1', '3', '2', '3', '3', '3', '4', '3', '5', '3', '6', '3', '7', '3', '8', '3', '9', '4',
+        '0', '4', '1', '4', '2', '4', '3', '4', '4', '4', '5', '4', '6', '4', '7', '4', '8', '4', '9', '5', '0', '5', '1', '5', '2', '5', '3',
+        '5', '4', '5', '5', '5', '6', '5', '7', '5', '8', '5', '9', '6', '0', '6', '1', '6', '2', '6', '3', '6', '4', '6', '5', '6', '6', '6',
+        '7', '6', '8', '6', '9', '7', '0', '7', '1', '7', '2', '7', '3', '7', '4', '7', '5', '7', '6', '7', '7', '7', '8', '7', '9', '8', '0',
+        '8', '1', '8', '2', '8', '3', '8', '4', '8', '5', '8', '6', '8', '7', '8', '8', '8', '9', '9', '0', '9', '1', '9', '2', '9', '3', '9',
+        '4', '9', '5', '9', '6', '9', '7', '9', '8', '9', '9'};
+
+      //*************************************************************************
+      /// The length of "YYYY-MM-DDTHH:MM:SS".
+      //*************************************************************************
+      static ETL_CONSTANT size_t Iso8601_Prefix_Size = 19U;
+
+      //*************************************************************************
+      /// Writes two digits.
+      //*************************************************************************
+      inline void write_digit_pair(char* p, uint32_t value) ETL_NOEXCEPT
+      {
+        const char* pair = &iso8601_tables<>::digit_pairs[2U * value];
+
+        p[0] = pair[0];
+        p[1] = pair[1];
+      }
+
+      //*************************************************************************
+      /// Reads two digits. Returns false if either is not a digit.
+      //*************************************************************************
+      inline bool read_digit_pair(const char* p, uint32_t& value) ETL_NOEXCEPT
+      {
+        const uint32_t high = static_cast<uint32_t>(p[0] - '0');
+        const uint32_t low  = static_cast<uint32_t>(p[1] - '0');
+
+        value = (high * 10U) + low;
+
+        return (high < 10U) && (low < 10U);
+      }
+
+      //*************************************************************************
+      /// Writes "YYYY-MM-DDTHH:MM:SS" for the seconds since 1970-01-01.
+      /// Returns false if the year is outside 0000 to 9999.
+      //*************************************************************************
+      inline bool write_iso8601_prefix(int64_t since_epoch, char* p) ETL_NOEXCEPT
+      {
+        // Floor division, so that times before the epoch belong to the previous day.
+        int64_t day_count = since_epoch / 86400;
+
+        if ((day_count * 86400) > since_epoch)
+        {
+          --day_count;
+        }
+
+        // 0000-01-01 to 9999-12-31.
+        if ((day_count < -719528) || (day_count > 2932896))
+        {
+          return false;
+        }
+
+        const civil_date date = civil_from_days(static_cast<int32_t>(day_count));
+
+        const uint32_t time_of_day = static_cast<uint32_t>(since_epoch - (day_count * 86400));
+        const uint32_t year        = static_cast<uint32_t>(date.year);
+
+        write_digit_pair(p, year / 100U);
+        write_digit_pair(p + 2, year % 100U);
+        p[4] = '-';
+        write_digit_pair(p + 5, date.month);
+        p[7] = '-';
+        write_digit_pair(p + 8, date.day);
+        p[10] = 'T';
+        write_digit_pair(p + 11, time_of_day / 3600U);
+        p[13] = ':';
+        write_digit_pair(p + 14, (time_of_day / 60U) % 60U);
+        p[16] = ':';
+        write_digit_pair(p + 17, time_of_day % 60U);
+
+        return true;
+      }
+
+      //*************************************************************************
+      /// Splits a time point into whole seconds and a decimal fraction of
+      /// Width digits.
+      //*************************************************************************
+      template <typename TDuration>
+      struct iso8601_split
+      {
+        ETL_STATIC_ASSERT(!etl::chrono::treat_as_floating_point<typename TDuration::rep>::value, "Floating point durations are not supported");
+
+        static ETL_CONSTANT size_t Width = static_cast<size_t>(etl::chrono::hh_mm_ss<TDuration>::fractional_width);
+
+        typedef typename etl::chrono::hh_mm_ss<TDuration>::precision precision;
+
+        static ETL_CONSTANT int64_t Scale = static_cast<int64_t>(etl::power<10, Width>::value);
+
+        explicit iso8601_split(const TDuration& d) ETL_NOEXCEPT
+          : seconds(0)
+          , fraction(0)
+        {
+          const int64_t ticks = static_cast<int64_t>(etl::chrono::duration_cast<precision>(d).count());
+
+          seconds  = ticks / Scale;
+          fraction = ticks % Scale;
+
+          if (fraction < 0)
+          {
+            fraction += Scale;
+            --seconds;
+          }
+        }
+
+        int64_t seconds;
+        int64_t fraction;
+      };
+
+      template <typename TDuration>
+      ETL_CONSTANT size_t iso8601_split<TDuration>::Width;
+
+      template <typename TDuration>
+      ETL_CONSTANT int64_t iso8601_split<TDuration>::Scale;
+
+      //*************************************************************************
+      /// Writes ".fff...Z" after the prefix.
+      //*************************************************************************
+      template <size_t Width>
+      size_t write_iso8601_suffix(uint64_t fraction, char* p) ETL_NOEXCEPT
+      {
+        size_t length = 0U;
+
+        if (Width != 0U)
+        {
+          p[0] = '.';
+
+          // From the right, two digits at a time.
+          char* digit = p + Width + 1U;
+
+          for (size_t i = 0U; i < (Width / 2U); ++i)
+          {
+            digit -= 2;
+            write_digit_pair(digit, static_cast<uint32_t>(fraction % 100U));
+            fraction /= 100U;
+          }
+
+          if ((Width % 2U) != 0U)
+          {
+            p[1] = static_cast<char>('0' + fraction);
+          }
+
+          length = Width + 1U;
+        }
+
+        p[length] = 'Z';
+
+        return length + 1U;
+      }
+    } // namespace private_chrono
+
+    //***************************************************************************
+    /// The number of characters written by format_iso8601 for TDuration.
+    /// "YYYY-MM-DDTHH:MM:SS", a fraction of as many digits as the precision of
+    /// TDuration, and "Z".
+    //***************************************************************************
+    template <typename TDuration>
+    struct iso8601_size
+      : etl::integral_constant<size_t, private_chrono::Iso8601_Prefix_Size + 1U
+                                         + ((private_chrono::iso8601_split<TDuration>::Width == 0U) ? 0U
+                                                                                                     : private_chrono::iso8601_split<TDuration>::Width + 1U)>
+    {
+    };
+
+  #if ETL_USING_CPP17
+    template <typename TDuration>
+    inline constexpr size_t iso8601_size_v = iso8601_size<TDuration>::value;
+  #endif
+
+    //***************************************************************************
+    /// Remembers the "YYYY-MM-DDTHH:MM:SS" prefix of the last second formatted,
+    /// so that consecutive timestamps within the same second only write the
+    /// fraction.
+    //***************************************************************************
+    class iso8601_cache
+    {
+    public:
+
+      //*************************************************************************
+      /// Constructor.
+      //*************************************************************************
+      iso8601_cache() ETL_NOEXCEPT
+        : cached_seconds(0)
+        , valid(false)
+      {
+      }
+
+      //*************************************************************************
+      /// Forgets the cached second.
+      //*************************************************************************
+      void clear() ETL_NOEXCEPT
+      {
+        valid = false;
+      }
+
+      //*************************************************************************
+      /// Returns the prefix for the seconds since 1970-01-01, or ETL_NULLPTR if
+      /// the year is outside 0000 to 9999.
+      //*************************************************************************
+      const char* prefix(int64_t since_epoch) ETL_NOEXCEPT
+      {
+        if (!valid || (since_epoch != cached_seconds))
+        {
+          valid          = private_chrono::write_iso8601_prefix(since_epoch, text);
+          cached_seconds = since_epoch;
+        }
+
+        return valid ? text : ETL_NULLPTR;
+      }
+
+    private:
+
+      int64_t cached_seconds;
+      bool    valid;
+      char    text[private_chrono::Iso8601_Prefix_Size];
+    };
+
+    //***************************************************************************
+    /// Formats a system time as "YYYY-MM-DDTHH:MM:SS[.fff...]Z", with as many
+    /// fractional digits as the precision of TDuration.
+    /// The text is not null terminated.
+    /// Returns the number of characters written, or 0 if the buffer is smaller
+    /// than iso8601_size<TDuration> or the year is outside 0000 to 9999.
+    //***************************************************************************
+    template <typename TDuration>
+    size_t format_iso8601(const etl::chrono::sys_time<TDuration>& tp, etl::span<char> buffer) ETL_NOEXCEPT
+    {
+      typedef private_chrono::iso8601_split<TDuration> split_t;
+
+      if (buffer.size() < iso8601_size<TDuration>::value)
+      {
+        return 0U;
+      }
+
+      const split_t split(tp.time_since_epoch());
+
+      if (!private_chrono::write_iso8601_prefix(split.seconds, buffer.data()))
+      {
+        return 0U;
+      }
+
+      return private_chrono::Iso8601_Prefix_Size
+             + private_chrono::write_iso8601_suffix<split_t::Width>(static_cast<uint64_t>(split.fraction),
+                                                                    buffer.data() + private_chrono::Iso8601_Prefix_Size);
+    }
+
+    //***************************************************************************
+    /// Formats a system time as "YYYY-MM-DDTHH:MM:SS[.fff...]Z", reusing the
+    /// cached prefix when the second has not changed since the last call.
+    //***************************************************************************
+    template <typename TDuration>
+    size_t format_iso8601(const etl::chrono::sys_time<TDuration>& tp, etl::span<char> buffer, etl::chrono::iso8601_cache& cache) ETL_NOEXCEPT
+    {
+      typedef private_chrono::iso8601_split<TDuration> split_t;
+
+      if (buffer.size() < iso8601_size<TDuration>::value)
+      {
+        return 0U;
+      }
+
+      const split_t split(tp.time_since_epoch());
+
+      const char* prefix = cache.prefix(split.seconds);
+
+      if (prefix == ETL_NULLPTR)
+      {
+        return 0U;
+      }
+
+      char* p = buffer.data();
+
+      for (size_t i = 0U; i < private_chrono::Iso8601_Prefix_Size; ++i)
+      {
+        p[i] = prefix[i];
+      }
+
+      return private_chrono::Iso8601_Prefix_Size
+             + private_chrono::write_iso8601_suffix<split_t::Width>(static_cast<uint64_t>(split.fraction), p + private_chrono::Iso8601_Prefix_Size);
+    }
+
+    //***************************************************************************
+    /// Parses "YYYY-MM-DDTHH:MM:SS[.fff...][Z|+HH:MM|-HH:MM]".
+    /// 't' or a space may separate the date and time, ',' may start the
+    /// fraction and the offset may omit the colon. Without a designator the
+    /// time is taken as UTC. Fractional digits beyond the precision of
+    /// TDuration are truncated.
+    /// Returns the number of characters parsed, or 0 if the text does not
+    /// start with a valid timestamp, in which case tp is unchanged.
+    //***************************************************************************
+    template <typename TDuration>
+    size_t parse_iso8601(etl::span<const char> text, etl::chrono::sys_time<TDuration>& tp) ETL_NOEXCEPT
+    {
+      typedef private_chrono::iso8601_split<TDuration> split_t;
+      typedef typename split_t::precision              precision;
+
+      const char*  p    = text.data();
+      const size_t size = text.size();
+
+      if (size < private_chrono::Iso8601_Prefix_Size)
+      {
+        return 0U;
+      }
+
+      uint32_t century = 0U;
+      uint32_t year    = 0U;
+      uint32_t month   = 0U;
+      uint32_t day     = 0U;
+      uint32_t hour    = 0U;
+      uint32_t minute  = 0U;
+      uint32_t second  = 0U;
+
+      const bool digits_ok = private_chrono::read_digit_pair(p, century) && private_chrono::read_digit_pair(p + 2, year)
+                             && private_chrono::read_digit_pair(p + 5, month) && private_chrono::read_digit_pair(p + 8, day)
+                             && private_chrono::read_digit_pair(p + 11, hour) && private_chrono::read_digit_pair(p + 14, minute)
+                             && private_chrono::read_digit_pair(p + 17, second);
+
+      const bool separators_ok = (p[4] == '-') && (p[7] == '-') && ((p[10] == 'T') || (p[10] == 't') || (p[10] == ' ')) && (p[13] == ':') && (p[16] == ':');
+
+      if (!digits_ok || !separators_ok)
+      {
+        return 0U;
+      }
+
+      year += 100U * century;
+
+      if ((month < 1U) || (month > 12U) || (day < 1U) || (hour > 23U) || (minute > 59U) || (second > 59U))
+      {
+        return 0U;
+      }
+
+      uint32_t max_day = private_chrono::days_in_month[month];
+
+      if ((month == 2U) && etl::chrono::year(static_cast<int>(year)).is_leap())
+      {
+        ++max_day;
+      }
+
+      if (day > max_day)
+      {
+        return 0U;
+      }
+
+      size_t position = private_chrono::Iso8601_Prefix_Size;
+
+      // Fraction.
+      int64_t fraction = 0;
+
+      if ((position < size) && ((p[position] == '.') || (p[position] == ',')))
+      {
+        ++position;
+
+        const size_t first = position;
+        size_t       width = 0U;
+
+        while ((position < size) && (static_cast<uint32_t>(p[position] - '0') < 10U))
+        {
+          if (width < split_t::Width)
+          {
+            fraction = (fraction * 10) + (p[position] - '0');
+            ++width;
+          }
+
+          ++position;
+        }
+
+        if (position == first)
+        {
+          return 0U;
+        }
+
+        for (; width < split_t::Width; ++width)
+        {
+          fraction *= 10;
+        }
+      }
+
+      // Designator.
+      int64_t offset = 0;
+
+      if (position < size)
+      {
+        const char designator = p[position];
+
+        if ((designator == 'Z') || (designator == 'z'))
+        {
+          ++position;
+        }
+        else if ((designator == '+') || (designator == '-'))
+        {
+          uint32_t offset_hours   = 0U;
+          uint32_t offset_minutes = 0U;
+
+          const size_t remaining = size - position;
+          const bool   colon     = (remaining >= 6U) && (p[position + 3U] == ':');
+
+          if ((remaining < (colon ? 6U : 5U)) || !private_chrono::read_digit_pair(p + position + 1U, offset_hours)
+              || !private_chrono::read_digit_pair(p + position + (colon ? 4U : 3U), offset_minutes) || (offset_hours > 23U) || (offset_minutes > 59U))
+          {
+            return 0U;
+          }
+
+          offset = (int64_t(offset_hours) * 3600) + (int64_t(offset_minutes) * 60);
+
+          if (designator == '+')
+          {
+            offset = -offset;
+          }
+
+          position += (colon ? 6U : 5U);
+        }
+      }
+
+      const int64_t day_count   = private_chrono::days_from_civil(static_cast<int32_t>(year), month, day);
+      const int64_t time_of_day = (int64_t(hour) * 3600) + (int64_t(minute) * 60) + int64_t(second);
+      const int64_t since_epoch = (day_count * 86400) + time_of_day + offset;
+      const int64_t max_seconds = etl::integral_limits<int64_t>::max / split_t::Scale;
+
+      if ((since_epoch > max_seconds) || (since_epoch < -max_seconds))
+      {
+        return 0U;
+      }
+
+      const precision ticks(static_cast<typename precision::rep>((since_epoch * split_t::Scale) + fraction));
+
+      tp = etl::chrono::sys_time<TDuration>(etl::chrono::duration_cast<TDuration>(ticks));
+
+      return position;
+    }
+  } // namespace chrono
+} // namespace etl
+
+#endif
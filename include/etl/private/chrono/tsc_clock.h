@@ -0,0 +1,311 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_IN_CHRONO_H
+  #error DO NOT DIRECTLY INCLUDE THIS FILE. USE CHRONO.H
+#endif
+
+#if ETL_USING_64BIT_TYPES
+
+  #if (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (defined(__x86_64__) || defined(__i386__))
+    #include <cpuid.h>
+    #define ETL_CHRONO_HAS_TSC 1
+  #elif defined(ETL_COMPILER_MICROSOFT) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+    #define ETL_CHRONO_HAS_TSC 1
+  #else
+    #define ETL_CHRONO_HAS_TSC 0
+  #endif
+
+namespace etl
+{
+  namespace chrono
+  {
+    namespace private_chrono
+    {
+      //*************************************************************************
+      /// The largest shift, up to 32, for which the multiplier
+      /// (numerator << shift) / denominator fits in 32 bits.
+      //*************************************************************************
+      ETL_CONSTEXPR uint32_t tsc_shift(uint64_t numerator, uint64_t denominator, uint32_t shift = 32U)
+      {
+        return ((shift == 0U) || ((((numerator << shift) >> shift) == numerator) && (((numerator << shift) / denominator) <= 0xFFFFFFFFULL)))
+                 ? shift
+                 : tsc_shift(numerator, denominator, shift - 1U);
+      }
+
+      //*************************************************************************
+      /// The multiplier for a shift, rounded to nearest.
+      //*************************************************************************
+      ETL_CONSTEXPR uint32_t tsc_multiplier(uint64_t numerator, uint64_t denominator, uint32_t shift)
+      {
+        return static_cast<uint32_t>(((numerator << shift) + (denominator / 2U)) / denominator);
+      }
+
+      //*************************************************************************
+      /// Converts a count with a multiplier and shift from tsc_multiplier() and
+      /// tsc_shift(). Each product is split so that it fits in 64 bits.
+      /// Exact for shift <= 32.
+      //*************************************************************************
+      ETL_CONSTEXPR uint64_t tsc_convert(uint64_t count, uint32_t multiplier, uint32_t shift)
+      {
+        return (((count >> 32U) * multiplier) << (32U - shift)) + (((count & 0xFFFFFFFFULL) * multiplier) >> shift);
+      }
+
+      //*************************************************************************
+      /// The nanoseconds in a tick of the steady clock.
+      //*************************************************************************
+      typedef ETL_CHRONO_STEADY_CLOCK_DURATION::period steady_period;
+
+      ETL_CONSTANT uint64_t Steady_Numerator   = uint64_t(steady_period::num) * 1000000000ULL;
+      ETL_CONSTANT uint64_t Steady_Denominator = uint64_t(steady_period::den);
+
+      //*************************************************************************
+      /// The conversion state of tsc_clock.
+      /// Starts by converting steady_clock ticks.
+      //*************************************************************************
+      template <typename TDummy = void>
+      struct tsc_clock_state
+      {
+        static bool     using_tsc;
+        static uint32_t multiplier;
+        static uint32_t shift;
+        static uint64_t frequency;
+      };
+
+      template <typename TDummy>
+      bool tsc_clock_state<TDummy>::using_tsc = false;
+
+      template <typename TDummy>
+      uint32_t tsc_clock_state<TDummy>::shift = tsc_shift(Steady_Numerator, Steady_Denominator);
+
+      template <typename TDummy>
+      uint32_t tsc_clock_state<TDummy>::multiplier = tsc_multiplier(Steady_Numerator, Steady_Denominator, tsc_shift(Steady_Numerator, Steady_Denominator));
+
+      template <typename TDummy>
+      uint64_t tsc_clock_state<TDummy>::frequency = Steady_Denominator / uint64_t(steady_period::num);
+    } // namespace private_chrono
+
+    //*************************************************************************
+    /// A steady clock that reads the processor's time stamp counter.
+    ///
+    /// Until it is calibrated, or if the processor has no invariant time stamp
+    /// counter, it reads etl_get_steady_clock() instead.
+    /// Counts are converted to nanoseconds with a multiply and shift.
+    /// Call calibrate() or set_frequency() once at startup, before other threads
+    /// read the clock. Time points from before are not comparable with those
+    /// from after. The calibration is shared by the whole program; reset()
+    /// returns to the steady clock.
+    /// Define ETL_CHRONO_TSC_CLOCK_USE_RDTSCP to read the counter with rdtscp,
+    /// which waits for earlier instructions to complete.
+    //*************************************************************************
+    class tsc_clock : public private_chrono::is_steady_trait<true>
+    {
+    public:
+
+      using duration   = etl::chrono::nanoseconds;
+      using rep        = duration::rep;
+      using period     = duration::period;
+      using time_point = etl::chrono::time_point<tsc_clock, duration>;
+
+      //*************************************************************************
+      static time_point now() ETL_NOEXCEPT
+      {
+        return time_point(cycles_to_duration(cycles()));
+      }
+
+      //*************************************************************************
+      /// Reads the counter: the time stamp counter once calibrated, otherwise
+      /// the steady clock.
+      //*************************************************************************
+      static uint64_t cycles() ETL_NOEXCEPT
+      {
+        return state::using_tsc ? read_tsc() : static_cast<uint64_t>(etl_get_steady_clock());
+      }
+
+      //*************************************************************************
+      /// Converts a count to nanoseconds, without a division.
+      //*************************************************************************
+      static duration cycles_to_duration(uint64_t count) ETL_NOEXCEPT
+      {
+        return duration(static_cast<rep>(private_chrono::tsc_convert(count, state::multiplier, state::shift)));
+      }
+
+      //*************************************************************************
+      /// Returns true if the processor has a time stamp counter that runs at a
+      /// constant rate in all power states.
+      //*************************************************************************
+      static bool has_invariant_tsc() ETL_NOEXCEPT
+      {
+  #if ETL_CHRONO_HAS_TSC
+    #if defined(ETL_COMPILER_MICROSOFT)
+        int registers[4];
+
+        __cpuid(registers, int(0x80000000));
+
+        if (static_cast<unsigned>(registers[0]) < 0x80000007U)
+        {
+          return false;
+        }
+
+        __cpuid(registers, int(0x80000007));
+
+        return (static_cast<unsigned>(registers[3]) & (1U << 8U)) != 0U;
+    #else
+        unsigned eax = 0U, ebx = 0U, ecx = 0U, edx = 0U;
+
+        if ((__get_cpuid(0x80000000U, &eax, &ebx, &ecx, &edx) == 0) || (eax < 0x80000007U))
+        {
+          return false;
+        }
+
+        __get_cpuid(0x80000007U, &eax, &ebx, &ecx, &edx);
+
+        return (edx & (1U << 8U)) != 0U;
+    #endif
+  #else
+        return false;
+  #endif
+      }
+
+      //*************************************************************************
+      /// Measures the frequency of the time stamp counter against TClock over
+      /// 'window', then uses the counter.
+      /// Returns false, and keeps using the steady clock, if there is no
+      /// invariant time stamp counter.
+      //*************************************************************************
+      template <typename TClock = etl::chrono::steady_clock>
+      static bool calibrate(etl::chrono::nanoseconds window = etl::chrono::milliseconds(10))
+      {
+        if (!has_invariant_tsc())
+        {
+          return false;
+        }
+
+        const typename TClock::time_point start       = TClock::now();
+        const uint64_t                    start_count = read_tsc();
+
+        typename TClock::time_point end;
+
+        do
+        {
+          end = TClock::now();
+        } while ((end.time_since_epoch() - start.time_since_epoch()) < window);
+
+        const uint64_t end_count = read_tsc();
+
+        const int64_t elapsed = static_cast<int64_t>(etl::chrono::duration_cast<etl::chrono::nanoseconds>(end.time_since_epoch() - start.time_since_epoch()).count());
+
+        if ((elapsed <= 0) || (end_count <= start_count))
+        {
+          return false;
+        }
+
+        return set_frequency(static_cast<uint64_t>((double(end_count - start_count) * 1e9 / double(elapsed)) + 0.5));
+      }
+
+      //*************************************************************************
+      /// Sets the frequency of the time stamp counter, if it is known, then
+      /// uses the counter.
+      /// Returns false, and keeps using the steady clock, if there is no
+      /// invariant time stamp counter.
+      //*************************************************************************
+      static bool set_frequency(uint64_t hertz)
+      {
+        if ((hertz == 0U) || !has_invariant_tsc())
+        {
+          return false;
+        }
+
+        state::shift      = private_chrono::tsc_shift(1000000000ULL, hertz);
+        state::multiplier = private_chrono::tsc_multiplier(1000000000ULL, hertz, state::shift);
+        state::frequency  = hertz;
+        state::using_tsc  = true;
+
+        return true;
+      }
+
+      //*************************************************************************
+      /// Returns to reading the steady clock, as before calibration.
+      /// Time points from before are not comparable with those from after.
+      //*************************************************************************
+      static void reset()
+      {
+        state::shift      = private_chrono::tsc_shift(private_chrono::Steady_Numerator, private_chrono::Steady_Denominator);
+        state::multiplier = private_chrono::tsc_multiplier(private_chrono::Steady_Numerator, private_chrono::Steady_Denominator, state::shift);
+        state::frequency  = private_chrono::Steady_Denominator / uint64_t(private_chrono::steady_period::num);
+        state::using_tsc  = false;
+      }
+
+      //*************************************************************************
+      /// Returns the counts per second of cycles().
+      //*************************************************************************
+      static uint64_t frequency() ETL_NOEXCEPT
+      {
+        return state::frequency;
+      }
+
+      //*************************************************************************
+      /// Returns true if cycles() reads the time stamp counter.
+      //*************************************************************************
+      static bool is_using_tsc() ETL_NOEXCEPT
+      {
+        return state::using_tsc;
+      }
+
+    private:
+
+      typedef private_chrono::tsc_clock_state<> state;
+
+      //*************************************************************************
+      static uint64_t read_tsc() ETL_NOEXCEPT
+      {
+  #if ETL_CHRONO_HAS_TSC
+    #if defined(ETL_CHRONO_TSC_CLOCK_USE_RDTSCP)
+        unsigned int processor;
+      #if defined(ETL_COMPILER_MICROSOFT)
+        return __rdtscp(&processor);
+      #else
+        return __builtin_ia32_rdtscp(&processor);
+      #endif
+    #else
+      #if defined(ETL_COMPILER_MICROSOFT)
+        return __rdtsc();
+      #else
+        return __builtin_ia32_rdtsc();
+      #endif
+    #endif
+  #else
+        return static_cast<uint64_t>(etl_get_steady_clock());
+  #endif
+      }
+    };
+  } // namespace chrono
+} // namespace etl
+
+#endif
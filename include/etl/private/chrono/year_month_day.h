@@ -38,6 +38,77 @@ namespace etl
   {
     class year_month_day_last;
 
+    namespace private_chrono
+    {
+      //*************************************************************************
+      /// A proleptic Gregorian date.
+      //*************************************************************************
+      struct civil_date
+      {
+        int32_t  year;
+        uint32_t month;
+        uint32_t day;
+      };
+
+      //*************************************************************************
+      /// The calendar is shifted forward by Civil_Eras 400 year eras so that
+      /// every date of etl::chrono::year maps to an unsigned day count.
+      //*************************************************************************
+      static ETL_CONSTANT uint32_t Civil_Eras       = 82U;
+      static ETL_CONSTANT uint32_t Civil_Year_Shift = 400U * Civil_Eras;
+      static ETL_CONSTANT uint32_t Civil_Day_Shift  = 719468U + (146097U * Civil_Eras);
+
+      //*************************************************************************
+      /// Converts days since 1970-01-01 to a date.
+      /// Neri and Schneider, "Euclidean affine functions and their application
+      /// to calendar algorithms". The year is computed in a calendar starting
+      /// on March 1st, so that the leap day is the last day of the year.
+      //*************************************************************************
+      inline ETL_CONSTEXPR14 civil_date civil_from_days(int32_t days) ETL_NOEXCEPT
+      {
+        const uint32_t n = static_cast<uint32_t>(days) + Civil_Day_Shift;
+
+        // Century and day of the century.
+        const uint32_t n1 = (4U * n) + 3U;
+        const uint32_t c  = n1 / 146097U;
+        const uint32_t nc = (n1 % 146097U) / 4U;
+
+        // Year of the century and day of the year.
+        const uint64_t p2 = uint64_t(2939745U) * ((4U * nc) + 3U);
+        const uint32_t z  = static_cast<uint32_t>(p2 >> 32U);
+        const uint32_t ny = static_cast<uint32_t>(p2) / 2939745U / 4U;
+
+        // Month and day, counting from March.
+        const uint32_t n3 = (2141U * ny) + 197913U;
+        const uint32_t mp = n3 >> 16U;
+        const uint32_t dp = (n3 & 0xFFFFU) / 2141U;
+
+        // Back to January.
+        const bool j = (ny >= 306U);
+
+        civil_date result = {static_cast<int32_t>(((100U * c) + z + (j ? 1U : 0U)) - Civil_Year_Shift), j ? mp - 12U : mp, dp + 1U};
+
+        return result;
+      }
+
+      //*************************************************************************
+      /// Converts a date to days since 1970-01-01.
+      //*************************************************************************
+      inline ETL_CONSTEXPR14 int32_t days_from_civil(int32_t year, uint32_t month, uint32_t day) ETL_NOEXCEPT
+      {
+        // Move January and February to the end of the previous year.
+        const bool     j  = (month <= 2U);
+        const uint32_t yp = static_cast<uint32_t>(year) + Civil_Year_Shift - (j ? 1U : 0U);
+        const uint32_t mp = j ? month + 12U : month;
+
+        const uint32_t c          = yp / 100U;
+        const uint32_t year_days  = ((1461U * yp) / 4U) - c + (c / 4U);
+        const uint32_t month_days = ((979U * mp) - 2919U) / 32U;
+
+        return static_cast<int32_t>((year_days + month_days + day - 1U) - Civil_Day_Shift);
+      }
+    } // namespace private_chrono
+
     //*************************************************************************
     /// year_month_day
     //*************************************************************************
@@ -78,49 +149,11 @@ namespace etl
         , m(0U)
         , d(0U)
       {
-        // Days since 1970-01-01
-        int days_since_epoch = static_cast<int>(sd.time_since_epoch().count());
-
-        // Start from 1970-01-01
-        etl::chrono::year  current_year(1970);
-        etl::chrono::month current_month(1);
+        const private_chrono::civil_date date = private_chrono::civil_from_days(static_cast<int32_t>(sd.time_since_epoch().count()));
 
-        // Find the year
-        while (true)
-        {
-          int days_in_year = current_year.is_leap() ? 366 : 365;
-
-          if (days_since_epoch < days_in_year)
-          {
-            break;
-          }
-
-          days_since_epoch -= days_in_year;
-          ++current_year;
-        }
-
-        // Find the month
-        while (true)
-        {
-          unsigned char days_in_month = etl::chrono::private_chrono::days_in_month[static_cast<unsigned>(current_month)];
-          if (current_month == etl::chrono::February && current_year.is_leap())
-          {
-            ++days_in_month;
-          }
-
-          if (days_since_epoch < days_in_month)
-          {
-            break;
-          }
-
-          days_since_epoch -= days_in_month;
-          ++current_month;
-        }
-
-        // The remaining days are the day of the month (0-based)
-        y = current_year;
-        m = current_month;
-        d = etl::chrono::day(static_cast<unsigned>(days_since_epoch) + 1);
+        y = etl::chrono::year(date.year);
+        m = etl::chrono::month(date.month);
+        d = etl::chrono::day(date.day);
       }
 
       //*************************************************************************
@@ -244,27 +277,7 @@ namespace etl
       //***********************************************************************
       ETL_NODISCARD ETL_CONSTEXPR14 operator etl::chrono::sys_days() const ETL_NOEXCEPT
       {
-        int day_count = 0;
-
-        // Add days for years since 1970
-        for (etl::chrono::year yr(1970); yr < this->year(); ++yr)
-        {
-          day_count += yr.is_leap() ? 366 : 365;
-        }
-
-        // Add days for months in the current year
-        for (etl::chrono::month mth(1); mth < this->month(); ++mth)
-        {
-          day_count += private_chrono::days_in_month[static_cast<unsigned>(mth)];
-
-          if (mth == etl::chrono::February && this->year().is_leap())
-          {
-            ++day_count; // Add one day for leap year February
-          }
-        }
-
-        // Add days for the current month
-        day_count += static_cast<int>(static_cast<unsigned>(this->day()) - 1);
+        const int32_t day_count = private_chrono::days_from_civil(static_cast<int32_t>(static_cast<int>(y)), static_cast<unsigned>(m), static_cast<unsigned>(d));
 
         return sys_days(etl::chrono::days(day_count));
       }
@@ -0,0 +1,253 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FILTER_ARITHMETIC_INCLUDED
+#define ETL_FILTER_ARITHMETIC_INCLUDED
+
+#include "../platform.h"
+#include "../error_handler.h"
+#include "../exception.h"
+#include "../file_error_numbers.h"
+#include "../integral_limits.h"
+#include "../static_assert.h"
+#include "../type_traits.h"
+#include "algorithm_simd.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for filter exceptions.
+  //***************************************************************************
+  class filter_exception : public exception
+  {
+  public:
+
+    filter_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The channel is not one of the filter's channels.
+  //***************************************************************************
+  class filter_channel_out_of_range : public filter_exception
+  {
+  public:
+
+    filter_channel_out_of_range(string_type file_name_, numeric_type line_number_)
+      : filter_exception(ETL_ERROR_TEXT("filter:channel", ETL_FILTER_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_filter
+  {
+    //*************************************************************************
+    /// The arithmetic used by the filters for a sample type.
+    /// Floating point types are used as they are.
+    /// int16_t and int32_t are Q15 and Q31 fixed point, with a 64 bit
+    /// accumulator and rounded, saturated results. The accumulator is not
+    /// saturated. Its sums are made in uint64_t, so a sum that exceeds the
+    /// range of int64_t wraps around in two's complement instead of being
+    /// undefined behaviour.
+    //*************************************************************************
+    template <typename T, bool Is_Floating_Point = etl::is_floating_point<T>::value>
+    struct arithmetic;
+
+    //*************************************************************************
+    /// Floating point.
+    //*************************************************************************
+    template <typename T>
+    struct arithmetic<T, true>
+    {
+      typedef T accumulator_type;
+
+      static ETL_CONSTANT int Fraction_Bits = 0;
+
+      //*********************************
+      template <int Shift>
+      static T to_coefficient(double value)
+      {
+        return T(value);
+      }
+
+      //*********************************
+      static accumulator_type product(T a, T b)
+      {
+        return a * b;
+      }
+
+      //*********************************
+      static accumulator_type add(accumulator_type a, accumulator_type b)
+      {
+        return a + b;
+      }
+
+      //*********************************
+      static accumulator_type subtract(accumulator_type a, accumulator_type b)
+      {
+        return a - b;
+      }
+
+      //*********************************
+      template <int Shift>
+      static T to_sample(accumulator_type value)
+      {
+        return value;
+      }
+
+      //*********************************
+      /// Uses the kernel in private/algorithm_simd.h if ETL_ALGORITHM_USE_SIMD is defined.
+      //*********************************
+      static accumulator_type dot(const T* a, const T* b, size_t n)
+      {
+#if ETL_USING_ALGORITHM_SIMD == 1
+        return etl::private_algorithm_simd::dot(a, b, n);
+#else
+        accumulator_type sum = T(0);
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          sum += a[i] * b[i];
+        }
+
+        return sum;
+#endif
+      }
+    };
+
+    template <typename T>
+    ETL_CONSTANT int arithmetic<T, true>::Fraction_Bits;
+
+    //*************************************************************************
+    /// Fixed point.
+    //*************************************************************************
+    template <typename T>
+    struct arithmetic<T, false>
+    {
+      ETL_STATIC_ASSERT((etl::is_same<T, int16_t>::value || etl::is_same<T, int32_t>::value), "Fixed point filters use int16_t (Q15) or int32_t (Q31)");
+
+      typedef int64_t accumulator_type;
+
+      static ETL_CONSTANT int Fraction_Bits = etl::integral_limits<T>::bits - 1;
+
+      //*********************************
+      /// Converts to a fixed point value with 'Shift' fraction bits,
+      /// rounded to nearest and saturated.
+      //*********************************
+      template <int Shift>
+      static T to_coefficient(double value)
+      {
+        double scaled = value * double(int64_t(1) << Shift);
+
+        scaled += (scaled < 0.0) ? -0.5 : 0.5;
+
+        if (scaled >= double(etl::integral_limits<T>::max))
+        {
+          return etl::integral_limits<T>::max;
+        }
+
+        if (scaled <= double(etl::integral_limits<T>::min))
+        {
+          return etl::integral_limits<T>::min;
+        }
+
+        return T(int64_t(scaled));
+      }
+
+      //*********************************
+      /// Cannot overflow, as the magnitude of the product of two int32_t is at most 2^62.
+      //*********************************
+      static accumulator_type product(T a, T b)
+      {
+        return accumulator_type(a) * accumulator_type(b);
+      }
+
+      //*********************************
+      /// Adds, wrapping around on overflow.
+      //*********************************
+      static accumulator_type add(accumulator_type a, accumulator_type b)
+      {
+        return accumulator_type(uint64_t(a) + uint64_t(b));
+      }
+
+      //*********************************
+      /// Subtracts, wrapping around on overflow.
+      //*********************************
+      static accumulator_type subtract(accumulator_type a, accumulator_type b)
+      {
+        return accumulator_type(uint64_t(a) - uint64_t(b));
+      }
+
+      //*********************************
+      /// Removes 'Shift' fraction bits, rounded to nearest and saturated.
+      //*********************************
+      template <int Shift>
+      static T to_sample(accumulator_type value)
+      {
+        value = add(value, accumulator_type(1) << (Shift - 1)) >> Shift;
+
+        if (value > accumulator_type(etl::integral_limits<T>::max))
+        {
+          return etl::integral_limits<T>::max;
+        }
+
+        if (value < accumulator_type(etl::integral_limits<T>::min))
+        {
+          return etl::integral_limits<T>::min;
+        }
+
+        return T(value);
+      }
+
+      //*********************************
+      static accumulator_type dot(const T* a, const T* b, size_t n)
+      {
+        uint64_t sum = 0U;
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          sum += uint64_t(product(a[i], b[i]));
+        }
+
+        return accumulator_type(sum);
+      }
+    };
+
+    template <typename T>
+    ETL_CONSTANT int arithmetic<T, false>::Fraction_Bits;
+  } // namespace private_filter
+} // namespace etl
+
+#endif
@@ -84,6 +84,8 @@ public:
   {
     const etl::message_id_t id = msg.get_message_id();
 
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), id);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     switch (id)
     {
@@ -123,6 +125,8 @@ public:
   typename etl::enable_if<etl::is_message<TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value, void>::type
     receive(const TMessage& msg)
   {
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), TMessage::ID);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     static_cast<TDerived*>(this)->on_receive(msg);
 #include "etl/private/diagnostic_pop.h"
@@ -239,6 +243,8 @@ public:
   {
     const etl::message_id_t id = msg.get_message_id();
 
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), id);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     switch (id)
     {
@@ -277,6 +283,8 @@ public:
   typename etl::enable_if<etl::is_message<TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15>::value, void>::type
     receive(const TMessage& msg)
   {
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), TMessage::ID);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     static_cast<TDerived*>(this)->on_receive(msg);
 #include "etl/private/diagnostic_pop.h"
@@ -394,6 +402,8 @@ public:
   {
     const etl::message_id_t id = msg.get_message_id();
 
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), id);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     switch (id)
     {
@@ -431,6 +441,8 @@ public:
   typename etl::enable_if<etl::is_message<TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14>::value, void>::type
     receive(const TMessage& msg)
   {
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), TMessage::ID);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     static_cast<TDerived*>(this)->on_receive(msg);
 #include "etl/private/diagnostic_pop.h"
@@ -548,6 +560,8 @@ public:
   {
     const etl::message_id_t id = msg.get_message_id();
 
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), id);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     switch (id)
     {
@@ -584,6 +598,8 @@ public:
   typename etl::enable_if<etl::is_message<TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13>::value, void>::type
     receive(const TMessage& msg)
   {
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), TMessage::ID);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     static_cast<TDerived*>(this)->on_receive(msg);
 #include "etl/private/diagnostic_pop.h"
@@ -700,6 +716,8 @@ public:
   {
     const etl::message_id_t id = msg.get_message_id();
 
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), id);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     switch (id)
     {
@@ -735,6 +753,8 @@ public:
   typename etl::enable_if<etl::is_message<TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12>::value, void>::type
     receive(const TMessage& msg)
   {
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), TMessage::ID);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     static_cast<TDerived*>(this)->on_receive(msg);
 #include "etl/private/diagnostic_pop.h"
@@ -851,6 +871,8 @@ public:
   {
     const etl::message_id_t id = msg.get_message_id();
 
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), id);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     switch (id)
     {
@@ -885,6 +907,8 @@ public:
   typename etl::enable_if<etl::is_message<TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11>::value, void>::type
     receive(const TMessage& msg)
   {
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), TMessage::ID);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     static_cast<TDerived*>(this)->on_receive(msg);
 #include "etl/private/diagnostic_pop.h"
@@ -1001,6 +1025,8 @@ public:
   {
     const etl::message_id_t id = msg.get_message_id();
 
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), id);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     switch (id)
     {
@@ -1034,6 +1060,8 @@ public:
   typename etl::enable_if<etl::is_message<TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10>::value, void>::type
     receive(const TMessage& msg)
   {
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), TMessage::ID);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     static_cast<TDerived*>(this)->on_receive(msg);
 #include "etl/private/diagnostic_pop.h"
@@ -1150,6 +1178,8 @@ public:
   {
     const etl::message_id_t id = msg.get_message_id();
 
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), id);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     switch (id)
     {
@@ -1182,6 +1212,8 @@ public:
   typename etl::enable_if<etl::is_message<TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8, T9>::value, void>::type
     receive(const TMessage& msg)
   {
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), TMessage::ID);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     static_cast<TDerived*>(this)->on_receive(msg);
 #include "etl/private/diagnostic_pop.h"
@@ -1297,6 +1329,8 @@ public:
   {
     const etl::message_id_t id = msg.get_message_id();
 
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), id);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     switch (id)
     {
@@ -1328,6 +1362,8 @@ public:
   typename etl::enable_if<etl::is_message<TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7, T8>::value, void>::type
     receive(const TMessage& msg)
   {
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), TMessage::ID);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     static_cast<TDerived*>(this)->on_receive(msg);
 #include "etl/private/diagnostic_pop.h"
@@ -1443,6 +1479,8 @@ public:
   {
     const etl::message_id_t id = msg.get_message_id();
 
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), id);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     switch (id)
     {
@@ -1473,6 +1511,8 @@ public:
   typename etl::enable_if<etl::is_message<TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6, T7>::value, void>::type
     receive(const TMessage& msg)
   {
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), TMessage::ID);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     static_cast<TDerived*>(this)->on_receive(msg);
 #include "etl/private/diagnostic_pop.h"
@@ -1587,6 +1627,8 @@ public:
   {
     const etl::message_id_t id = msg.get_message_id();
 
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), id);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     switch (id)
     {
@@ -1616,6 +1658,8 @@ public:
   typename etl::enable_if<etl::is_message<TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5, T6>::value, void>::type
     receive(const TMessage& msg)
   {
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), TMessage::ID);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     static_cast<TDerived*>(this)->on_receive(msg);
 #include "etl/private/diagnostic_pop.h"
@@ -1730,6 +1774,8 @@ public:
   {
     const etl::message_id_t id = msg.get_message_id();
 
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), id);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     switch (id)
     {
@@ -1758,6 +1804,8 @@ public:
   typename etl::enable_if<etl::is_message<TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4, T5>::value, void>::type
     receive(const TMessage& msg)
   {
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), TMessage::ID);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     static_cast<TDerived*>(this)->on_receive(msg);
 #include "etl/private/diagnostic_pop.h"
@@ -1871,6 +1919,8 @@ public:
   {
     const etl::message_id_t id = msg.get_message_id();
 
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), id);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     switch (id)
     {
@@ -1898,6 +1948,8 @@ public:
   typename etl::enable_if<etl::is_message<TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3, T4>::value, void>::type
     receive(const TMessage& msg)
   {
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), TMessage::ID);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     static_cast<TDerived*>(this)->on_receive(msg);
 #include "etl/private/diagnostic_pop.h"
@@ -2011,6 +2063,8 @@ public:
   {
     const etl::message_id_t id = msg.get_message_id();
 
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), id);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     switch (id)
     {
@@ -2037,6 +2091,8 @@ public:
   typename etl::enable_if<etl::is_message<TMessage>::value && etl::is_one_of<TMessage, T1, T2, T3>::value, void>::type
     receive(const TMessage& msg)
   {
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), TMessage::ID);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     static_cast<TDerived*>(this)->on_receive(msg);
 #include "etl/private/diagnostic_pop.h"
@@ -2150,6 +2206,8 @@ public:
   {
     const etl::message_id_t id = msg.get_message_id();
 
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), id);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     switch (id)
     {
@@ -2175,6 +2233,8 @@ public:
   typename etl::enable_if<etl::is_message<TMessage>::value && etl::is_one_of<TMessage, T1, T2>::value, void>::type
     receive(const TMessage& msg)
   {
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), TMessage::ID);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     static_cast<TDerived*>(this)->on_receive(msg);
 #include "etl/private/diagnostic_pop.h"
@@ -2288,6 +2348,8 @@ public:
   {
     const etl::message_id_t id = msg.get_message_id();
 
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), id);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     switch (id)
     {
@@ -2312,6 +2374,8 @@ public:
   typename etl::enable_if<etl::is_message<TMessage>::value && etl::is_one_of<TMessage, T1>::value, void>::type
     receive(const TMessage& msg)
   {
+    ETL_TRACE_SCOPE(etl::trace_category::Message_Router, get_message_router_id(), TMessage::ID);
+
 #include "etl/private/diagnostic_array_bounds_push.h"
     static_cast<TDerived*>(this)->on_receive(msg);
 #include "etl/private/diagnostic_pop.h"
@@ -0,0 +1,88 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SKETCH_COMMON_INCLUDED
+#define ETL_SKETCH_COMMON_INCLUDED
+
+#include "../platform.h"
+#include "../hash.h"
+#include "../integral_limits.h"
+
+#include <stdint.h>
+
+//*****************************************************************************
+// Hashing and counting shared by the streaming sketches:
+// etl::hyperloglog, etl::count_min_sketch and etl::top_k.
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_sketch
+  {
+    //*************************************************************************
+    /// Spreads the bits of a hash over all 64 bits.
+    /// etl::hash is the identity for many integral types, and may only be
+    /// 32 bits wide, but the sketches use the top and bottom bits
+    /// independently. This is the MurmurHash3 64 bit finaliser.
+    //*************************************************************************
+    inline uint64_t mix(uint64_t hash)
+    {
+      hash ^= hash >> 33U;
+      hash *= 0xFF51AFD7ED558CCDULL;
+      hash ^= hash >> 33U;
+      hash *= 0xC4CEB9FE1A85EC53ULL;
+      hash ^= hash >> 33U;
+
+      return hash;
+    }
+
+    //*************************************************************************
+    /// The mixed etl::hash of a value.
+    //*************************************************************************
+    template <typename T>
+    uint64_t hash_of(const T& value)
+    {
+      return mix(static_cast<uint64_t>(etl::hash<T>()(value)));
+    }
+
+    //*************************************************************************
+    /// Adds two counts, stopping at the largest count rather than wrapping.
+    //*************************************************************************
+    template <typename TCount>
+    TCount saturating_add(TCount a, TCount b)
+    {
+      const TCount Max = etl::integral_limits<TCount>::max;
+
+      return (b > (Max - a)) ? Max : static_cast<TCount>(a + b);
+    }
+  } // namespace private_sketch
+} // namespace etl
+
+#endif
@@ -36,6 +36,7 @@ SOFTWARE.
   #define ETL_VECTOR_BASE_INCLUDED
 
   #include "../platform.h"
+  #include "../container_statistics.h"
   #include "../debug_count.h"
   #include "../error_handler.h"
   #include "../exception.h"
@@ -142,6 +143,24 @@ namespace etl
       return CAPACITY;
     }
 
+  #if defined(ETL_CONTAINER_STATISTICS)
+    //*************************************************************************
+    /// Returns the occupancy statistics.
+    //*************************************************************************
+    etl::container_statistics& statistics()
+    {
+      return etl_container_statistics;
+    }
+
+    //*************************************************************************
+    /// Returns the occupancy statistics.
+    //*************************************************************************
+    const etl::container_statistics& statistics() const
+    {
+      return etl_container_statistics;
+    }
+  #endif
+
   protected:
 
     //*************************************************************************
@@ -150,6 +169,7 @@ namespace etl
     vector_base(size_t max_size_)
       : CAPACITY(max_size_)
     {
+      ETL_CONTAINER_STATISTICS_INITIALISE("vector", max_size_);
     }
 
     //*************************************************************************
@@ -167,8 +187,9 @@ namespace etl
     ~vector_base() {}
   #endif
 
-    const size_type CAPACITY; ///< The maximum number of elements in the vector.
-    ETL_DECLARE_DEBUG_COUNT;  ///< Internal debugging.
+    const size_type CAPACITY;         ///< The maximum number of elements in the vector.
+    ETL_DECLARE_DEBUG_COUNT;          ///< Internal debugging.
+    ETL_DECLARE_CONTAINER_STATISTICS; ///< Occupancy profile.
   };
 } // namespace etl
 
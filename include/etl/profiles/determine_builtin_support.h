@@ -80,6 +80,10 @@ SOFTWARE.
   #if !defined(ETL_USING_BUILTIN_MEMCHR)
     #define ETL_USING_BUILTIN_MEMCHR 1
   #endif
+
+  #if !defined(ETL_USING_BUILTIN_PREFETCH)
+    #define ETL_USING_BUILTIN_PREFETCH 1
+  #endif
 #endif
 
 #if defined(__has_builtin) && !defined(ETL_COMPILER_MICROSOFT) // Use __has_builtin to check for
@@ -132,6 +136,10 @@ SOFTWARE.
   #if !defined(ETL_USING_BUILTIN_MEMCHR)
     #define ETL_USING_BUILTIN_MEMCHR __has_builtin(__builtin_memchr)
   #endif
+
+  #if !defined(ETL_USING_BUILTIN_PREFETCH)
+    #define ETL_USING_BUILTIN_PREFETCH __has_builtin(__builtin_prefetch)
+  #endif
 #endif
 
 // The default. Set to 0, if not already set.
@@ -183,6 +191,10 @@ SOFTWARE.
   #define ETL_USING_BUILTIN_MEMCHR 0
 #endif
 
+#if !defined(ETL_USING_BUILTIN_PREFETCH)
+  #define ETL_USING_BUILTIN_PREFETCH 0
+#endif
+
 namespace etl
 {
   namespace traits
@@ -201,6 +213,7 @@ namespace etl
     static ETL_CONSTANT bool using_builtin_memset                     = (ETL_USING_BUILTIN_MEMSET == 1);
     static ETL_CONSTANT bool using_builtin_memcmp                     = (ETL_USING_BUILTIN_MEMCMP == 1);
     static ETL_CONSTANT bool using_builtin_memchr                     = (ETL_USING_BUILTIN_MEMCHR == 1);
+    static ETL_CONSTANT bool using_builtin_prefetch                   = (ETL_USING_BUILTIN_PREFETCH == 1);
   } // namespace traits
 } // namespace etl
 
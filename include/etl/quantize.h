@@ -33,7 +33,9 @@ SOFTWARE.
 
 #include "platform.h"
 #include "functional.h"
+#include "span.h"
 #include "type_traits.h"
+#include "private/algorithm_simd.h"
 
 ////#include <math.h>
 #include <stdint.h>
@@ -75,8 +77,43 @@ namespace etl
       return p_quantizations[n_levels];
     }
 
+    //*****************************************************************
+    /// Quantizes each value of 'input' into 'output'.
+    /// Processes the length of the shorter span and returns it.
+    /// 'output' may be the same as 'input'.
+    /// Arithmetic types with the default compare use the kernels in
+    /// private/algorithm_simd.h if ETL_ALGORITHM_USE_SIMD is defined.
+    //*****************************************************************
+    size_t apply(etl::span<const TInput> input, etl::span<TInput> output) const
+    {
+      const size_t n = (input.size() < output.size()) ? input.size() : output.size();
+
+      apply(input.data(), output.data(), n, use_kernel());
+
+      return n;
+    }
+
   private:
 
+    typedef etl::integral_constant<bool, etl::private_algorithm_simd::use_compare_kernel<const TInput*, TInput>::value
+                                           && etl::is_same<TCompare, etl::less<TInput> >::value>
+      use_kernel;
+
+    //*****************************************************************
+    void apply(const TInput* input, TInput* output, size_t n, etl::false_type /*use_kernel*/) const
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        output[i] = operator()(input[i]);
+      }
+    }
+
+    //*****************************************************************
+    void apply(const TInput* input, TInput* output, size_t n, etl::true_type /*use_kernel*/) const
+    {
+      etl::private_algorithm_simd::quantize(input, output, n, p_thresholds, p_quantizations, n_levels);
+    }
+
     const TInput* const p_thresholds;
     const TInput* const p_quantizations;
     const size_t        n_levels;
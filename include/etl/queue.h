@@ -33,6 +33,7 @@ SOFTWARE.
 
 #include "platform.h"
 #include "alignment.h"
+#include "container_statistics.h"
 #include "debug_count.h"
 #include "error_handler.h"
 #include "exception.h"
@@ -160,6 +161,24 @@ namespace etl
       return max_size() - size();
     }
 
+#if defined(ETL_CONTAINER_STATISTICS)
+    //*************************************************************************
+    /// Returns the occupancy statistics.
+    //*************************************************************************
+    etl::container_statistics& statistics()
+    {
+      return etl_container_statistics;
+    }
+
+    //*************************************************************************
+    /// Returns the occupancy statistics.
+    //*************************************************************************
+    const etl::container_statistics& statistics() const
+    {
+      return etl_container_statistics;
+    }
+#endif
+
   protected:
 
     //*************************************************************************
@@ -171,6 +190,7 @@ namespace etl
       , current_size(0)
       , CAPACITY(max_size_)
     {
+      ETL_CONTAINER_STATISTICS_INITIALISE("queue", max_size_);
     }
 
     //*************************************************************************
@@ -190,6 +210,7 @@ namespace etl
 
       ++current_size;
       ETL_INCREMENT_DEBUG_COUNT;
+      ETL_CONTAINER_STATISTICS_SIZE(current_size);
     }
 
     //*************************************************************************
@@ -219,8 +240,9 @@ namespace etl
     size_type       in;           ///< Where to input new data.
     size_type       out;          ///< Where to get the oldest data.
     size_type       current_size; ///< The number of items in the queue.
-    const size_type CAPACITY;     ///< The maximum number of items in the queue.
-    ETL_DECLARE_DEBUG_COUNT;      ///< For internal debugging purposes.
+    const size_type CAPACITY;         ///< The maximum number of items in the queue.
+    ETL_DECLARE_DEBUG_COUNT;          ///< For internal debugging purposes.
+    ETL_DECLARE_CONTAINER_STATISTICS; ///< Occupancy profile.
   };
 
   //***************************************************************************
@@ -318,6 +340,7 @@ namespace etl
     //*************************************************************************
     void push(const_reference value)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT_CHECK_PUSH_POP_OR_RETURN(!full(), ETL_ERROR(queue_full));
 
       ::new (&p_buffer[in]) T(value);
@@ -333,6 +356,7 @@ namespace etl
     //*************************************************************************
     void push(rvalue_reference value)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT_CHECK_PUSH_POP_OR_RETURN(!full(), ETL_ERROR(queue_full));
 
       ::new (&p_buffer[in]) T(etl::move(value));
@@ -351,6 +375,7 @@ namespace etl
     template <typename... Args>
     reference emplace(Args&&... args)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT_CHECK_PUSH_POP(!full(), ETL_ERROR(queue_full));
 
       reference value = p_buffer[in];
@@ -366,6 +391,7 @@ namespace etl
     //*************************************************************************
     reference emplace()
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT_CHECK_PUSH_POP(!full(), ETL_ERROR(queue_full));
 
       reference value = p_buffer[in];
@@ -384,6 +410,7 @@ namespace etl
     template <typename T1>
     reference emplace(const T1& value1)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT_CHECK_PUSH_POP(!full(), ETL_ERROR(queue_full));
 
       reference value = p_buffer[in];
@@ -403,6 +430,7 @@ namespace etl
     template <typename T1, typename T2>
     reference emplace(const T1& value1, const T2& value2)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT_CHECK_PUSH_POP(!full(), ETL_ERROR(queue_full));
 
       reference value = p_buffer[in];
@@ -423,6 +451,7 @@ namespace etl
     template <typename T1, typename T2, typename T3>
     reference emplace(const T1& value1, const T2& value2, const T3& value3)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT_CHECK_PUSH_POP(!full(), ETL_ERROR(queue_full));
 
       reference value = p_buffer[in];
@@ -444,6 +473,7 @@ namespace etl
     template <typename T1, typename T2, typename T3, typename T4>
     reference emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT_CHECK_PUSH_POP(!full(), ETL_ERROR(queue_full));
 
       reference value = p_buffer[in];
@@ -34,6 +34,7 @@ SOFTWARE.
 #include "platform.h"
 #include "alignment.h"
 #include "atomic.h"
+#include "container_statistics.h"
 #include "integral_limits.h"
 #include "memory_model.h"
 #include "parameter_type.h"
@@ -125,6 +126,26 @@ namespace etl
       return Reserved - 1;
     }
 
+  #if defined(ETL_CONTAINER_STATISTICS)
+    //*************************************************************************
+    /// Returns the occupancy statistics.
+    /// Read from the 'push' thread or when the queue is idle.
+    //*************************************************************************
+    etl::container_statistics& statistics()
+    {
+      return this->etl_container_statistics;
+    }
+
+    //*************************************************************************
+    /// Returns the occupancy statistics.
+    /// Read from the 'push' thread or when the queue is idle.
+    //*************************************************************************
+    const etl::container_statistics& statistics() const
+    {
+      return this->etl_container_statistics;
+    }
+  #endif
+
   protected:
 
     queue_spsc_atomic_base(size_type reserved_)
@@ -132,6 +153,7 @@ namespace etl
       , read(0)
       , Reserved(reserved_)
     {
+      ETL_CONTAINER_STATISTICS_INITIALISE("queue_spsc_atomic", reserved_ - 1);
     }
 
     //*************************************************************************
@@ -153,6 +175,8 @@ namespace etl
     etl::atomic<size_type> read;     ///< Where to get the oldest data.
     const size_type        Reserved; ///< The maximum number of items in the queue.
 
+    ETL_DECLARE_CONTAINER_STATISTICS; ///< Occupancy profile. Written by the 'push' thread only.
+
   private:
 
       //*************************************************************************
@@ -217,11 +241,13 @@ namespace etl
         ::new (&p_buffer[write_index]) T(value);
 
         write.store(next_index, etl::memory_order_release);
+        ETL_CONTAINER_STATISTICS_SIZE(this->size());
 
         return true;
       }
 
       // Queue is full.
+      ETL_CONTAINER_STATISTICS_REJECT;
       return false;
     }
 
@@ -239,11 +265,13 @@ namespace etl
         ::new (&p_buffer[write_index]) T(etl::move(value));
 
         write.store(next_index, etl::memory_order_release);
+        ETL_CONTAINER_STATISTICS_SIZE(this->size());
 
         return true;
       }
 
       // Queue is full.
+      ETL_CONTAINER_STATISTICS_REJECT;
       return false;
     }
   #endif
@@ -265,11 +293,13 @@ namespace etl
         ::new (&p_buffer[write_index]) T(etl::forward<Args>(args)...);
 
         write.store(next_index, etl::memory_order_release);
+        ETL_CONTAINER_STATISTICS_SIZE(this->size());
 
         return true;
       }
 
       // Queue is full.
+      ETL_CONTAINER_STATISTICS_REJECT;
       return false;
     }
   #else
@@ -288,11 +318,13 @@ namespace etl
         ::new (&p_buffer[write_index]) T();
 
         write.store(next_index, etl::memory_order_release);
+        ETL_CONTAINER_STATISTICS_SIZE(this->size());
 
         return true;
       }
 
       // Queue is full.
+      ETL_CONTAINER_STATISTICS_REJECT;
       return false;
     }
 
@@ -312,11 +344,13 @@ namespace etl
         ::new (&p_buffer[write_index]) T(value1);
 
         write.store(next_index, etl::memory_order_release);
+        ETL_CONTAINER_STATISTICS_SIZE(this->size());
 
         return true;
       }
 
       // Queue is full.
+      ETL_CONTAINER_STATISTICS_REJECT;
       return false;
     }
 
@@ -336,11 +370,13 @@ namespace etl
         ::new (&p_buffer[write_index]) T(value1, value2);
 
         write.store(next_index, etl::memory_order_release);
+        ETL_CONTAINER_STATISTICS_SIZE(this->size());
 
         return true;
       }
 
       // Queue is full.
+      ETL_CONTAINER_STATISTICS_REJECT;
       return false;
     }
 
@@ -360,11 +396,13 @@ namespace etl
         ::new (&p_buffer[write_index]) T(value1, value2, value3);
 
         write.store(next_index, etl::memory_order_release);
+        ETL_CONTAINER_STATISTICS_SIZE(this->size());
 
         return true;
       }
 
       // Queue is full.
+      ETL_CONTAINER_STATISTICS_REJECT;
       return false;
     }
 
@@ -384,11 +422,13 @@ namespace etl
         ::new (&p_buffer[write_index]) T(value1, value2, value3, value4);
 
         write.store(next_index, etl::memory_order_release);
+        ETL_CONTAINER_STATISTICS_SIZE(this->size());
 
         return true;
       }
 
       // Queue is full.
+      ETL_CONTAINER_STATISTICS_REJECT;
       return false;
     }
   #endif
@@ -0,0 +1,2157 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_RADIX_TREE_INCLUDED
+#define ETL_RADIX_TREE_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "debug_count.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "iterator.h"
+#include "nullptr.h"
+#include "placement_new.h"
+#include "pool.h"
+#include "static_assert.h"
+#include "string_view.h"
+#include "utility.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup radix_tree radix_tree
+/// A map from string keys to values, held in an adaptive radix tree with the
+/// capacity defined at compile time.
+/// Runs of bytes shared by every key below a node are compressed into the
+/// node, and each node is sized for the number of children that it has, so a
+/// lookup costs one step per distinct byte of the key, rather than a full key
+/// comparison at every level of an etl::map.
+/// Keys are ordered byte by byte, as unsigned char, with a key before any
+/// longer key that it is a prefix of.
+/// Inserting or erasing invalidates all iterators to other values.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the radix trees.
+  ///\ingroup radix_tree
+  //***************************************************************************
+  class radix_tree_exception : public etl::exception
+  {
+  public:
+
+    radix_tree_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the radix trees.
+  ///\ingroup radix_tree
+  //***************************************************************************
+  class radix_tree_full : public etl::radix_tree_exception
+  {
+  public:
+
+    radix_tree_full(string_type file_name_, numeric_type line_number_)
+      : etl::radix_tree_exception(ETL_ERROR_TEXT("radix_tree:full", ETL_RADIX_TREE_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Key too long exception for the radix trees.
+  ///\ingroup radix_tree
+  //***************************************************************************
+  class radix_tree_key_length : public etl::radix_tree_exception
+  {
+  public:
+
+    radix_tree_key_length(string_type file_name_, numeric_type line_number_)
+      : etl::radix_tree_exception(ETL_ERROR_TEXT("radix_tree:key length", ETL_RADIX_TREE_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_radix_tree
+  {
+    //*************************************************************************
+    /// The most nodes of a kind that Size keys can need.
+    /// Every inner node leads to at least two keys, either as children or as
+    /// the key that ends at the node, so the number of nodes with at least
+    /// Minimum outgoing links cannot exceed (Size - 1) / (Minimum - 1).
+    /// Never zero.
+    //*************************************************************************
+    template <size_t Size, size_t Minimum>
+    struct inner_nodes
+    {
+      static ETL_CONSTANT size_t Count = (Size < 2U) ? 0U : ((Size - 1U) / (Minimum - 1U));
+      static ETL_CONSTANT size_t value = (Count == 0U) ? 1U : Count;
+    };
+
+    template <size_t Size, size_t Minimum>
+    ETL_CONSTANT size_t inner_nodes<Size, Minimum>::value;
+  } // namespace private_radix_tree
+
+  //***************************************************************************
+  /// The base class for all radix trees.
+  ///\ingroup radix_tree
+  //***************************************************************************
+  class radix_tree_base
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// Gets the number of values.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible number of values.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the tree is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the tree is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return max_size() - size();
+    }
+
+  protected:
+
+    // The sizes at which inner nodes shrink to the next smaller kind.
+    // They are below the sizes at which they grow, so that a node does not
+    // change kind on every insert and erase at the boundary.
+    static ETL_CONSTANT size_t Node16_Shrink  = 3U;
+    static ETL_CONSTANT size_t Node48_Shrink  = 12U;
+    static ETL_CONSTANT size_t Node256_Shrink = 40U;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit radix_tree_base(size_type max_size_)
+      : current_size(0U)
+      , CAPACITY(max_size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~radix_tree_base() {}
+
+    size_type       current_size; ///< The number of values.
+    const size_type CAPACITY;     ///< The maximum number of values.
+    ETL_DECLARE_DEBUG_COUNT;
+  };
+
+  //***************************************************************************
+  /// A radix tree of string keys, each no longer than MAX_KEY_LENGTH_.
+  /// Every key is held, with its value, in a leaf. Leaves are linked in key
+  /// order. Inner nodes hold 4, 16, 48 or 256 children, and the number of
+  /// key bytes that every key below them shares. Those bytes are read from
+  /// any one of the leaves below the node.
+  ///\ingroup radix_tree
+  //***************************************************************************
+  template <typename TValue, const size_t MAX_KEY_LENGTH_>
+  class iradix_tree : public etl::radix_tree_base
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_KEY_LENGTH_ > 0U, "Keys must be allowed at least one character");
+
+    typedef etl::string_view  key_type;
+    typedef TValue            value_type;
+    typedef TValue            mapped_type;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&& rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    static ETL_CONSTANT size_t MAX_KEY_LENGTH = MAX_KEY_LENGTH_;
+
+  protected:
+
+    enum
+    {
+      Leaf,
+      Node4,
+      Node16,
+      Node48,
+      Node256
+    };
+
+    //*************************************************************************
+    /// The common part of leaves and inner nodes.
+    //*************************************************************************
+    struct node
+    {
+      explicit node(uint8_t type_)
+        : type(type_)
+      {
+      }
+
+      uint8_t type;
+    };
+
+    //*************************************************************************
+    /// A key and its value.
+    //*************************************************************************
+    struct leaf : public node
+    {
+      explicit leaf(const value_type& value_)
+        : node(Leaf)
+        , previous(ETL_NULLPTR)
+        , next(ETL_NULLPTR)
+        , length(0U)
+        , value(value_)
+      {
+      }
+
+#if ETL_USING_CPP11
+      explicit leaf(rvalue_reference value_)
+        : node(Leaf)
+        , previous(ETL_NULLPTR)
+        , next(ETL_NULLPTR)
+        , length(0U)
+        , value(etl::move(value_))
+      {
+      }
+#endif
+
+      leaf*      previous;
+      leaf*      next;
+      size_t     length;
+      value_type value;
+      char       key[MAX_KEY_LENGTH_];
+    };
+
+    //*************************************************************************
+    /// The common part of inner nodes.
+    /// The prefix is the prefix_length bytes that every key below shares from
+    /// the depth of the node. p_source is a leaf below to read them from.
+    /// p_terminal is the leaf whose key ends after the prefix, if there is one.
+    //*************************************************************************
+    struct inner_node : public node
+    {
+      explicit inner_node(uint8_t type_)
+        : node(type_)
+        , count(0U)
+        , prefix_length(0U)
+        , p_source(ETL_NULLPTR)
+        , p_terminal(ETL_NULLPTR)
+      {
+      }
+
+      size_t count;
+      size_t prefix_length;
+      leaf*  p_source;
+      leaf*  p_terminal;
+    };
+
+    //*************************************************************************
+    /// Up to 4 children, with the key bytes in order.
+    //*************************************************************************
+    struct node4 : public inner_node
+    {
+      node4()
+        : inner_node(Node4)
+      {
+      }
+
+      uint8_t keys[4];
+      node*   children[4];
+    };
+
+    //*************************************************************************
+    /// Up to 16 children, with the key bytes in order.
+    //*************************************************************************
+    struct node16 : public inner_node
+    {
+      node16()
+        : inner_node(Node16)
+      {
+      }
+
+      uint8_t keys[16];
+      node*   children[16];
+    };
+
+    //*************************************************************************
+    /// Up to 48 children, with an index from key byte to child slot + 1.
+    //*************************************************************************
+    struct node48 : public inner_node
+    {
+      node48()
+        : inner_node(Node48)
+      {
+        etl::fill_n(index, 256U, uint8_t(0U));
+        etl::fill_n(children, 48U, static_cast<node*>(ETL_NULLPTR));
+      }
+
+      uint8_t index[256];
+      node*   children[48];
+    };
+
+    //*************************************************************************
+    /// A child for every key byte.
+    //*************************************************************************
+    struct node256 : public inner_node
+    {
+      node256()
+        : inner_node(Node256)
+      {
+        etl::fill_n(children, 256U, static_cast<node*>(ETL_NULLPTR));
+      }
+
+      node* children[256];
+    };
+
+  public:
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type>
+    {
+    public:
+
+      friend class iradix_tree;
+      friend class const_iterator;
+
+      iterator()
+        : p_tree(ETL_NULLPTR)
+        , p_leaf(ETL_NULLPTR)
+      {
+      }
+
+      iterator(iradix_tree& tree, leaf* p_leaf_)
+        : p_tree(&tree)
+        , p_leaf(p_leaf_)
+      {
+      }
+
+      iterator& operator++()
+      {
+        p_leaf = p_leaf->next;
+        return *this;
+      }
+
+      iterator operator++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      iterator& operator--()
+      {
+        p_leaf = (p_leaf == ETL_NULLPTR) ? p_tree->p_last : p_leaf->previous;
+        return *this;
+      }
+
+      iterator operator--(int)
+      {
+        iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      //***********************************
+      /// The key of the value.
+      //***********************************
+      key_type key() const
+      {
+        return key_type(p_leaf->key, p_leaf->length);
+      }
+
+      reference operator*() const
+      {
+        return p_leaf->value;
+      }
+
+      pointer operator&() const
+      {
+        return &(p_leaf->value);
+      }
+
+      pointer operator->() const
+      {
+        return &(p_leaf->value);
+      }
+
+      friend bool operator==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p_leaf == rhs.p_leaf;
+      }
+
+      friend bool operator!=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      iradix_tree* p_tree;
+      leaf*        p_leaf;
+    };
+
+    //*************************************************************************
+    /// const_iterator.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class iradix_tree;
+
+      const_iterator()
+        : p_tree(ETL_NULLPTR)
+        , p_leaf(ETL_NULLPTR)
+      {
+      }
+
+      const_iterator(const iradix_tree& tree, const leaf* p_leaf_)
+        : p_tree(&tree)
+        , p_leaf(p_leaf_)
+      {
+      }
+
+      const_iterator(const typename iradix_tree::iterator& other)
+        : p_tree(other.p_tree)
+        , p_leaf(other.p_leaf)
+      {
+      }
+
+      const_iterator& operator++()
+      {
+        p_leaf = p_leaf->next;
+        return *this;
+      }
+
+      const_iterator operator++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const_iterator& operator--()
+      {
+        p_leaf = (p_leaf == ETL_NULLPTR) ? p_tree->p_last : p_leaf->previous;
+        return *this;
+      }
+
+      const_iterator operator--(int)
+      {
+        const_iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      //***********************************
+      /// The key of the value.
+      //***********************************
+      key_type key() const
+      {
+        return key_type(p_leaf->key, p_leaf->length);
+      }
+
+      const_reference operator*() const
+      {
+        return p_leaf->value;
+      }
+
+      const_pointer operator&() const
+      {
+        return &(p_leaf->value);
+      }
+
+      const_pointer operator->() const
+      {
+        return &(p_leaf->value);
+      }
+
+      friend bool operator==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.p_leaf == rhs.p_leaf;
+      }
+
+      friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const iradix_tree* p_tree;
+      const leaf*        p_leaf;
+    };
+
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Gets the beginning of the tree.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(*this, p_first);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the tree.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(*this, p_first);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the tree.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(*this, ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the tree.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(*this, ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the tree.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(*this, p_first);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the tree.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(*this, ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the tree.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the tree.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the tree.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the tree.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the tree.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the tree.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Clears the tree.
+    //*************************************************************************
+    void clear()
+    {
+      leaf* p_leaf = p_first;
+
+      while (p_leaf != ETL_NULLPTR)
+      {
+        leaf* p_next = p_leaf->next;
+        p_leaf_pool->destroy(p_leaf);
+        p_leaf = p_next;
+      }
+
+      p_node4_pool->release_all();
+      p_node16_pool->release_all();
+      p_node48_pool->release_all();
+      p_node256_pool->release_all();
+
+      p_root       = ETL_NULLPTR;
+      p_first      = ETL_NULLPTR;
+      p_last       = ETL_NULLPTR;
+      current_size = 0U;
+      ETL_RESET_DEBUG_COUNT;
+    }
+
+    //*************************************************************************
+    /// Inserts a value with the key, if the key is not already in the tree.
+    /// If asserts or exceptions are enabled, emits radix_tree_full if the tree
+    /// is full, or radix_tree_key_length if the key is too long.
+    ///\return An iterator to the value with the key and true if it was inserted.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(key_type key, const_reference value)
+    {
+      node** p_slot = ETL_NULLPTR;
+      size_t depth  = 0U;
+
+      ETL_OR_STD::pair<iterator, bool> result = insert_position(key, p_slot, depth);
+
+      if (result.second)
+      {
+        result.first.p_leaf = add_leaf(key, p_slot, depth, p_leaf_pool->template create<leaf>(value));
+      }
+
+      return result;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Inserts a value with the key, if the key is not already in the tree.
+    /// If asserts or exceptions are enabled, emits radix_tree_full if the tree
+    /// is full, or radix_tree_key_length if the key is too long.
+    ///\return An iterator to the value with the key and true if it was inserted.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(key_type key, rvalue_reference value)
+    {
+      node** p_slot = ETL_NULLPTR;
+      size_t depth  = 0U;
+
+      ETL_OR_STD::pair<iterator, bool> result = insert_position(key, p_slot, depth);
+
+      if (result.second)
+      {
+        result.first.p_leaf = add_leaf(key, p_slot, depth, p_leaf_pool->template create<leaf>(etl::move(value)));
+      }
+
+      return result;
+    }
+#endif
+
+    //*************************************************************************
+    /// Erases the value with the key.
+    ///\return The number of values erased, 0 or 1.
+    //*************************************************************************
+    size_t erase(key_type key)
+    {
+      node**      p_slot        = &p_root;
+      node**      p_parent_slot = ETL_NULLPTR;
+      inner_node* p_parent      = ETL_NULLPTR;
+      uint8_t     byte          = 0U;
+      size_t      depth         = 0U;
+
+      while ((*p_slot != ETL_NULLPTR) && ((*p_slot)->type != Leaf))
+      {
+        inner_node& inner = static_cast<inner_node&>(**p_slot);
+
+        depth += inner.prefix_length;
+
+        if (depth >= key.size())
+        {
+          if ((depth == key.size()) && (inner.p_terminal != ETL_NULLPTR) && key_equals(*inner.p_terminal, key))
+          {
+            leaf* p_leaf     = inner.p_terminal;
+            inner.p_terminal = ETL_NULLPTR;
+            tidy(p_slot);
+            remove_leaf(p_leaf, key);
+
+            return 1U;
+          }
+
+          return 0U;
+        }
+
+        byte = static_cast<uint8_t>(key[depth]);
+
+        node** p_child = find_child(inner, byte);
+
+        if (p_child == ETL_NULLPTR)
+        {
+          return 0U;
+        }
+
+        p_parent_slot = p_slot;
+        p_parent      = &inner;
+        p_slot        = p_child;
+        ++depth;
+      }
+
+      if ((*p_slot == ETL_NULLPTR) || !key_equals(static_cast<leaf&>(**p_slot), key))
+      {
+        return 0U;
+      }
+
+      leaf* p_leaf = static_cast<leaf*>(*p_slot);
+
+      if (p_parent == ETL_NULLPTR)
+      {
+        p_root = ETL_NULLPTR;
+      }
+      else
+      {
+        remove_child(*p_parent, byte);
+        tidy(p_parent_slot);
+      }
+
+      remove_leaf(p_leaf, key);
+
+      return 1U;
+    }
+
+    //*************************************************************************
+    /// Erases the value at the position.
+    ///\return An iterator to the next value.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      leaf* p_next = position.p_leaf->next;
+
+      // The key is read from the leaf, which is destroyed last.
+      erase(position.key());
+
+      return iterator(*this, p_next);
+    }
+
+    //*************************************************************************
+    /// Finds the value with the key.
+    ///\return An iterator to the value, or end() if the key is not in the tree.
+    //*************************************************************************
+    iterator find(key_type key)
+    {
+      return iterator(*this, const_cast<leaf*>(find_leaf(key)));
+    }
+
+    //*************************************************************************
+    /// Finds the value with the key.
+    ///\return An iterator to the value, or end() if the key is not in the tree.
+    //*************************************************************************
+    const_iterator find(key_type key) const
+    {
+      return const_iterator(*this, find_leaf(key));
+    }
+
+    //*************************************************************************
+    /// Checks if the tree contains the key.
+    //*************************************************************************
+    bool contains(key_type key) const
+    {
+      return find_leaf(key) != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Counts the values with the key, 0 or 1.
+    //*************************************************************************
+    size_t count(key_type key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*************************************************************************
+    /// Finds the value with the longest key that is a prefix of the key,
+    /// including the key itself.
+    ///\return An iterator to the value, or end() if no key is a prefix.
+    //*************************************************************************
+    iterator longest_prefix_match(key_type key)
+    {
+      return iterator(*this, const_cast<leaf*>(find_longest_prefix(key)));
+    }
+
+    //*************************************************************************
+    /// Finds the value with the longest key that is a prefix of the key,
+    /// including the key itself.
+    ///\return An iterator to the value, or end() if no key is a prefix.
+    //*************************************************************************
+    const_iterator longest_prefix_match(key_type key) const
+    {
+      return const_iterator(*this, find_longest_prefix(key));
+    }
+
+    //*************************************************************************
+    /// Gets the range of the values with keys that start with the prefix.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, iterator> prefix_range(key_type prefix)
+    {
+      const ETL_OR_STD::pair<const leaf*, const leaf*> range = find_prefix_range(prefix);
+
+      return ETL_OR_STD::make_pair(iterator(*this, const_cast<leaf*>(range.first)), iterator(*this, const_cast<leaf*>(range.second)));
+    }
+
+    //*************************************************************************
+    /// Gets the range of the values with keys that start with the prefix.
+    //*************************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> prefix_range(key_type prefix) const
+    {
+      const ETL_OR_STD::pair<const leaf*, const leaf*> range = find_prefix_range(prefix);
+
+      return ETL_OR_STD::make_pair(const_iterator(*this, range.first), const_iterator(*this, range.second));
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iradix_tree(etl::ipool& leaf_pool, etl::ipool& node4_pool, etl::ipool& node16_pool, etl::ipool& node48_pool, etl::ipool& node256_pool,
+                size_t max_size_)
+      : etl::radix_tree_base(max_size_)
+      , p_leaf_pool(&leaf_pool)
+      , p_node4_pool(&node4_pool)
+      , p_node16_pool(&node16_pool)
+      , p_node48_pool(&node48_pool)
+      , p_node256_pool(&node256_pool)
+      , p_root(ETL_NULLPTR)
+      , p_first(ETL_NULLPTR)
+      , p_last(ETL_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Initialise the tree.
+    //*************************************************************************
+    void initialise()
+    {
+      clear();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Checks the leaf's key against the key.
+    //*************************************************************************
+    static bool key_equals(const leaf& l, key_type key)
+    {
+      return (l.length == key.size()) && etl::equal(key.begin(), key.end(), l.key);
+    }
+
+    //*************************************************************************
+    /// Finds the leaf with the key.
+    /// Prefixes are skipped on the way down. The key is checked at the leaf.
+    //*************************************************************************
+    const leaf* find_leaf(key_type key) const
+    {
+      const node* p_node = p_root;
+      size_t      depth  = 0U;
+
+      while ((p_node != ETL_NULLPTR) && (p_node->type != Leaf))
+      {
+        const inner_node& inner = static_cast<const inner_node&>(*p_node);
+
+        depth += inner.prefix_length;
+
+        if (depth >= key.size())
+        {
+          p_node = (depth == key.size()) ? inner.p_terminal : ETL_NULLPTR;
+        }
+        else
+        {
+          node* const* p_child = find_child(inner, static_cast<uint8_t>(key[depth]));
+
+          p_node = (p_child == ETL_NULLPTR) ? ETL_NULLPTR : *p_child;
+          ++depth;
+        }
+      }
+
+      if ((p_node != ETL_NULLPTR) && key_equals(static_cast<const leaf&>(*p_node), key))
+      {
+        return static_cast<const leaf*>(p_node);
+      }
+
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Checks that the node's prefix matches the key from the depth.
+    /// A key that ends within the prefix does not match.
+    //*************************************************************************
+    static bool prefix_matches(const inner_node& inner, key_type key, size_t depth)
+    {
+      if ((depth + inner.prefix_length) > key.size())
+      {
+        return false;
+      }
+
+      const char* source = inner.p_source->key + depth;
+
+      return etl::equal(source, source + inner.prefix_length, key.data() + depth);
+    }
+
+    //*************************************************************************
+    /// Finds the leaf with the longest key that is a prefix of the key.
+    //*************************************************************************
+    const leaf* find_longest_prefix(key_type key) const
+    {
+      const leaf* p_best = ETL_NULLPTR;
+      const node* p_node = p_root;
+      size_t      depth  = 0U;
+
+      while (p_node != ETL_NULLPTR)
+      {
+        if (p_node->type == Leaf)
+        {
+          const leaf& l = static_cast<const leaf&>(*p_node);
+
+          // The bytes before the depth have already been matched.
+          if ((l.length <= key.size()) && etl::equal(l.key + depth, l.key + l.length, key.data() + depth))
+          {
+            p_best = &l;
+          }
+
+          break;
+        }
+
+        const inner_node& inner = static_cast<const inner_node&>(*p_node);
+
+        if (!prefix_matches(inner, key, depth))
+        {
+          break;
+        }
+
+        depth += inner.prefix_length;
+
+        if (inner.p_terminal != ETL_NULLPTR)
+        {
+          p_best = inner.p_terminal;
+        }
+
+        if (depth == key.size())
+        {
+          break;
+        }
+
+        node* const* p_child = find_child(inner, static_cast<uint8_t>(key[depth]));
+
+        p_node = (p_child == ETL_NULLPTR) ? ETL_NULLPTR : *p_child;
+        ++depth;
+      }
+
+      return p_best;
+    }
+
+    //*************************************************************************
+    /// Finds the first leaf with a key that starts with the prefix, and the
+    /// leaf after the last.
+    //*************************************************************************
+    ETL_OR_STD::pair<const leaf*, const leaf*> find_prefix_range(key_type prefix) const
+    {
+      const node* p_node = p_root;
+      size_t      depth  = 0U;
+
+      while (p_node != ETL_NULLPTR)
+      {
+        if (p_node->type == Leaf)
+        {
+          const leaf& l = static_cast<const leaf&>(*p_node);
+
+          if ((l.length >= prefix.size()) && etl::equal(prefix.begin() + depth, prefix.end(), l.key + depth))
+          {
+            return ETL_OR_STD::make_pair(&l, l.next);
+          }
+
+          break;
+        }
+
+        const inner_node& inner = static_cast<const inner_node&>(*p_node);
+
+        // Only the part of the node's prefix within the search prefix is compared.
+        const size_t length = etl::min(inner.prefix_length, prefix.size() - depth);
+        const char*  source = inner.p_source->key + depth;
+
+        if (!etl::equal(source, source + length, prefix.data() + depth))
+        {
+          break;
+        }
+
+        depth += inner.prefix_length;
+
+        if (depth >= prefix.size())
+        {
+          return ETL_OR_STD::make_pair(first_leaf(p_node), last_leaf(p_node)->next);
+        }
+
+        node* const* p_child = find_child(inner, static_cast<uint8_t>(prefix[depth]));
+
+        p_node = (p_child == ETL_NULLPTR) ? ETL_NULLPTR : *p_child;
+        ++depth;
+      }
+
+      return ETL_OR_STD::pair<const leaf*, const leaf*>(ETL_NULLPTR, ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    /// Finds where the key belongs.
+    /// Sets the slot of the node where the key leaves the tree, and the depth
+    /// of the key at the start of the node.
+    ///\return An iterator to the value with the key and false, or true in
+    /// second if the key is not in the tree and there is room for it.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert_position(key_type key, node**& p_slot, size_t& depth)
+    {
+      const ETL_OR_STD::pair<iterator, bool> failed(end(), false);
+
+      if (key.size() > MAX_KEY_LENGTH)
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(radix_tree_key_length));
+        return failed;
+      }
+
+      p_slot = &p_root;
+      depth  = 0U;
+
+      while ((*p_slot != ETL_NULLPTR) && ((*p_slot)->type != Leaf))
+      {
+        inner_node& inner = static_cast<inner_node&>(**p_slot);
+
+        if (!prefix_matches(inner, key, depth))
+        {
+          break;
+        }
+
+        const size_t next_depth = depth + inner.prefix_length;
+
+        if (next_depth == key.size())
+        {
+          if (inner.p_terminal != ETL_NULLPTR)
+          {
+            return ETL_OR_STD::make_pair(iterator(*this, inner.p_terminal), false);
+          }
+
+          break;
+        }
+
+        node** p_child = find_child(inner, static_cast<uint8_t>(key[next_depth]));
+
+        if (p_child == ETL_NULLPTR)
+        {
+          break;
+        }
+
+        p_slot = p_child;
+        depth  = next_depth + 1U;
+      }
+
+      if ((*p_slot != ETL_NULLPTR) && ((*p_slot)->type == Leaf) && key_equals(static_cast<leaf&>(**p_slot), key))
+      {
+        return ETL_OR_STD::make_pair(iterator(*this, static_cast<leaf*>(*p_slot)), false);
+      }
+
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(radix_tree_full));
+        return failed;
+      }
+
+      return ETL_OR_STD::make_pair(end(), true);
+    }
+
+    //*************************************************************************
+    /// Adds the new leaf for the key at the slot found by insert_position.
+    /// The slot holds one of:
+    /// Nothing, when the tree is empty.
+    /// A leaf with a different key.
+    /// An inner node whose prefix the key leaves before the end.
+    /// An inner node with no child for the next byte of the key, or whose
+    /// prefix the key ends at.
+    //*************************************************************************
+    leaf* add_leaf(key_type key, node** p_slot, size_t depth, leaf* p_leaf)
+    {
+      // insert_position() has checked the length; the bound lets the compiler see it.
+      etl::copy_n(key.begin(), etl::min(key.size(), MAX_KEY_LENGTH), p_leaf->key);
+      p_leaf->length = key.size();
+
+      if (*p_slot == ETL_NULLPTR)
+      {
+        *p_slot = p_leaf;
+        link_after(p_leaf, ETL_NULLPTR);
+      }
+      else if ((*p_slot)->type == Leaf)
+      {
+        split_leaf(p_slot, depth, p_leaf);
+      }
+      else
+      {
+        inner_node& inner  = static_cast<inner_node&>(**p_slot);
+        const char* source = inner.p_source->key;
+
+        // Find where the key leaves the node's prefix.
+        size_t length = 0U;
+
+        while ((length < inner.prefix_length) && ((depth + length) < p_leaf->length) && (source[depth + length] == p_leaf->key[depth + length]))
+        {
+          ++length;
+        }
+
+        if (length < inner.prefix_length)
+        {
+          split_prefix(p_slot, depth, length, p_leaf);
+        }
+        else if ((depth + length) == p_leaf->length)
+        {
+          link_before(p_leaf, first_leaf(&inner));
+          inner.p_terminal = p_leaf;
+        }
+        else
+        {
+          add_leaf_child(p_slot, static_cast<uint8_t>(p_leaf->key[depth + length]), p_leaf);
+        }
+      }
+
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return p_leaf;
+    }
+
+    //*************************************************************************
+    /// Replaces a leaf with a node holding it and the new leaf, with the bytes
+    /// that their keys share as its prefix.
+    //*************************************************************************
+    void split_leaf(node** p_slot, size_t depth, leaf* p_leaf)
+    {
+      leaf* p_other = static_cast<leaf*>(*p_slot);
+
+      const size_t limit = etl::min(p_leaf->length, p_other->length);
+
+      size_t common = depth;
+
+      while ((common < limit) && (p_leaf->key[common] == p_other->key[common]))
+      {
+        ++common;
+      }
+
+      node4* p_node         = p_node4_pool->template create<node4>();
+      p_node->prefix_length = common - depth;
+      p_node->p_source      = p_leaf;
+
+      if (common == p_leaf->length)
+      {
+        p_node->p_terminal = p_leaf;
+        add_child(*p_node, static_cast<uint8_t>(p_other->key[common]), p_other);
+        link_before(p_leaf, p_other);
+      }
+      else if (common == p_other->length)
+      {
+        p_node->p_terminal = p_other;
+        add_child(*p_node, static_cast<uint8_t>(p_leaf->key[common]), p_leaf);
+        link_after(p_leaf, p_other);
+      }
+      else
+      {
+        const uint8_t leaf_byte  = static_cast<uint8_t>(p_leaf->key[common]);
+        const uint8_t other_byte = static_cast<uint8_t>(p_other->key[common]);
+
+        add_child(*p_node, leaf_byte, p_leaf);
+        add_child(*p_node, other_byte, p_other);
+
+        if (leaf_byte < other_byte)
+        {
+          link_before(p_leaf, p_other);
+        }
+        else
+        {
+          link_after(p_leaf, p_other);
+        }
+      }
+
+      *p_slot = p_node;
+    }
+
+    //*************************************************************************
+    /// Places a new node above an inner node whose prefix the key leaves after
+    /// length bytes. The new node's prefix is those bytes.
+    //*************************************************************************
+    void split_prefix(node** p_slot, size_t depth, size_t length, leaf* p_leaf)
+    {
+      inner_node& inner = static_cast<inner_node&>(**p_slot);
+
+      const uint8_t inner_byte = static_cast<uint8_t>(inner.p_source->key[depth + length]);
+
+      node4* p_node         = p_node4_pool->template create<node4>();
+      p_node->prefix_length = length;
+      p_node->p_source      = p_leaf;
+
+      // The byte that the key leaves at becomes the link to the old node.
+      inner.prefix_length -= length + 1U;
+      add_child(*p_node, inner_byte, &inner);
+
+      if ((depth + length) == p_leaf->length)
+      {
+        p_node->p_terminal = p_leaf;
+        link_before(p_leaf, first_leaf(&inner));
+      }
+      else
+      {
+        const uint8_t leaf_byte = static_cast<uint8_t>(p_leaf->key[depth + length]);
+
+        add_child(*p_node, leaf_byte, p_leaf);
+
+        if (leaf_byte < inner_byte)
+        {
+          link_before(p_leaf, first_leaf(&inner));
+        }
+        else
+        {
+          link_after(p_leaf, last_leaf(&inner));
+        }
+      }
+
+      *p_slot = p_node;
+    }
+
+    //*************************************************************************
+    /// Adds the new leaf as the child of the node for the byte.
+    //*************************************************************************
+    void add_leaf_child(node** p_slot, uint8_t byte, leaf* p_leaf)
+    {
+      inner_node& inner = static_cast<inner_node&>(**p_slot);
+
+      // The leaf follows the last key before it in the node, or precedes the first after it.
+      const node* p_previous = previous_child(inner, byte);
+
+      if (p_previous != ETL_NULLPTR)
+      {
+        link_after(p_leaf, last_leaf(p_previous));
+      }
+      else if (inner.p_terminal != ETL_NULLPTR)
+      {
+        link_after(p_leaf, inner.p_terminal);
+      }
+      else
+      {
+        // No child precedes the byte, so the first child follows it.
+        link_before(p_leaf, first_leaf(first_child(inner)));
+      }
+
+      if (is_full(inner))
+      {
+        *p_slot = grow(inner);
+      }
+
+      add_child(static_cast<inner_node&>(**p_slot), byte, p_leaf);
+    }
+
+    //*************************************************************************
+    /// Removes a leaf that has been detached from the tree, and replaces it as
+    /// the source of the prefixes of the nodes that used it.
+    //*************************************************************************
+    void remove_leaf(leaf* p_leaf, key_type key)
+    {
+      if (p_leaf->previous == ETL_NULLPTR)
+      {
+        p_first = p_leaf->next;
+      }
+      else
+      {
+        p_leaf->previous->next = p_leaf->next;
+      }
+
+      if (p_leaf->next == ETL_NULLPTR)
+      {
+        p_last = p_leaf->previous;
+      }
+      else
+      {
+        p_leaf->next->previous = p_leaf->previous;
+      }
+
+      // Any node that read its prefix from the leaf was above it.
+      node*  p_node = p_root;
+      size_t depth  = 0U;
+
+      while ((p_node != ETL_NULLPTR) && (p_node->type != Leaf))
+      {
+        inner_node& inner = static_cast<inner_node&>(*p_node);
+
+        if (inner.p_source == p_leaf)
+        {
+          inner.p_source = const_cast<leaf*>(first_leaf(p_node));
+        }
+
+        depth += inner.prefix_length;
+
+        if (depth >= key.size())
+        {
+          break;
+        }
+
+        node** p_child = find_child(inner, static_cast<uint8_t>(key[depth]));
+
+        p_node = (p_child == ETL_NULLPTR) ? ETL_NULLPTR : *p_child;
+        ++depth;
+      }
+
+      p_leaf_pool->destroy(p_leaf);
+
+      --current_size;
+      ETL_DECREMENT_DEBUG_COUNT;
+    }
+
+    //*************************************************************************
+    /// Links the leaf into the list before the next leaf.
+    //*************************************************************************
+    void link_before(leaf* p_leaf, const leaf* p_next)
+    {
+      leaf* p_mutable_next = const_cast<leaf*>(p_next);
+
+      p_leaf->next     = p_mutable_next;
+      p_leaf->previous = p_mutable_next->previous;
+
+      if (p_leaf->previous == ETL_NULLPTR)
+      {
+        p_first = p_leaf;
+      }
+      else
+      {
+        p_leaf->previous->next = p_leaf;
+      }
+
+      p_mutable_next->previous = p_leaf;
+    }
+
+    //*************************************************************************
+    /// Links the leaf into the list after the previous leaf, or as the only
+    /// leaf if there is no previous leaf.
+    //*************************************************************************
+    void link_after(leaf* p_leaf, const leaf* p_previous)
+    {
+      leaf* p_mutable_previous = const_cast<leaf*>(p_previous);
+
+      p_leaf->previous = p_mutable_previous;
+
+      if (p_mutable_previous == ETL_NULLPTR)
+      {
+        p_leaf->next = ETL_NULLPTR;
+        p_first      = p_leaf;
+      }
+      else
+      {
+        p_leaf->next             = p_mutable_previous->next;
+        p_mutable_previous->next = p_leaf;
+      }
+
+      if (p_leaf->next == ETL_NULLPTR)
+      {
+        p_last = p_leaf;
+      }
+      else
+      {
+        p_leaf->next->previous = p_leaf;
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the leaf with the smallest key at or below the node.
+    //*************************************************************************
+    static const leaf* first_leaf(const node* p_node)
+    {
+      while (p_node->type != Leaf)
+      {
+        const inner_node& inner = static_cast<const inner_node&>(*p_node);
+
+        if (inner.p_terminal != ETL_NULLPTR)
+        {
+          return inner.p_terminal;
+        }
+
+        p_node = first_child(inner);
+      }
+
+      return static_cast<const leaf*>(p_node);
+    }
+
+    //*************************************************************************
+    /// Gets the leaf with the largest key at or below the node.
+    //*************************************************************************
+    static const leaf* last_leaf(const node* p_node)
+    {
+      while (p_node->type != Leaf)
+      {
+        p_node = last_child(static_cast<const inner_node&>(*p_node));
+      }
+
+      return static_cast<const leaf*>(p_node);
+    }
+
+    //*************************************************************************
+    /// Gets the child with the smallest byte.
+    /// Every inner node has at least one child, so this never returns null.
+    //*************************************************************************
+    static const node* first_child(const inner_node& inner)
+    {
+      switch (inner.type)
+      {
+        case Node4:  return static_cast<const node4&>(inner).children[0];
+        case Node16: return static_cast<const node16&>(inner).children[0];
+
+        case Node48:
+        {
+          const node48& n = static_cast<const node48&>(inner);
+
+          size_t i = 0U;
+
+          while ((i < 255U) && (n.index[i] == 0U))
+          {
+            ++i;
+          }
+
+          return n.children[n.index[i] - 1U];
+        }
+
+        default:
+        {
+          const node256& n = static_cast<const node256&>(inner);
+
+          size_t i = 0U;
+
+          while ((i < 255U) && (n.children[i] == ETL_NULLPTR))
+          {
+            ++i;
+          }
+
+          return n.children[i];
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the child with the largest byte.
+    /// Every inner node has at least one child, so this never returns null.
+    //*************************************************************************
+    static const node* last_child(const inner_node& inner)
+    {
+      switch (inner.type)
+      {
+        case Node4:  return static_cast<const node4&>(inner).children[inner.count - 1U];
+        case Node16: return static_cast<const node16&>(inner).children[inner.count - 1U];
+
+        case Node48:
+        {
+          const node48& n = static_cast<const node48&>(inner);
+
+          size_t i = 255U;
+
+          while ((i > 0U) && (n.index[i] == 0U))
+          {
+            --i;
+          }
+
+          return n.children[n.index[i] - 1U];
+        }
+
+        default:
+        {
+          const node256& n = static_cast<const node256&>(inner);
+
+          size_t i = 255U;
+
+          while ((i > 0U) && (n.children[i] == ETL_NULLPTR))
+          {
+            --i;
+          }
+
+          return n.children[i];
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Checks if the node has no room for another child.
+    //*************************************************************************
+    static bool is_full(const inner_node& inner)
+    {
+      switch (inner.type)
+      {
+        case Node4:  return inner.count == 4U;
+        case Node16: return inner.count == 16U;
+        case Node48: return inner.count == 48U;
+        default:     return false;
+      }
+    }
+
+    //*************************************************************************
+    /// Finds the child for the byte.
+    ///\return A pointer to the child's link, or null if there is no child.
+    //*************************************************************************
+    static node** find_child(inner_node& inner, uint8_t byte)
+    {
+      return const_cast<node**>(find_child(static_cast<const inner_node&>(inner), byte));
+    }
+
+    static node* const* find_child(const inner_node& inner, uint8_t byte)
+    {
+      switch (inner.type)
+      {
+        case Node4:
+        {
+          const node4& n = static_cast<const node4&>(inner);
+
+          for (size_t i = 0U; i < n.count; ++i)
+          {
+            if (n.keys[i] == byte)
+            {
+              return &n.children[i];
+            }
+          }
+
+          return ETL_NULLPTR;
+        }
+
+        case Node16:
+        {
+          const node16& n = static_cast<const node16&>(inner);
+
+          // Count the smaller keys without branches.
+          size_t index = 0U;
+
+          for (size_t i = 0U; i < n.count; ++i)
+          {
+            index += (n.keys[i] < byte) ? 1U : 0U;
+          }
+
+          return ((index < n.count) && (n.keys[index] == byte)) ? &n.children[index] : ETL_NULLPTR;
+        }
+
+        case Node48:
+        {
+          const node48& n = static_cast<const node48&>(inner);
+
+          return (n.index[byte] == 0U) ? ETL_NULLPTR : &n.children[n.index[byte] - 1U];
+        }
+
+        default:
+        {
+          const node256& n = static_cast<const node256&>(inner);
+
+          return (n.children[byte] == ETL_NULLPTR) ? ETL_NULLPTR : &n.children[byte];
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the child with the largest byte less than the byte, or null.
+    //*************************************************************************
+    static const node* previous_child(const inner_node& inner, int byte)
+    {
+      switch (inner.type)
+      {
+        case Node4:
+        case Node16:
+        {
+          const uint8_t* keys     = (inner.type == Node4) ? static_cast<const node4&>(inner).keys : static_cast<const node16&>(inner).keys;
+          node* const*   children = (inner.type == Node4) ? static_cast<const node4&>(inner).children : static_cast<const node16&>(inner).children;
+
+          for (size_t i = inner.count; i != 0U; --i)
+          {
+            if (keys[i - 1U] < byte)
+            {
+              return children[i - 1U];
+            }
+          }
+
+          return ETL_NULLPTR;
+        }
+
+        case Node48:
+        {
+          const node48& n = static_cast<const node48&>(inner);
+
+          for (int i = byte - 1; i >= 0; --i)
+          {
+            if (n.index[i] != 0U)
+            {
+              return n.children[n.index[i] - 1U];
+            }
+          }
+
+          return ETL_NULLPTR;
+        }
+
+        default:
+        {
+          const node256& n = static_cast<const node256&>(inner);
+
+          for (int i = byte - 1; i >= 0; --i)
+          {
+            if (n.children[i] != ETL_NULLPTR)
+            {
+              return n.children[i];
+            }
+          }
+
+          return ETL_NULLPTR;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a child for the byte to a node that has room for it.
+    //*************************************************************************
+    static void add_child(inner_node& inner, uint8_t byte, node* p_child)
+    {
+      switch (inner.type)
+      {
+        case Node4:
+        {
+          node4& n = static_cast<node4&>(inner);
+          insert_sorted(n.keys, n.children, n.count, byte, p_child);
+          break;
+        }
+
+        case Node16:
+        {
+          node16& n = static_cast<node16&>(inner);
+          insert_sorted(n.keys, n.children, n.count, byte, p_child);
+          break;
+        }
+
+        case Node48:
+        {
+          node48& n = static_cast<node48&>(inner);
+
+          size_t slot = 0U;
+
+          while (n.children[slot] != ETL_NULLPTR)
+          {
+            ++slot;
+          }
+
+          n.children[slot] = p_child;
+          n.index[byte]    = static_cast<uint8_t>(slot + 1U);
+          break;
+        }
+
+        default:
+        {
+          static_cast<node256&>(inner).children[byte] = p_child;
+          break;
+        }
+      }
+
+      ++inner.count;
+    }
+
+    //*************************************************************************
+    /// Inserts a key byte and child into sorted arrays.
+    //*************************************************************************
+    static void insert_sorted(uint8_t* keys, node** children, size_t count, uint8_t byte, node* p_child)
+    {
+      size_t i = count;
+
+      while ((i != 0U) && (keys[i - 1U] > byte))
+      {
+        keys[i]     = keys[i - 1U];
+        children[i] = children[i - 1U];
+        --i;
+      }
+
+      keys[i]     = byte;
+      children[i] = p_child;
+    }
+
+    //*************************************************************************
+    /// Removes the child for the byte.
+    //*************************************************************************
+    static void remove_child(inner_node& inner, uint8_t byte)
+    {
+      switch (inner.type)
+      {
+        case Node4:
+        {
+          node4& n = static_cast<node4&>(inner);
+          erase_sorted(n.keys, n.children, n.count, byte);
+          break;
+        }
+
+        case Node16:
+        {
+          node16& n = static_cast<node16&>(inner);
+          erase_sorted(n.keys, n.children, n.count, byte);
+          break;
+        }
+
+        case Node48:
+        {
+          node48& n = static_cast<node48&>(inner);
+
+          n.children[n.index[byte] - 1U] = ETL_NULLPTR;
+          n.index[byte]                  = 0U;
+          break;
+        }
+
+        default:
+        {
+          static_cast<node256&>(inner).children[byte] = ETL_NULLPTR;
+          break;
+        }
+      }
+
+      --inner.count;
+    }
+
+    //*************************************************************************
+    /// Erases a key byte and child from sorted arrays.
+    //*************************************************************************
+    static void erase_sorted(uint8_t* keys, node** children, size_t count, uint8_t byte)
+    {
+      size_t i = 0U;
+
+      while (keys[i] != byte)
+      {
+        ++i;
+      }
+
+      for (; (i + 1U) < count; ++i)
+      {
+        keys[i]     = keys[i + 1U];
+        children[i] = children[i + 1U];
+      }
+    }
+
+    //*************************************************************************
+    /// Copies the common part of a node that is changing kind.
+    //*************************************************************************
+    static void copy_header(inner_node& destination, const inner_node& source)
+    {
+      destination.count         = source.count;
+      destination.prefix_length = source.prefix_length;
+      destination.p_source      = source.p_source;
+      destination.p_terminal    = source.p_terminal;
+    }
+
+    //*************************************************************************
+    /// Replaces a full node with one of the next larger kind.
+    //*************************************************************************
+    inner_node* grow(inner_node& inner)
+    {
+      switch (inner.type)
+      {
+        case Node4:
+        {
+          node4&  n      = static_cast<node4&>(inner);
+          node16* p_node = p_node16_pool->template create<node16>();
+
+          copy_header(*p_node, n);
+          etl::copy_n(n.keys, n.count, p_node->keys);
+          etl::copy_n(n.children, n.count, p_node->children);
+
+          p_node4_pool->release(&n);
+          return p_node;
+        }
+
+        case Node16:
+        {
+          node16& n      = static_cast<node16&>(inner);
+          node48* p_node = p_node48_pool->template create<node48>();
+
+          copy_header(*p_node, n);
+
+          for (size_t i = 0U; i < n.count; ++i)
+          {
+            p_node->index[n.keys[i]] = static_cast<uint8_t>(i + 1U);
+            p_node->children[i]      = n.children[i];
+          }
+
+          p_node16_pool->release(&n);
+          return p_node;
+        }
+
+        default:
+        {
+          node48&  n      = static_cast<node48&>(inner);
+          node256* p_node = p_node256_pool->template create<node256>();
+
+          copy_header(*p_node, n);
+
+          for (size_t i = 0U; i < 256U; ++i)
+          {
+            if (n.index[i] != 0U)
+            {
+              p_node->children[i] = n.children[n.index[i] - 1U];
+            }
+          }
+
+          p_node48_pool->release(&n);
+          return p_node;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Restores the shape of a node that has lost a child or its terminal.
+    /// A node with one link left is replaced by what it links to. A node that
+    /// has dropped to its shrink size is replaced by one of the next smaller kind.
+    //*************************************************************************
+    void tidy(node** p_slot)
+    {
+      inner_node& inner = static_cast<inner_node&>(**p_slot);
+
+      switch (inner.type)
+      {
+        case Node4:
+        {
+          node4& n = static_cast<node4&>(inner);
+
+          if (n.count == 0U)
+          {
+            *p_slot = n.p_terminal;
+            p_node4_pool->release(&n);
+          }
+          else if ((n.count == 1U) && (n.p_terminal == ETL_NULLPTR))
+          {
+            node* p_child = n.children[0];
+
+            // The node's prefix and link byte are added to the front of the child's prefix.
+            if (p_child->type != Leaf)
+            {
+              static_cast<inner_node*>(p_child)->prefix_length += n.prefix_length + 1U;
+            }
+
+            *p_slot = p_child;
+            p_node4_pool->release(&n);
+          }
+          break;
+        }
+
+        case Node16:
+        {
+          node16& n = static_cast<node16&>(inner);
+
+          if (n.count == Node16_Shrink)
+          {
+            node4* p_node = p_node4_pool->template create<node4>();
+
+            copy_header(*p_node, n);
+            etl::copy_n(n.keys, Node16_Shrink, p_node->keys);
+            etl::copy_n(n.children, Node16_Shrink, p_node->children);
+
+            *p_slot = p_node;
+            p_node16_pool->release(&n);
+          }
+          break;
+        }
+
+        case Node48:
+        {
+          node48& n = static_cast<node48&>(inner);
+
+          if (n.count == Node48_Shrink)
+          {
+            node16* p_node = p_node16_pool->template create<node16>();
+
+            copy_header(*p_node, n);
+
+            size_t j = 0U;
+
+            for (size_t i = 0U; i < 256U; ++i)
+            {
+              if (n.index[i] != 0U)
+              {
+                p_node->keys[j]     = static_cast<uint8_t>(i);
+                p_node->children[j] = n.children[n.index[i] - 1U];
+                ++j;
+              }
+            }
+
+            *p_slot = p_node;
+            p_node48_pool->release(&n);
+          }
+          break;
+        }
+
+        default:
+        {
+          node256& n = static_cast<node256&>(inner);
+
+          if (n.count == Node256_Shrink)
+          {
+            node48* p_node = p_node48_pool->template create<node48>();
+
+            copy_header(*p_node, n);
+
+            size_t j = 0U;
+
+            for (size_t i = 0U; i < 256U; ++i)
+            {
+              if (n.children[i] != ETL_NULLPTR)
+              {
+                p_node->index[i]    = static_cast<uint8_t>(j + 1U);
+                p_node->children[j] = n.children[i];
+                ++j;
+              }
+            }
+
+            *p_slot = p_node;
+            p_node256_pool->release(&n);
+          }
+          break;
+        }
+      }
+    }
+
+    // Disable copy construction.
+    iradix_tree(const iradix_tree&);
+
+    etl::ipool* p_leaf_pool;    ///< The pool of leaves.
+    etl::ipool* p_node4_pool;   ///< The pool of 4 child nodes.
+    etl::ipool* p_node16_pool;  ///< The pool of 16 child nodes.
+    etl::ipool* p_node48_pool;  ///< The pool of 48 child nodes.
+    etl::ipool* p_node256_pool; ///< The pool of 256 child nodes.
+    node*       p_root;         ///< The root, a leaf or an inner node.
+    leaf*       p_first;        ///< The leaf with the smallest key.
+    leaf*       p_last;         ///< The leaf with the largest key.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_RADIX_TREE) || defined(ETL_POLYMORPHIC_CONTAINERS)
+
+  public:
+
+    virtual ~iradix_tree() {}
+#else
+
+  protected:
+
+    ~iradix_tree() {}
+#endif
+  };
+
+  template <typename TValue, const size_t MAX_KEY_LENGTH_>
+  ETL_CONSTANT size_t iradix_tree<TValue, MAX_KEY_LENGTH_>::MAX_KEY_LENGTH;
+
+  //***************************************************************************
+  /// A radix tree with the capacity defined at compile time.
+  /// The pools of inner nodes are sized for the worst case mix of node kinds.
+  ///\ingroup radix_tree
+  ///\tparam TValue          The type of the values.
+  ///\tparam MAX_SIZE_       The maximum number of values.
+  ///\tparam MAX_KEY_LENGTH_ The maximum length of a key.
+  //***************************************************************************
+  template <typename TValue, const size_t MAX_SIZE_, const size_t MAX_KEY_LENGTH_>
+  class radix_tree : public etl::iradix_tree<TValue, MAX_KEY_LENGTH_>
+  {
+  private:
+
+    typedef etl::iradix_tree<TValue, MAX_KEY_LENGTH_> base_t;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    radix_tree()
+      : base_t(leaf_pool, node4_pool, node16_pool, node48_pool, node256_pool, MAX_SIZE)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    radix_tree(const radix_tree& other)
+      : base_t(leaf_pool, node4_pool, node16_pool, node48_pool, node256_pool, MAX_SIZE)
+    {
+      copy_from(other);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    radix_tree(radix_tree&& other)
+      : base_t(leaf_pool, node4_pool, node16_pool, node48_pool, node256_pool, MAX_SIZE)
+    {
+      move_from(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~radix_tree()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    radix_tree& operator=(const radix_tree& rhs)
+    {
+      if (this != &rhs)
+      {
+        this->clear();
+        copy_from(rhs);
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    radix_tree& operator=(radix_tree&& rhs)
+    {
+      if (this != &rhs)
+      {
+        this->clear();
+        move_from(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    //*************************************************************************
+    /// Copies the values from the other tree.
+    //*************************************************************************
+    void copy_from(const radix_tree& other)
+    {
+      for (typename base_t::const_iterator i_element = other.cbegin(); i_element != other.cend(); ++i_element)
+      {
+        this->insert(i_element.key(), *i_element);
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves the values from the other tree, which is left empty.
+    //*************************************************************************
+    void move_from(radix_tree& other)
+    {
+      for (typename base_t::iterator i_element = other.begin(); i_element != other.end(); ++i_element)
+      {
+        this->insert(i_element.key(), etl::move(*i_element));
+      }
+
+      other.clear();
+    }
+#endif
+
+    // Inner nodes lead to at least 2, 4, 13 and 41 keys, by kind.
+    typedef etl::private_radix_tree::inner_nodes<MAX_SIZE_, 2U> node4_count;
+    typedef etl::private_radix_tree::inner_nodes<MAX_SIZE_, 4U> node16_count;
+    typedef etl::private_radix_tree::inner_nodes<MAX_SIZE_, 13U> node48_count;
+    typedef etl::private_radix_tree::inner_nodes<MAX_SIZE_, 41U> node256_count;
+
+    /// The pools of leaves and nodes used by the tree.
+    etl::pool<typename base_t::leaf, MAX_SIZE_>                      leaf_pool;
+    etl::pool<typename base_t::node4, node4_count::value>     node4_pool;
+    etl::pool<typename base_t::node16, node16_count::value>   node16_pool;
+    etl::pool<typename base_t::node48, node48_count::value>   node48_pool;
+    etl::pool<typename base_t::node256, node256_count::value> node256_pool;
+  };
+
+  template <typename TValue, const size_t MAX_SIZE_, const size_t MAX_KEY_LENGTH_>
+  ETL_CONSTANT size_t radix_tree<TValue, MAX_SIZE_, MAX_KEY_LENGTH_>::MAX_SIZE;
+} // namespace etl
+
+#endif
@@ -34,7 +34,9 @@ SOFTWARE.
 #include "platform.h"
 #include "algorithm.h"
 #include "functional.h"
+#include "span.h"
 #include "type_traits.h"
+#include "private/algorithm_simd.h"
 
 // #include <math.h>
 #include <stdint.h>
@@ -68,8 +70,42 @@ namespace etl
       return TOutput(((value - input_min_value) * multiplier)) + output_min_value;
     }
 
+    //*****************************************************************
+    /// Rescales each value of 'input' into 'output'.
+    /// Processes the length of the shorter span and returns it.
+    /// Arithmetic types use the kernels in private/algorithm_simd.h
+    /// if ETL_ALGORITHM_USE_SIMD is defined.
+    //*****************************************************************
+    size_t apply(etl::span<const TInput> input, etl::span<TOutput> output) const
+    {
+      const size_t n = (input.size() < output.size()) ? input.size() : output.size();
+
+      apply(input.data(), output.data(), n, use_kernel());
+
+      return n;
+    }
+
   private:
 
+    typedef etl::integral_constant<bool, etl::private_algorithm_simd::use_compare_kernel<const TInput*, TInput>::value
+                                           && etl::private_algorithm_simd::use_compare_kernel<TOutput*, TOutput>::value>
+      use_kernel;
+
+    //*****************************************************************
+    void apply(const TInput* input, TOutput* output, size_t n, etl::false_type /*use_kernel*/) const
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        output[i] = operator()(input[i]);
+      }
+    }
+
+    //*****************************************************************
+    void apply(const TInput* input, TOutput* output, size_t n, etl::true_type /*use_kernel*/) const
+    {
+      etl::private_algorithm_simd::rescale(input, output, n, input_min_value, multiplier, output_min_value);
+    }
+
     const TInput  input_min_value;
     const TOutput output_min_value;
     const TOutput output_max_value;
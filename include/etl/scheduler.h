@@ -35,6 +35,7 @@ SOFTWARE.
 #include "function.h"
 #include "nullptr.h"
 #include "task.h"
+#include "trace_hooks.h"
 #include "type_traits.h"
 #include "vector.h"
 
@@ -111,6 +112,8 @@ namespace etl
 
         if (task.task_request_work() > 0)
         {
+          ETL_TRACE_SCOPE(etl::trace_category::Scheduler, task.get_task_priority(), 0U);
+
           task.task_process_work();
           idle = false;
         }
@@ -140,6 +143,8 @@ namespace etl
 
         while (task.task_request_work() > 0)
         {
+          ETL_TRACE_SCOPE(etl::trace_category::Scheduler, task.get_task_priority(), 0U);
+
           task.task_process_work();
           idle = false;
         }
@@ -171,6 +176,8 @@ namespace etl
 
         if (task.task_request_work() > 0)
         {
+          ETL_TRACE_SCOPE(etl::trace_category::Scheduler, task.get_task_priority(), 0U);
+
           task.task_process_work();
           idle = false;
           break;
@@ -216,6 +223,8 @@ namespace etl
 
       if (!idle)
       {
+        ETL_TRACE_SCOPE(etl::trace_category::Scheduler, task_list[most_index]->get_task_priority(), 0U);
+
         task_list[most_index]->task_process_work();
       }
 
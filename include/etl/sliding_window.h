@@ -0,0 +1,572 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SLIDING_WINDOW_INCLUDED
+#define ETL_SLIDING_WINDOW_INCLUDED
+
+#include "platform.h"
+#include "circular_buffer.h"
+#include "functional.h"
+#include "smallest.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Statistics over the last N samples.
+  /// Sum and mean are O(1) per sample. Minimum and maximum are amortised O(1),
+  /// using monotonic queues. The median and quantiles are O(log N), using an
+  /// order statistic tree (a treap) over the window.
+  /// T must be strictly weakly ordered by operator <, so NaN must not be added.
+  /// For floating point T the running sum accumulates rounding error over time;
+  /// call recalculate_sum() to refresh it.
+  ///\tparam T     The sample type.
+  ///\tparam N     The window size.
+  ///\tparam TCalc The type used for the sum.
+  //***************************************************************************
+  template <typename T, size_t N, typename TCalc = T>
+  class sliding_window : public etl::unary_function<T, void>
+  {
+  public:
+
+    ETL_STATIC_ASSERT(N > 0U, "Window size must be greater than 0");
+
+    typedef T                          value_type;
+    typedef TCalc                      calc_type;
+    typedef size_t                     size_type;
+    typedef etl::circular_buffer<T, N> buffer_type;
+
+    static ETL_CONSTANT size_t Window_Size = N;
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    sliding_window()
+      : random_state(0x9E3779B9UL)
+    {
+      clear();
+    }
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    template <typename TIterator>
+    sliding_window(TIterator first, TIterator last)
+      : random_state(0x9E3779B9UL)
+    {
+      clear();
+      add(first, last);
+    }
+
+    //*********************************
+    /// Add a value.
+    /// The oldest value is removed if the window is full.
+    //*********************************
+    void add(T value)
+    {
+      if (buffer.full())
+      {
+        remove_oldest();
+      }
+
+      const index_t slot = index_t((head + buffer.size()) % N);
+
+      buffer.push(value);
+      sum_value += TCalc(value);
+
+      // Values that can no longer be the minimum or maximum are dropped.
+      while (!minimums.empty() && (value < get(minimums.back())))
+      {
+        minimums.pop_back();
+      }
+
+      minimums.push_back(slot);
+
+      while (!maximums.empty() && (get(maximums.back()) < value))
+      {
+        maximums.pop_back();
+      }
+
+      maximums.push_back(slot);
+
+      tree_insert(slot);
+    }
+
+    //*********************************
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        add(*first);
+        ++first;
+      }
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a value.
+    //*********************************
+    void operator()(T value)
+    {
+      add(value);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void operator()(TIterator first, TIterator last)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// Get the smallest value in the window.
+    /// Returns T() if the window is empty.
+    //*********************************
+    T get_min() const
+    {
+      return minimums.empty() ? T() : get(minimums.front());
+    }
+
+    //*********************************
+    /// Get the largest value in the window.
+    /// Returns T() if the window is empty.
+    //*********************************
+    T get_max() const
+    {
+      return maximums.empty() ? T() : get(maximums.front());
+    }
+
+    //*********************************
+    /// Get the sum of the window.
+    //*********************************
+    TCalc get_sum() const
+    {
+      return sum_value;
+    }
+
+    //*********************************
+    /// Get the mean of the window.
+    /// Returns 0.0 if the window is empty.
+    //*********************************
+    double get_mean() const
+    {
+      return buffer.empty() ? 0.0 : double(sum_value) / double(buffer.size());
+    }
+
+    //*********************************
+    /// Get the k'th smallest value in the window, from 0.
+    /// Returns T() if k is not less than size().
+    //*********************************
+    T get_kth_smallest(size_t k) const
+    {
+      if (k >= buffer.size())
+      {
+        return T();
+      }
+
+      index_t node = root;
+
+      while (true)
+      {
+        const size_t left_size = count(nodes[node].left);
+
+        if (k < left_size)
+        {
+          node = nodes[node].left;
+        }
+        else if (k == left_size)
+        {
+          return get(node);
+        }
+        else
+        {
+          k -= left_size + 1U;
+          node = nodes[node].right;
+        }
+      }
+    }
+
+    //*********************************
+    /// Get the median of the window.
+    /// The mean of the two middle values if the size is even.
+    /// Returns 0.0 if the window is empty.
+    //*********************************
+    double get_median() const
+    {
+      const size_t n = buffer.size();
+
+      if (n == 0U)
+      {
+        return 0.0;
+      }
+      else if ((n & 1U) != 0U)
+      {
+        return double(get_kth_smallest(n / 2U));
+      }
+      else
+      {
+        return (double(get_kth_smallest((n / 2U) - 1U)) + double(get_kth_smallest(n / 2U))) / 2.0;
+      }
+    }
+
+    //*********************************
+    /// Get the quantile q, from 0 to 1, of the window.
+    /// The value at rank floor(q * (size() - 1)), with no interpolation.
+    /// Returns T() if the window is empty.
+    //*********************************
+    T get_quantile(double q) const
+    {
+      if (buffer.empty())
+      {
+        return T();
+      }
+
+      q = (q < 0.0) ? 0.0 : ((q > 1.0) ? 1.0 : q);
+
+      return get_kth_smallest(size_t(q * double(buffer.size() - 1U)));
+    }
+
+    //*********************************
+    /// Recalculates the sum from the window's values.
+    //*********************************
+    void recalculate_sum()
+    {
+      sum_value = TCalc(0);
+
+      for (typename buffer_type::const_iterator itr = buffer.begin(); itr != buffer.end(); ++itr)
+      {
+        sum_value += TCalc(*itr);
+      }
+    }
+
+    //*********************************
+    /// The values in the window, oldest first.
+    //*********************************
+    const buffer_type& values() const
+    {
+      return buffer;
+    }
+
+    //*********************************
+    /// The number of values in the window.
+    //*********************************
+    size_t size() const
+    {
+      return buffer.size();
+    }
+
+    //*********************************
+    /// Is the window empty?
+    //*********************************
+    bool empty() const
+    {
+      return buffer.empty();
+    }
+
+    //*********************************
+    /// Is the window full?
+    //*********************************
+    bool full() const
+    {
+      return buffer.full();
+    }
+
+    //*********************************
+    /// The window size.
+    //*********************************
+    size_t max_size() const
+    {
+      return N;
+    }
+
+    //*********************************
+    /// Clear the window.
+    //*********************************
+    void clear()
+    {
+      buffer.clear();
+      minimums.clear();
+      maximums.clear();
+      sum_value = TCalc(0);
+      head      = 0U;
+      root      = Null;
+    }
+
+  private:
+
+    typedef typename etl::smallest_uint_for_value<N>::type index_t;
+
+    /// The index of an empty subtree.
+    static ETL_CONSTANT index_t Null = index_t(N);
+
+    //*************************************************************************
+    /// A fixed capacity double ended queue of slots.
+    //*************************************************************************
+    class slot_queue
+    {
+    public:
+
+      void clear()
+      {
+        first  = 0U;
+        length = 0U;
+      }
+
+      bool empty() const
+      {
+        return length == 0U;
+      }
+
+      index_t front() const
+      {
+        return slots[first];
+      }
+
+      index_t back() const
+      {
+        return slots[(first + length - 1U) % N];
+      }
+
+      void push_back(index_t slot)
+      {
+        slots[(first + length) % N] = slot;
+        ++length;
+      }
+
+      void pop_back()
+      {
+        --length;
+      }
+
+      void pop_front()
+      {
+        first = (first + 1U) % N;
+        --length;
+      }
+
+    private:
+
+      index_t slots[N];
+      size_t  first;
+      size_t  length;
+    };
+
+    //*************************************************************************
+    /// A node of the order statistic tree.
+    /// Node i holds the value in slot i.
+    //*************************************************************************
+    struct node_type
+    {
+      index_t  left;
+      index_t  right;
+      index_t  size;
+      uint32_t priority;
+    };
+
+    //*********************************
+    /// The value in a slot.
+    //*********************************
+    const T& get(index_t slot) const
+    {
+      return buffer[(size_t(slot) + N - head) % N];
+    }
+
+    //*********************************
+    /// Orders slots by value, then by slot so that keys are unique.
+    //*********************************
+    bool less(index_t a, index_t b) const
+    {
+      const T& va = get(a);
+      const T& vb = get(b);
+
+      return (va < vb) || (!(vb < va) && (a < b));
+    }
+
+    //*********************************
+    size_t count(index_t node) const
+    {
+      return (node == Null) ? 0U : size_t(nodes[node].size);
+    }
+
+    //*********************************
+    void update(index_t node)
+    {
+      nodes[node].size = index_t(count(nodes[node].left) + count(nodes[node].right) + 1U);
+    }
+
+    //*********************************
+    void remove_oldest()
+    {
+      if (!minimums.empty() && (minimums.front() == head))
+      {
+        minimums.pop_front();
+      }
+
+      if (!maximums.empty() && (maximums.front() == head))
+      {
+        maximums.pop_front();
+      }
+
+      root = tree_erase(root, head);
+
+      sum_value -= TCalc(buffer.front());
+      buffer.pop();
+      head = index_t((head + 1U) % N);
+    }
+
+    //*********************************
+    /// A xorshift generator for the node priorities.
+    //*********************************
+    uint32_t next_priority()
+    {
+      random_state ^= random_state << 13;
+      random_state ^= random_state >> 17;
+      random_state ^= random_state << 5;
+
+      return random_state;
+    }
+
+    //*********************************
+    void tree_insert(index_t slot)
+    {
+      nodes[slot].left     = Null;
+      nodes[slot].right    = Null;
+      nodes[slot].size     = 1U;
+      nodes[slot].priority = next_priority();
+
+      index_t lower;
+      index_t upper;
+      split(root, slot, lower, upper);
+
+      root = merge(merge(lower, slot), upper);
+    }
+
+    //*********************************
+    /// Splits 'node' into the keys less than 'slot' and the rest.
+    //*********************************
+    void split(index_t node, index_t slot, index_t& lower, index_t& upper)
+    {
+      if (node == Null)
+      {
+        lower = Null;
+        upper = Null;
+      }
+      else if (less(node, slot))
+      {
+        split(nodes[node].right, slot, nodes[node].right, upper);
+        lower = node;
+        update(node);
+      }
+      else
+      {
+        split(nodes[node].left, slot, lower, nodes[node].left);
+        upper = node;
+        update(node);
+      }
+    }
+
+    //*********************************
+    /// Joins two trees, where every key in 'lower' is less than every key in 'upper'.
+    //*********************************
+    index_t merge(index_t lower, index_t upper)
+    {
+      if (lower == Null)
+      {
+        return upper;
+      }
+
+      if (upper == Null)
+      {
+        return lower;
+      }
+
+      if (nodes[lower].priority > nodes[upper].priority)
+      {
+        nodes[lower].right = merge(nodes[lower].right, upper);
+        update(lower);
+        return lower;
+      }
+      else
+      {
+        nodes[upper].left = merge(lower, nodes[upper].left);
+        update(upper);
+        return upper;
+      }
+    }
+
+    //*********************************
+    index_t tree_erase(index_t node, index_t slot)
+    {
+      if (node == slot)
+      {
+        return merge(nodes[node].left, nodes[node].right);
+      }
+
+      if (less(slot, node))
+      {
+        nodes[node].left = tree_erase(nodes[node].left, slot);
+      }
+      else
+      {
+        nodes[node].right = tree_erase(nodes[node].right, slot);
+      }
+
+      update(node);
+
+      return node;
+    }
+
+    buffer_type buffer;   ///< The window, oldest first.
+    slot_queue  minimums; ///< Slots in increasing order of value, oldest first.
+    slot_queue  maximums; ///< Slots in decreasing order of value, oldest first.
+    node_type   nodes[N]; ///< The order statistic tree, one node per slot.
+    TCalc       sum_value;
+    index_t     head;     ///< The slot of the oldest value.
+    index_t     root;
+    uint32_t    random_state;
+  };
+
+  template <typename T, size_t N, typename TCalc>
+  ETL_CONSTANT size_t sliding_window<T, N, TCalc>::Window_Size;
+
+  template <typename T, size_t N, typename TCalc>
+  ETL_CONSTANT typename sliding_window<T, N, TCalc>::index_t sliding_window<T, N, TCalc>::Null;
+} // namespace etl
+
+#endif
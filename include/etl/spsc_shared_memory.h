@@ -0,0 +1,754 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SPSC_SHARED_MEMORY_INCLUDED
+#define ETL_SPSC_SHARED_MEMORY_INCLUDED
+
+#include "platform.h"
+#include "alignment.h"
+#include "atomic.h"
+#include "integral_limits.h"
+#include "nullptr.h"
+#include "placement_new.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+#if ETL_USING_CPP11
+  #include "bip_buffer_spsc_atomic.h"
+  #include "span.h"
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup spsc_shared_memory spsc shared memory
+/// Single producer, single consumer queue and bipartite buffer whose control
+/// block and data live together in one caller supplied memory region, such as
+/// a POSIX shared memory object mapped into two processes.
+///
+/// The region holds no pointers; indices and offsets are relative to its start,
+/// so each process may map it at a different address. The layout uses fixed
+/// width fields so that 32 and 64 bit processes on the same host may share it.
+///
+/// One side calls create() to initialise the region; the other calls attach(),
+/// which validates the layout before use.
+///\code
+/// int   fd     = memfd_create("capture", 0);
+/// size_t bytes = etl::queue_spsc_atomic_shared<Sample>::required_size(1024);
+/// ftruncate(fd, bytes);
+/// void* p = mmap(ETL_NULLPTR, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+///
+/// etl::queue_spsc_atomic_shared<Sample> queue;
+/// queue.create(p, bytes);  // Producer. The consumer calls queue.attach(p, bytes).
+///\endcode
+/// T is copied bytewise between processes, so it must be trivially copyable
+/// and contain no pointers.
+///\ingroup containers
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// The result of creating or attaching to a shared region.
+  ///\ingroup spsc_shared_memory
+  //***************************************************************************
+  struct spsc_shared_status
+  {
+    enum enum_type
+    {
+      Ok,
+      Null_Memory,   ///< The region pointer is null.
+      Misaligned,    ///< The region is not aligned for the header or the elements.
+      Too_Small,     ///< The region cannot hold the header and at least one element.
+      Bad_Magic,     ///< The region was not created, or was created for a different container.
+      Bad_Version,   ///< The region was created with a different layout version.
+      Bad_Element,   ///< The region was created for a different element size or alignment.
+      Bad_Layout     ///< The recorded offsets or capacity are inconsistent with the region.
+    };
+  };
+
+  //***************************************************************************
+  /// The control block at the start of a shared region.
+  /// Each index is on its own cache line.
+  ///\ingroup spsc_shared_memory
+  //***************************************************************************
+  struct spsc_shared_header
+  {
+    static ETL_CONSTANT uint16_t Version         = 1U;
+    static ETL_CONSTANT size_t   Cache_Line_Size = 64U;
+
+    etl::atomic<uint32_t> magic;             ///< Written last by create().
+    uint16_t              version;
+    uint16_t              header_size;
+    uint32_t              element_size;
+    uint32_t              element_alignment;
+    uint32_t              slots;             ///< The number of element slots in the data area.
+    uint32_t              data_offset;       ///< From the start of the region.
+    char                  padding0[Cache_Line_Size - 24U];
+
+    etl::atomic<uint32_t> write;
+    char                  padding1[Cache_Line_Size - sizeof(etl::atomic<uint32_t>)];
+
+    etl::atomic<uint32_t> read;
+    char                  padding2[Cache_Line_Size - sizeof(etl::atomic<uint32_t>)];
+
+    etl::atomic<uint32_t> last;              ///< The wrap point. Used by the bip buffer only.
+    char                  padding3[Cache_Line_Size - sizeof(etl::atomic<uint32_t>)];
+  };
+
+  ETL_STATIC_ASSERT(sizeof(etl::atomic<uint32_t>) == sizeof(uint32_t), "etl::atomic<uint32_t> must have the size of uint32_t to be shared");
+  #if ETL_HAS_ATOMIC_ALWAYS_LOCK_FREE && ETL_USING_CPP17
+  ETL_STATIC_ASSERT(etl::atomic<uint32_t>::is_always_lock_free, "etl::atomic<uint32_t> must be lock free to be shared between processes");
+  #endif
+
+  namespace private_spsc_shared_memory
+  {
+    //*************************************************************************
+    /// The offset of the data area for elements of the given alignment.
+    //*************************************************************************
+    inline size_t data_offset(size_t alignment)
+    {
+      const size_t unit = (alignment > spsc_shared_header::Cache_Line_Size) ? alignment : spsc_shared_header::Cache_Line_Size;
+
+      return ((sizeof(spsc_shared_header) + unit - 1U) / unit) * unit;
+    }
+
+    //*************************************************************************
+    /// Initialises the header. The magic number is published last.
+    //*************************************************************************
+    inline spsc_shared_header* create(void* memory, size_t size, uint32_t magic, size_t element_size, size_t element_alignment, size_t minimum_slots,
+                                      etl::spsc_shared_status::enum_type& status)
+    {
+      if (memory == ETL_NULLPTR)
+      {
+        status = etl::spsc_shared_status::Null_Memory;
+        return ETL_NULLPTR;
+      }
+
+      const size_t alignment = (element_alignment > etl::alignment_of<spsc_shared_header>::value) ? element_alignment : etl::alignment_of<spsc_shared_header>::value;
+
+      if ((reinterpret_cast<uintptr_t>(memory) % alignment) != 0U)
+      {
+        status = etl::spsc_shared_status::Misaligned;
+        return ETL_NULLPTR;
+      }
+
+      const size_t offset = data_offset(element_alignment);
+
+      if ((size < offset) || (((size - offset) / element_size) < minimum_slots))
+      {
+        status = etl::spsc_shared_status::Too_Small;
+        return ETL_NULLPTR;
+      }
+
+      size_t slots = (size - offset) / element_size;
+
+      if (slots > etl::integral_limits<uint32_t>::max)
+      {
+        slots = etl::integral_limits<uint32_t>::max;
+      }
+
+      spsc_shared_header* p_header = ::new (memory) spsc_shared_header;
+
+      p_header->version           = spsc_shared_header::Version;
+      p_header->header_size       = static_cast<uint16_t>(sizeof(spsc_shared_header));
+      p_header->element_size      = static_cast<uint32_t>(element_size);
+      p_header->element_alignment = static_cast<uint32_t>(element_alignment);
+      p_header->slots             = static_cast<uint32_t>(slots);
+      p_header->data_offset       = static_cast<uint32_t>(offset);
+      p_header->write.store(0U, etl::memory_order_relaxed);
+      p_header->read.store(0U, etl::memory_order_relaxed);
+      p_header->last.store(0U, etl::memory_order_relaxed);
+      p_header->magic.store(magic, etl::memory_order_release);
+
+      status = etl::spsc_shared_status::Ok;
+
+      return p_header;
+    }
+
+    //*************************************************************************
+    /// Checks a header written by create().
+    //*************************************************************************
+    inline etl::spsc_shared_status::enum_type validate(const void* memory, size_t size, uint32_t magic, size_t element_size, size_t element_alignment,
+                                                       size_t minimum_slots)
+    {
+      if (memory == ETL_NULLPTR)
+      {
+        return etl::spsc_shared_status::Null_Memory;
+      }
+
+      if ((reinterpret_cast<uintptr_t>(memory) % etl::alignment_of<spsc_shared_header>::value) != 0U)
+      {
+        return etl::spsc_shared_status::Misaligned;
+      }
+
+      if (size < sizeof(spsc_shared_header))
+      {
+        return etl::spsc_shared_status::Too_Small;
+      }
+
+      const spsc_shared_header* p_header = static_cast<const spsc_shared_header*>(memory);
+
+      if (p_header->magic.load(etl::memory_order_acquire) != magic)
+      {
+        return etl::spsc_shared_status::Bad_Magic;
+      }
+
+      if (p_header->version != spsc_shared_header::Version)
+      {
+        return etl::spsc_shared_status::Bad_Version;
+      }
+
+      if ((p_header->element_size != element_size) || (p_header->element_alignment != element_alignment))
+      {
+        return etl::spsc_shared_status::Bad_Element;
+      }
+
+      if ((reinterpret_cast<uintptr_t>(memory) % element_alignment) != 0U)
+      {
+        return etl::spsc_shared_status::Misaligned;
+      }
+
+      if ((p_header->header_size != sizeof(spsc_shared_header)) || (p_header->data_offset != data_offset(element_alignment)) || (p_header->slots < minimum_slots))
+      {
+        return etl::spsc_shared_status::Bad_Layout;
+      }
+
+      // The data offset may be larger than the header for over-aligned elements.
+      if ((size < p_header->data_offset) || (((size - p_header->data_offset) / element_size) < p_header->slots))
+      {
+        return etl::spsc_shared_status::Too_Small;
+      }
+
+      const uint32_t slots = p_header->slots;
+
+      if ((p_header->write.load(etl::memory_order_acquire) > slots) || (p_header->read.load(etl::memory_order_acquire) > slots)
+          || (p_header->last.load(etl::memory_order_acquire) > slots))
+      {
+        return etl::spsc_shared_status::Bad_Layout;
+      }
+
+      return etl::spsc_shared_status::Ok;
+    }
+  } // namespace private_spsc_shared_memory
+
+  //***************************************************************************
+  ///\ingroup spsc_shared_memory
+  /// A queue_spsc_atomic whose indices and data live in a shared region.
+  /// Supports one producer and one consumer, which may be in different
+  /// processes.
+  ///\tparam T The element type. Must be trivially copyable.
+  //***************************************************************************
+  template <typename T>
+  class queue_spsc_atomic_shared
+  {
+  public:
+
+    typedef T        value_type;
+    typedef T&       reference;
+    typedef const T& const_reference;
+    typedef uint32_t size_type;
+
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "T must be trivially copyable to be shared between processes");
+
+    /// "ETLQ"
+    static ETL_CONSTANT uint32_t Magic = 0x45544C51UL;
+
+    //*************************************************************************
+    /// The region size needed for a queue of 'capacity' elements.
+    //*************************************************************************
+    static size_t required_size(size_t capacity)
+    {
+      return private_spsc_shared_memory::data_offset(etl::alignment_of<T>::value) + ((capacity + 1U) * sizeof(T));
+    }
+
+    //*************************************************************************
+    /// Checks that 'memory' holds a queue of T created by create().
+    //*************************************************************************
+    static etl::spsc_shared_status::enum_type validate(const void* memory, size_t size)
+    {
+      return private_spsc_shared_memory::validate(memory, size, Magic, sizeof(T), etl::alignment_of<T>::value, 2U);
+    }
+
+    //*************************************************************************
+    /// Constructs a queue that is not attached to a region.
+    //*************************************************************************
+    queue_spsc_atomic_shared()
+      : p_header(ETL_NULLPTR)
+      , p_buffer(ETL_NULLPTR)
+      , reserved(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Initialises 'memory' as an empty queue and attaches to it.
+    /// The capacity is the largest that fits in 'size' bytes.
+    /// Must complete before the other side attaches.
+    //*************************************************************************
+    etl::spsc_shared_status::enum_type create(void* memory, size_t size)
+    {
+      etl::spsc_shared_status::enum_type status;
+
+      set(private_spsc_shared_memory::create(memory, size, Magic, sizeof(T), etl::alignment_of<T>::value, 2U, status));
+
+      return status;
+    }
+
+    //*************************************************************************
+    /// Validates and attaches to a queue initialised by create().
+    /// The queue is left detached if validation fails.
+    //*************************************************************************
+    etl::spsc_shared_status::enum_type attach(void* memory, size_t size)
+    {
+      const etl::spsc_shared_status::enum_type status = validate(memory, size);
+
+      set((status == etl::spsc_shared_status::Ok) ? static_cast<spsc_shared_header*>(memory) : ETL_NULLPTR);
+
+      return status;
+    }
+
+    //*************************************************************************
+    /// Detaches from the region. The region is unchanged.
+    //*************************************************************************
+    void detach()
+    {
+      set(ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    /// Is the queue attached to a region?
+    //*************************************************************************
+    bool is_attached() const
+    {
+      return p_header != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Push a value to the queue.
+    /// Call from the producer only.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      size_type write_index = p_header->write.load(etl::memory_order_relaxed);
+      size_type next_index  = get_next_index(write_index);
+
+      if (next_index != p_header->read.load(etl::memory_order_acquire))
+      {
+        ::new (&p_buffer[write_index]) T(value);
+
+        p_header->write.store(next_index, etl::memory_order_release);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Peek the next value in the queue without removing it.
+    /// Call from the consumer only.
+    //*************************************************************************
+    bool front(reference value) const
+    {
+      size_type read_index = p_header->read.load(etl::memory_order_relaxed);
+
+      if (read_index == p_header->write.load(etl::memory_order_acquire))
+      {
+        // Queue is empty
+        return false;
+      }
+
+      value = p_buffer[read_index];
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue.
+    /// Call from the consumer only.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      size_type read_index = p_header->read.load(etl::memory_order_relaxed);
+
+      if (read_index == p_header->write.load(etl::memory_order_acquire))
+      {
+        // Queue is empty
+        return false;
+      }
+
+      value = p_buffer[read_index];
+
+      p_header->read.store(get_next_index(read_index), etl::memory_order_release);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue and discard.
+    /// Call from the consumer only.
+    //*************************************************************************
+    bool pop()
+    {
+      size_type read_index = p_header->read.load(etl::memory_order_relaxed);
+
+      if (read_index == p_header->write.load(etl::memory_order_acquire))
+      {
+        // Queue is empty
+        return false;
+      }
+
+      p_header->read.store(get_next_index(read_index), etl::memory_order_release);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Is the queue empty?
+    /// Accurate from the consumer.
+    //*************************************************************************
+    bool empty() const
+    {
+      return p_header->read.load(etl::memory_order_acquire) == p_header->write.load(etl::memory_order_acquire);
+    }
+
+    //*************************************************************************
+    /// Is the queue full?
+    /// Accurate from the producer.
+    //*************************************************************************
+    bool full() const
+    {
+      return get_next_index(p_header->write.load(etl::memory_order_acquire)) == p_header->read.load(etl::memory_order_acquire);
+    }
+
+    //*************************************************************************
+    /// How many items in the queue?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type size() const
+    {
+      size_type write_index = p_header->write.load(etl::memory_order_acquire);
+      size_type read_index  = p_header->read.load(etl::memory_order_acquire);
+
+      return (write_index >= read_index) ? (write_index - read_index) : (reserved - read_index + write_index);
+    }
+
+    //*************************************************************************
+    /// How much free space available in the queue.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type available() const
+    {
+      return reserved - size() - 1U;
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return reserved - 1U;
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return reserved - 1U;
+    }
+
+  private:
+
+    //*************************************************************************
+    void set(spsc_shared_header* p_header_)
+    {
+      p_header = p_header_;
+      p_buffer = (p_header != ETL_NULLPTR) ? reinterpret_cast<T*>(reinterpret_cast<char*>(p_header) + p_header->data_offset) : ETL_NULLPTR;
+      reserved = (p_header != ETL_NULLPTR) ? p_header->slots : 0U;
+    }
+
+    //*************************************************************************
+    size_type get_next_index(size_type index) const
+    {
+      ++index;
+
+      if (index == reserved) ETL_UNLIKELY
+      {
+        index = 0U;
+      }
+
+      return index;
+    }
+
+    // Disable copy construction and assignment.
+    queue_spsc_atomic_shared(const queue_spsc_atomic_shared&) ETL_DELETE;
+    queue_spsc_atomic_shared& operator=(const queue_spsc_atomic_shared&) ETL_DELETE;
+
+    spsc_shared_header* p_header;
+    T*                  p_buffer;
+    size_type           reserved; ///< A copy of the slot count, so that a corrupted header cannot move the indices out of range.
+  };
+
+  template <typename T>
+  ETL_CONSTANT uint32_t queue_spsc_atomic_shared<T>::Magic;
+
+  #if ETL_USING_CPP11
+  //***************************************************************************
+  ///\ingroup spsc_shared_memory
+  /// A bip_buffer_spsc_atomic whose indices and data live in a shared region.
+  /// Supports one producer and one consumer, which may be in different
+  /// processes. Reserves are contiguous spans of the region.
+  ///\tparam T The element type. Must be trivially copyable.
+  //***************************************************************************
+  template <typename T>
+  class bip_buffer_spsc_atomic_shared
+  {
+  public:
+
+    typedef T        value_type;
+    typedef T&       reference;
+    typedef const T& const_reference;
+    typedef uint32_t size_type;
+
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "T must be trivially copyable to be shared between processes");
+
+    /// "ETLB"
+    static ETL_CONSTANT uint32_t Magic = 0x45544C42UL;
+
+    //*************************************************************************
+    /// The region size needed for a buffer of 'capacity' elements.
+    //*************************************************************************
+    static size_t required_size(size_t capacity)
+    {
+      return private_spsc_shared_memory::data_offset(etl::alignment_of<T>::value) + (capacity * sizeof(T));
+    }
+
+    //*************************************************************************
+    /// Checks that 'memory' holds a bip buffer of T created by create().
+    //*************************************************************************
+    static etl::spsc_shared_status::enum_type validate(const void* memory, size_t size)
+    {
+      return private_spsc_shared_memory::validate(memory, size, Magic, sizeof(T), etl::alignment_of<T>::value, 1U);
+    }
+
+    //*************************************************************************
+    /// Constructs a buffer that is not attached to a region.
+    //*************************************************************************
+    bip_buffer_spsc_atomic_shared()
+      : p_header(ETL_NULLPTR)
+      , p_buffer(ETL_NULLPTR)
+      , reserved(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Initialises 'memory' as an empty buffer and attaches to it.
+    /// The capacity is the largest that fits in 'size' bytes.
+    /// Must complete before the other side attaches.
+    //*************************************************************************
+    etl::spsc_shared_status::enum_type create(void* memory, size_t size)
+    {
+      etl::spsc_shared_status::enum_type status;
+
+      set(private_spsc_shared_memory::create(memory, size, Magic, sizeof(T), etl::alignment_of<T>::value, 1U, status));
+
+      return status;
+    }
+
+    //*************************************************************************
+    /// Validates and attaches to a buffer initialised by create().
+    /// The buffer is left detached if validation fails.
+    //*************************************************************************
+    etl::spsc_shared_status::enum_type attach(void* memory, size_t size)
+    {
+      const etl::spsc_shared_status::enum_type status = validate(memory, size);
+
+      set((status == etl::spsc_shared_status::Ok) ? static_cast<spsc_shared_header*>(memory) : ETL_NULLPTR);
+
+      return status;
+    }
+
+    //*************************************************************************
+    /// Detaches from the region. The region is unchanged.
+    //*************************************************************************
+    void detach()
+    {
+      set(ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    /// Is the buffer attached to a region?
+    //*************************************************************************
+    bool is_attached() const
+    {
+      return p_header != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Returns true if the buffer is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns true if the buffer is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return available() == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the total used size, which may be split in two blocks.
+    //*************************************************************************
+    size_type size() const
+    {
+      return logic_t::size(*p_header);
+    }
+
+    //*************************************************************************
+    /// Returns the largest contiguous available block size.
+    //*************************************************************************
+    size_type available() const
+    {
+      return logic_t::available(*p_header, reserved);
+    }
+
+    //*************************************************************************
+    /// Returns the maximum capacity of the buffer.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return reserved;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum size of the buffer.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return reserved;
+    }
+
+    //*************************************************************************
+    /// Reserves a memory area for reading (up to the max_reserve_size).
+    /// Call from the consumer only.
+    //*************************************************************************
+    etl::span<T> read_reserve(size_type max_reserve_size = etl::integral_limits<size_type>::max)
+    {
+      size_type reserve_size = max_reserve_size;
+      size_type rindex       = logic_t::get_read_reserve(*p_header, &reserve_size);
+
+      return etl::span<T>(p_buffer + rindex, reserve_size);
+    }
+
+    //*************************************************************************
+    /// Commits the previously reserved read memory area.
+    /// The reserve can be trimmed at the end before committing.
+    /// Asserts etl::bip_buffer_reserve_invalid.
+    //*************************************************************************
+    void read_commit(const etl::span<T>& reserve)
+    {
+      const size_type rindex = static_cast<size_type>(reserve.data() - p_buffer);
+
+      logic_t::apply_read_reserve(*p_header, rindex, static_cast<size_type>(reserve.size()));
+    }
+
+    //*************************************************************************
+    /// Reserves a memory area for writing up to the max_reserve_size.
+    /// Call from the producer only.
+    //*************************************************************************
+    etl::span<T> write_reserve(size_type max_reserve_size)
+    {
+      size_type reserve_size = max_reserve_size;
+      size_type windex       = logic_t::get_write_reserve(*p_header, reserved, &reserve_size, etl::integral_limits<size_type>::max);
+
+      return etl::span<T>(p_buffer + windex, reserve_size);
+    }
+
+    //*************************************************************************
+    /// Reserves an optimal memory area for writing. The buffer will only wrap
+    /// around if the available forward space is less than min_reserve_size.
+    /// Call from the producer only.
+    //*************************************************************************
+    etl::span<T> write_reserve_optimal(size_type min_reserve_size = 1U)
+    {
+      size_type reserve_size = etl::integral_limits<size_type>::max;
+      size_type windex       = logic_t::get_write_reserve(*p_header, reserved, &reserve_size, min_reserve_size);
+
+      return etl::span<T>(p_buffer + windex, reserve_size);
+    }
+
+    //*************************************************************************
+    /// Commits the previously reserved write memory area.
+    /// The reserve can be trimmed at the end before committing.
+    /// Asserts etl::bip_buffer_reserve_invalid.
+    //*************************************************************************
+    void write_commit(const etl::span<T>& reserve)
+    {
+      const size_type windex = static_cast<size_type>(reserve.data() - p_buffer);
+
+      logic_t::apply_write_reserve(*p_header, reserved, windex, static_cast<size_type>(reserve.size()));
+    }
+
+  private:
+
+    //*************************************************************************
+    void set(spsc_shared_header* p_header_)
+    {
+      p_header = p_header_;
+      p_buffer = (p_header != ETL_NULLPTR) ? reinterpret_cast<T*>(reinterpret_cast<char*>(p_header) + p_header->data_offset) : ETL_NULLPTR;
+      reserved = (p_header != ETL_NULLPTR) ? p_header->slots : 0U;
+    }
+
+    // Disable copy construction and assignment.
+    bip_buffer_spsc_atomic_shared(const bip_buffer_spsc_atomic_shared&)            = delete;
+    bip_buffer_spsc_atomic_shared& operator=(const bip_buffer_spsc_atomic_shared&) = delete;
+
+    typedef private_bip_buffer_spsc_atomic::logic<size_type> logic_t;
+
+    spsc_shared_header* p_header;
+    T*                  p_buffer;
+    size_type           reserved; ///< A copy of the slot count, so that a corrupted header cannot move the reserves out of range.
+  };
+
+  template <typename T>
+  ETL_CONSTANT uint32_t bip_buffer_spsc_atomic_shared<T>::Magic;
+  #endif
+} // namespace etl
+
+#endif // ETL_HAS_ATOMIC
+
+#endif
@@ -33,6 +33,7 @@ SOFTWARE.
 #include "array.h"
 #include "array_view.h"
 #include "nullptr.h"
+#include "trace_hooks.h"
 #include "utility.h"
 
 #include <stdint.h>
@@ -286,6 +287,8 @@ namespace etl
     //*************************************************************************
     virtual void process_event(event_id_t event_id) ETL_OVERRIDE
     {
+      ETL_TRACE_SCOPE(etl::trace_category::State_Chart, this->current_state_id, event_id);
+
       if (started)
       {
         const transition* t = Transition_Table_Begin;
@@ -476,6 +479,8 @@ namespace etl
     //*************************************************************************
     virtual void process_event(event_id_t event_id, parameter_t data) ETL_OVERRIDE
     {
+      ETL_TRACE_SCOPE(etl::trace_category::State_Chart, this->current_state_id, event_id);
+
       if (started)
       {
         const transition* t = Transition_Table_Begin;
@@ -701,6 +706,8 @@ namespace etl
     //*************************************************************************
     void process_event(event_id_t event_id, parameter_t data) ETL_OVERRIDE
     {
+      ETL_TRACE_SCOPE(etl::trace_category::State_Chart, this->current_state_id, event_id);
+
       if (started)
       {
         const transition* t = transition_table_begin;
@@ -950,6 +957,8 @@ namespace etl
     //*************************************************************************
     void process_event(event_id_t event_id) ETL_OVERRIDE
     {
+      ETL_TRACE_SCOPE(etl::trace_category::State_Chart, this->current_state_id, event_id);
+
       if (started)
       {
         const transition* t = transition_table_begin;
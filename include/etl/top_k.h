@@ -0,0 +1,496 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TOP_K_INCLUDED
+#define ETL_TOP_K_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "hash.h"
+#include "integral_limits.h"
+#include "power.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "private/sketch_common.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup top_k top_k
+/// Finds the most frequent values in a stream, in fixed memory.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// The heavy hitters of a stream, found with the Space-Saving algorithm.
+  /// Up to MAX_SIZE_ values are counted. When a new value arrives and every
+  /// counter is in use, the value with the smallest count is replaced, and
+  /// the new value inherits its count as an error bound. Any value that
+  /// occurs more than total() / MAX_SIZE_ times is guaranteed to be counted.
+  /// The counts are held in a min-heap, indexed by a hash table, so adding a
+  /// value is O(log MAX_SIZE_).
+  /// Sketches of the same type may be merged, so each thread can count its
+  /// own part of a stream.
+  /// Keys must be default constructible and assignable.
+  ///\tparam TKey      The type of the values counted.
+  ///\tparam MAX_SIZE_ The number of counters.
+  ///\tparam TCount    The counter type.
+  ///\ingroup top_k
+  //***************************************************************************
+  template <typename TKey, size_t MAX_SIZE_, typename TCount = uint32_t, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class top_k
+  {
+  public:
+
+    ETL_STATIC_ASSERT((MAX_SIZE_ > 0U), "Zero capacity sketches are not valid");
+    ETL_STATIC_ASSERT((etl::is_integral<TCount>::value && etl::is_unsigned<TCount>::value), "The count must be an unsigned integral type");
+
+    typedef TKey      key_type;
+    typedef TCount    count_type;
+    typedef THash     hasher;
+    typedef TKeyEqual key_equal;
+
+    //*************************************************************************
+    /// A counted value.
+    /// 'count' is never less than the true count, and 'count - error' is
+    /// never more.
+    //*************************************************************************
+    struct counter
+    {
+      key_type   key;
+      count_type count;
+      count_type error;
+    };
+
+    typedef counter value_type;
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    /// The number of hash buckets, at least one per counter.
+    static ETL_CONSTANT size_t Bucket_Count = etl::power_of_2_round_up<MAX_SIZE_>::value;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    top_k()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Forgets every value.
+    //*************************************************************************
+    void clear()
+    {
+      etl::fill_n(buckets, Bucket_Count, Npos);
+      current_size = 0U;
+      total_count  = 0U;
+    }
+
+    //*************************************************************************
+    /// Adds 'count' occurrences of the key.
+    //*************************************************************************
+    void add(const key_type& key, count_type count = 1U)
+    {
+      total_count += count;
+
+      const size_t index = find_index(key);
+
+      if (index != Npos)
+      {
+        entries[index].count = etl::private_sketch::saturating_add(entries[index].count, count);
+        sift_down(entries[index].heap_position);
+      }
+      else if (current_size < MAX_SIZE_)
+      {
+        insert_new(key, count, 0U);
+      }
+      else
+      {
+        const count_type minimum = entries[heap[0]].count;
+
+        replace_minimum(key, etl::private_sketch::saturating_add(minimum, count), minimum);
+      }
+    }
+
+    //*************************************************************************
+    /// An upper bound on the number of occurrences of the key.
+    /// For a key that is not counted, this is the smallest count, as the key
+    /// would have been counted had it occurred more often.
+    //*************************************************************************
+    count_type count(const key_type& key) const
+    {
+      const size_t index = find_index(key);
+
+      return (index == Npos) ? minimum_count() : entries[index].count;
+    }
+
+    //*************************************************************************
+    /// A lower bound on the number of occurrences of the key.
+    //*************************************************************************
+    count_type guaranteed(const key_type& key) const
+    {
+      const size_t index = find_index(key);
+
+      return (index == Npos) ? count_type(0U) : static_cast<count_type>(entries[index].count - entries[index].error);
+    }
+
+    //*************************************************************************
+    /// Checks if the key is counted.
+    //*************************************************************************
+    bool contains(const key_type& key) const
+    {
+      return find_index(key) != Npos;
+    }
+
+    //*************************************************************************
+    /// The smallest count, or zero if not every counter is in use.
+    //*************************************************************************
+    count_type minimum_count() const
+    {
+      return full() ? entries[heap[0]].count : count_type(0U);
+    }
+
+    //*************************************************************************
+    /// Copies up to 'n' counters, most frequent first, to 'out'.
+    ///\return The output iterator, after the last counter copied.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    TOutputIterator top(TOutputIterator out, size_t n = MAX_SIZE_) const
+    {
+      // Sort a copy, so that the heap is left untouched.
+      size_t order[MAX_SIZE_];
+
+      etl::copy_n(heap, current_size, order);
+      etl::sort(order, order + current_size, count_less(entries));
+
+      for (size_t i = current_size; (i != 0U) && (n != 0U); --i, --n)
+      {
+        *out = static_cast<const counter&>(entries[order[i - 1U]]);
+        ++out;
+      }
+
+      return out;
+    }
+
+    //*************************************************************************
+    /// Adds the counts of another sketch.
+    /// A key missing from one sketch may have occurred up to its smallest
+    /// count times, which is added to both its count and its error.
+    //*************************************************************************
+    void merge(const top_k& other)
+    {
+      const count_type this_minimum  = minimum_count();
+      const count_type other_minimum = other.minimum_count();
+
+      for (size_t i = 0U; i < current_size; ++i)
+      {
+        entry&       e     = entries[i];
+        const size_t index = other.find_index(e.key);
+
+        if (index == Npos)
+        {
+          e.count = etl::private_sketch::saturating_add(e.count, other_minimum);
+          e.error = etl::private_sketch::saturating_add(e.error, other_minimum);
+        }
+        else
+        {
+          e.count = etl::private_sketch::saturating_add(e.count, other.entries[index].count);
+          e.error = etl::private_sketch::saturating_add(e.error, other.entries[index].error);
+        }
+      }
+
+      // The counts have changed unevenly, so rebuild the heap.
+      for (size_t i = current_size / 2U; i != 0U; --i)
+      {
+        sift_down(i - 1U);
+      }
+
+      for (size_t i = 0U; i < other.current_size; ++i)
+      {
+        const entry& o = other.entries[i];
+
+        if (find_index(o.key) == Npos)
+        {
+          const count_type count = etl::private_sketch::saturating_add(o.count, this_minimum);
+          const count_type error = etl::private_sketch::saturating_add(o.error, this_minimum);
+
+          if (current_size < MAX_SIZE_)
+          {
+            insert_new(o.key, count, error);
+          }
+          else if (count > entries[heap[0]].count)
+          {
+            replace_minimum(o.key, count, error);
+          }
+        }
+      }
+
+      total_count += other.total_count;
+    }
+
+    //*************************************************************************
+    /// The total of all of the counts added.
+    //*************************************************************************
+    uint64_t total() const
+    {
+      return total_count;
+    }
+
+    //*************************************************************************
+    /// Gets the number of keys counted.
+    //*************************************************************************
+    size_t size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the number of counters.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return MAX_SIZE_;
+    }
+
+    //*************************************************************************
+    /// Checks if no keys are counted.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if every counter is in use.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == MAX_SIZE_;
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Npos = etl::integral_limits<size_t>::max;
+
+    //*************************************************************************
+    /// A counter, its place in the heap and the next in its bucket.
+    //*************************************************************************
+    struct entry : public counter
+    {
+      size_t heap_position; ///< The place in the heap.
+      size_t next_in_bucket;
+    };
+
+    //*************************************************************************
+    /// Orders entry indexes by count.
+    //*************************************************************************
+    struct count_less
+    {
+      explicit count_less(const entry* p_entries_)
+        : p_entries(p_entries_)
+      {
+      }
+
+      bool operator()(size_t a, size_t b) const
+      {
+        return p_entries[a].count < p_entries[b].count;
+      }
+
+      const entry* p_entries;
+    };
+
+    //*************************************************************************
+    /// Gets the bucket for the key.
+    //*************************************************************************
+    size_t bucket_of(const key_type& key) const
+    {
+      return static_cast<size_t>(etl::private_sketch::mix(static_cast<uint64_t>(hash_function(key)))) & (Bucket_Count - 1U);
+    }
+
+    //*************************************************************************
+    /// Finds the entry for the key, or Npos.
+    //*************************************************************************
+    size_t find_index(const key_type& key) const
+    {
+      size_t index = buckets[bucket_of(key)];
+
+      while ((index != Npos) && !key_equal_function(entries[index].key, key))
+      {
+        index = entries[index].next_in_bucket;
+      }
+
+      return index;
+    }
+
+    //*************************************************************************
+    /// Links the entry at the front of the bucket for its key.
+    //*************************************************************************
+    void link(size_t index)
+    {
+      const size_t bucket = bucket_of(entries[index].key);
+
+      entries[index].next_in_bucket = buckets[bucket];
+      buckets[bucket]               = index;
+    }
+
+    //*************************************************************************
+    /// Unlinks the entry from the bucket for its key.
+    //*************************************************************************
+    void unlink(size_t index)
+    {
+      size_t* p_link = &buckets[bucket_of(entries[index].key)];
+
+      while (*p_link != index)
+      {
+        p_link = &entries[*p_link].next_in_bucket;
+      }
+
+      *p_link = entries[index].next_in_bucket;
+    }
+
+    //*************************************************************************
+    /// Counts a new key in a free entry.
+    //*************************************************************************
+    void insert_new(const key_type& key, count_type count, count_type error)
+    {
+      const size_t index = current_size++;
+      entry&       e     = entries[index];
+
+      e.key   = key;
+      e.count = count;
+      e.error = error;
+      link(index);
+
+      heap[index]     = index;
+      e.heap_position = index;
+      sift_up(index);
+    }
+
+    //*************************************************************************
+    /// Counts a new key in place of the one with the smallest count.
+    //*************************************************************************
+    void replace_minimum(const key_type& key, count_type count, count_type error)
+    {
+      const size_t index = heap[0];
+      entry&       e     = entries[index];
+
+      unlink(index);
+      e.key   = key;
+      e.count = count;
+      e.error = error;
+      link(index);
+
+      sift_down(0U);
+    }
+
+    //*************************************************************************
+    /// Swaps two places in the heap.
+    //*************************************************************************
+    void swap_heap(size_t a, size_t b)
+    {
+      ETL_OR_STD::swap(heap[a], heap[b]);
+      entries[heap[a]].heap_position = a;
+      entries[heap[b]].heap_position = b;
+    }
+
+    //*************************************************************************
+    /// Moves an entry towards the root while its count is smaller.
+    //*************************************************************************
+    void sift_up(size_t position)
+    {
+      while (position != 0U)
+      {
+        const size_t parent = (position - 1U) / 2U;
+
+        if (!(entries[heap[position]].count < entries[heap[parent]].count))
+        {
+          break;
+        }
+
+        swap_heap(position, parent);
+        position = parent;
+      }
+    }
+
+    //*************************************************************************
+    /// Moves an entry away from the root while its count is larger.
+    //*************************************************************************
+    void sift_down(size_t position)
+    {
+      while (true)
+      {
+        const size_t left     = (2U * position) + 1U;
+        const size_t right    = left + 1U;
+        size_t       smallest = position;
+
+        if ((left < current_size) && (entries[heap[left]].count < entries[heap[smallest]].count))
+        {
+          smallest = left;
+        }
+
+        if ((right < current_size) && (entries[heap[right]].count < entries[heap[smallest]].count))
+        {
+          smallest = right;
+        }
+
+        if (smallest == position)
+        {
+          break;
+        }
+
+        swap_heap(position, smallest);
+        position = smallest;
+      }
+    }
+
+    entry          entries[MAX_SIZE_];    ///< The counters, in order of arrival.
+    size_t         heap[MAX_SIZE_];       ///< Entry indexes, smallest count first.
+    size_t         buckets[Bucket_Count]; ///< The first entry in each bucket.
+    size_t         current_size;          ///< The number of entries in use.
+    uint64_t       total_count;           ///< The total of all of the counts added.
+    hasher         hash_function;         ///< The key hash function.
+    key_equal      key_equal_function;    ///< The key equality function.
+  };
+
+  template <typename TKey, size_t MAX_SIZE_, typename TCount, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t top_k<TKey, MAX_SIZE_, TCount, THash, TKeyEqual>::MAX_SIZE;
+
+  template <typename TKey, size_t MAX_SIZE_, typename TCount, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t top_k<TKey, MAX_SIZE_, TCount, THash, TKeyEqual>::Bucket_Count;
+
+  template <typename TKey, size_t MAX_SIZE_, typename TCount, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t top_k<TKey, MAX_SIZE_, TCount, THash, TKeyEqual>::Npos;
+} // namespace etl
+
+#endif
@@ -0,0 +1,713 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TRACE_HOOKS_INCLUDED
+#define ETL_TRACE_HOOKS_INCLUDED
+
+#include "platform.h"
+#include "integral_limits.h"
+#include "nullptr.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup trace_hooks trace hooks
+/// Latency probes for message routers, FSMs, state charts, schedulers and
+/// callback timers.
+/// Define ETL_TRACE_HOOKS to enable. When not defined, the probes expand to
+/// nothing and the instrumented classes are unchanged.
+///
+/// Each probe records the start time, duration, component id and message id
+/// of the call it wraps into the calling thread's etl::trace_ring.
+/// The meaning of the ids depends on the category.
+/// | Category       | Component id       | Message id       |
+/// | -------------- | ------------------ | ---------------- |
+/// | Message_Router | Router id          | Message id       |
+/// | Fsm            | FSM router id      | Message id       |
+/// | State_Chart    | Current state id   | Event id         |
+/// | Scheduler      | Task priority      | 0                |
+/// | Timer          | Timer id           | 0                |
+///
+/// Probes record nothing until a clock has been set with
+/// etl::trace_hooks::set_clock and the thread has a ring.
+///\ingroup utilities
+
+#if defined(ETL_TRACE_HOOKS)
+
+  #include "atomic.h"
+  #include "static_assert.h"
+
+  #define ETL_TRACE_SCOPE(category, component_id, message_id) \
+    etl::trace_scope etl_trace_scope((category), static_cast<uint32_t>(component_id), static_cast<uint32_t>(message_id))
+
+namespace etl
+{
+  //***************************************************************************
+  /// The instrumented components.
+  ///\ingroup trace_hooks
+  //***************************************************************************
+  struct trace_category
+  {
+    enum enum_type
+    {
+      Message_Router,
+      Fsm,
+      State_Chart,
+      Scheduler,
+      Timer
+    };
+
+    //*************************************************************************
+    /// The name used in exported traces.
+    //*************************************************************************
+    static const char* name(int category)
+    {
+      switch (category)
+      {
+        case Message_Router:
+          return "message_router";
+        case Fsm:
+          return "fsm";
+        case State_Chart:
+          return "state_chart";
+        case Scheduler:
+          return "scheduler";
+        case Timer:
+          return "timer";
+        default:
+          return "unknown";
+      }
+    }
+  };
+
+  //***************************************************************************
+  /// One completed probe.
+  ///\ingroup trace_hooks
+  //***************************************************************************
+  struct trace_record
+  {
+    uint64_t start;    ///< Clock ticks at entry.
+    uint32_t duration; ///< Clock ticks from entry to exit, saturated.
+    uint32_t component_id;
+    uint32_t message_id;
+    uint8_t  category; ///< An etl::trace_category::enum_type.
+  };
+
+  //***************************************************************************
+  /// Ring of trace records, overwriting the oldest when full.
+  /// Written only by the thread that owns it, without locks. The write count
+  /// is published with release ordering so that another thread may export
+  /// the ring, though records being overwritten during the export may be torn.
+  ///\ingroup trace_hooks
+  //***************************************************************************
+  class itrace_ring
+  {
+  public:
+
+    //*************************************************************************
+    /// Adds a record, overwriting the oldest if the ring is full.
+    //*************************************************************************
+    void push(const trace_record& record)
+    {
+  #if ETL_HAS_ATOMIC
+      const uint32_t n = written.load(etl::memory_order_relaxed);
+      p_buffer[n & mask] = record;
+      written.store(n + 1U, etl::memory_order_release);
+  #else
+      p_buffer[written & mask] = record;
+      ++written;
+  #endif
+    }
+
+    //*************************************************************************
+    /// The number of records ever pushed, modulo 2^32.
+    //*************************************************************************
+    uint32_t total() const
+    {
+  #if ETL_HAS_ATOMIC
+      return written.load(etl::memory_order_acquire);
+  #else
+      return written;
+  #endif
+    }
+
+    //*************************************************************************
+    /// The number of records held.
+    //*************************************************************************
+    size_t size() const
+    {
+      const uint32_t n = total();
+
+      return (n < capacity()) ? n : capacity();
+    }
+
+    //*************************************************************************
+    /// The number of records that have been overwritten.
+    //*************************************************************************
+    uint32_t dropped() const
+    {
+      return total() - static_cast<uint32_t>(size());
+    }
+
+    //*************************************************************************
+    /// The maximum number of records held.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return static_cast<size_t>(mask) + 1U;
+    }
+
+    //*************************************************************************
+    /// Gets a held record. 0 is the oldest.
+    //*************************************************************************
+    const trace_record& operator[](size_t i) const
+    {
+      const uint32_t n     = total();
+      const uint32_t first = (n < capacity()) ? 0U : (n - static_cast<uint32_t>(capacity()));
+
+      return p_buffer[(first + static_cast<uint32_t>(i)) & mask];
+    }
+
+    //*************************************************************************
+    /// Discards all records. Call from the owning thread.
+    //*************************************************************************
+    void clear()
+    {
+  #if ETL_HAS_ATOMIC
+      written.store(0U, etl::memory_order_release);
+  #else
+      written = 0U;
+  #endif
+    }
+
+    //*************************************************************************
+    /// The thread id used in exported traces.
+    //*************************************************************************
+    uint32_t thread_id() const
+    {
+      return tid;
+    }
+
+    //*************************************************************************
+    /// The thread name used in exported traces, or null.
+    //*************************************************************************
+    const char* thread_name() const
+    {
+      return p_name;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    itrace_ring(trace_record* p_buffer_, uint32_t capacity_, uint32_t thread_id_, const char* thread_name_)
+      : p_buffer(p_buffer_)
+      , mask(capacity_ - 1U)
+      , written(0U)
+      , tid(thread_id_)
+      , p_name(thread_name_)
+    {
+    }
+
+  private:
+
+    // Disabled.
+    itrace_ring(const itrace_ring&) ETL_DELETE;
+    itrace_ring& operator=(const itrace_ring&) ETL_DELETE;
+
+    trace_record* p_buffer;
+    uint32_t      mask;
+  #if ETL_HAS_ATOMIC
+    etl::atomic<uint32_t> written;
+  #else
+    volatile uint32_t written;
+  #endif
+    uint32_t    tid;
+    const char* p_name;
+  };
+
+  //***************************************************************************
+  /// Ring of trace records with storage for Size records.
+  ///\tparam Size The number of records. Must be a power of two.
+  ///\ingroup trace_hooks
+  //***************************************************************************
+  template <size_t Size>
+  class trace_ring : public itrace_ring
+  {
+  public:
+
+    ETL_STATIC_ASSERT((Size > 0U) && ((Size & (Size - 1U)) == 0U), "Size must be a power of two");
+
+    static ETL_CONSTANT size_t Capacity = Size;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit trace_ring(uint32_t thread_id_ = 0U, const char* thread_name_ = ETL_NULLPTR)
+      : itrace_ring(buffer, static_cast<uint32_t>(Size), thread_id_, thread_name_)
+    {
+    }
+
+  private:
+
+    trace_record buffer[Size];
+  };
+
+  template <size_t Size>
+  ETL_CONSTANT size_t trace_ring<Size>::Capacity;
+
+  //***************************************************************************
+  /// Global probe configuration.
+  ///\ingroup trace_hooks
+  //***************************************************************************
+  class trace_hooks
+  {
+  public:
+
+    typedef uint64_t (*clock_type)();
+    typedef etl::itrace_ring* (*ring_provider_type)();
+
+    //*************************************************************************
+    /// Sets the clock read at probe entry and exit. Null disables the probes.
+    /// The clock is held in an etl::atomic, so it may be changed while other
+    /// threads are tracing. Without ETL_HAS_ATOMIC it must be set before any
+    /// tracing starts.
+    //*************************************************************************
+    static void set_clock(clock_type clock_)
+    {
+  #if ETL_HAS_ATOMIC
+      clock_function().store(clock_, etl::memory_order_release);
+  #else
+      clock_function() = clock_;
+  #endif
+    }
+
+    //*************************************************************************
+    /// The current clock, or null.
+    //*************************************************************************
+    static clock_type get_clock()
+    {
+  #if ETL_HAS_ATOMIC
+      return clock_function().load(etl::memory_order_acquire);
+  #else
+      return clock_function();
+  #endif
+    }
+
+    //*************************************************************************
+    /// Sets the ring for the calling thread.
+    /// Before C++11 this is shared by all threads, so multi-threaded targets
+    /// should use set_ring_provider instead.
+    //*************************************************************************
+    static void set_thread_ring(etl::itrace_ring* p_ring)
+    {
+      thread_ring() = p_ring;
+    }
+
+    //*************************************************************************
+    /// Sets a function that returns the calling thread's ring, for example from
+    /// an RTOS task control block. Overrides set_thread_ring when set.
+    /// Like the clock, it is atomic if ETL_HAS_ATOMIC.
+    //*************************************************************************
+    static void set_ring_provider(ring_provider_type provider)
+    {
+  #if ETL_HAS_ATOMIC
+      ring_provider().store(provider, etl::memory_order_release);
+  #else
+      ring_provider() = provider;
+  #endif
+    }
+
+    //*************************************************************************
+    /// The ring for the calling thread, or null.
+    //*************************************************************************
+    static etl::itrace_ring* current_ring()
+    {
+  #if ETL_HAS_ATOMIC
+      ring_provider_type provider = ring_provider().load(etl::memory_order_acquire);
+  #else
+      ring_provider_type provider = ring_provider();
+  #endif
+
+      return (provider != ETL_NULLPTR) ? provider() : thread_ring();
+    }
+
+  private:
+
+  #if ETL_HAS_ATOMIC
+    typedef etl::atomic<clock_type>         clock_storage_type;
+    typedef etl::atomic<ring_provider_type> ring_provider_storage_type;
+  #else
+    typedef clock_type         clock_storage_type;
+    typedef ring_provider_type ring_provider_storage_type;
+  #endif
+
+    //*************************************************************************
+    static clock_storage_type& clock_function()
+    {
+      static clock_storage_type clock_(ETL_NULLPTR);
+
+      return clock_;
+    }
+
+    //*************************************************************************
+    static ring_provider_storage_type& ring_provider()
+    {
+      static ring_provider_storage_type provider(ETL_NULLPTR);
+
+      return provider;
+    }
+
+    //*************************************************************************
+    static etl::itrace_ring*& thread_ring()
+    {
+  #if ETL_USING_CPP11
+      static thread_local etl::itrace_ring* p_ring = ETL_NULLPTR;
+  #else
+      static etl::itrace_ring* p_ring = ETL_NULLPTR;
+  #endif
+
+      return p_ring;
+    }
+  };
+
+  //***************************************************************************
+  /// Records the duration of the enclosing scope.
+  /// Use via ETL_TRACE_SCOPE.
+  ///\ingroup trace_hooks
+  //***************************************************************************
+  class trace_scope
+  {
+  public:
+
+    //*************************************************************************
+    trace_scope(int category, uint32_t component_id, uint32_t message_id)
+      : p_ring(ETL_NULLPTR)
+      , clock(etl::trace_hooks::get_clock())
+    {
+      if (clock != ETL_NULLPTR)
+      {
+        p_ring = etl::trace_hooks::current_ring();
+
+        if (p_ring != ETL_NULLPTR)
+        {
+          record.category     = static_cast<uint8_t>(category);
+          record.component_id = component_id;
+          record.message_id   = message_id;
+          record.start        = clock();
+        }
+      }
+    }
+
+    //*************************************************************************
+    ~trace_scope()
+    {
+      if (p_ring != ETL_NULLPTR)
+      {
+        const uint64_t elapsed = clock() - record.start;
+
+        record.duration = (elapsed > 0xFFFFFFFFUL) ? 0xFFFFFFFFUL : static_cast<uint32_t>(elapsed);
+        p_ring->push(record);
+      }
+    }
+
+  private:
+
+    // Disabled.
+    trace_scope(const trace_scope&) ETL_DELETE;
+    trace_scope& operator=(const trace_scope&) ETL_DELETE;
+
+    etl::itrace_ring*            p_ring;
+    etl::trace_hooks::clock_type clock;
+    trace_record                 record;
+  };
+
+  //***************************************************************************
+  /// The exported JSON layouts.
+  ///\ingroup trace_hooks
+  //***************************************************************************
+  struct trace_format
+  {
+    enum enum_type
+    {
+      Chrome,  ///< A JSON array of events, as read by chrome://tracing.
+      Perfetto ///< A JSON object with a traceEvents array, as read by ui.perfetto.dev.
+    };
+  };
+
+  //***************************************************************************
+  /// Writes trace rings as Chrome trace event JSON.
+  /// Each record is a complete ('X') event on the ring's thread, with the
+  /// component and message ids as arguments. Each named ring adds a
+  /// thread_name metadata event.
+  ///\tparam TWriter A functor called with each null terminated piece of text.
+  ///\ingroup trace_hooks
+  //***************************************************************************
+  template <typename TWriter>
+  class trace_json_writer
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor. Writes the opening of the document.
+    ///\param ticks_per_second The frequency of the clock set in etl::trace_hooks.
+    //*************************************************************************
+    trace_json_writer(TWriter& writer_, uint64_t ticks_per_second_, trace_format::enum_type format_ = trace_format::Chrome,
+                      uint32_t process_id_ = 1U)
+      : writer(writer_)
+      , ticks_per_second(ticks_per_second_)
+      , format(format_)
+      , process_id(process_id_)
+      , first_event(true)
+      , finished(false)
+    {
+      writer((format == trace_format::Perfetto) ? "{\"traceEvents\":[" : "[");
+    }
+
+    //*************************************************************************
+    /// Destructor. Finishes the document if finish() has not been called.
+    //*************************************************************************
+    ~trace_json_writer()
+    {
+      finish();
+    }
+
+    //*************************************************************************
+    /// Writes the records held in a ring, oldest first.
+    //*************************************************************************
+    void write(const etl::itrace_ring& ring)
+    {
+      if (ring.thread_name() != ETL_NULLPTR)
+      {
+        begin_event();
+        writer("\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":");
+        write_integer(process_id);
+        writer(",\"tid\":");
+        write_integer(ring.thread_id());
+        writer(",\"args\":{\"name\":\"");
+        write_escaped(ring.thread_name());
+        writer("\"}}");
+      }
+
+      const size_t n = ring.size();
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        write(ring[i], ring.thread_id());
+      }
+    }
+
+    //*************************************************************************
+    /// Writes a single record.
+    //*************************************************************************
+    void write(const etl::trace_record& record, uint32_t thread_id)
+    {
+      begin_event();
+      writer("\"name\":\"");
+      writer(etl::trace_category::name(record.category));
+      writer("\",\"cat\":\"etl\",\"ph\":\"X\",\"pid\":");
+      write_integer(process_id);
+      writer(",\"tid\":");
+      write_integer(thread_id);
+      writer(",\"ts\":");
+      write_microseconds(record.start);
+      writer(",\"dur\":");
+      write_microseconds(record.duration);
+      writer(",\"args\":{\"component\":");
+      write_integer(record.component_id);
+      writer(",\"message\":");
+      write_integer(record.message_id);
+      writer("}}");
+    }
+
+    //*************************************************************************
+    /// Writes the closing of the document. Further calls do nothing.
+    //*************************************************************************
+    void finish()
+    {
+      if (!finished)
+      {
+        writer((format == trace_format::Perfetto) ? "],\"displayTimeUnit\":\"ns\"}\n" : "]\n");
+        finished = true;
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    void begin_event()
+    {
+      writer(first_event ? "\n{" : ",\n{");
+      first_event = false;
+    }
+
+    //*************************************************************************
+    /// Writes text as the contents of a JSON string. Quotes, backslashes and
+    /// control characters are escaped.
+    //*************************************************************************
+    void write_escaped(const char* text)
+    {
+      static const char hex[] = "0123456789abcdef";
+
+      char   buffer[32];
+      size_t length = 0U;
+
+      while (*text != '\0')
+      {
+        const unsigned char c = static_cast<unsigned char>(*text++);
+
+        // Leave room for the longest escape and the terminator.
+        if (length > (sizeof(buffer) - 7U))
+        {
+          buffer[length] = '\0';
+          writer(static_cast<const char*>(buffer));
+          length = 0U;
+        }
+
+        if ((c == '"') || (c == '\\'))
+        {
+          buffer[length++] = '\\';
+          buffer[length++] = static_cast<char>(c);
+        }
+        else if (c < 0x20U)
+        {
+          buffer[length++] = '\\';
+          buffer[length++] = 'u';
+          buffer[length++] = '0';
+          buffer[length++] = '0';
+          buffer[length++] = hex[c >> 4U];
+          buffer[length++] = hex[c & 0x0FU];
+        }
+        else
+        {
+          buffer[length++] = static_cast<char>(c);
+        }
+      }
+
+      buffer[length] = '\0';
+      writer(static_cast<const char*>(buffer));
+    }
+
+    //*************************************************************************
+    void write_integer(uint64_t value)
+    {
+      char  text[21];
+      char* p = text + sizeof(text) - 1U;
+
+      *p = '\0';
+
+      do
+      {
+        *--p = static_cast<char>('0' + (value % 10U));
+        value /= 10U;
+      } while (value != 0U);
+
+      writer(static_cast<const char*>(p));
+    }
+
+    //*************************************************************************
+    /// Converts part of a second, in ticks, to nanoseconds, rounded down.
+    /// Above about 1.8e10 ticks per second part * 10^9 would overflow, so the
+    /// nanoseconds are found one decimal digit at a time, multiplying the
+    /// remainder by 10 with additions that never exceed ticks_per_second.
+    //*************************************************************************
+    uint64_t part_to_nanoseconds(uint64_t part) const
+    {
+      if (part <= (etl::integral_limits<uint64_t>::max / 1000000000ULL))
+      {
+        return (part * 1000000000ULL) / ticks_per_second;
+      }
+
+      uint64_t ns = 0U;
+
+      for (int digit = 0; digit < 9; ++digit)
+      {
+        uint64_t quotient  = 0U;
+        uint64_t remainder = 0U;
+
+        for (int i = 0; i < 10; ++i)
+        {
+          if (remainder >= (ticks_per_second - part))
+          {
+            remainder -= (ticks_per_second - part);
+            ++quotient;
+          }
+          else
+          {
+            remainder += part;
+          }
+        }
+
+        ns   = (ns * 10U) + quotient;
+        part = remainder;
+      }
+
+      return ns;
+    }
+
+    //*************************************************************************
+    /// Writes ticks as microseconds with three decimal places.
+    //*************************************************************************
+    void write_microseconds(uint64_t ticks)
+    {
+      // Split to avoid overflowing ticks * 10^9.
+      const uint64_t whole = ticks / ticks_per_second;
+      const uint64_t part  = ticks % ticks_per_second;
+      const uint64_t ns    = (whole * 1000000000ULL) + part_to_nanoseconds(part);
+
+      write_integer(ns / 1000U);
+
+      char fraction[5];
+      const uint32_t remainder = static_cast<uint32_t>(ns % 1000U);
+
+      fraction[0] = '.';
+      fraction[1] = static_cast<char>('0' + (remainder / 100U));
+      fraction[2] = static_cast<char>('0' + ((remainder / 10U) % 10U));
+      fraction[3] = static_cast<char>('0' + (remainder % 10U));
+      fraction[4] = '\0';
+
+      writer(static_cast<const char*>(fraction));
+    }
+
+    TWriter&                writer;
+    uint64_t                ticks_per_second;
+    trace_format::enum_type format;
+    uint32_t                process_id;
+    bool                    first_event;
+    bool                    finished;
+  };
+} // namespace etl
+
+#else
+  #define ETL_TRACE_SCOPE(category, component_id, message_id) ((void)0)
+#endif // ETL_TRACE_HOOKS
+
+#endif
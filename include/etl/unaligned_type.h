@@ -44,7 +44,10 @@ SOFTWARE.
 #include "exception.h"
 #include "file_error_numbers.h"
 #include "iterator.h"
+#include "span.h"
+#include "type_list.h"
 #include "type_traits.h"
+#include "utility.h"
 
 #if ETL_USING_CPP20 && ETL_USING_STL
   #include <bit>
@@ -447,6 +450,49 @@ namespace etl
       }
     };
     ETL_END_PACKED
+
+    //*************************************************************************
+    /// Reverses the bytes of 'n' elements of Size_ bytes.
+    /// Uses the vector kernel for 2, 4 and 8 byte elements.
+    //*************************************************************************
+    template <size_t Size_>
+    void reverse_bytes_each(unsigned char* data, size_t n, etl::true_type /*use kernel*/)
+    {
+      etl::private_algorithm_simd::reverse_bytes_each<Size_>(data, n);
+    }
+
+    template <size_t Size_>
+    void reverse_bytes_each(unsigned char* data, size_t n, etl::false_type /*use kernel*/)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        etl::reverse(data, data + Size_);
+        data += Size_;
+      }
+    }
+
+    template <size_t Size_>
+    struct use_reverse_bytes_kernel
+      : etl::integral_constant<bool, (ETL_USING_ALGORITHM_SIMD == 1) && ((Size_ == 2U) || (Size_ == 4U) || ((Size_ == 8U) && (ETL_USING_64BIT_TYPES == 1)))>
+    {
+    };
+
+    //*************************************************************************
+    /// Reverses the bytes of 'n' elements of Size_ bytes if Endian_ is not the
+    /// host endianness.
+    //*************************************************************************
+    template <size_t Size_, int Endian_>
+    void reverse_bytes_if(unsigned char* data, size_t n)
+    {
+#if ETL_HAS_CONSTEXPR_ENDIANNESS
+      if ETL_IF_CONSTEXPR ((Size_ > 1U) && (Endian_ != etl::endianness::value()))
+#else
+      if ((Size_ > 1U) && (Endian_ != etl::endianness::value()))
+#endif
+      {
+        reverse_bytes_each<Size_>(data, n, use_reverse_bytes_kernel<Size_>());
+      }
+    }
   } // namespace private_unaligned_type
 
   //*************************************************************************
@@ -1032,6 +1078,271 @@ namespace etl
   template <typename T, int Endian>
   constexpr size_t unaligned_type_ext_t_v = etl::unaligned_type_ext<T, Endian>::Size;
 #endif
+
+  //***************************************************************************
+  /// Copies 'n' unaligned_type values to an array of native values.
+  /// The bytes are copied in one block and then reversed in place if the
+  /// endianness differs from the host, using the vector kernels when
+  /// ETL_ALGORITHM_USE_SIMD is defined.
+  //***************************************************************************
+  template <typename T, int Endian_>
+  void unaligned_copy_to_native(const etl::unaligned_type<T, Endian_>* source, size_t n, T* destination)
+  {
+    ETL_STATIC_ASSERT(sizeof(etl::unaligned_type<T, Endian_>) == sizeof(T), "unaligned_type is not packed");
+
+    if (n == 0U)
+    {
+      return;
+    }
+
+    unsigned char* p_destination = reinterpret_cast<unsigned char*>(destination);
+
+    memcpy(p_destination, source->data(), n * sizeof(T));
+    private_unaligned_type::reverse_bytes_if<sizeof(T), Endian_>(p_destination, n);
+  }
+
+  //***************************************************************************
+  /// Copies 'n' native values to an array of unaligned_type.
+  //***************************************************************************
+  template <typename T, int Endian_>
+  void unaligned_copy_from_native(const T* source, size_t n, etl::unaligned_type<T, Endian_>* destination)
+  {
+    ETL_STATIC_ASSERT(sizeof(etl::unaligned_type<T, Endian_>) == sizeof(T), "unaligned_type is not packed");
+
+    if (n == 0U)
+    {
+      return;
+    }
+
+    unsigned char* p_destination = reinterpret_cast<unsigned char*>(destination);
+
+    memcpy(p_destination, source, n * sizeof(T));
+    private_unaligned_type::reverse_bytes_if<sizeof(T), Endian_>(p_destination, n);
+  }
+
+  //***************************************************************************
+  /// Copies a span of unaligned_type values to a span of native values.
+  /// Returns the number of values copied; the smaller of the two sizes.
+  //***************************************************************************
+  template <typename T, int Endian_, size_t Source_Extent, size_t Destination_Extent>
+  size_t unaligned_copy_to_native(etl::span<const etl::unaligned_type<T, Endian_>, Source_Extent> source, etl::span<T, Destination_Extent> destination)
+  {
+    const size_t n = etl::min(source.size(), destination.size());
+
+    unaligned_copy_to_native(source.data(), n, destination.data());
+
+    return n;
+  }
+
+  //***************************************************************************
+  /// Copies a span of unaligned_type values to a span of native values.
+  /// Returns the number of values copied; the smaller of the two sizes.
+  //***************************************************************************
+  template <typename T, int Endian_, size_t Source_Extent, size_t Destination_Extent>
+  size_t unaligned_copy_to_native(etl::span<etl::unaligned_type<T, Endian_>, Source_Extent> source, etl::span<T, Destination_Extent> destination)
+  {
+    const size_t n = etl::min(source.size(), destination.size());
+
+    unaligned_copy_to_native(source.data(), n, destination.data());
+
+    return n;
+  }
+
+  //***************************************************************************
+  /// Copies a span of native values to a span of unaligned_type values.
+  /// Returns the number of values copied; the smaller of the two sizes.
+  //***************************************************************************
+  template <typename T, int Endian_, size_t Source_Extent, size_t Destination_Extent>
+  size_t unaligned_copy_from_native(etl::span<const T, Source_Extent> source, etl::span<etl::unaligned_type<T, Endian_>, Destination_Extent> destination)
+  {
+    const size_t n = etl::min(source.size(), destination.size());
+
+    unaligned_copy_from_native(source.data(), n, destination.data());
+
+    return n;
+  }
+
+  //***************************************************************************
+  /// Copies a span of native values to a span of unaligned_type values.
+  /// Returns the number of values copied; the smaller of the two sizes.
+  //***************************************************************************
+  template <typename T, int Endian_, size_t Source_Extent, size_t Destination_Extent>
+  size_t unaligned_copy_from_native(etl::span<T, Source_Extent> source, etl::span<etl::unaligned_type<T, Endian_>, Destination_Extent> destination)
+  {
+    const size_t n = etl::min(source.size(), destination.size());
+
+    unaligned_copy_from_native(source.data(), n, destination.data());
+
+    return n;
+  }
+
+#if ETL_USING_CPP11
+  namespace private_unaligned_type
+  {
+    //*************************************************************************
+    /// The byte offset of field 'Index'.
+    //*************************************************************************
+    template <size_t Index, typename... TFields>
+    struct field_offset;
+
+    template <typename TFirst, typename... TRest>
+    struct field_offset<0U, TFirst, TRest...> : etl::integral_constant<size_t, 0U>
+    {
+    };
+
+    template <size_t Index, typename TFirst, typename... TRest>
+    struct field_offset<Index, TFirst, TRest...> : etl::integral_constant<size_t, TFirst::Size + field_offset<Index - 1U, TRest...>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// The total size of the fields.
+    //*************************************************************************
+    template <typename... TFields>
+    struct fields_size;
+
+    template <>
+    struct fields_size<> : etl::integral_constant<size_t, 0U>
+    {
+    };
+
+    template <typename TFirst, typename... TRest>
+    struct fields_size<TFirst, TRest...> : etl::integral_constant<size_t, TFirst::Size + fields_size<TRest...>::value>
+    {
+    };
+  } // namespace private_unaligned_type
+
+  //***************************************************************************
+  /// A view of a packed wire structure whose fields are unaligned_type.
+  /// Field offsets are computed at compile time and decode/encode convert every
+  /// field in a single pass over the buffer.
+  ///\code
+  /// typedef etl::unaligned_struct_view<etl::be_uint32_t, etl::be_uint16_t, etl::be_uint16_t> header_view;
+  ///
+  /// uint32_t magic;
+  /// uint16_t version;
+  /// uint16_t count;
+  /// header_view(buffer, length).decode(magic, version, count);
+  ///\endcode
+  ///\tparam TFields The unaligned_type of each field, in wire order.
+  //***************************************************************************
+  template <typename... TFields>
+  class unaligned_struct_view
+  {
+  public:
+
+    ETL_STATIC_ASSERT(sizeof...(TFields) > 0U, "unaligned_struct_view requires at least one field");
+
+    typedef etl::type_list<TFields...> field_types;
+
+    /// The size of the structure on the wire.
+    static ETL_CONSTANT size_t Size = private_unaligned_type::fields_size<TFields...>::value;
+
+    /// The number of fields.
+    static ETL_CONSTANT size_t Number_Of_Fields = sizeof...(TFields);
+
+    /// The unaligned_type of field 'Index'.
+    template <size_t Index>
+    using field_type = etl::type_list_type_at_index_t<field_types, Index>;
+
+    /// The native type of field 'Index'.
+    template <size_t Index>
+    using field_value_type = typename field_type<Index>::value_type;
+
+    //*************************************************************************
+    /// The byte offset of field 'Index'.
+    //*************************************************************************
+    template <size_t Index>
+    static ETL_CONSTEXPR size_t offset()
+    {
+      return private_unaligned_type::field_offset<Index, TFields...>::value;
+    }
+
+    //*************************************************************************
+    /// Constructs a view of the structure at 'data'.
+    /// Asserts etl::unaligned_type_buffer_size if 'length' is less than Size.
+    //*************************************************************************
+    unaligned_struct_view(const void* data_, size_t length)
+      : p_data(static_cast<const unsigned char*>(data_))
+    {
+      ETL_ASSERT(length >= Size, ETL_ERROR(etl::unaligned_type_buffer_size));
+    }
+
+    //*************************************************************************
+    /// Decodes field 'Index'.
+    //*************************************************************************
+    template <size_t Index>
+    field_value_type<Index> get() const
+    {
+      field_value_type<Index> value = field_value_type<Index>();
+
+      field_type<Index>::unaligned_copy::copy_store_to_value(p_data + offset<Index>(), value);
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Decodes every field, in order.
+    //*************************************************************************
+    void decode(typename TFields::value_type&... values) const
+    {
+      decode_fields(etl::make_index_sequence<Number_Of_Fields>(), values...);
+    }
+
+    //*************************************************************************
+    /// Encodes every field, in order, to 'data'.
+    /// Asserts etl::unaligned_type_buffer_size if 'length' is less than Size.
+    //*************************************************************************
+    static void encode(void* data, size_t length, typename TFields::value_type... values)
+    {
+      ETL_ASSERT_OR_RETURN(length >= Size, ETL_ERROR(etl::unaligned_type_buffer_size));
+
+      encode_fields(static_cast<unsigned char*>(data), etl::make_index_sequence<Number_Of_Fields>(), values...);
+    }
+
+    //*************************************************************************
+    /// The start of the viewed structure.
+    //*************************************************************************
+    const unsigned char* data() const
+    {
+      return p_data;
+    }
+
+    //*************************************************************************
+    /// The size of the structure on the wire.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t size() const
+    {
+      return Size;
+    }
+
+  private:
+
+    //*************************************************************************
+    template <size_t... Indices>
+    void decode_fields(etl::index_sequence<Indices...>, typename TFields::value_type&... values) const
+    {
+      const int expand[] = {0, (field_type<Indices>::unaligned_copy::copy_store_to_value(p_data + offset<Indices>(), values), 0)...};
+      (void)expand;
+    }
+
+    //*************************************************************************
+    template <size_t... Indices>
+    static void encode_fields(unsigned char* p, etl::index_sequence<Indices...>, typename TFields::value_type... values)
+    {
+      const int expand[] = {0, (field_type<Indices>::unaligned_copy::copy_value_to_store(values, p + offset<Indices>()), 0)...};
+      (void)expand;
+    }
+
+    const unsigned char* p_data;
+  };
+
+  template <typename... TFields>
+  ETL_CONSTANT size_t unaligned_struct_view<TFields...>::Size;
+
+  template <typename... TFields>
+  ETL_CONSTANT size_t unaligned_struct_view<TFields...>::Number_Of_Fields;
+#endif
 } // namespace etl
 
 #endif
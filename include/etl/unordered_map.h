@@ -34,6 +34,7 @@ SOFTWARE.
 #include "platform.h"
 #include "algorithm.h"
 #include "array.h"
+#include "container_statistics.h"
 #include "debug_count.h"
 #include "error_handler.h"
 #include "exception.h"
@@ -688,6 +689,7 @@ namespace etl
       ::new ((void*)etl::addressof(node->key_value_pair.first)) key_type(etl::move(key));
       ::new ((void*)etl::addressof(node->key_value_pair.second)) mapped_type();
       ETL_INCREMENT_DEBUG_COUNT;
+      ETL_CONTAINER_STATISTICS_SIZE(size());
 
       pbucket->insert_after(pbucket->before_begin(), *node);
 
@@ -732,6 +734,7 @@ namespace etl
       ::new ((void*)etl::addressof(node->key_value_pair.first)) key_type(key);
       ::new ((void*)etl::addressof(node->key_value_pair.second)) mapped_type();
       ETL_INCREMENT_DEBUG_COUNT;
+      ETL_CONTAINER_STATISTICS_SIZE(size());
 
       pbucket->insert_after(pbucket->before_begin(), *node);
 
@@ -777,6 +780,7 @@ namespace etl
       ::new ((void*)etl::addressof(node->key_value_pair.first)) key_type(key);
       ::new ((void*)etl::addressof(node->key_value_pair.second)) mapped_type();
       ETL_INCREMENT_DEBUG_COUNT;
+      ETL_CONTAINER_STATISTICS_SIZE(size());
 
       pbucket->insert_after(pbucket->before_begin(), *node);
 
@@ -972,16 +976,19 @@ namespace etl
     {
       ETL_OR_STD::pair<iterator, bool> result(end(), false);
 
-      ETL_ASSERT(!full(), ETL_ERROR(unordered_map_full));
-
       const key_type& key = key_value_pair.first;
 
+      // Only a new key needs a node.
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full() && !contains(key));
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_map_full));
+
       // Get the hash index.
       size_t index = get_bucket_index(key);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket  = *pbucket;
+      ETL_CONTAINER_STATISTICS_PROBE_BEGIN;
 
       // The first one in the bucket?
       if (bucket.empty())
@@ -991,6 +998,7 @@ namespace etl
         node->clear();
         ::new ((void*)etl::addressof(node->key_value_pair)) value_type(key_value_pair);
         ETL_INCREMENT_DEBUG_COUNT;
+        ETL_CONTAINER_STATISTICS_SIZE(size());
 
         // Just add the pointer to the bucket;
         bucket.insert_after(bucket.before_begin(), *node);
@@ -1008,6 +1016,8 @@ namespace etl
 
         while (inode != bucket.end())
         {
+          ETL_CONTAINER_STATISTICS_PROBE_STEP;
+
           // Do we already have this key?
           if (key_equal_function(inode->key_value_pair.first, key))
           {
@@ -1026,6 +1036,7 @@ namespace etl
           node->clear();
           ::new ((void*)etl::addressof(node->key_value_pair)) value_type(key_value_pair);
           ETL_INCREMENT_DEBUG_COUNT;
+          ETL_CONTAINER_STATISTICS_SIZE(size());
 
           // Add the node to the end of the bucket;
           bucket.insert_after(inode_previous, *node);
@@ -1037,6 +1048,8 @@ namespace etl
         }
       }
 
+      ETL_CONTAINER_STATISTICS_PROBE_END;
+
       return result;
     }
 
@@ -1051,16 +1064,19 @@ namespace etl
     {
       ETL_OR_STD::pair<iterator, bool> result(end(), false);
 
-      ETL_ASSERT(!full(), ETL_ERROR(unordered_map_full));
-
       const key_type& key = key_value_pair.first;
 
+      // Only a new key needs a node.
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full() && !contains(key));
+      ETL_ASSERT(!full(), ETL_ERROR(unordered_map_full));
+
       // Get the hash index.
       size_t index = get_bucket_index(key);
 
       // Get the bucket & bucket iterator.
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket  = *pbucket;
+      ETL_CONTAINER_STATISTICS_PROBE_BEGIN;
 
       // The first one in the bucket?
       if (bucket.empty())
@@ -1070,6 +1086,7 @@ namespace etl
         node->clear();
         ::new ((void*)etl::addressof(node->key_value_pair)) value_type(etl::move(key_value_pair));
         ETL_INCREMENT_DEBUG_COUNT;
+        ETL_CONTAINER_STATISTICS_SIZE(size());
 
         // Just add the pointer to the bucket;
         bucket.insert_after(bucket.before_begin(), *node);
@@ -1087,6 +1104,8 @@ namespace etl
 
         while (inode != bucket.end())
         {
+          ETL_CONTAINER_STATISTICS_PROBE_STEP;
+
           // Do we already have this key?
           if (key_equal_function(inode->key_value_pair.first, key))
           {
@@ -1105,6 +1124,7 @@ namespace etl
           node->clear();
           ::new ((void*)etl::addressof(node->key_value_pair)) value_type(etl::move(key_value_pair));
           ETL_INCREMENT_DEBUG_COUNT;
+          ETL_CONTAINER_STATISTICS_SIZE(size());
 
           // Add the node to the end of the bucket;
           bucket.insert_after(inode_previous, *node);
@@ -1116,6 +1136,8 @@ namespace etl
         }
       }
 
+      ETL_CONTAINER_STATISTICS_PROBE_END;
+
       return result;
     }
 #endif
@@ -1356,6 +1378,7 @@ namespace etl
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket  = *pbucket;
+      ETL_CONTAINER_STATISTICS_PROBE_BEGIN;
 
       // Is the bucket not empty?
       if (!bucket.empty())
@@ -1366,9 +1389,12 @@ namespace etl
 
         while (inode != iend)
         {
+          ETL_CONTAINER_STATISTICS_PROBE_STEP;
+
           // Do we have this one?
           if (key_equal_function(key, inode->key_value_pair.first))
           {
+            ETL_CONTAINER_STATISTICS_PROBE_END;
             return iterator((pbuckets + number_of_buckets), pbucket, inode);
           }
 
@@ -1376,6 +1402,7 @@ namespace etl
         }
       }
 
+      ETL_CONTAINER_STATISTICS_PROBE_END;
       return end();
     }
 
@@ -1426,6 +1453,7 @@ namespace etl
 
       bucket_t* pbucket = pbuckets + index;
       bucket_t& bucket  = *pbucket;
+      ETL_CONTAINER_STATISTICS_PROBE_BEGIN;
 
       // Is the bucket not empty?
       if (!bucket.empty())
@@ -1436,9 +1464,12 @@ namespace etl
 
         while (inode != iend)
         {
+          ETL_CONTAINER_STATISTICS_PROBE_STEP;
+
           // Do we have this one?
           if (key_equal_function(key, inode->key_value_pair.first))
           {
+            ETL_CONTAINER_STATISTICS_PROBE_END;
             return iterator((pbuckets + number_of_buckets), pbucket, inode);
           }
 
@@ -1446,6 +1477,7 @@ namespace etl
         }
       }
 
+      ETL_CONTAINER_STATISTICS_PROBE_END;
       return end();
     }
 #endif
@@ -1605,6 +1637,30 @@ namespace etl
       return pnodepool->max_size();
     }
 
+#if defined(ETL_CONTAINER_STATISTICS)
+    //*************************************************************************
+    /// Returns the occupancy statistics.
+    /// The probe lengths are the number of nodes compared by insert and by
+    /// the non-const find. Const lookups leave the statistics untouched, so
+    /// concurrent readers do not write to them.
+    //*************************************************************************
+    etl::container_statistics& statistics()
+    {
+      return this->etl_container_statistics;
+    }
+
+    //*************************************************************************
+    /// Returns the occupancy statistics.
+    /// The probe lengths are the number of nodes compared by insert and by
+    /// the non-const find. Const lookups leave the statistics untouched, so
+    /// concurrent readers do not write to them.
+    //*************************************************************************
+    const etl::container_statistics& statistics() const
+    {
+      return this->etl_container_statistics;
+    }
+#endif
+
     //*************************************************************************
     /// Checks to see if the unordered_map is empty.
     //*************************************************************************
@@ -1726,6 +1782,15 @@ namespace etl
     {
     }
 
+    //*********************************************************************
+    /// Names the container in its statistics.
+    /// Called by the derived constructors, once the node pool exists.
+    //*********************************************************************
+    void initialise_statistics()
+    {
+      ETL_CONTAINER_STATISTICS_INITIALISE("unordered_map", pnodepool->max_size());
+    }
+
     //*********************************************************************
     /// Initialise the unordered_map.
     //*********************************************************************
@@ -1897,6 +1962,9 @@ namespace etl
     /// For library debugging purposes only.
     ETL_DECLARE_DEBUG_COUNT;
 
+    /// Occupancy and bucket chain length profile.
+    ETL_DECLARE_CONTAINER_STATISTICS;
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -1995,6 +2063,7 @@ namespace etl
     unordered_map(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
       : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
     {
+      base::initialise_statistics();
     }
 
     //*************************************************************************
@@ -2003,6 +2072,7 @@ namespace etl
     unordered_map(const unordered_map& other)
       : base(node_pool, buckets, MAX_BUCKETS_, other.hash_function(), other.key_eq())
     {
+      base::initialise_statistics();
       base::assign(other.cbegin(), other.cend());
     }
 
@@ -2013,6 +2083,7 @@ namespace etl
     unordered_map(unordered_map&& other)
       : base(node_pool, buckets, MAX_BUCKETS_, other.hash_function(), other.key_eq())
     {
+      base::initialise_statistics();
       if (this != &other)
       {
         base::move(other.begin(), other.end());
@@ -2030,6 +2101,7 @@ namespace etl
     unordered_map(TIterator first_, TIterator last_, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
       : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
     {
+      base::initialise_statistics();
       base::assign(first_, last_);
     }
 
@@ -2040,6 +2112,7 @@ namespace etl
     unordered_map(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
       : base(node_pool, buckets, MAX_BUCKETS_, hash, equal)
     {
+      base::initialise_statistics();
       base::assign(init.begin(), init.end());
     }
 #endif
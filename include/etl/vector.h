@@ -221,6 +221,7 @@ namespace etl
     //*********************************************************************
     void resize(size_t new_size, const_reference value)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(new_size > CAPACITY);
       ETL_ASSERT_OR_RETURN(new_size <= CAPACITY, ETL_ERROR(vector_full));
 
       const size_t current_size = size();
@@ -238,6 +239,7 @@ namespace etl
       }
 
       p_end = p_buffer + new_size;
+      ETL_CONTAINER_STATISTICS_SIZE(size());
     }
 
     //*********************************************************************
@@ -246,6 +248,7 @@ namespace etl
     //*********************************************************************
     void uninitialized_resize(size_t new_size)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(new_size > CAPACITY);
       ETL_ASSERT_OR_RETURN(new_size <= CAPACITY, ETL_ERROR(vector_full));
 
 #if defined(ETL_DEBUG_COUNT)
@@ -260,6 +263,7 @@ namespace etl
 #endif
 
       p_end = p_buffer + new_size;
+      ETL_CONTAINER_STATISTICS_SIZE(size());
     }
 
     //*********************************************************************
@@ -404,6 +408,7 @@ namespace etl
 
       p_end = etl::uninitialized_copy(first, last, p_buffer);
       ETL_ADD_DEBUG_COUNT(uint32_t(etl::distance(first, last)));
+      ETL_CONTAINER_STATISTICS_SIZE(size());
     }
 
     //*********************************************************************
@@ -415,12 +420,14 @@ namespace etl
     //*********************************************************************
     void assign(size_t n, parameter_t value)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(n > CAPACITY);
       ETL_ASSERT_OR_RETURN(n <= CAPACITY, ETL_ERROR(vector_full));
 
       initialise();
 
       p_end = etl::uninitialized_fill_n(p_buffer, n, value);
       ETL_ADD_DEBUG_COUNT(uint32_t(n));
+      ETL_CONTAINER_STATISTICS_SIZE(size());
     }
 
     //*************************************************************************
@@ -447,6 +454,7 @@ namespace etl
     //*********************************************************************
     void push_back(const_reference value)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT_CHECK_PUSH_POP_OR_RETURN(size() != CAPACITY, ETL_ERROR(vector_full));
 
       create_back(value);
@@ -461,6 +469,7 @@ namespace etl
     //*********************************************************************
     void push_back(rvalue_reference value)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT_CHECK_PUSH_POP_OR_RETURN(size() != CAPACITY, ETL_ERROR(vector_full));
 
       create_back(etl::move(value));
@@ -477,11 +486,13 @@ namespace etl
     template <typename... Args>
     reference emplace_back(Args&&... args)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT_CHECK_PUSH_POP(size() != CAPACITY, ETL_ERROR(vector_full));
 
       ::new (p_end) T(etl::forward<Args>(args)...);
       ++p_end;
       ETL_INCREMENT_DEBUG_COUNT;
+      ETL_CONTAINER_STATISTICS_SIZE(size());
       return back();
     }
 #else
@@ -493,11 +504,13 @@ namespace etl
     //*********************************************************************
     reference emplace_back()
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT_CHECK_PUSH_POP(size() != CAPACITY, ETL_ERROR(vector_full));
 
       ::new (p_end) T();
       ++p_end;
       ETL_INCREMENT_DEBUG_COUNT;
+      ETL_CONTAINER_STATISTICS_SIZE(size());
       return back();
     }
 
@@ -510,11 +523,13 @@ namespace etl
     template <typename T1>
     reference emplace_back(const T1& value1)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT_CHECK_PUSH_POP(size() != CAPACITY, ETL_ERROR(vector_full));
 
       ::new (p_end) T(value1);
       ++p_end;
       ETL_INCREMENT_DEBUG_COUNT;
+      ETL_CONTAINER_STATISTICS_SIZE(size());
       return back();
     }
 
@@ -527,11 +542,13 @@ namespace etl
     template <typename T1, typename T2>
     reference emplace_back(const T1& value1, const T2& value2)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT_CHECK_PUSH_POP(size() != CAPACITY, ETL_ERROR(vector_full));
 
       ::new (p_end) T(value1, value2);
       ++p_end;
       ETL_INCREMENT_DEBUG_COUNT;
+      ETL_CONTAINER_STATISTICS_SIZE(size());
       return back();
     }
 
@@ -544,11 +561,13 @@ namespace etl
     template <typename T1, typename T2, typename T3>
     reference emplace_back(const T1& value1, const T2& value2, const T3& value3)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT_CHECK_PUSH_POP(size() != CAPACITY, ETL_ERROR(vector_full));
 
       ::new (p_end) T(value1, value2, value3);
       ++p_end;
       ETL_INCREMENT_DEBUG_COUNT;
+      ETL_CONTAINER_STATISTICS_SIZE(size());
       return back();
     }
 
@@ -561,11 +580,13 @@ namespace etl
     template <typename T1, typename T2, typename T3, typename T4>
     reference emplace_back(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT_CHECK_PUSH_POP(size() != CAPACITY, ETL_ERROR(vector_full));
 
       ::new (p_end) T(value1, value2, value3, value4);
       ++p_end;
       ETL_INCREMENT_DEBUG_COUNT;
+      ETL_CONTAINER_STATISTICS_SIZE(size());
       return back();
     }
 #endif
@@ -592,6 +613,7 @@ namespace etl
     //*********************************************************************
     iterator insert(const_iterator position, const_reference value)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
       ETL_ASSERT_CHECK_EXTRA(cbegin() <= position && position <= cend(), ETL_ERROR(vector_out_of_bounds));
 
@@ -621,6 +643,7 @@ namespace etl
     //*********************************************************************
     iterator insert(const_iterator position, rvalue_reference value)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
       ETL_ASSERT_CHECK_EXTRA(cbegin() <= position && position <= cend(), ETL_ERROR(vector_out_of_bounds));
 
@@ -648,6 +671,7 @@ namespace etl
     template <typename... Args>
     iterator emplace(const_iterator position, Args&&... args)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT(!full(), ETL_ERROR(vector_full));
       ETL_ASSERT_CHECK_EXTRA(cbegin() <= position && position <= cend(), ETL_ERROR(vector_out_of_bounds));
 
@@ -659,6 +683,7 @@ namespace etl
       {
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
+        ETL_CONTAINER_STATISTICS_SIZE(size());
       }
       else
       {
@@ -676,6 +701,7 @@ namespace etl
     template <typename T1>
     iterator emplace(const_iterator position, const T1& value1)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT(!full(), ETL_ERROR(vector_full));
       ETL_ASSERT_CHECK_EXTRA(cbegin() <= position && position <= cend(), ETL_ERROR(vector_out_of_bounds));
 
@@ -687,6 +713,7 @@ namespace etl
       {
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
+        ETL_CONTAINER_STATISTICS_SIZE(size());
       }
       else
       {
@@ -704,6 +731,7 @@ namespace etl
     template <typename T1, typename T2>
     iterator emplace(const_iterator position, const T1& value1, const T2& value2)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT(!full(), ETL_ERROR(vector_full));
       ETL_ASSERT_CHECK_EXTRA(cbegin() <= position && position <= cend(), ETL_ERROR(vector_out_of_bounds));
 
@@ -715,6 +743,7 @@ namespace etl
       {
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
+        ETL_CONTAINER_STATISTICS_SIZE(size());
       }
       else
       {
@@ -732,6 +761,7 @@ namespace etl
     template <typename T1, typename T2, typename T3>
     iterator emplace(const_iterator position, const T1& value1, const T2& value2, const T3& value3)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT(!full(), ETL_ERROR(vector_full));
       ETL_ASSERT_CHECK_EXTRA(cbegin() <= position && position <= cend(), ETL_ERROR(vector_out_of_bounds));
 
@@ -743,6 +773,7 @@ namespace etl
       {
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
+        ETL_CONTAINER_STATISTICS_SIZE(size());
       }
       else
       {
@@ -760,6 +791,7 @@ namespace etl
     template <typename T1, typename T2, typename T3, typename T4>
     iterator emplace(const_iterator position, const T1& value1, const T2& value2, const T3& value3, const T4& value4)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF(full());
       ETL_ASSERT(!full(), ETL_ERROR(vector_full));
       ETL_ASSERT_CHECK_EXTRA(cbegin() <= position && position <= cend(), ETL_ERROR(vector_out_of_bounds));
 
@@ -771,6 +803,7 @@ namespace etl
       {
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
+        ETL_CONTAINER_STATISTICS_SIZE(size());
       }
       else
       {
@@ -796,6 +829,7 @@ namespace etl
     //*********************************************************************
     void insert(const_iterator position, size_t n, parameter_t value)
     {
+      ETL_CONTAINER_STATISTICS_REJECT_IF((size() + n) > CAPACITY);
       ETL_ASSERT_OR_RETURN((size() + n) <= CAPACITY, ETL_ERROR(vector_full));
       ETL_ASSERT_CHECK_EXTRA(cbegin() <= position && position <= cend(), ETL_ERROR(vector_out_of_bounds));
 
@@ -841,6 +875,7 @@ namespace etl
       etl::fill_n(p_buffer + insert_begin, copy_new_n, value);
 
       p_end += n;
+      ETL_CONTAINER_STATISTICS_SIZE(size());
     }
 
     //*********************************************************************
@@ -856,6 +891,7 @@ namespace etl
     {
       size_t count = static_cast<size_t>(etl::distance(first, last));
 
+      ETL_CONTAINER_STATISTICS_REJECT_IF((size() + count) > CAPACITY);
       ETL_ASSERT_OR_RETURN((size() + count) <= CAPACITY, ETL_ERROR(vector_full));
       ETL_ASSERT_CHECK_EXTRA(cbegin() <= position && position <= cend(), ETL_ERROR(vector_out_of_bounds));
 
@@ -900,6 +936,7 @@ namespace etl
       etl::copy(first, first + static_cast<diff_t>(copy_new_n), p_buffer + insert_begin);
 
       p_end += count;
+      ETL_CONTAINER_STATISTICS_SIZE(size());
     }
 
     //*********************************************************************
@@ -1130,6 +1167,7 @@ namespace etl
       ETL_INCREMENT_DEBUG_COUNT;
 
       ++p_end;
+      ETL_CONTAINER_STATISTICS_SIZE(size());
     }
 
     //*********************************************************************
@@ -1141,6 +1179,7 @@ namespace etl
       ETL_INCREMENT_DEBUG_COUNT;
 
       ++p_end;
+      ETL_CONTAINER_STATISTICS_SIZE(size());
     }
 
 #if ETL_USING_CPP11
@@ -1153,6 +1192,7 @@ namespace etl
       ETL_INCREMENT_DEBUG_COUNT;
 
       ++p_end;
+      ETL_CONTAINER_STATISTICS_SIZE(size());
     }
 #endif
 
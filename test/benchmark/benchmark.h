@@ -0,0 +1,755 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Common support for the ETL benchmarks.
+// Timing, latency percentiles, thread pinning, command line options and
+// text/JSON reports. Hosted builds only; the benchmarks use the STL freely.
+//*****************************************************************************
+
+#ifndef ETL_BENCHMARK_INCLUDED
+#define ETL_BENCHMARK_INCLUDED
+
+#include "etl/platform.h"
+#include "etl/mutex.h"
+#include "etl/version.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <stdint.h>
+
+#if defined(__linux__)
+  #include <pthread.h>
+  #include <sched.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+  #include <x86intrin.h>
+  #define ETL_BENCHMARK_HAS_CYCLE_COUNTER 1
+#elif defined(_M_X64) || defined(_M_IX86)
+  #include <intrin.h>
+  #define ETL_BENCHMARK_HAS_CYCLE_COUNTER 1
+#else
+  #define ETL_BENCHMARK_HAS_CYCLE_COUNTER 0
+#endif
+
+namespace etl_benchmark
+{
+  //***************************************************************************
+  /// The current time in nanoseconds from an arbitrary epoch.
+  //***************************************************************************
+  inline uint64_t now_ns()
+  {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+  }
+
+  //***************************************************************************
+  /// The processor time stamp counter, or 0 where there is none.
+  /// The counter runs at the nominal clock rate, not the current one.
+  //***************************************************************************
+  inline uint64_t cycle_counter()
+  {
+#if ETL_BENCHMARK_HAS_CYCLE_COUNTER
+    return static_cast<uint64_t>(__rdtsc());
+#else
+    return 0U;
+#endif
+  }
+
+  //***************************************************************************
+  /// Keeps the compiler from discarding a computed value.
+  //***************************************************************************
+  template <typename T>
+  inline void do_not_optimise(const T& value)
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    __asm__ __volatile__("" : : "g"(&value) : "memory");
+#else
+    static volatile const T* volatile sink;
+    sink = &value;
+#endif
+  }
+
+  //***************************************************************************
+  /// The number of hardware threads, never less than one.
+  //***************************************************************************
+  inline size_t hardware_threads()
+  {
+    const unsigned n = std::thread::hardware_concurrency();
+
+    return (n == 0U) ? 1U : n;
+  }
+
+  //***************************************************************************
+  /// Pins the calling thread to 'cpu' modulo the number of hardware threads.
+  /// Returns false if pinning is not supported or failed.
+  //***************************************************************************
+  inline bool pin_thread(size_t cpu)
+  {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(static_cast<int>(cpu % hardware_threads()), &set);
+
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+  }
+
+  //***************************************************************************
+  /// Releases a group of threads at the same moment.
+  //***************************************************************************
+  class start_line
+  {
+  public:
+
+    explicit start_line(size_t threads_)
+      : waiting(threads_)
+    {
+    }
+
+    void arrive_and_wait()
+    {
+      waiting.fetch_sub(1U);
+
+      while (waiting.load() != 0U)
+      {
+        std::this_thread::yield();
+      }
+    }
+
+  private:
+
+    std::atomic<size_t> waiting;
+  };
+
+  //***************************************************************************
+  /// The wall time of a run, from the first thread to start to the last
+  /// thread to finish. Each thread calls start() and stop() itself, so the
+  /// time the launching thread takes to be scheduled is not counted.
+  //***************************************************************************
+  class run_timer
+  {
+  public:
+
+    run_timer()
+      : first_start(UINT64_MAX)
+      , last_stop(0U)
+    {
+    }
+
+    void start()
+    {
+      const uint64_t now      = now_ns();
+      uint64_t       previous = first_start.load();
+
+      while ((now < previous) && !first_start.compare_exchange_weak(previous, now))
+      {
+      }
+    }
+
+    void stop()
+    {
+      const uint64_t now      = now_ns();
+      uint64_t       previous = last_stop.load();
+
+      while ((now > previous) && !last_stop.compare_exchange_weak(previous, now))
+      {
+      }
+    }
+
+    double seconds() const
+    {
+      const uint64_t begin = first_start.load();
+      const uint64_t end   = last_stop.load();
+
+      return (end > begin) ? static_cast<double>(end - begin) * 1.0e-9 : 0.0;
+    }
+
+  private:
+
+    std::atomic<uint64_t> first_start;
+    std::atomic<uint64_t> last_stop;
+  };
+
+  //***************************************************************************
+  /// A set of latency samples in nanoseconds.
+  //***************************************************************************
+  class latency_samples
+  {
+  public:
+
+    void reserve(size_t n)
+    {
+      samples.reserve(n);
+    }
+
+    void add(uint64_t ns)
+    {
+      samples.push_back(ns);
+    }
+
+    void append(const latency_samples& other)
+    {
+      samples.insert(samples.end(), other.samples.begin(), other.samples.end());
+    }
+
+    size_t size() const
+    {
+      return samples.size();
+    }
+
+    //*************************************************************************
+    /// The sample at fraction 'p' (0 to 1) of the sorted set, or 0 if empty.
+    /// Sorts the samples on first use.
+    //*************************************************************************
+    uint64_t percentile(double p)
+    {
+      if (samples.empty())
+      {
+        return 0U;
+      }
+
+      if (!std::is_sorted(samples.begin(), samples.end()))
+      {
+        std::sort(samples.begin(), samples.end());
+      }
+
+      size_t index = static_cast<size_t>(p * static_cast<double>(samples.size() - 1U) + 0.5);
+
+      return samples[std::min(index, samples.size() - 1U)];
+    }
+
+  private:
+
+    std::vector<uint64_t> samples;
+  };
+
+  //***************************************************************************
+  /// One row of a report.
+  //***************************************************************************
+  struct result
+  {
+    result()
+      : producers(0U)
+      , consumers(0U)
+      , operations(0U)
+      , bytes(0U)
+      , size(0U)
+      , cycles(0U)
+      , seconds(0.0)
+      , p50(0U)
+      , p90(0U)
+      , p99(0U)
+      , p999(0U)
+      , max(0U)
+      , has_latency(false)
+    {
+    }
+
+    //*************************************************************************
+    /// Fills in the latency percentiles.
+    //*************************************************************************
+    void set_latency(latency_samples& samples)
+    {
+      has_latency = (samples.size() != 0U);
+      p50         = samples.percentile(0.50);
+      p90         = samples.percentile(0.90);
+      p99         = samples.percentile(0.99);
+      p999        = samples.percentile(0.999);
+      max         = samples.percentile(1.0);
+    }
+
+    double operations_per_second() const
+    {
+      return (seconds > 0.0) ? static_cast<double>(operations) / seconds : 0.0;
+    }
+
+    double bytes_per_second() const
+    {
+      return (seconds > 0.0) ? static_cast<double>(bytes) / seconds : 0.0;
+    }
+
+    //*************************************************************************
+    /// Cycles per byte, or a negative value if unknown.
+    //*************************************************************************
+    double cycles_per_byte() const
+    {
+      return ((cycles != 0U) && (bytes != 0U)) ? static_cast<double>(cycles) / static_cast<double>(bytes) : -1.0;
+    }
+
+    std::string name;
+    std::string variant;
+    size_t      producers;
+    size_t      consumers;
+    uint64_t    operations;
+    uint64_t    bytes;
+    size_t      size;
+    uint64_t    cycles;
+    double      seconds;
+    uint64_t    p50;
+    uint64_t    p90;
+    uint64_t    p99;
+    uint64_t    p999;
+    uint64_t    max;
+    bool        has_latency;
+  };
+
+  //***************************************************************************
+  /// Command line options shared by the benchmarks.
+  ///   --json <file>      Write the results as JSON.
+  ///   --operations <n>   Operations per run.
+  ///   --bytes <n>        Bytes to process per run, for byte oriented benchmarks.
+  ///   --max-size <n>     Largest block size in a size sweep.
+  ///   --ghz <f>          Clock rate used for cycles per byte where there is
+  ///                      no cycle counter.
+  ///   --threads <a,b,..> Thread counts to sweep.
+  ///   --filter <text>    Only run benchmarks whose name contains 'text'.
+  ///   --no-pin           Do not pin threads to cores.
+  ///   --quick            One tenth of the operations and bytes.
+  //***************************************************************************
+  struct options
+  {
+    options()
+      : operations(1000000U)
+      , bytes(16U * 1024U * 1024U)
+      , max_size(16U * 1024U * 1024U)
+      , ghz(0.0)
+      , pin(true)
+    {
+      threads.push_back(1U);
+      threads.push_back(2U);
+      threads.push_back(4U);
+    }
+
+    bool parse(int argc, char* argv[])
+    {
+      for (int i = 1; i < argc; ++i)
+      {
+        const std::string arg = argv[i];
+        const bool has_value  = (i + 1) < argc;
+
+        if ((arg == "--json") && has_value)
+        {
+          json_file = argv[++i];
+        }
+        else if ((arg == "--operations") && has_value)
+        {
+          operations = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if ((arg == "--bytes") && has_value)
+        {
+          bytes = std::strtoull(argv[++i], nullptr, 10);
+        }
+        else if ((arg == "--max-size") && has_value)
+        {
+          max_size = static_cast<size_t>(std::strtoull(argv[++i], nullptr, 10));
+        }
+        else if ((arg == "--ghz") && has_value)
+        {
+          ghz = std::strtod(argv[++i], nullptr);
+        }
+        else if ((arg == "--threads") && has_value)
+        {
+          threads.clear();
+
+          for (const char* p = argv[++i]; *p != '\0';)
+          {
+            char* end;
+            const size_t n = static_cast<size_t>(std::strtoul(p, &end, 10));
+
+            if (end == p)
+            {
+              return false;
+            }
+
+            if (n != 0U)
+            {
+              threads.push_back(n);
+            }
+
+            p = (*end == ',') ? end + 1 : end;
+          }
+        }
+        else if ((arg == "--filter") && has_value)
+        {
+          filter = argv[++i];
+        }
+        else if (arg == "--no-pin")
+        {
+          pin = false;
+        }
+        else if (arg == "--quick")
+        {
+          operations /= 10U;
+          bytes /= 10U;
+        }
+        else
+        {
+          std::cerr << "Usage: " << argv[0] << " [--json <file>] [--operations <n>] [--bytes <n>] [--max-size <n>] [--ghz <f>]"
+                    << " [--threads <a,b,...>] [--filter <text>] [--no-pin] [--quick]\n";
+          return false;
+        }
+      }
+
+      return !threads.empty() && (operations != 0U) && (bytes != 0U);
+    }
+
+    bool selected(const std::string& name) const
+    {
+      return filter.empty() || (name.find(filter) != std::string::npos);
+    }
+
+    //*************************************************************************
+    /// Converts a duration to cycles using --ghz, or 0 if not given.
+    //*************************************************************************
+    uint64_t cycles_from_seconds(double seconds) const
+    {
+      return static_cast<uint64_t>(seconds * ghz * 1.0e9);
+    }
+
+    uint64_t            operations;
+    uint64_t            bytes;
+    size_t              max_size;
+    double              ghz;
+    std::vector<size_t> threads;
+    std::string         filter;
+    std::string         json_file;
+    bool                pin;
+  };
+
+  //***************************************************************************
+  /// Collects results and writes them as a text table and as JSON.
+  //***************************************************************************
+  class report
+  {
+  public:
+
+    //*************************************************************************
+    /// The columns of the text table.
+    /// Threaded: thread counts and latency percentiles.
+    /// Sized:    block size, throughput and cycles per byte.
+    //*************************************************************************
+    enum layout
+    {
+      Threaded,
+      Sized
+    };
+
+    report(const std::string& suite_, const options& options_, layout layout_ = Threaded)
+      : suite(suite_)
+      , opts(options_)
+      , columns(layout_)
+    {
+    }
+
+    //*************************************************************************
+    /// Records a property of the whole run, such as the mutex backend.
+    //*************************************************************************
+    void set_property(const std::string& key, const std::string& value)
+    {
+      properties.push_back(std::make_pair(key, value));
+    }
+
+    void add(const result& r)
+    {
+      results.push_back(r);
+      print_row(std::cout, r);
+    }
+
+    void print_header(std::ostream& os) const
+    {
+      char line[256];
+
+      if (columns == Sized)
+      {
+        std::snprintf(line, sizeof(line), "%-40s %-16s %10s %12s %10s\n", "benchmark", "variant", "size", "MB/s", "cycles/B");
+      }
+      else
+      {
+        std::snprintf(line, sizeof(line), "%-40s %-14s %4s %4s %14s %12s %9s %9s %9s %9s %9s\n", "benchmark", "variant", "prod", "cons", "ops/s", "MB/s",
+                      "p50 ns", "p90 ns", "p99 ns", "p99.9 ns", "max ns");
+      }
+
+      os << line;
+    }
+
+    //*************************************************************************
+    /// Writes the JSON report to the file named by --json, if any.
+    //*************************************************************************
+    bool write_json() const
+    {
+      if (opts.json_file.empty())
+      {
+        return true;
+      }
+
+      std::ofstream os(opts.json_file.c_str());
+
+      if (!os)
+      {
+        std::cerr << "Cannot open " << opts.json_file << "\n";
+        return false;
+      }
+
+      write_json(os);
+
+      return static_cast<bool>(os);
+    }
+
+    void write_json(std::ostream& os) const
+    {
+      os << std::setprecision(12);
+      os << "{\n";
+      os << "  \"suite\": \"" << suite << "\",\n";
+      os << "  \"etl_version\": \"" << ETL_VERSION << "\",\n";
+      os << "  \"compiler\": \"" << compiler() << "\",\n";
+      os << "  \"cplusplus\": " << static_cast<long>(__cplusplus) << ",\n";
+      os << "  \"hardware_threads\": " << hardware_threads() << ",\n";
+      os << "  \"pinned\": " << (opts.pin ? "true" : "false") << ",\n";
+      os << "  \"operations\": " << opts.operations << ",\n";
+
+      for (size_t i = 0U; i < properties.size(); ++i)
+      {
+        os << "  \"" << properties[i].first << "\": \"" << properties[i].second << "\",\n";
+      }
+
+      os << "  \"results\": [";
+
+      for (size_t i = 0U; i < results.size(); ++i)
+      {
+        const result& r = results[i];
+
+        os << ((i == 0U) ? "\n" : ",\n");
+        os << "    {\"name\": \"" << r.name << "\", \"variant\": \"" << r.variant << "\"";
+        os << ", \"producers\": " << r.producers << ", \"consumers\": " << r.consumers;
+        os << ", \"operations\": " << r.operations << ", \"bytes\": " << r.bytes;
+        os << ", \"seconds\": " << r.seconds;
+
+        if (r.size != 0U)
+        {
+          os << ", \"size\": " << r.size;
+        }
+
+        if (r.cycles_per_byte() >= 0.0)
+        {
+          os << ", \"cycles_per_byte\": " << r.cycles_per_byte();
+        }
+
+        os << ", \"operations_per_second\": " << r.operations_per_second();
+        os << ", \"bytes_per_second\": " << r.bytes_per_second();
+
+        if (r.has_latency)
+        {
+          os << ", \"latency_ns\": {\"p50\": " << r.p50 << ", \"p90\": " << r.p90 << ", \"p99\": " << r.p99 << ", \"p999\": " << r.p999
+             << ", \"max\": " << r.max << "}";
+        }
+
+        os << "}";
+      }
+
+      os << "\n  ]\n}\n";
+    }
+
+  private:
+
+    void print_row(std::ostream& os, const result& r) const
+    {
+      char throughput[32] = "-";
+
+      if (r.bytes != 0U)
+      {
+        std::snprintf(throughput, sizeof(throughput), "%.1f", r.bytes_per_second() / 1.0e6);
+      }
+
+      char line[256];
+
+      if (columns == Sized)
+      {
+        char cycles[32] = "-";
+
+        if (r.cycles_per_byte() >= 0.0)
+        {
+          std::snprintf(cycles, sizeof(cycles), "%.2f", r.cycles_per_byte());
+        }
+
+        std::snprintf(line, sizeof(line), "%-40s %-16s %10zu %12s %10s\n", r.name.c_str(), r.variant.c_str(), r.size, throughput, cycles);
+      }
+      else if (r.has_latency)
+      {
+        std::snprintf(line, sizeof(line), "%-40s %-14s %4zu %4zu %14.0f %12s %9llu %9llu %9llu %9llu %9llu\n", r.name.c_str(), r.variant.c_str(), r.producers,
+                      r.consumers, r.operations_per_second(), throughput, static_cast<unsigned long long>(r.p50), static_cast<unsigned long long>(r.p90),
+                      static_cast<unsigned long long>(r.p99), static_cast<unsigned long long>(r.p999), static_cast<unsigned long long>(r.max));
+      }
+      else
+      {
+        std::snprintf(line, sizeof(line), "%-40s %-14s %4zu %4zu %14.0f %12s\n", r.name.c_str(), r.variant.c_str(), r.producers, r.consumers,
+                      r.operations_per_second(), throughput);
+      }
+
+      os << line << std::flush;
+    }
+
+    static std::string compiler()
+    {
+#if defined(__clang__)
+      return std::string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+      return std::string("gcc ") + __VERSION__;
+#elif defined(_MSC_VER)
+      return std::string("msvc ") + std::to_string(_MSC_VER);
+#else
+      return "unknown";
+#endif
+    }
+
+    std::string                                      suite;
+    const options&                                   opts;
+    layout                                           columns;
+    std::vector<std::pair<std::string, std::string>> properties;
+    std::vector<result>                              results;
+  };
+
+  //***************************************************************************
+  /// The etl::mutex backend selected by etl/mutex.h for this build.
+  //***************************************************************************
+  inline const char* mutex_backend()
+  {
+#if defined(ETL_MUTEX_STD_INCLUDED)
+    return "std";
+#elif defined(ETL_MUTEX_GCC_SYNC_INCLUDED)
+    return "gcc_sync";
+#elif defined(ETL_MUTEX_CLANG_INCLUDED)
+    return "clang_sync";
+#elif defined(ETL_MUTEX_ARM_INCLUDED)
+    return "arm";
+#else
+    return "other";
+#endif
+  }
+
+  /// The most latency samples that a run keeps.
+  const uint64_t Max_Latency_Samples = 200000U;
+
+  //***************************************************************************
+  /// Take one latency sample every 'stride' operations.
+  //***************************************************************************
+  inline uint64_t sample_stride(uint64_t operations)
+  {
+    const uint64_t stride = operations / Max_Latency_Samples;
+
+    return (stride == 0U) ? 1U : stride;
+  }
+
+  //***************************************************************************
+  /// Runs 'threads' threads each calling 'operation' for its share of the
+  /// operations. Samples the time taken by one call every 'stride' calls.
+  //***************************************************************************
+  template <typename TOperation>
+  result run_threads(const char* name, const char* variant, size_t thread_count, const options& opts, TOperation operation)
+  {
+    const uint64_t per_thread = opts.operations / thread_count;
+    const uint64_t total      = per_thread * thread_count;
+    const uint64_t stride     = sample_stride(total);
+
+    std::vector<latency_samples> samples(thread_count);
+    std::vector<std::thread>     threads;
+    start_line                   start(thread_count);
+    run_timer                    timer;
+
+    for (size_t t = 0U; t < thread_count; ++t)
+    {
+      threads.push_back(std::thread(
+        [&, t]()
+        {
+          if (opts.pin)
+          {
+            etl_benchmark::pin_thread(t);
+          }
+
+          samples[t].reserve(static_cast<size_t>(per_thread / stride + 1U));
+          start.arrive_and_wait();
+          timer.start();
+
+          for (uint64_t i = 0U; i < per_thread; ++i)
+          {
+            if ((i % stride) == 0U)
+            {
+              const uint64_t begin = now_ns();
+              operation(t, i);
+              samples[t].add(now_ns() - begin);
+            }
+            else
+            {
+              operation(t, i);
+            }
+          }
+
+          timer.stop();
+        }));
+    }
+
+    for (size_t i = 0U; i < threads.size(); ++i)
+    {
+      threads[i].join();
+    }
+
+    latency_samples all;
+
+    for (size_t t = 0U; t < thread_count; ++t)
+    {
+      all.append(samples[t]);
+    }
+
+    result r;
+    r.name       = name;
+    r.variant    = variant;
+    r.producers  = thread_count;
+    r.consumers  = 0U;
+    r.operations = total;
+    r.seconds    = timer.seconds();
+    r.set_latency(all);
+
+    return r;
+  }
+} // namespace etl_benchmark
+
+#endif
@@ -0,0 +1,534 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Throughput of the ETL CRCs, checksums, hashes and codecs.
+//
+// Each benchmark processes blocks from 16 bytes to 16 MB, repeating each
+// block size until about --bytes bytes have been processed. Cycles per byte
+// come from the time stamp counter where there is one, or from --ghz.
+// If zlib is found, its crc32 is reported as a reference.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/base64_decoder.h"
+#include "etl/base64_encoder.h"
+#include "etl/bit_stream.h"
+#include "etl/byte_stream.h"
+#include "etl/checksum.h"
+#include "etl/crc.h"
+#include "etl/fnv_1.h"
+#include "etl/jenkins.h"
+#include "etl/manchester.h"
+#include "etl/murmur3.h"
+#include "etl/pearson.h"
+#include "etl/span.h"
+
+#if defined(ETL_BENCHMARK_HAS_ZLIB)
+  #include <zlib.h>
+#endif
+
+//*****************************************************************************
+// Every CRC parameter set in etl/private/crc_parameters.h.
+//*****************************************************************************
+#define ETL_BENCHMARK_CRC_PARAMETERS(X) \
+  X(crc8_ccitt)                         \
+  X(crc8_rohc)                          \
+  X(crc8_cdma2000)                      \
+  X(crc8_darc)                          \
+  X(crc8_dvbs2)                         \
+  X(crc8_ebu)                           \
+  X(crc8_icode)                         \
+  X(crc8_itu)                           \
+  X(crc8_maxim)                         \
+  X(crc8_wcdma)                         \
+  X(crc8_j1850)                         \
+  X(crc8_j1850_zero)                    \
+  X(crc8_nrsc5)                         \
+  X(crc8_opensafety)                    \
+  X(crc16)                              \
+  X(crc16_ccitt)                        \
+  X(crc16_aug_ccitt)                    \
+  X(crc16_buypass)                      \
+  X(crc16_genibus)                      \
+  X(crc16_profibus)                     \
+  X(crc16_kermit)                       \
+  X(crc16_modbus)                       \
+  X(crc16_usb)                          \
+  X(crc16_x25)                          \
+  X(crc16_xmodem)                       \
+  X(crc16_cdma2000)                     \
+  X(crc16_dds110)                       \
+  X(crc16_dect_r)                       \
+  X(crc16_dect_x)                       \
+  X(crc16_dnp)                          \
+  X(crc16_en13757)                      \
+  X(crc16_maxim)                        \
+  X(crc16_mcrf4xx)                      \
+  X(crc16_riello)                       \
+  X(crc16_t10dif)                       \
+  X(crc16_teledisk)                     \
+  X(crc16_tms37157)                     \
+  X(crc16_a)                            \
+  X(crc16_arc)                          \
+  X(crc16_m17)                          \
+  X(crc16_opensafety_a)                 \
+  X(crc16_opensafety_b)                 \
+  X(crc32)                              \
+  X(crc32_c)                            \
+  X(crc32_bzip2)                        \
+  X(crc32_mpeg2)                        \
+  X(crc32_posix)                        \
+  X(crc32_d)                            \
+  X(crc32_q)                            \
+  X(crc32_jamcrc)                       \
+  X(crc32_xfer)                         \
+  X(crc64_ecma)                         \
+  X(crc64_iso)
+
+namespace
+{
+  using etl_benchmark::now_ns;
+  using etl_benchmark::options;
+  using etl_benchmark::report;
+  using etl_benchmark::result;
+
+  const size_t Min_Size   = 16U;
+  const size_t Size_Step  = 4U;
+  const size_t Max_Size   = 16U * 1024U * 1024U;
+  const size_t Chunk_Size = 1024U;
+
+  std::vector<uint8_t> input;
+  std::vector<uint8_t> output;
+  uint64_t             sink = 0U;
+
+  //***************************************************************************
+  /// Fills the input with a repeatable pseudo random sequence.
+  //***************************************************************************
+  void make_input(size_t size)
+  {
+    input.resize(size);
+    output.resize(2U * size);
+
+    uint32_t x = 0x12345678UL;
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      input[i] = static_cast<uint8_t>(x);
+    }
+  }
+
+  //***************************************************************************
+  /// Runs 'process(data, size)' over each block size and reports the
+  /// throughput. 'process' returns a value that depends on the whole block.
+  //***************************************************************************
+  template <typename TProcess>
+  void run_sizes(report& rep, const options& opts, const std::string& name, const std::string& variant, TProcess process)
+  {
+    const size_t largest = std::min(opts.max_size, input.size());
+
+    for (size_t size = Min_Size; size <= largest; size *= Size_Step)
+    {
+      const uint64_t repeats = std::max<uint64_t>(1U, opts.bytes / size);
+
+      // Warm the caches and any tables.
+      sink += process(input.data(), size);
+
+      const uint64_t begin_cycles = etl_benchmark::cycle_counter();
+      const uint64_t begin        = now_ns();
+
+      for (uint64_t i = 0U; i < repeats; ++i)
+      {
+        sink += process(input.data(), size);
+      }
+
+      const uint64_t end        = now_ns();
+      const uint64_t end_cycles = etl_benchmark::cycle_counter();
+
+      result r;
+      r.name       = name;
+      r.variant    = variant;
+      r.size       = size;
+      r.operations = repeats;
+      r.bytes      = repeats * size;
+      r.seconds    = static_cast<double>(end - begin) * 1.0e-9;
+      r.cycles     = (end_cycles != begin_cycles) ? (end_cycles - begin_cycles) : opts.cycles_from_seconds(r.seconds);
+
+      rep.add(r);
+    }
+  }
+
+  //***************************************************************************
+  // CRC
+  //***************************************************************************
+  template <typename TParameters, size_t Table_Size>
+  uint64_t crc_block(const uint8_t* data, size_t size)
+  {
+    etl::crc_type<TParameters, Table_Size> crc;
+    crc.add(data, data + size);
+
+    return static_cast<uint64_t>(crc.value());
+  }
+
+  template <typename TParameters>
+  void crc(report& rep, const options& opts, const char* name)
+  {
+    if (opts.selected(name))
+    {
+      run_sizes(rep, opts, name, "table 4", crc_block<TParameters, 4U>);
+      run_sizes(rep, opts, name, "table 16", crc_block<TParameters, 16U>);
+      run_sizes(rep, opts, name, "table 256", crc_block<TParameters, 256U>);
+    }
+  }
+
+  void crcs(report& rep, const options& opts)
+  {
+#define ETL_BENCHMARK_CRC(name) crc<etl::private_crc::name##_parameters>(rep, opts, #name);
+    ETL_BENCHMARK_CRC_PARAMETERS(ETL_BENCHMARK_CRC)
+#undef ETL_BENCHMARK_CRC
+
+#if defined(ETL_BENCHMARK_HAS_ZLIB)
+    if (opts.selected("zlib.crc32"))
+    {
+      run_sizes(rep, opts, "zlib.crc32", "reference",
+                [](const uint8_t* data, size_t size) { return static_cast<uint64_t>(::crc32(0UL, data, static_cast<uInt>(size))); });
+    }
+#endif
+  }
+
+  //***************************************************************************
+  // Checksums and hashes
+  //***************************************************************************
+  template <typename THash>
+  uint64_t hash_block(const uint8_t* data, size_t size)
+  {
+    THash hash;
+    hash.add(data, data + size);
+
+    return static_cast<uint64_t>(hash.value());
+  }
+
+  template <typename THash>
+  void hash(report& rep, const options& opts, const char* name, const char* variant = "")
+  {
+    if (opts.selected(name))
+    {
+      run_sizes(rep, opts, name, variant, hash_block<THash>);
+    }
+  }
+
+  uint64_t pearson_block(const uint8_t* data, size_t size)
+  {
+    etl::pearson<8U> hash;
+    hash.add(data, data + size);
+
+    return hash.value()[0];
+  }
+
+  void hashes(report& rep, const options& opts)
+  {
+    hash<etl::checksum<uint32_t> >(rep, opts, "checksum", "uint32_t");
+    hash<etl::bsd_checksum<uint16_t> >(rep, opts, "bsd_checksum", "uint16_t");
+    hash<etl::xor_checksum<uint8_t> >(rep, opts, "xor_checksum", "uint8_t");
+    hash<etl::fnv_1_32>(rep, opts, "fnv_1_32");
+    hash<etl::fnv_1a_32>(rep, opts, "fnv_1a_32");
+    hash<etl::fnv_1_64>(rep, opts, "fnv_1_64");
+    hash<etl::fnv_1a_64>(rep, opts, "fnv_1a_64");
+    hash<etl::murmur3<uint32_t> >(rep, opts, "murmur3", "uint32_t");
+    hash<etl::jenkins>(rep, opts, "jenkins");
+
+    if (opts.selected("pearson"))
+    {
+      run_sizes(rep, opts, "pearson", "8 bytes", pearson_block);
+    }
+  }
+
+  //***************************************************************************
+  // Base64
+  //***************************************************************************
+  std::string encoded_text;
+
+  void count_output(const etl::span<const char>& data)
+  {
+    sink += data.size();
+  }
+
+  void append_output(const etl::span<const char>& data)
+  {
+    encoded_text.append(data.begin(), data.end());
+  }
+
+  void count_decoded(const etl::span<const unsigned char>& data)
+  {
+    sink += data.size();
+  }
+
+  //***************************************************************************
+  /// Encodes the input, then decodes its encoding.
+  /// The decoder block size is the size of the encoded input.
+  //***************************************************************************
+  template <template <size_t> class TEncoder, template <size_t> class TDecoder>
+  void base64(report& rep, const options& opts, const char* name)
+  {
+    typedef TEncoder<etl::base64::Min_Encode_Buffer_Size * Chunk_Size> encoder_t;
+    typedef TDecoder<etl::base64::Min_Decode_Buffer_Size * Chunk_Size> decoder_t;
+    typedef typename encoder_t::callback_type                          encoder_callback_t;
+    typedef typename decoder_t::callback_type                          decoder_callback_t;
+
+    const std::string encode_name = std::string(name) + ".encode";
+    const std::string decode_name = std::string(name) + ".decode";
+
+    if (opts.selected(encode_name))
+    {
+      encoder_t encoder(encoder_callback_t::template create<count_output>());
+
+      run_sizes(rep, opts, encode_name, "",
+                [&](const uint8_t* data, size_t size)
+                {
+                  encoder.restart();
+                  encoder.encode_final(data, size);
+
+                  return sink;
+                });
+    }
+
+    if (opts.selected(decode_name))
+    {
+      // The encoded form of the input.
+      encoded_text.clear();
+      encoded_text.reserve(encoder_t::safe_output_buffer_size(input.size()));
+
+      encoder_t encoder(encoder_callback_t::template create<append_output>());
+      encoder.encode_final(input.data(), input.size());
+
+      decoder_t decoder(decoder_callback_t::template create<count_decoded>());
+
+      run_sizes(rep, opts, decode_name, "",
+                [&](const uint8_t*, size_t size)
+                {
+                  decoder.restart();
+                  decoder.decode_final(encoded_text.data(), size);
+
+                  return sink;
+                });
+
+      std::string().swap(encoded_text);
+    }
+  }
+
+  void base64s(report& rep, const options& opts)
+  {
+    base64<etl::base64_rfc2152_encoder, etl::base64_rfc2152_decoder>(rep, opts, "base64_rfc2152");
+    base64<etl::base64_rfc3501_encoder, etl::base64_rfc3501_decoder>(rep, opts, "base64_rfc3501");
+    base64<etl::base64_rfc4648_encoder, etl::base64_rfc4648_decoder>(rep, opts, "base64_rfc4648");
+    base64<etl::base64_rfc4648_padding_encoder, etl::base64_rfc4648_padding_decoder>(rep, opts, "base64_rfc4648_padding");
+    base64<etl::base64_rfc4648_url_encoder, etl::base64_rfc4648_url_decoder>(rep, opts, "base64_rfc4648_url");
+    base64<etl::base64_rfc4648_url_padding_encoder, etl::base64_rfc4648_url_padding_decoder>(rep, opts, "base64_rfc4648_url_padding");
+  }
+
+  //***************************************************************************
+  // bit_stream
+  // Writes the block as 'Bits' bit fields, then reads them back.
+  //***************************************************************************
+  template <typename T, uint_least8_t Bits>
+  uint64_t bit_stream_write(const uint8_t* data, size_t size)
+  {
+    etl::bit_stream_writer writer(output.data(), size, etl::endian::big);
+
+    const size_t fields = (size * CHAR_BIT) / Bits;
+
+    for (size_t i = 0U; i < fields; ++i)
+    {
+      writer.write_unchecked(static_cast<T>(data[i % size]), Bits);
+    }
+
+    return writer.size_bytes();
+  }
+
+  template <typename T, uint_least8_t Bits>
+  uint64_t bit_stream_read(const uint8_t* data, size_t size)
+  {
+    etl::bit_stream_reader reader(data, size, etl::endian::big);
+
+    const size_t fields = (size * CHAR_BIT) / Bits;
+    uint64_t     total  = 0U;
+
+    for (size_t i = 0U; i < fields; ++i)
+    {
+      total += reader.read_unchecked<T>(Bits);
+    }
+
+    return total;
+  }
+
+  void bit_stream(report& rep, const options& opts)
+  {
+    if (opts.selected("bit_stream_writer"))
+    {
+      run_sizes(rep, opts, "bit_stream_writer", "5 bit fields", bit_stream_write<uint8_t, 5U>);
+      run_sizes(rep, opts, "bit_stream_writer", "8 bit fields", bit_stream_write<uint8_t, 8U>);
+      run_sizes(rep, opts, "bit_stream_writer", "13 bit fields", bit_stream_write<uint16_t, 13U>);
+      run_sizes(rep, opts, "bit_stream_writer", "32 bit fields", bit_stream_write<uint32_t, 32U>);
+    }
+
+    if (opts.selected("bit_stream_reader"))
+    {
+      run_sizes(rep, opts, "bit_stream_reader", "5 bit fields", bit_stream_read<uint8_t, 5U>);
+      run_sizes(rep, opts, "bit_stream_reader", "8 bit fields", bit_stream_read<uint8_t, 8U>);
+      run_sizes(rep, opts, "bit_stream_reader", "13 bit fields", bit_stream_read<uint16_t, 13U>);
+      run_sizes(rep, opts, "bit_stream_reader", "32 bit fields", bit_stream_read<uint32_t, 32U>);
+    }
+  }
+
+  //***************************************************************************
+  // byte_stream
+  // Writes the block as 32 bit values, then reads them back.
+  //***************************************************************************
+  template <etl::endian::enum_type Endian>
+  uint64_t byte_stream_write(const uint8_t* data, size_t size)
+  {
+    etl::byte_stream_writer writer(output.data(), size, Endian);
+
+    const size_t values = size / sizeof(uint32_t);
+
+    for (size_t i = 0U; i < values; ++i)
+    {
+      writer.write_unchecked(static_cast<uint32_t>(data[i]) * 0x01010101UL);
+    }
+
+    return writer.size_bytes();
+  }
+
+  template <etl::endian::enum_type Endian>
+  uint64_t byte_stream_read(const uint8_t* data, size_t size)
+  {
+    etl::byte_stream_reader reader(data, size, Endian);
+
+    const size_t values = size / sizeof(uint32_t);
+    uint64_t     total  = 0U;
+
+    for (size_t i = 0U; i < values; ++i)
+    {
+      total += reader.read_unchecked<uint32_t>();
+    }
+
+    return total;
+  }
+
+  void byte_stream(report& rep, const options& opts)
+  {
+    if (opts.selected("byte_stream_writer"))
+    {
+      run_sizes(rep, opts, "byte_stream_writer", "little endian", byte_stream_write<etl::endian::little>);
+      run_sizes(rep, opts, "byte_stream_writer", "big endian", byte_stream_write<etl::endian::big>);
+    }
+
+    if (opts.selected("byte_stream_reader"))
+    {
+      run_sizes(rep, opts, "byte_stream_reader", "little endian", byte_stream_read<etl::endian::little>);
+      run_sizes(rep, opts, "byte_stream_reader", "big endian", byte_stream_read<etl::endian::big>);
+    }
+  }
+
+  //***************************************************************************
+  // Manchester
+  // The decoder block size is the size of the decoded output.
+  //***************************************************************************
+  std::vector<uint8_t> manchester_encoded;
+
+  template <typename TChunk>
+  uint64_t manchester_encode(const uint8_t* data, size_t size)
+  {
+    etl::manchester::encode<TChunk>(etl::span<const uint_least8_t>(data, size), etl::span<uint_least8_t>(output.data(), 2U * size));
+
+    return output[0];
+  }
+
+  template <typename TChunk>
+  uint64_t manchester_decode(const uint8_t*, size_t size)
+  {
+    etl::manchester::decode<TChunk>(etl::span<const uint_least8_t>(manchester_encoded.data(), 2U * size), etl::span<uint_least8_t>(output.data(), size));
+
+    return output[0];
+  }
+
+  void manchester(report& rep, const options& opts)
+  {
+    if (opts.selected("manchester.encode"))
+    {
+      run_sizes(rep, opts, "manchester.encode", "8 bit chunks", manchester_encode<uint8_t>);
+      run_sizes(rep, opts, "manchester.encode", "16 bit chunks", manchester_encode<uint16_t>);
+      run_sizes(rep, opts, "manchester.encode", "32 bit chunks", manchester_encode<uint32_t>);
+    }
+
+    if (opts.selected("manchester.decode"))
+    {
+      manchester_encoded.resize(2U * input.size());
+      etl::manchester::encode(etl::span<const uint_least8_t>(input.data(), input.size()),
+                              etl::span<uint_least8_t>(manchester_encoded.data(), manchester_encoded.size()));
+
+      run_sizes(rep, opts, "manchester.decode", "8 bit chunks", manchester_decode<uint16_t>);
+      run_sizes(rep, opts, "manchester.decode", "16 bit chunks", manchester_decode<uint32_t>);
+      run_sizes(rep, opts, "manchester.decode", "32 bit chunks", manchester_decode<uint64_t>);
+
+      std::vector<uint8_t>().swap(manchester_encoded);
+    }
+  }
+} // namespace
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  options opts;
+
+  if (!opts.parse(argc, argv))
+  {
+    return EXIT_FAILURE;
+  }
+
+  make_input(std::min(opts.max_size, Max_Size));
+
+  report rep("codec", opts, report::Sized);
+  rep.set_property("cycle_source", ETL_BENCHMARK_HAS_CYCLE_COUNTER ? "time stamp counter" : ((opts.ghz > 0.0) ? "--ghz" : "none"));
+  rep.print_header(std::cout);
+
+  crcs(rep, opts);
+  hashes(rep, opts);
+  base64s(rep, opts);
+  bit_stream(rep, opts);
+  byte_stream(rep, opts);
+  manchester(rep, opts);
+
+  etl_benchmark::do_not_optimise(sink);
+
+  return rep.write_json() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
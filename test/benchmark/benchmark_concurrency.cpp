@@ -0,0 +1,630 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Throughput and latency of the ETL concurrency primitives.
+//
+// Queues carry a send timestamp, so the latency is the time from push to pop.
+// Pools, the message pool and the mutex sample the time of one operation.
+// The mutex backend is the one selected by etl/mutex.h for this build; the
+// CMake file builds a second executable with ETL_NO_STL to measure the
+// compiler builtin backend.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/bip_buffer_spsc_atomic.h"
+#include "etl/callback_timer_atomic.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/function.h"
+#include "etl/generic_pool.h"
+#include "etl/message.h"
+#include "etl/mutex.h"
+#include "etl/pool.h"
+#include "etl/queue_mpmc_mutex.h"
+#include "etl/queue_spsc_atomic.h"
+#include "etl/queue_spsc_locked.h"
+#include "etl/reference_counted_message_pool.h"
+
+namespace
+{
+  using etl_benchmark::latency_samples;
+  using etl_benchmark::mutex_backend;
+  using etl_benchmark::now_ns;
+  using etl_benchmark::options;
+  using etl_benchmark::report;
+  using etl_benchmark::result;
+  using etl_benchmark::run_threads;
+  using etl_benchmark::run_timer;
+  using etl_benchmark::sample_stride;
+  using etl_benchmark::start_line;
+
+  const size_t Queue_Size       = 1024U;
+  const size_t Pool_Size        = 256U;
+  const size_t Max_Pool_Threads = 32U;
+  const size_t Outstanding      = Pool_Size / Max_Pool_Threads;
+
+  //***************************************************************************
+  /// Runs 'producers' threads calling 'push' and 'consumers' threads calling
+  /// 'pop' until 'operations' timestamps have passed through the queue.
+  //***************************************************************************
+  template <typename TPush, typename TPop>
+  result run_queue(const char* name, const char* variant, size_t producers, size_t consumers, const options& opts, TPush push, TPop pop)
+  {
+    const uint64_t per_producer = opts.operations / producers;
+    const uint64_t total        = per_producer * producers;
+    const uint64_t stride       = sample_stride(total);
+
+    std::atomic<uint64_t>        consumed(0U);
+    std::vector<latency_samples> samples(consumers);
+    std::vector<std::thread>     threads;
+    start_line                   start(producers + consumers);
+    run_timer                    timer;
+
+    for (size_t p = 0U; p < producers; ++p)
+    {
+      threads.push_back(std::thread(
+        [&, p]()
+        {
+          if (opts.pin)
+          {
+            etl_benchmark::pin_thread(p);
+          }
+
+          start.arrive_and_wait();
+          timer.start();
+
+          for (uint64_t i = 0U; i < per_producer; ++i)
+          {
+            while (!push(now_ns()))
+            {
+              std::this_thread::yield();
+            }
+          }
+
+          timer.stop();
+        }));
+    }
+
+    for (size_t c = 0U; c < consumers; ++c)
+    {
+      threads.push_back(std::thread(
+        [&, c]()
+        {
+          if (opts.pin)
+          {
+            etl_benchmark::pin_thread(producers + c);
+          }
+
+          samples[c].reserve(static_cast<size_t>(total / stride / consumers + 1U));
+          start.arrive_and_wait();
+          timer.start();
+
+          uint64_t count = 0U;
+          uint64_t value = 0U;
+
+          while (consumed.load(std::memory_order_relaxed) < total)
+          {
+            if (pop(value))
+            {
+              if ((++count % stride) == 0U)
+              {
+                samples[c].add(now_ns() - value);
+              }
+
+              consumed.fetch_add(1U, std::memory_order_relaxed);
+            }
+            else
+            {
+              std::this_thread::yield();
+            }
+          }
+
+          timer.stop();
+        }));
+    }
+
+    for (size_t i = 0U; i < threads.size(); ++i)
+    {
+      threads[i].join();
+    }
+
+    latency_samples all;
+
+    for (size_t c = 0U; c < consumers; ++c)
+    {
+      all.append(samples[c]);
+    }
+
+    result r;
+    r.name       = name;
+    r.variant    = variant;
+    r.producers  = producers;
+    r.consumers  = consumers;
+    r.operations = total;
+    r.bytes      = total * sizeof(uint64_t);
+    r.seconds    = timer.seconds();
+    r.set_latency(all);
+
+    return r;
+  }
+
+  //***************************************************************************
+  // Queues
+  //***************************************************************************
+  void queue_spsc_atomic(report& rep, const options& opts)
+  {
+    etl::queue_spsc_atomic<uint64_t, Queue_Size> queue;
+
+    rep.add(run_queue(
+      "queue_spsc_atomic", "", 1U, 1U, opts, [&](uint64_t value) { return queue.push(value); }, [&](uint64_t& value) { return queue.pop(value); }));
+  }
+
+  //***************************************************************************
+  void queue_spsc_locked(report& rep, const options& opts)
+  {
+    etl::mutex                                        mutex;
+    etl::function_mv<etl::mutex, &etl::mutex::lock>   lock(mutex);
+    etl::function_mv<etl::mutex, &etl::mutex::unlock> unlock(mutex);
+    etl::queue_spsc_locked<uint64_t, Queue_Size>      queue(lock, unlock);
+
+    rep.add(run_queue(
+      "queue_spsc_locked", mutex_backend(), 1U, 1U, opts, [&](uint64_t value) { return queue.push(value); },
+      [&](uint64_t& value) { return queue.pop(value); }));
+  }
+
+  //***************************************************************************
+  void queue_mpmc_mutex(report& rep, const options& opts)
+  {
+    for (size_t p = 0U; p < opts.threads.size(); ++p)
+    {
+      for (size_t c = 0U; c < opts.threads.size(); ++c)
+      {
+        etl::queue_mpmc_mutex<uint64_t, Queue_Size> queue;
+
+        rep.add(run_queue(
+          "queue_mpmc_mutex", mutex_backend(), opts.threads[p], opts.threads[c], opts, [&](uint64_t value) { return queue.push(value); },
+          [&](uint64_t& value) { return queue.pop(value); }));
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// The producer reserves up to 'batch' slots at a time; the consumer takes
+  /// whatever is committed.
+  //***************************************************************************
+  void bip_buffer_spsc_atomic(report& rep, const options& opts, size_t batch)
+  {
+    typedef etl::bip_buffer_spsc_atomic<uint64_t, Queue_Size> buffer_t;
+
+    buffer_t buffer;
+
+    const uint64_t total  = opts.operations;
+    const uint64_t stride = sample_stride(total);
+
+    latency_samples samples;
+    samples.reserve(static_cast<size_t>(total / stride + 1U));
+
+    start_line start(2U);
+    run_timer  timer;
+
+    std::thread producer(
+      [&]()
+      {
+        if (opts.pin)
+        {
+          etl_benchmark::pin_thread(0U);
+        }
+
+        start.arrive_and_wait();
+        timer.start();
+
+        uint64_t sent = 0U;
+
+        while (sent < total)
+        {
+          const uint64_t      wanted  = std::min<uint64_t>(batch, total - sent);
+          etl::span<uint64_t> reserve = buffer.write_reserve(static_cast<size_t>(wanted));
+
+          if (reserve.empty())
+          {
+            std::this_thread::yield();
+            continue;
+          }
+
+          const uint64_t stamp = now_ns();
+
+          for (size_t i = 0U; i < reserve.size(); ++i)
+          {
+            reserve[i] = stamp;
+          }
+
+          buffer.write_commit(reserve);
+          sent += reserve.size();
+        }
+
+        timer.stop();
+      });
+
+    std::thread consumer(
+      [&]()
+      {
+        if (opts.pin)
+        {
+          etl_benchmark::pin_thread(1U);
+        }
+
+        start.arrive_and_wait();
+        timer.start();
+
+        uint64_t received = 0U;
+
+        while (received < total)
+        {
+          etl::span<uint64_t> reserve = buffer.read_reserve();
+
+          if (reserve.empty())
+          {
+            std::this_thread::yield();
+            continue;
+          }
+
+          const uint64_t now = now_ns();
+
+          for (size_t i = 0U; i < reserve.size(); ++i)
+          {
+            if ((++received % stride) == 0U)
+            {
+              samples.add(now - reserve[i]);
+            }
+          }
+
+          buffer.read_commit(reserve);
+        }
+
+        timer.stop();
+      });
+
+    producer.join();
+    consumer.join();
+
+    result r;
+    r.name       = "bip_buffer_spsc_atomic";
+    r.variant    = (batch == 1U) ? "batch 1" : "batch " + std::to_string(batch);
+    r.producers  = 1U;
+    r.consumers  = 1U;
+    r.operations = total;
+    r.bytes      = total * sizeof(uint64_t);
+    r.seconds    = timer.seconds();
+    r.set_latency(samples);
+
+    rep.add(r);
+  }
+
+  //***************************************************************************
+  // Pools
+  //***************************************************************************
+  struct payload
+  {
+    uint64_t data[4];
+  };
+
+  //***************************************************************************
+  /// Each thread keeps a ring of 'Outstanding' allocations and replaces the
+  /// oldest on every operation, so the free list does not stay in one slot.
+  //***************************************************************************
+  template <typename TAllocate, typename TRelease>
+  void run_pool(report& rep, const char* name, const options& opts, TAllocate allocate, TRelease release)
+  {
+    // Single thread, no lock.
+    {
+      payload* ring[Outstanding] = {};
+
+      rep.add(run_threads(name, "unlocked", 1U, opts,
+                          [&](size_t, uint64_t i)
+                          {
+                            payload*& slot = ring[i % Outstanding];
+
+                            if (slot != nullptr)
+                            {
+                              release(slot);
+                            }
+
+                            slot = allocate();
+                          }));
+
+      for (size_t i = 0U; i < Outstanding; ++i)
+      {
+        if (ring[i] != nullptr)
+        {
+          release(ring[i]);
+        }
+      }
+    }
+
+    // Shared by several threads behind an etl::mutex.
+    for (size_t n = 0U; n < opts.threads.size(); ++n)
+    {
+      const size_t thread_count = std::min(opts.threads[n], Max_Pool_Threads);
+
+      etl::mutex            mutex;
+      std::vector<payload*> rings(thread_count * Outstanding, nullptr);
+
+      rep.add(run_threads(name, mutex_backend(), thread_count, opts,
+                          [&](size_t t, uint64_t i)
+                          {
+                            payload*& slot = rings[(t * Outstanding) + (i % Outstanding)];
+
+                            etl::lock_guard<etl::mutex> guard(mutex);
+
+                            if (slot != nullptr)
+                            {
+                              release(slot);
+                            }
+
+                            slot = allocate();
+                          }));
+
+      for (size_t i = 0U; i < rings.size(); ++i)
+      {
+        if (rings[i] != nullptr)
+        {
+          release(rings[i]);
+        }
+      }
+    }
+  }
+
+  //***************************************************************************
+  void pool(report& rep, const options& opts)
+  {
+    etl::pool<payload, Pool_Size> pool;
+
+    run_pool(
+      rep, "pool", opts, [&]() { return pool.allocate(); }, [&](payload* p) { pool.release(p); });
+  }
+
+  //***************************************************************************
+  void generic_pool(report& rep, const options& opts)
+  {
+    etl::generic_pool<sizeof(payload), etl::alignment_of<payload>::value, Pool_Size> pool;
+
+    run_pool(
+      rep, "generic_pool", opts, [&]() { return pool.allocate<payload>(); }, [&](payload* p) { pool.release(p); });
+  }
+
+  //***************************************************************************
+  // Reference counted message pool
+  //***************************************************************************
+#if ETL_HAS_ATOMIC
+  struct bench_message : public etl::message<1>
+  {
+    uint64_t stamp;
+  };
+
+  typedef etl::atomic_counted_message_pool::pool_message_parameters<bench_message> message_parameters;
+
+  //***************************************************************************
+  /// The message pool locked with an etl::mutex, as it would be when shared.
+  //***************************************************************************
+  class locked_message_pool : public etl::atomic_counted_message_pool
+  {
+  public:
+
+    explicit locked_message_pool(etl::imemory_block_allocator& allocator)
+      : etl::atomic_counted_message_pool(allocator)
+    {
+    }
+
+  private:
+
+    void lock() override
+    {
+      mutex.lock();
+    }
+
+    void unlock() override
+    {
+      mutex.unlock();
+    }
+
+    etl::mutex mutex;
+  };
+
+  //***************************************************************************
+  /// Each operation allocates a message with two owners, then drops both
+  /// references, the last of which returns it to the pool.
+  //***************************************************************************
+  void reference_counted_message_pool(report& rep, const options& opts)
+  {
+    for (size_t n = 0U; n < opts.threads.size(); ++n)
+    {
+      const size_t thread_count = std::min(opts.threads[n], Max_Pool_Threads);
+
+      etl::fixed_sized_memory_block_allocator<message_parameters::max_size, message_parameters::max_alignment, Pool_Size> allocator;
+      locked_message_pool                                                                                                pool(allocator);
+
+      rep.add(run_threads("reference_counted_message_pool", mutex_backend(), thread_count, opts,
+                          [&](size_t, uint64_t i)
+                          {
+                            etl::reference_counted_message<bench_message, etl::atomic_int>* p = pool.allocate<bench_message>();
+
+                            p->get_message().stamp = i;
+                            p->get_reference_counter().set_reference_count(2);
+
+                            p->get_reference_counter().decrement_reference_count();
+
+                            if (p->get_reference_counter().decrement_reference_count() == 0)
+                            {
+                              p->release();
+                            }
+                          }));
+    }
+  }
+#endif
+
+  //***************************************************************************
+  // Mutex
+  //***************************************************************************
+  void mutex(report& rep, const options& opts)
+  {
+    for (size_t n = 0U; n < opts.threads.size(); ++n)
+    {
+      etl::mutex mutex;
+      uint64_t   counter = 0U;
+
+      rep.add(run_threads("mutex.lock_unlock", mutex_backend(), opts.threads[n], opts,
+                          [&](size_t, uint64_t)
+                          {
+                            mutex.lock();
+                            ++counter;
+                            mutex.unlock();
+                          }));
+
+      etl_benchmark::do_not_optimise(counter);
+    }
+  }
+
+  //***************************************************************************
+  // Callback timer
+  //***************************************************************************
+  const uint_least8_t Number_Of_Timers = 16U;
+
+  uint64_t timer_callbacks = 0U;
+
+  void timer_callback()
+  {
+    ++timer_callbacks;
+  }
+
+  //***************************************************************************
+  /// Times tick(1) with 16 repeating timers.
+  /// With 'restart' set, each operation also stops and restarts one timer, as
+  /// the application side would between ticks.
+  /// callback_timer_atomic expects tick() to pre-empt the application, as an
+  /// interrupt does, so both sides are run from one thread here; two
+  /// pre-emptible threads would not be a supported use.
+  //***************************************************************************
+  void callback_timer_atomic(report& rep, const options& opts, bool restart)
+  {
+    typedef etl::callback_timer_atomic<Number_Of_Timers, etl::atomic<uint32_t> > timer_controller_t;
+    typedef timer_controller_t::callback_type                                   callback_type;
+
+    timer_controller_t   controller;
+    etl::timer::id::type ids[Number_Of_Timers];
+
+    for (uint_least8_t i = 0U; i < Number_Of_Timers; ++i)
+    {
+      ids[i] = controller.register_timer(callback_type::create<timer_callback>(), 1U + (i % 8U), etl::timer::mode::Repeating);
+      controller.start(ids[i]);
+    }
+
+    controller.enable(true);
+
+    rep.add(run_threads("callback_timer_atomic.tick", restart ? "restart" : "", 1U, opts,
+                        [&](size_t, uint64_t i)
+                        {
+                          if (restart)
+                          {
+                            const etl::timer::id::type id = ids[i % Number_Of_Timers];
+                            controller.stop(id);
+                            controller.start(id);
+                          }
+
+                          controller.tick(1U);
+                        }));
+
+    etl_benchmark::do_not_optimise(timer_callbacks);
+  }
+} // namespace
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  options opts;
+
+  if (!opts.parse(argc, argv))
+  {
+    return EXIT_FAILURE;
+  }
+
+  report rep("concurrency", opts);
+  rep.set_property("mutex_backend", mutex_backend());
+  rep.print_header(std::cout);
+
+  if (opts.selected("queue_spsc_atomic"))
+  {
+    queue_spsc_atomic(rep, opts);
+  }
+
+  if (opts.selected("queue_spsc_locked"))
+  {
+    queue_spsc_locked(rep, opts);
+  }
+
+  if (opts.selected("queue_mpmc_mutex"))
+  {
+    queue_mpmc_mutex(rep, opts);
+  }
+
+  if (opts.selected("bip_buffer_spsc_atomic"))
+  {
+    bip_buffer_spsc_atomic(rep, opts, 1U);
+    bip_buffer_spsc_atomic(rep, opts, 32U);
+  }
+
+  if (opts.selected("pool"))
+  {
+    pool(rep, opts);
+  }
+
+  if (opts.selected("generic_pool"))
+  {
+    generic_pool(rep, opts);
+  }
+
+#if ETL_HAS_ATOMIC
+  if (opts.selected("reference_counted_message_pool"))
+  {
+    reference_counted_message_pool(rep, opts);
+  }
+#endif
+
+  if (opts.selected("mutex"))
+  {
+    mutex(rep, opts);
+  }
+
+  if (opts.selected("callback_timer_atomic"))
+  {
+    callback_timer_atomic(rep, opts, false);
+    callback_timer_atomic(rep, opts, true);
+  }
+
+  return rep.write_json() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
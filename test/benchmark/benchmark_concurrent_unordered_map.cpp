@@ -0,0 +1,287 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Scaling of etl::concurrent_unordered_map with the number of threads.
+//
+// Each workload is run against the striped map and against an
+// etl::unordered_map behind one etl::mutex, which is what sharing a map
+// between threads costs without it. Threads pick keys at random from a fixed
+// key space, so they collide as they would in a shared session table.
+// The default thread sweep is 1 to 32; --threads overrides it.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/concurrent_unordered_map.h"
+#include "etl/mutex.h"
+#include "etl/unordered_map.h"
+
+#include <memory>
+
+namespace
+{
+  using etl_benchmark::mutex_backend;
+  using etl_benchmark::options;
+  using etl_benchmark::report;
+  using etl_benchmark::run_threads;
+
+  const size_t   Capacity = 32768U;
+  const uint32_t Keys     = 16384U;
+
+  //***************************************************************************
+  /// The mix of operations.
+  //***************************************************************************
+  enum workload
+  {
+    Read_Mostly, ///< 90% find, 10% insert_or_assign.
+    Update,      ///< 100% update.
+    Mixed        ///< 50% find, 25% insert_or_assign, 25% erase.
+  };
+
+  const char* workload_name(workload w)
+  {
+    switch (w)
+    {
+      case Read_Mostly:
+        return "concurrent_unordered_map.read_mostly";
+      case Update:
+        return "concurrent_unordered_map.update";
+      default:
+        return "concurrent_unordered_map.mixed";
+    }
+  }
+
+  //***************************************************************************
+  /// Increments a value.
+  //***************************************************************************
+  struct increment
+  {
+    void operator()(uint64_t& value) const
+    {
+      ++value;
+    }
+  };
+
+  //***************************************************************************
+  /// An etl::unordered_map behind a single mutex, with the same interface as
+  /// etl::concurrent_unordered_map.
+  //***************************************************************************
+  class global_lock_map
+  {
+  public:
+
+    bool find(uint32_t key, uint64_t& value) const
+    {
+      etl::lock_guard<etl::mutex> lock(mutex);
+
+      map_type::const_iterator itr = map.find(key);
+
+      if (itr == map.end())
+      {
+        return false;
+      }
+
+      value = itr->second;
+
+      return true;
+    }
+
+    bool insert_or_assign(uint32_t key, uint64_t value)
+    {
+      etl::lock_guard<etl::mutex> lock(mutex);
+
+      map_type::iterator itr = map.find(key);
+
+      if (itr == map.end())
+      {
+        map.insert(ETL_OR_STD::make_pair(key, value));
+        return true;
+      }
+
+      itr->second = value;
+
+      return false;
+    }
+
+    template <typename TFunction>
+    bool update(uint32_t key, TFunction function)
+    {
+      etl::lock_guard<etl::mutex> lock(mutex);
+
+      map_type::iterator itr = map.find(key);
+
+      if (itr == map.end())
+      {
+        return false;
+      }
+
+      function(itr->second);
+
+      return true;
+    }
+
+    size_t erase(uint32_t key)
+    {
+      etl::lock_guard<etl::mutex> lock(mutex);
+
+      return map.erase(key);
+    }
+
+  private:
+
+    typedef etl::unordered_map<uint32_t, uint64_t, Capacity> map_type;
+
+    mutable etl::mutex mutex;
+    map_type           map;
+  };
+
+  typedef etl::concurrent_unordered_map<uint32_t, uint64_t, Capacity, 16U> striped_16_map;
+  typedef etl::concurrent_unordered_map<uint32_t, uint64_t, Capacity, 64U> striped_64_map;
+
+  //***************************************************************************
+  /// A well mixed 64 bit value from a thread and operation number.
+  //***************************************************************************
+  uint64_t mix(uint64_t x)
+  {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27U)) * 0x94D049BB133111EBULL;
+
+    return x ^ (x >> 31U);
+  }
+
+  //***************************************************************************
+  /// Runs every workload for every thread count against one type of map.
+  /// Every key is present at the start of each run.
+  //***************************************************************************
+  template <typename TMap>
+  void run_map(report& rep, const options& opts, const char* variant)
+  {
+    const workload workloads[] = {Read_Mostly, Update, Mixed};
+
+    for (size_t w = 0U; w < (sizeof(workloads) / sizeof(workloads[0])); ++w)
+    {
+      const workload load = workloads[w];
+
+      if (!opts.selected(workload_name(load)))
+      {
+        continue;
+      }
+
+      for (size_t n = 0U; n < opts.threads.size(); ++n)
+      {
+        std::unique_ptr<TMap> p_map(new TMap);
+        TMap&                 map = *p_map;
+
+        for (uint32_t key = 0U; key < Keys; ++key)
+        {
+          map.insert_or_assign(key, key);
+        }
+
+        rep.add(run_threads(workload_name(load), variant, opts.threads[n], opts,
+                            [&](size_t t, uint64_t i)
+                            {
+                              const uint64_t r      = mix((static_cast<uint64_t>(t) << 40U) ^ i);
+                              const uint32_t key    = static_cast<uint32_t>(r % Keys);
+                              const uint32_t choice = static_cast<uint32_t>((r >> 32U) % 100U);
+                              uint64_t       value  = 0U;
+
+                              switch (load)
+                              {
+                                case Read_Mostly:
+                                {
+                                  if (choice < 90U)
+                                  {
+                                    map.find(key, value);
+                                  }
+                                  else
+                                  {
+                                    map.insert_or_assign(key, i);
+                                  }
+                                  break;
+                                }
+
+                                case Update:
+                                {
+                                  map.update(key, increment());
+                                  break;
+                                }
+
+                                default:
+                                {
+                                  if (choice < 50U)
+                                  {
+                                    map.find(key, value);
+                                  }
+                                  else if (choice < 75U)
+                                  {
+                                    map.insert_or_assign(key, i);
+                                  }
+                                  else
+                                  {
+                                    map.erase(key);
+                                  }
+                                  break;
+                                }
+                              }
+
+                              etl_benchmark::do_not_optimise(value);
+                            }));
+      }
+    }
+  }
+} // namespace
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  options opts;
+
+  opts.threads.clear();
+
+  for (size_t n = 1U; n <= 32U; n *= 2U)
+  {
+    opts.threads.push_back(n);
+  }
+
+  if (!opts.parse(argc, argv))
+  {
+    return EXIT_FAILURE;
+  }
+
+  report rep("concurrent_unordered_map", opts);
+  rep.set_property("mutex_backend", mutex_backend());
+  rep.print_header(std::cout);
+
+  run_map<global_lock_map>(rep, opts, "global_lock");
+  run_map<striped_16_map>(rep, opts, "stripes_16");
+  run_map<striped_64_map>(rep, opts, "stripes_64");
+
+  return rep.write_json() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -51,6 +51,8 @@ SOFTWARE.
 
 #define ETL_MESSAGE_TIMER_USE_ATOMIC_LOCK
 #define ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK
+#define ETL_ALGORITHM_USE_SIMD
+#define ETL_TRACE_HOOKS
 
 #define ETL_POLYMORPHIC_RANDOM
 
@@ -0,0 +1,56 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TEST_RANDOM_VALUES_INCLUDED
+#define ETL_TEST_RANDOM_VALUES_INCLUDED
+
+#include <math.h>
+#include <random>
+#include <vector>
+
+//*****************************************************************************
+/// 'n' repeatable pseudo random values in [lowest, highest), rounded down to
+/// a multiple of 0.5, so that some values equal the limits.
+//*****************************************************************************
+template <typename T>
+std::vector<T> random_values(size_t n, double lowest, double highest, unsigned seed)
+{
+  std::mt19937                           generator(seed);
+  std::uniform_real_distribution<double> distribution(lowest, highest);
+
+  std::vector<T> values(n);
+
+  for (size_t i = 0U; i < n; ++i)
+  {
+    values[i] = static_cast<T>(floor(distribution(generator) * 2.0) / 2.0);
+  }
+
+  return values;
+}
+
+#endif
@@ -39,6 +39,7 @@ SOFTWARE.
 #include <array>
 #include <forward_list>
 #include <functional>
+#include <limits>
 #include <list>
 #include <memory>
 #include <numeric>
@@ -140,6 +141,115 @@ namespace
     return os;
   }
 
+  //***************************************************************************
+  // Compares the arithmetic fast paths with the generic algorithms.
+  // Small value ranges give plenty of duplicates, unaligned starts test the tails.
+  //***************************************************************************
+  template <typename T>
+  bool fast_paths_match_generic()
+  {
+    std::uniform_int_distribution<int> dist(0, 9);
+
+    std::vector<T> buffer(200);
+    std::vector<T> other(200);
+
+    for (size_t length = 0; length < 150; ++length)
+    {
+      for (size_t offset = 0; offset < 3; ++offset)
+      {
+        for (size_t i = 0; i < buffer.size(); ++i)
+        {
+          buffer[i] = static_cast<T>(dist(urng) - 3);
+        }
+
+        T* b = buffer.data() + offset;
+        T* e = b + length;
+
+        std::copy(b, e, other.begin());
+
+        for (int v = -4; v < 8; ++v)
+        {
+          const T value = static_cast<T>(v);
+
+          if (etl::find(b, e, value) != std::find(b, e, value))
+          {
+            return false;
+          }
+
+          if (etl::count(b, e, value) != std::count(b, e, value))
+          {
+            return false;
+          }
+        }
+
+        if ((etl::min_element(b, e) != std::min_element(b, e)) || (etl::max_element(b, e) != std::max_element(b, e)))
+        {
+          return false;
+        }
+
+        if (etl::minmax_element(b, e) != std::minmax_element(b, e))
+        {
+          return false;
+        }
+
+        if (!etl::equal(b, e, other.data()))
+        {
+          return false;
+        }
+
+        if (length != 0)
+        {
+          other[length / 2] = static_cast<T>(other[length / 2] + 1);
+
+          if (etl::equal(b, e, other.data()))
+          {
+            return false;
+          }
+        }
+
+        if (etl::accumulate(b, e, T(1)) != std::accumulate(b, e, T(1), [](T a, T x) { return static_cast<T>(a + x); }))
+        {
+          return false;
+        }
+
+        etl::fill(b, e, T(5));
+
+        if (std::count(b, e, T(5)) != std::ptrdiff_t(length))
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  // Compares the min/max fast paths with the generic loops, which are used
+  // when a comparison is passed. The values have plenty of equal extremes.
+  //***************************************************************************
+  template <typename T>
+  bool extremes_match_generic(const std::vector<T>& buffer)
+  {
+    for (size_t length = 0; length < (buffer.size() - 3); ++length)
+    {
+      for (size_t offset = 0; offset < 3; ++offset)
+      {
+        const T* b = buffer.data() + offset;
+        const T* e = b + length;
+
+        if ((etl::min_element(b, e) != etl::min_element(b, e, etl::less<T>())) ||
+            (etl::max_element(b, e) != etl::max_element(b, e, etl::less<T>())) ||
+            (etl::minmax_element(b, e) != etl::minmax_element(b, e, etl::less<T>())))
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
   SUITE(test_algorithm)
   {
     //*************************************************************************
@@ -813,6 +923,226 @@ namespace
       CHECK_EQUAL(false, etl::binary_search(std::begin(single), std::end(single), 7));
     }
 
+    //*************************************************************************
+    TEST(arithmetic_fast_paths_match_generic)
+    {
+      CHECK(fast_paths_match_generic<int8_t>());
+      CHECK(fast_paths_match_generic<uint8_t>());
+      CHECK(fast_paths_match_generic<char>());
+      CHECK(fast_paths_match_generic<int16_t>());
+      CHECK(fast_paths_match_generic<uint16_t>());
+      CHECK(fast_paths_match_generic<int32_t>());
+      CHECK(fast_paths_match_generic<uint32_t>());
+      CHECK(fast_paths_match_generic<int64_t>());
+      CHECK(fast_paths_match_generic<uint64_t>());
+    }
+
+    //*************************************************************************
+    TEST(arithmetic_fast_paths_floating_point_kernels)
+    {
+      std::vector<double> values(100);
+
+      for (size_t i = 0; i < values.size(); ++i)
+      {
+        values[i] = double(i % 7) - 0.5;
+      }
+
+      values[50] = -0.0;
+
+      const double* b = values.data();
+      const double* e = values.data() + values.size();
+
+      for (size_t i = 0; i < 10; ++i)
+      {
+        const double value = double(i) - 0.5;
+
+        CHECK(std::find(b, e, value) == etl::private_algorithm_simd::find(b, e, value));
+        CHECK_EQUAL(size_t(std::count(b, e, value)), etl::private_algorithm_simd::count(b, e, value));
+      }
+
+      CHECK(etl::private_algorithm_simd::find(b, e, 0.0) == b + 50);
+    }
+
+    //*************************************************************************
+    TEST(arithmetic_fast_paths_extremes)
+    {
+      std::uniform_int_distribution<int> dist(-3, 6);
+
+      std::vector<int8_t> i8(150);
+      std::vector<uint16_t> u16(150);
+      std::vector<int64_t> i64(150);
+      std::vector<float> f(150);
+      std::vector<double> d(150);
+
+      for (size_t i = 0; i < f.size(); ++i)
+      {
+        const int value = dist(urng);
+
+        i8[i]  = int8_t(value);
+        u16[i] = uint16_t(value);
+        i64[i] = int64_t(value);
+        f[i]   = float(value) * 0.5f;
+        d[i]   = double(value) * 0.25;
+      }
+
+      CHECK(extremes_match_generic(i8));
+      CHECK(extremes_match_generic(u16));
+      CHECK(extremes_match_generic(i64));
+      CHECK(extremes_match_generic(f));
+      CHECK(extremes_match_generic(d));
+
+      // Signed zeros are equal, so the position decides.
+      std::fill(d.begin(), d.end(), 0.0);
+      d[40] = -0.0;
+      d[90] = -0.0;
+
+      CHECK(extremes_match_generic(d));
+      CHECK(etl::min_element(d.data(), d.data() + d.size()) == d.data());
+
+      // A NaN does not order, so the results depend on where it is.
+      const float nan = std::numeric_limits<float>::quiet_NaN();
+
+      for (size_t i = 0; i < 40; ++i)
+      {
+        std::vector<float> nans(f.begin(), f.end());
+        nans[i * 3] = nan;
+
+        CHECK(extremes_match_generic(nans));
+      }
+    }
+
+    //*************************************************************************
+    TEST(arithmetic_fast_paths_extremes_long_range)
+    {
+      // More blocks than an 8 bit lane can number.
+      std::vector<uint8_t> values(100000);
+
+      for (size_t i = 0; i < values.size(); ++i)
+      {
+        values[i] = uint8_t(100 + ((i * 7) % 50));
+      }
+
+      values[77777] = 250;
+      values[88888] = 250;
+      values[33333] = 3;
+      values[66666] = 3;
+
+      const uint8_t* b = values.data();
+      const uint8_t* e = values.data() + values.size();
+
+      CHECK(etl::min_element(b, e) == b + 33333);
+      CHECK(etl::max_element(b, e) == b + 77777);
+      CHECK(etl::minmax_element(b, e).first == b + 33333);
+      CHECK(etl::minmax_element(b, e).second == b + 88888);
+    }
+
+    //*************************************************************************
+    TEST(arithmetic_fast_paths_count_long_range)
+    {
+      // More matches than an 8 bit lane counter can hold.
+      std::vector<uint8_t> values(100000, uint8_t(7));
+      values[12345] = 8;
+
+      CHECK_EQUAL(99999, etl::count(values.data(), values.data() + values.size(), uint8_t(7)));
+      CHECK_EQUAL(1, etl::count(values.data(), values.data() + values.size(), uint8_t(8)));
+    }
+
+    //*************************************************************************
+    TEST(arithmetic_fast_paths_swar_kernels)
+    {
+      std::vector<uint8_t> values(100);
+
+      for (size_t i = 0; i < values.size(); ++i)
+      {
+        values[i] = uint8_t((i * 37) % 11);
+      }
+
+      const uint8_t* b = values.data();
+      const uint8_t* e = values.data() + values.size();
+
+      for (uint8_t v = 0; v < 13; ++v)
+      {
+        for (size_t offset = 0; offset < 9; ++offset)
+        {
+          CHECK(std::find(b + offset, e, v) == etl::private_algorithm_simd::swar_find(b + offset, e, v));
+          CHECK_EQUAL(size_t(std::count(b + offset, e, v)), etl::private_algorithm_simd::swar_count(b + offset, e, v));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(lower_bound_upper_bound_branchless_all_lengths)
+    {
+      // Pointers to arithmetic types use the branchless search.
+      std::vector<int> values;
+
+      for (size_t length = 0; length < 67; ++length)
+      {
+        values.clear();
+
+        for (size_t i = 0; i < length; ++i)
+        {
+          values.push_back(int(i / 3) * 2);
+        }
+
+        const int* b = values.data();
+        const int* e = values.data() + values.size();
+
+        for (int i = -1; i < int(length) + 1; ++i)
+        {
+          CHECK_EQUAL(std::lower_bound(b, e, i), etl::lower_bound(b, e, i));
+          CHECK_EQUAL(std::upper_bound(b, e, i), etl::upper_bound(b, e, i));
+          CHECK_EQUAL(std::binary_search(b, e, i), etl::binary_search(b, e, i));
+
+          ETL_OR_STD::pair<const int*, const int*> expected = std::equal_range(b, e, i);
+          ETL_OR_STD::pair<const int*, const int*> result   = etl::equal_range(b, e, i);
+
+          CHECK_EQUAL(expected.first, result.first);
+          CHECK_EQUAL(expected.second, result.second);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(lower_bound_upper_bound_branchless_random_data_with_compare)
+    {
+      std::vector<double> values(1000);
+      std::uniform_real_distribution<double> dist(-100.0, 100.0);
+
+      for (size_t i = 0; i < values.size(); ++i)
+      {
+        values[i] = dist(urng);
+      }
+
+      std::sort(values.begin(), values.end(), std::greater<double>());
+
+      for (size_t i = 0; i < 1000; ++i)
+      {
+        const double value = (i % 2 == 0) ? values[i] : dist(urng);
+
+        CHECK(std::lower_bound(values.begin(), values.end(), value, std::greater<double>())
+              == etl::lower_bound(values.begin(), values.end(), value, std::greater<double>()));
+        CHECK(std::upper_bound(values.begin(), values.end(), value, std::greater<double>())
+              == etl::upper_bound(values.begin(), values.end(), value, std::greater<double>()));
+      }
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(lower_bound_upper_bound_constexpr)
+    {
+      static constexpr int values[] = {1, 2, 2, 2, 5, 7, 9};
+
+      constexpr const int* lower = etl::lower_bound(values, values + 7, 2);
+      constexpr const int* upper = etl::upper_bound(values, values + 7, 2);
+      constexpr bool       found = etl::binary_search(values, values + 7, 7);
+
+      CHECK_EQUAL(values + 1, lower);
+      CHECK_EQUAL(values + 4, upper);
+      CHECK_TRUE(found);
+    }
+#endif
+
     //*************************************************************************
     TEST(fill_non_char)
     {
@@ -1940,6 +2270,66 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(partial_sort_all_prefix_lengths)
+    {
+      const size_t Size = 200U;
+
+      std::vector<int>                   initial(Size);
+      std::uniform_int_distribution<int> dist(0, 50);
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        initial[i] = dist(urng);
+      }
+
+      std::vector<int> sorted = initial;
+      std::sort(sorted.begin(), sorted.end());
+
+      for (size_t k = 0U; k <= Size; ++k)
+      {
+        std::vector<int> data = initial;
+
+        etl::partial_sort(data.begin(), data.begin() + static_cast<ptrdiff_t>(k), data.end());
+
+        CHECK(std::equal(data.begin(), data.begin() + static_cast<ptrdiff_t>(k), sorted.begin()));
+
+        std::sort(data.begin() + static_cast<ptrdiff_t>(k), data.end());
+        CHECK(data == sorted);
+      }
+    }
+
+    //*************************************************************************
+    TEST(partial_sort_large_prefix_worst_case_inputs)
+    {
+      const size_t Size = 10000U;
+
+      std::vector<int> sorted(Size);
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        sorted[i] = static_cast<int>(i);
+      }
+
+      std::vector<int> reversed(sorted.rbegin(), sorted.rend());
+
+      const size_t prefixes[] = {Size / 100U, Size / 4U, Size / 2U, Size - 1U};
+
+      for (size_t j = 0U; j < (sizeof(prefixes) / sizeof(prefixes[0])); ++j)
+      {
+        const ptrdiff_t k = static_cast<ptrdiff_t>(prefixes[j]);
+
+        std::vector<int> data1 = sorted;
+        std::vector<int> data2 = reversed;
+
+        etl::partial_sort(data1.begin(), data1.begin() + k, data1.end());
+        etl::partial_sort(data2.begin(), data2.begin() + k, data2.end(), Greater());
+
+        CHECK(std::equal(data1.begin(), data1.begin() + k, sorted.begin()));
+        CHECK(std::equal(data2.begin(), data2.begin() + k, reversed.begin()));
+      }
+    }
+
     //*************************************************************************
     TEST(partial_sort_copy_default)
     {
@@ -4368,6 +4758,151 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(nth_element_worst_case_inputs)
+    {
+      const size_t Size = 100000U;
+
+      struct counting_less
+      {
+        counting_less(size_t& count_)
+          : count(&count_)
+        {
+        }
+
+        bool operator()(int a, int b) const
+        {
+          ++(*count);
+          return a < b;
+        }
+
+        size_t* count;
+      };
+
+      std::vector<std::vector<int> > inputs;
+      std::vector<int>               input(Size);
+
+      // Sorted.
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        input[i] = static_cast<int>(i);
+      }
+      inputs.push_back(input);
+
+      // Reverse sorted.
+      std::reverse(input.begin(), input.end());
+      inputs.push_back(input);
+
+      // Organ pipe.
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        input[i] = static_cast<int>((i < (Size / 2U)) ? i : (Size - i));
+      }
+      inputs.push_back(input);
+
+      // Sawtooth.
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        input[i] = static_cast<int>(i % 1000U);
+      }
+      inputs.push_back(input);
+
+      // All equal.
+      std::fill(input.begin(), input.end(), 42);
+      inputs.push_back(input);
+
+      // Random with duplicates.
+      std::uniform_int_distribution<int> dist(0, 1000);
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        input[i] = dist(urng);
+      }
+      inputs.push_back(input);
+
+      const size_t positions[] = {0U, Size / 2U, (Size * 99U) / 100U, Size - 1U};
+
+      for (size_t i = 0U; i < inputs.size(); ++i)
+      {
+        std::vector<int> sorted = inputs[i];
+        std::sort(sorted.begin(), sorted.end());
+
+        for (size_t j = 0U; j < (sizeof(positions) / sizeof(positions[0])); ++j)
+        {
+          const size_t nth = positions[j];
+
+          std::vector<int> data  = inputs[i];
+          size_t           count = 0U;
+
+          etl::nth_element(data.begin(), data.begin() + static_cast<ptrdiff_t>(nth), data.end(), counting_less(count));
+
+          CHECK_EQUAL(sorted[nth], data[nth]);
+          CHECK(std::find_if(data.begin(), data.begin() + static_cast<ptrdiff_t>(nth), [&](int v) { return v > data[nth]; })
+                == data.begin() + static_cast<ptrdiff_t>(nth));
+          CHECK(std::find_if(data.begin() + static_cast<ptrdiff_t>(nth), data.end(), [&](int v) { return v < data[nth]; }) == data.end());
+
+          // Linear, not quadratic, number of comparisons.
+          CHECK(count < (20U * Size));
+
+          std::sort(data.begin(), data.end());
+          CHECK(data == sorted);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(nth_element_median_of_medians_pivot_is_central)
+    {
+      const size_t Size = 1000U;
+
+      std::vector<int> data(Size);
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        data[i] = static_cast<int>(i);
+      }
+
+      std::shuffle(data.begin(), data.end(), urng);
+
+      std::vector<int>::iterator pivot = etl::private_algorithm::median_of_medians(data.begin(), data.end(), std::less<int>());
+
+      // At least 3/10 of the values lie on each side of the pivot.
+      CHECK(*pivot >= static_cast<int>((Size * 3U) / 10U) - 5);
+      CHECK(*pivot <= static_cast<int>((Size * 7U) / 10U) + 5);
+    }
+
+    //*************************************************************************
+    TEST(nth_element_small_ranges_all_positions)
+    {
+      for (size_t size = 1U; size <= 64U; ++size)
+      {
+        std::vector<int>                   initial(size);
+        std::uniform_int_distribution<int> dist(0, static_cast<int>(size / 2U));
+
+        for (size_t i = 0U; i < size; ++i)
+        {
+          initial[i] = dist(urng);
+        }
+
+        std::vector<int> sorted = initial;
+        std::sort(sorted.begin(), sorted.end());
+
+        for (size_t nth = 0U; nth <= size; ++nth)
+        {
+          std::vector<int> data = initial;
+
+          etl::nth_element(data.begin(), data.begin() + static_cast<ptrdiff_t>(nth), data.end());
+
+          if (nth < size)
+          {
+            CHECK_EQUAL(sorted[nth], data[nth]);
+          }
+
+          std::sort(data.begin(), data.end());
+          CHECK(data == sorted);
+        }
+      }
+    }
+
     //*************************************************************************
     TEST(accumulate_default)
     {
@@ -4923,6 +5458,189 @@ namespace
       CHECK_ARRAY_EQUAL(expected, data, 12);
     }
 
+    //*************************************************************************
+    TEST(merge_galloping_matches_std)
+    {
+      // Sizes chosen so that long runs from one side trigger galloping.
+      const size_t sizes[][2] = {{0U, 50U}, {3U, 1000U}, {1000U, 3U}, {100U, 100U}, {20U, 5000U}, {777U, 1234U}};
+
+      for (size_t i = 0U; i < (sizeof(sizes) / sizeof(sizes[0])); ++i)
+      {
+        std::uniform_int_distribution<int> dist(0, static_cast<int>((sizes[i][0] + sizes[i][1]) / 4U));
+
+        std::vector<Data> input1(sizes[i][0]);
+        std::vector<Data> input2(sizes[i][1]);
+
+        for (size_t j = 0U; j < input1.size(); ++j)
+        {
+          input1[j] = Data(dist(urng), static_cast<int>(j));
+        }
+
+        for (size_t j = 0U; j < input2.size(); ++j)
+        {
+          input2[j] = Data(dist(urng), -static_cast<int>(j));
+        }
+
+        std::stable_sort(input1.begin(), input1.end(), DataPredicate());
+        std::stable_sort(input2.begin(), input2.end(), DataPredicate());
+
+        std::vector<Data> expected(input1.size() + input2.size());
+        std::vector<Data> output(input1.size() + input2.size());
+
+        std::merge(input1.begin(), input1.end(), input2.begin(), input2.end(), expected.begin(), DataPredicate());
+        std::vector<Data>::iterator result = etl::merge(input1.begin(), input1.end(), input2.begin(), input2.end(), output.begin(), DataPredicate());
+
+        CHECK(result == output.end());
+        CHECK(output == expected);
+      }
+    }
+
+    //*************************************************************************
+    TEST(inplace_merge_skewed_matches_std)
+    {
+      std::uniform_int_distribution<int> dist(0, 500);
+
+      std::vector<int> data1(2000U);
+
+      for (size_t i = 0U; i < data1.size(); ++i)
+      {
+        data1[i] = dist(urng);
+      }
+
+      const ptrdiff_t middles[] = {1, 10, 1000, 1990, 1999};
+
+      for (size_t i = 0U; i < (sizeof(middles) / sizeof(middles[0])); ++i)
+      {
+        std::vector<int> data2 = data1;
+        std::sort(data2.begin(), data2.begin() + middles[i]);
+        std::sort(data2.begin() + middles[i], data2.end());
+
+        std::vector<int> expected = data2;
+
+        std::inplace_merge(expected.begin(), expected.begin() + middles[i], expected.end());
+        etl::inplace_merge(data2.begin(), data2.begin() + middles[i], data2.end());
+
+        CHECK(data2 == expected);
+      }
+    }
+
+    //*************************************************************************
+    TEST(set_intersection_gallop_matches_std)
+    {
+      const size_t sizes[][2] = {{0U, 10U}, {10U, 0U}, {1U, 1U}, {5U, 1000U}, {1000U, 5U}, {300U, 300U}, {50U, 2000U}};
+
+      for (size_t i = 0U; i < (sizeof(sizes) / sizeof(sizes[0])); ++i)
+      {
+        std::uniform_int_distribution<int> dist(0, static_cast<int>(sizes[i][0] + sizes[i][1]));
+
+        std::vector<int> input1(sizes[i][0]);
+        std::vector<int> input2(sizes[i][1]);
+
+        std::generate(input1.begin(), input1.end(), [&]() { return dist(urng); });
+        std::generate(input2.begin(), input2.end(), [&]() { return dist(urng); });
+
+        std::sort(input1.begin(), input1.end());
+        std::sort(input2.begin(), input2.end());
+
+        std::vector<int> expected;
+        std::vector<int> output(input1.size() + input2.size());
+
+        std::set_intersection(input1.begin(), input1.end(), input2.begin(), input2.end(), std::back_inserter(expected));
+        std::vector<int>::iterator result = etl::set_intersection_gallop(input1.begin(), input1.end(), input2.begin(), input2.end(), output.begin());
+        output.erase(result, output.end());
+
+        CHECK(output == expected);
+
+        // Descending order with a comparator.
+        std::reverse(input1.begin(), input1.end());
+        std::reverse(input2.begin(), input2.end());
+        expected.clear();
+        output.resize(input1.size() + input2.size());
+
+        std::set_intersection(input1.begin(), input1.end(), input2.begin(), input2.end(), std::back_inserter(expected), Greater());
+        result = etl::set_intersection_gallop(input1.begin(), input1.end(), input2.begin(), input2.end(), output.begin(), Greater());
+        output.erase(result, output.end());
+
+        CHECK(output == expected);
+      }
+    }
+
+    //*************************************************************************
+    TEST(set_intersection_gallop_skewed_sizes_are_sublinear)
+    {
+      struct counting_less
+      {
+        counting_less(size_t& count_)
+          : count(&count_)
+        {
+        }
+
+        bool operator()(int a, int b) const
+        {
+          ++(*count);
+          return a < b;
+        }
+
+        size_t* count;
+      };
+
+      std::vector<int> ids(1000000U);
+      std::vector<int> filter;
+
+      for (size_t i = 0U; i < ids.size(); ++i)
+      {
+        ids[i] = static_cast<int>(i * 2U);
+      }
+
+      for (int i = 0; i < 100; ++i)
+      {
+        filter.push_back(i * 19997);
+      }
+
+      std::vector<int> expected;
+      std::vector<int> output(filter.size());
+      size_t           count = 0U;
+
+      std::set_intersection(filter.begin(), filter.end(), ids.begin(), ids.end(), std::back_inserter(expected));
+      std::vector<int>::iterator result =
+        etl::set_intersection_gallop(filter.begin(), filter.end(), ids.begin(), ids.end(), output.begin(), counting_less(count));
+      output.erase(result, output.end());
+
+      CHECK(output == expected);
+
+      // Roughly 2 * log2(1000000 / 100) comparisons per filter entry.
+      CHECK(count < 100U * 64U);
+    }
+
+    //*************************************************************************
+    TEST(set_difference_gallop_matches_std)
+    {
+      const size_t sizes[][2] = {{0U, 10U}, {10U, 0U}, {1U, 1U}, {5U, 1000U}, {1000U, 5U}, {300U, 300U}, {2000U, 50U}};
+
+      for (size_t i = 0U; i < (sizeof(sizes) / sizeof(sizes[0])); ++i)
+      {
+        std::uniform_int_distribution<int> dist(0, static_cast<int>(sizes[i][0] + sizes[i][1]) / 2);
+
+        std::vector<int> input1(sizes[i][0]);
+        std::vector<int> input2(sizes[i][1]);
+
+        std::generate(input1.begin(), input1.end(), [&]() { return dist(urng); });
+        std::generate(input2.begin(), input2.end(), [&]() { return dist(urng); });
+
+        std::sort(input1.begin(), input1.end());
+        std::sort(input2.begin(), input2.end());
+
+        std::vector<int> expected;
+        std::vector<int> output(input1.size());
+
+        std::set_difference(input1.begin(), input1.end(), input2.begin(), input2.end(), std::back_inserter(expected));
+        std::vector<int>::iterator result = etl::set_difference_gallop(input1.begin(), input1.end(), input2.begin(), input2.end(), output.begin());
+        output.erase(result, output.end());
+
+        CHECK(output == expected);
+      }
+    }
+
 #if ETL_USING_CPP17
 
     //*************************************************************************
@@ -0,0 +1,309 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "etl/bip_record_queue.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  typedef etl::bip_record_queue<64, 8> Queue;
+
+  //***************************************************************************
+  struct collector
+  {
+    explicit collector(std::vector<std::string>& records_)
+      : records(records_)
+    {
+    }
+
+    void operator()(etl::span<const unsigned char> record)
+    {
+      CHECK_EQUAL(0U, reinterpret_cast<uintptr_t>(record.data()) % 8U);
+      records.push_back(std::string(reinterpret_cast<const char*>(record.data()), record.size()));
+    }
+
+    std::vector<std::string>& records;
+  };
+
+  bool push(Queue& queue, const std::string& text)
+  {
+    return queue.push_record(text.data(), text.size());
+  }
+
+  SUITE(test_bip_record_queue)
+  {
+    //*************************************************************************
+    TEST(test_constants)
+    {
+      CHECK_EQUAL(8U, Queue::Block_Size);
+      CHECK_EQUAL(1U, Queue::Header_Blocks);
+      CHECK_EQUAL(8U, Queue::Blocks);
+      CHECK_EQUAL(24U, Queue::Max_Record_Size);
+
+      Queue queue;
+      CHECK(queue.empty());
+      CHECK_EQUAL(64U, queue.capacity_bytes());
+      CHECK_EQUAL(24U, queue.max_record_size());
+      CHECK_EQUAL(24U, queue.available());
+
+      // Rounded up to the alignment.
+      CHECK_EQUAL(24U, (etl::bip_record_queue<22, 4>::Blocks * etl::bip_record_queue<22, 4>::Block_Size));
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_and_commit)
+    {
+      Queue queue;
+
+      etl::span<unsigned char> record = queue.emplace_record(5U);
+      CHECK_EQUAL(5U, record.size());
+      CHECK_EQUAL(0U, reinterpret_cast<uintptr_t>(record.data()) % 8U);
+      memcpy(record.data(), "hello", 5U);
+
+      // Not visible until committed.
+      CHECK(queue.empty());
+      queue.commit();
+      CHECK(!queue.empty());
+      CHECK_EQUAL(16U, queue.size_bytes());
+
+      std::vector<std::string> records;
+      CHECK_EQUAL(1U, queue.for_each_record(10U, collector(records)));
+      CHECK_EQUAL(1U, records.size());
+      CHECK_EQUAL(std::string("hello"), records[0]);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_commit_trimmed)
+    {
+      Queue queue;
+
+      etl::span<unsigned char> record = queue.emplace_record(24U);
+      CHECK_EQUAL(24U, record.size());
+      memcpy(record.data(), "abc", 3U);
+      queue.commit(3U);
+
+      // Only the trimmed record is in use.
+      CHECK_EQUAL(16U, queue.size_bytes());
+
+      std::vector<std::string> records;
+      queue.for_each_record(10U, collector(records));
+      CHECK_EQUAL(std::string("abc"), records[0]);
+
+      // Larger than the reservation.
+      queue.emplace_record(4U);
+      CHECK_THROW(queue.commit(5U), etl::bip_buffer_reserve_invalid);
+
+      // Nothing reserved.
+      Queue other;
+      CHECK_THROW(other.commit(), etl::bip_buffer_reserve_invalid);
+    }
+
+    //*************************************************************************
+    TEST(test_empty_record)
+    {
+      Queue queue;
+
+      CHECK(queue.push_record(ETL_NULLPTR, 0U));
+
+      std::vector<std::string> records;
+      CHECK_EQUAL(1U, queue.for_each_record(10U, collector(records)));
+      CHECK_EQUAL(std::string(), records[0]);
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      Queue queue;
+
+      CHECK(queue.emplace_record(25U).empty());
+      CHECK(push(queue, std::string(24U, 'a')));
+      CHECK_EQUAL(24U, queue.available());
+      CHECK(!push(queue, std::string(25U, 'b')));
+      CHECK(push(queue, std::string(24U, 'b')));
+      CHECK(!push(queue, std::string()));
+      CHECK_EQUAL(0U, queue.available());
+    }
+
+    //*************************************************************************
+    TEST(test_max_record_after_drain)
+    {
+      // Leave the indices at every position, then queue the largest record.
+      for (size_t size = 0U; size <= Queue::Max_Record_Size; ++size)
+      {
+        Queue queue;
+
+        for (int round = 0; round < 3; ++round)
+        {
+          CHECK(push(queue, std::string(size, 'a')));
+
+          std::vector<std::string> records;
+          queue.drain(collector(records));
+          CHECK(queue.empty());
+          CHECK_EQUAL(queue.max_record_size(), queue.available());
+
+          CHECK(push(queue, std::string(queue.max_record_size(), 'b')));
+
+          records.clear();
+          CHECK_EQUAL(1U, queue.drain(collector(records)));
+          CHECK_EQUAL(std::string(queue.max_record_size(), 'b'), records[0]);
+        }
+      }
+
+      etl::bip_record_queue<256, 8> large;
+      const std::string             small(100U, 'c');
+      const std::string             big(large.max_record_size(), 'd');
+
+      CHECK(large.push_record(small.data(), small.size()));
+      large.for_each_record(1U, [](etl::span<const unsigned char>) {});
+      CHECK(large.push_record(big.data(), big.size()));
+    }
+
+    //*************************************************************************
+    TEST(test_batch_limit)
+    {
+      Queue queue;
+
+      CHECK(push(queue, "one"));
+      CHECK(push(queue, "two"));
+      CHECK(push(queue, "three"));
+
+      std::vector<std::string> records;
+      CHECK_EQUAL(2U, queue.for_each_record(2U, collector(records)));
+      CHECK_EQUAL(2U, records.size());
+      CHECK_EQUAL(std::string("two"), records[1]);
+
+      CHECK_EQUAL(1U, queue.for_each_record(2U, collector(records)));
+      CHECK_EQUAL(std::string("three"), records[2]);
+      CHECK_EQUAL(0U, queue.for_each_record(2U, collector(records)));
+    }
+
+    //*************************************************************************
+    TEST(test_records_do_not_straddle_the_wrap)
+    {
+      Queue queue;
+
+      CHECK(push(queue, std::string(24U, 'a'))); // Blocks 0-3
+      CHECK(push(queue, std::string(8U, 'b')));  // Blocks 4-5
+
+      std::vector<std::string> records;
+      CHECK_EQUAL(1U, queue.for_each_record(1U, collector(records)));
+
+      // 2 blocks remain at the end; the record needs 3, so it wraps to the start.
+      CHECK_EQUAL(16U, queue.available());
+      etl::span<unsigned char> record = queue.emplace_record(10U);
+      CHECK_EQUAL(10U, record.size());
+      memset(record.data(), 'c', record.size());
+      queue.commit();
+
+      // The first batch stops at the wrap point.
+      CHECK_EQUAL(1U, queue.for_each_record(10U, collector(records)));
+      CHECK_EQUAL(std::string(8U, 'b'), records[1]);
+
+      CHECK_EQUAL(1U, queue.for_each_record(10U, collector(records)));
+      CHECK_EQUAL(std::string(10U, 'c'), records[2]);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_drain_across_the_wrap)
+    {
+      Queue queue;
+
+      CHECK(push(queue, std::string(24U, 'a')));
+      CHECK(push(queue, std::string(8U, 'b')));
+
+      std::vector<std::string> records;
+      queue.for_each_record(1U, collector(records));
+
+      CHECK(push(queue, std::string(10U, 'c')));
+
+      records.clear();
+      CHECK_EQUAL(2U, queue.drain(collector(records)));
+      CHECK_EQUAL(std::string(8U, 'b'), records[0]);
+      CHECK_EQUAL(std::string(10U, 'c'), records[1]);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      static etl::bip_record_queue<1024> queue;
+
+      const uint32_t Count = 20000U;
+
+      std::thread consumer([Count]() {
+        uint32_t expected = 0U;
+        bool     ok       = true;
+
+        while (expected < Count)
+        {
+          queue.for_each_record(8U, [&](etl::span<const unsigned char> record) {
+            uint32_t value;
+            memcpy(&value, record.data(), sizeof(value));
+            ok = ok && (record.size() == (sizeof(uint32_t) + 1U + (value % 37U))) && (value == expected) && (record.back() == (value & 0xFFU));
+            ++expected;
+          });
+        }
+
+        CHECK(ok);
+        CHECK_EQUAL(Count, expected);
+      });
+
+      for (uint32_t i = 0U; i < Count;)
+      {
+        const size_t size = sizeof(uint32_t) + 1U + (i % 37U);
+
+        etl::span<unsigned char> record = queue.emplace_record(size);
+
+        if (record.empty())
+        {
+          std::this_thread::yield();
+        }
+        else
+        {
+          memcpy(record.data(), &i, sizeof(i));
+          record.back() = static_cast<unsigned char>(i & 0xFFU);
+          queue.commit();
+          ++i;
+        }
+      }
+
+      consumer.join();
+    }
+  }
+} // namespace
+
+#endif
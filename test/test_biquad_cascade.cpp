@@ -0,0 +1,253 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/biquad_cascade.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+  //***************************************************************************
+  std::vector<double> random_values(size_t n, double amplitude, unsigned seed)
+  {
+    std::mt19937                           generator(seed);
+    std::uniform_real_distribution<double> distribution(-amplitude, amplitude);
+
+    std::vector<double> values(n);
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      values[i] = distribution(generator);
+    }
+
+    return values;
+  }
+
+  //***************************************************************************
+  /// Stable sections, with poles inside radius 0.9.
+  //***************************************************************************
+  std::vector<double> random_sections(size_t stages, unsigned seed)
+  {
+    std::mt19937                           generator(seed);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    std::vector<double> coefficients;
+
+    for (size_t s = 0U; s < stages; ++s)
+    {
+      const double radius = 0.9 * distribution(generator);
+      const double angle  = 3.14159 * distribution(generator);
+
+      coefficients.push_back(0.2 + 0.3 * distribution(generator)); // b0
+      coefficients.push_back(0.3 * distribution(generator));       // b1
+      coefficients.push_back(0.2 * distribution(generator));       // b2
+      coefficients.push_back(-2.0 * radius * std::cos(angle));    // a1
+      coefficients.push_back(radius * radius);                     // a2
+    }
+
+    return coefficients;
+  }
+
+  //***************************************************************************
+  /// Direct form I in double.
+  //***************************************************************************
+  std::vector<double> reference(const std::vector<double>& k, const std::vector<double>& x)
+  {
+    std::vector<double> y(x);
+
+    for (size_t s = 0U; s < (k.size() / 5U); ++s)
+    {
+      double x1 = 0.0, x2 = 0.0, y1 = 0.0, y2 = 0.0;
+
+      for (size_t n = 0U; n < y.size(); ++n)
+      {
+        const double in  = y[n];
+        const double out = k[5U * s] * in + k[5U * s + 1U] * x1 + k[5U * s + 2U] * x2 - k[5U * s + 3U] * y1 - k[5U * s + 4U] * y2;
+
+        x2   = x1;
+        x1   = in;
+        y2   = y1;
+        y1   = out;
+        y[n] = out;
+      }
+    }
+
+    return y;
+  }
+
+  //***************************************************************************
+  template <typename T, size_t Stages>
+  void check_against_reference(double scale, double coefficient_scale, double tolerance, unsigned seed)
+  {
+    typedef etl::biquad_cascade<T, Stages> cascade_t;
+
+    const std::vector<double> k  = random_sections(Stages, seed);
+    const std::vector<double> xd = random_values(1000U, 0.25, seed + 1U);
+
+    std::vector<T> coefficients;
+
+    for (size_t i = 0U; i < k.size(); ++i)
+    {
+      coefficients.push_back(cascade_t::coefficient(k[i]));
+    }
+
+    std::vector<T>      x(xd.size());
+    std::vector<double> xq(xd.size());
+
+    for (size_t i = 0U; i < x.size(); ++i)
+    {
+      x[i]  = T(xd[i] * scale);
+      xq[i] = double(x[i]) / scale;
+    }
+
+    // The reference uses the quantized coefficients.
+    std::vector<double> kq(k.size());
+
+    for (size_t i = 0U; i < k.size(); ++i)
+    {
+      kq[i] = double(coefficients[i]) / coefficient_scale;
+    }
+
+    const std::vector<double> expected = reference(kq, xq);
+
+    cascade_t cascade(coefficients.data());
+
+    std::vector<T> y(x.size());
+    CHECK_EQUAL(x.size(), cascade.apply(x, y));
+
+    for (size_t i = 0U; i < y.size(); ++i)
+    {
+      CHECK_CLOSE(expected[i], double(y[i]) / scale, tolerance);
+    }
+  }
+
+  SUITE(test_biquad_cascade)
+  {
+    //*************************************************************************
+    TEST(test_constants)
+    {
+      CHECK_EQUAL(3U, (etl::biquad_cascade<float, 3, 2>::STAGES));
+      CHECK_EQUAL(2U, (etl::biquad_cascade<float, 3, 2>::CHANNELS));
+      CHECK_EQUAL(5U, (etl::biquad_cascade<float, 3, 2>::COEFFICIENTS_PER_STAGE));
+    }
+
+    //*************************************************************************
+    TEST(test_single_section)
+    {
+      // y[n] = x[n] + 0.5y[n-1]
+      const double k[] = {1.0, 0.0, 0.0, -0.5, 0.0};
+
+      etl::biquad_cascade<double, 1> cascade(k);
+
+      CHECK_CLOSE(1.0, cascade(1.0), 0.0);
+      CHECK_CLOSE(0.5, cascade(0.0), 0.0);
+      CHECK_CLOSE(0.25, cascade(0.0), 0.0);
+
+      cascade.reset();
+      CHECK_CLOSE(0.0, cascade(0.0), 0.0);
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point)
+    {
+      check_against_reference<double, 1>(1.0, 1.0, 1e-12, 1U);
+      check_against_reference<double, 4>(1.0, 1.0, 1e-12, 2U);
+      check_against_reference<float, 3>(1.0, 1.0, 1e-4, 3U);
+    }
+
+    //*************************************************************************
+    TEST(test_fixed_point)
+    {
+      check_against_reference<int16_t, 1>(32768.0, 16384.0, 1e-3, 4U);
+      check_against_reference<int16_t, 3>(32768.0, 16384.0, 1e-3, 5U);
+      check_against_reference<int32_t, 1>(2147483648.0, 1073741824.0, 1e-7, 6U);
+      check_against_reference<int32_t, 4>(2147483648.0, 1073741824.0, 1e-7, 7U);
+    }
+
+    //*************************************************************************
+    TEST(test_coefficient)
+    {
+      CHECK_EQUAL(24576, etl::biquad_cascade_q15<1>::coefficient(1.5));
+      CHECK_EQUAL(-32768, etl::biquad_cascade_q15<1>::coefficient(-2.0));
+      CHECK_EQUAL(32767, etl::biquad_cascade_q15<1>::coefficient(2.0));
+      CHECK_EQUAL(-1610612736, etl::biquad_cascade_q31<1>::coefficient(-1.5));
+    }
+
+    //*************************************************************************
+    TEST(test_fixed_point_saturates)
+    {
+      const int16_t k[] = {etl::biquad_cascade_q15<1>::coefficient(1.9), 0, 0, 0, 0};
+
+      etl::biquad_cascade_q15<1> cascade(k);
+
+      CHECK_EQUAL(32767, cascade(30000));
+      CHECK_EQUAL(-32768, cascade(-30000));
+      CHECK_EQUAL(19, cascade(10));
+    }
+
+    //*************************************************************************
+    TEST(test_fixed_point_accumulator_wraps)
+    {
+      // Each feed forward product is 2^62, so the sum exceeds int64_t from the second sample.
+      const int32_t k[] = {INT32_MIN, INT32_MIN, INT32_MIN, 0, 0};
+
+      etl::biquad_cascade_q31<1> cascade(k);
+
+      CHECK_EQUAL(INT32_MAX, cascade(INT32_MIN)); // 2^62, saturated
+      CHECK_EQUAL(INT32_MIN, cascade(INT32_MIN)); // 2^63 wraps to -2^63, saturated
+      CHECK_EQUAL(INT32_MIN, cascade(INT32_MIN)); // 3 * 2^62 wraps to -2^62, saturated
+    }
+
+    //*************************************************************************
+    TEST(test_interleaved_channels)
+    {
+      const std::vector<double> kd = random_sections(2U, 8U);
+      const std::vector<double> x  = random_values(400U, 1.0, 9U);
+
+      etl::biquad_cascade<double, 2, 2> cascade(kd.data());
+      etl::biquad_cascade<double, 2>    left(kd.data());
+      etl::biquad_cascade<double, 2>    right(kd.data());
+
+      std::vector<double> y(x);
+      CHECK_EQUAL(400U, cascade.apply(y, y));
+
+      for (size_t i = 0U; i < 400U; i += 2U)
+      {
+        CHECK_CLOSE(left(x[i]), y[i], 0.0);
+        CHECK_CLOSE(right(x[i + 1U]), y[i + 1U], 0.0);
+      }
+
+      CHECK_THROW(cascade.process(1.0, 2U), etl::filter_channel_out_of_range);
+    }
+  }
+} // namespace
@@ -0,0 +1,554 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/btree_map.h"
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "data.h"
+
+namespace
+{
+  typedef etl::btree_map<int, int, 512, 4> Small_Map;
+  typedef etl::btree_map<int, int, 4096>   Default_Map;
+
+  typedef TestDataNDC<int> NDC;
+
+  //***************************************************************************
+  // Checks the map against the reference, forwards and backwards.
+  //***************************************************************************
+  template <typename TMap>
+  bool matches(const TMap& map, const std::map<int, int>& reference)
+  {
+    if (map.size() != reference.size())
+    {
+      return false;
+    }
+
+    if (!std::equal(map.begin(), map.end(), reference.begin()))
+    {
+      return false;
+    }
+
+    return std::equal(map.rbegin(), map.rend(), reference.rbegin());
+  }
+
+  //***************************************************************************
+  std::vector<std::pair<int, int>> sorted_pairs(int n)
+  {
+    std::vector<std::pair<int, int>> pairs;
+
+    for (int i = 0; i < n; ++i)
+    {
+      pairs.push_back(std::make_pair(i * 2, i));
+    }
+
+    return pairs;
+  }
+
+  SUITE(test_btree_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Small_Map map;
+
+      CHECK(map.empty());
+      CHECK(!map.full());
+      CHECK_EQUAL(0U, map.size());
+      CHECK_EQUAL(512U, map.max_size());
+      CHECK_EQUAL(512U, map.capacity());
+      CHECK_EQUAL(512U, map.available());
+      CHECK_EQUAL(0U, map.height());
+      CHECK(map.begin() == map.end());
+      CHECK(map.rbegin() == map.rend());
+      CHECK(map.find(1) == map.end());
+      CHECK(map.lower_bound(1) == map.end());
+      CHECK_EQUAL(4U, Small_Map::FANOUT);
+      CHECK_EQUAL(16U, Default_Map::FANOUT);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_and_find)
+    {
+      Small_Map map;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        const int key = (i * 37) % 100;
+
+        std::pair<Small_Map::iterator, bool> result = map.insert(std::make_pair(key, key * 10));
+
+        CHECK(result.second);
+        CHECK_EQUAL(key, result.first->first);
+        CHECK_EQUAL(key * 10, result.first->second);
+      }
+
+      CHECK_EQUAL(100U, map.size());
+      CHECK(map.height() >= 3U);
+
+      // Duplicates are not inserted.
+      std::pair<Small_Map::iterator, bool> result = map.insert(std::make_pair(5, 0));
+      CHECK(!result.second);
+      CHECK_EQUAL(50, result.first->second);
+      CHECK_EQUAL(100U, map.size());
+
+      for (int key = 0; key < 100; ++key)
+      {
+        CHECK(map.contains(key));
+        CHECK_EQUAL(1U, map.count(key));
+        CHECK_EQUAL(key * 10, map.find(key)->second);
+      }
+
+      CHECK(!map.contains(100));
+      CHECK(!map.contains(-1));
+
+      int expected = 0;
+
+      for (Small_Map::const_iterator i = map.cbegin(); i != map.cend(); ++i)
+      {
+        CHECK_EQUAL(expected++, i->first);
+      }
+
+      CHECK_EQUAL(100, expected);
+    }
+
+    //*************************************************************************
+    TEST(test_bounds)
+    {
+      const std::vector<std::pair<int, int>> pairs = sorted_pairs(100);
+
+      Small_Map map(pairs.begin(), pairs.end());
+
+      for (int key = -1; key <= 200; ++key)
+      {
+        const Small_Map& cmap = map;
+
+        Small_Map::const_iterator lower = cmap.lower_bound(key);
+        Small_Map::const_iterator upper = cmap.upper_bound(key);
+
+        const int expected_lower = (key < 0) ? 0 : ((key + 1) / 2) * 2;
+        const int expected_upper = (key < 0) ? 0 : ((key / 2) + 1) * 2;
+
+        if (expected_lower < 200)
+        {
+          CHECK_EQUAL(expected_lower, lower->first);
+        }
+        else
+        {
+          CHECK(lower == cmap.end());
+        }
+
+        if (expected_upper < 200)
+        {
+          CHECK_EQUAL(expected_upper, upper->first);
+        }
+        else
+        {
+          CHECK(upper == cmap.end());
+        }
+
+        std::pair<Small_Map::const_iterator, Small_Map::const_iterator> range = cmap.equal_range(key);
+        CHECK(range.first == lower);
+        CHECK(range.second == upper);
+        CHECK_EQUAL(((key >= 0) && (key < 200) && ((key % 2) == 0)) ? 1 : 0, std::distance(range.first, range.second));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_matches_std_map)
+    {
+      Small_Map          map;
+      std::map<int, int> reference;
+
+      std::mt19937                       generator(1);
+      std::uniform_int_distribution<int> key_distribution(0, 1000);
+      std::uniform_int_distribution<int> operation(0, 9);
+
+      for (int i = 0; i < 50000; ++i)
+      {
+        const int key = key_distribution(generator);
+
+        switch (operation(generator))
+        {
+          case 0:
+          case 1:
+          case 2:
+          case 3:
+          {
+            if (map.size() < map.max_size())
+            {
+              const bool inserted = map.insert(std::make_pair(key, i)).second;
+              CHECK_EQUAL(reference.insert(std::make_pair(key, i)).second, inserted);
+            }
+            break;
+          }
+
+          case 4:
+          case 5:
+          case 6:
+          {
+            CHECK_EQUAL(reference.erase(key), map.erase(key));
+            break;
+          }
+
+          case 7:
+          {
+            Small_Map::iterator                position = map.lower_bound(key);
+            std::map<int, int>::iterator reference_position = reference.lower_bound(key);
+
+            if (reference_position != reference.end())
+            {
+              position           = map.erase(position);
+              reference_position = reference.erase(reference_position);
+
+              if (reference_position == reference.end())
+              {
+                CHECK(position == map.end());
+              }
+              else
+              {
+                CHECK_EQUAL(reference_position->first, position->first);
+              }
+            }
+            break;
+          }
+
+          case 8:
+          {
+            Small_Map::iterator position = map.find(key);
+            CHECK_EQUAL(reference.count(key), (position == map.end()) ? 0U : 1U);
+            break;
+          }
+
+          default:
+          {
+            Small_Map::iterator          position           = map.upper_bound(key);
+            std::map<int, int>::iterator reference_position = reference.upper_bound(key);
+            CHECK_EQUAL((reference_position == reference.end()), (position == map.end()));
+            break;
+          }
+        }
+
+        CHECK_EQUAL(reference.size(), map.size());
+      }
+
+      CHECK(matches(map, reference));
+    }
+
+    //*************************************************************************
+    TEST(test_fill_in_any_order)
+    {
+      // The pools must hold the worst case shapes.
+      std::vector<int> keys(512);
+
+      for (size_t i = 0U; i < keys.size(); ++i)
+      {
+        keys[i] = int(i);
+      }
+
+      std::mt19937 generator(2);
+
+      for (int order = 0; order < 4; ++order)
+      {
+        if (order == 1)
+        {
+          std::reverse(keys.begin(), keys.end());
+        }
+        else if (order >= 2)
+        {
+          std::shuffle(keys.begin(), keys.end(), generator);
+        }
+
+        Small_Map map;
+
+        for (size_t i = 0U; i < keys.size(); ++i)
+        {
+          map[keys[i]] = keys[i];
+        }
+
+        CHECK(map.full());
+        CHECK_EQUAL(0U, map.available());
+        CHECK_THROW(map.insert(std::make_pair(1000, 0)), etl::btree_full);
+
+        // Replace half, keeping the tree full.
+        std::shuffle(keys.begin(), keys.end(), generator);
+
+        for (size_t i = 0U; i < (keys.size() / 2U); ++i)
+        {
+          CHECK_EQUAL(1U, map.erase(keys[i]));
+        }
+
+        for (size_t i = 0U; i < (keys.size() / 2U); ++i)
+        {
+          map[keys[i]] = keys[i];
+        }
+
+        CHECK(map.full());
+
+        for (size_t i = 0U; i < keys.size(); ++i)
+        {
+          CHECK_EQUAL(1U, map.erase(keys[i]));
+        }
+
+        CHECK(map.empty());
+        CHECK_EQUAL(0U, map.height());
+        CHECK(map.begin() == map.end());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_bulk_load)
+    {
+      for (int n = 0; n <= 200; ++n)
+      {
+        const std::vector<std::pair<int, int>> pairs = sorted_pairs(n);
+
+        Small_Map map(pairs.begin(), pairs.end());
+
+        std::map<int, int> reference(pairs.begin(), pairs.end());
+        CHECK(matches(map, reference));
+
+        for (int i = 0; i < n; ++i)
+        {
+          CHECK_EQUAL(i, map.at(i * 2));
+        }
+
+        // Packed leaves give the minimum height.
+        size_t expected_height = 0U;
+
+        for (int nodes = (n + 3) / 4; nodes > 1; nodes = (nodes + 3) / 4)
+        {
+          ++expected_height;
+        }
+
+        CHECK_EQUAL(expected_height, map.height());
+
+        // Then mixed with inserts and erases.
+        for (int i = 0; i < n; ++i)
+        {
+          map.insert(std::make_pair((i * 2) + 1, i));
+          reference.insert(std::make_pair((i * 2) + 1, i));
+
+          if ((i % 3) == 0)
+          {
+            map.erase(i);
+            reference.erase(i);
+          }
+        }
+
+        CHECK(matches(map, reference));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_assign_unsorted)
+    {
+      std::vector<std::pair<int, int>> pairs = sorted_pairs(300);
+
+      std::mt19937 generator(3);
+      std::shuffle(pairs.begin(), pairs.end(), generator);
+
+      // Duplicates are dropped.
+      pairs.push_back(pairs.front());
+
+      Small_Map map;
+      map.assign(pairs.begin(), pairs.end());
+
+      std::map<int, int> reference(pairs.begin(), pairs.end());
+      CHECK(matches(map, reference));
+
+      const std::vector<std::pair<int, int>> too_many = sorted_pairs(513);
+      CHECK_THROW(map.assign(too_many.begin(), too_many.end()), etl::btree_full);
+    }
+
+    //*************************************************************************
+    TEST(test_erase_range)
+    {
+      const std::vector<std::pair<int, int>> pairs = sorted_pairs(200);
+
+      for (int first = 0; first < 200; first += 13)
+      {
+        for (int last = first; last <= 200; last += 17)
+        {
+          Small_Map          map(pairs.begin(), pairs.end());
+          std::map<int, int> reference(pairs.begin(), pairs.end());
+
+          Small_Map::const_iterator map_first = map.find(first * 2);
+          Small_Map::const_iterator map_last  = (last == 200) ? map.cend() : Small_Map::const_iterator(map.find(last * 2));
+
+          Small_Map::iterator result = map.erase(map_first, map_last);
+          reference.erase(reference.find(first * 2), (last == 200) ? reference.end() : reference.find(last * 2));
+
+          CHECK(matches(map, reference));
+
+          if (last == 200)
+          {
+            CHECK(result == map.end());
+          }
+          else
+          {
+            CHECK_EQUAL(last * 2, result->first);
+          }
+        }
+      }
+
+      Small_Map map(pairs.begin(), pairs.end());
+      CHECK(map.erase(map.cbegin(), map.cend()) == map.end());
+      CHECK(map.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_index_and_at)
+    {
+      Small_Map map;
+
+      map[3] = 30;
+      map[1] = 10;
+      map[3] += 1;
+
+      CHECK_EQUAL(2U, map.size());
+      CHECK_EQUAL(31, map.at(3));
+      CHECK_EQUAL(10, map.at(1));
+      CHECK_EQUAL(0, map[2]);
+      CHECK_EQUAL(3U, map.size());
+
+      const Small_Map& cmap = map;
+      CHECK_EQUAL(31, cmap.at(3));
+      CHECK_THROW(map.at(4), etl::btree_out_of_bounds);
+      CHECK_THROW(cmap.at(4), etl::btree_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_copy_move_and_compare)
+    {
+      const std::vector<std::pair<int, int>> pairs = sorted_pairs(100);
+
+      Small_Map map1(pairs.begin(), pairs.end());
+      Small_Map map2(map1);
+
+      CHECK(map1 == map2);
+
+      map2[1] = 1;
+      CHECK(map1 != map2);
+
+      map2 = map1;
+      CHECK(map1 == map2);
+
+      Small_Map map3(std::move(map2));
+      CHECK(map1 == map3);
+      CHECK(map2.empty());
+
+      Small_Map map4;
+      map4 = std::move(map3);
+      CHECK(map1 == map4);
+      CHECK(map3.empty());
+
+      Small_Map map5 = {std::make_pair(2, 1), std::make_pair(1, 2)};
+      CHECK_EQUAL(2U, map5.size());
+      CHECK_EQUAL(1, map5.begin()->first);
+
+      // Through the base class.
+      etl::ibtree_map<int, int, 4>& imap = map5;
+      imap.clear();
+      CHECK(map5.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_string_keys)
+    {
+      typedef etl::btree_map<std::string, int, 1000, 5> String_Map;
+
+      String_Map                 map;
+      std::map<std::string, int> reference;
+
+      std::mt19937                       generator(4);
+      std::uniform_int_distribution<int> distribution(0, 2000);
+
+      for (int i = 0; i < 5000; ++i)
+      {
+        const std::string key = std::to_string(distribution(generator));
+
+        if ((i % 3) == 2)
+        {
+          CHECK_EQUAL(reference.erase(key), map.erase(key));
+        }
+        else if (!map.full())
+        {
+          map[key] = i;
+          reference[key] = i;
+        }
+      }
+
+      CHECK_EQUAL(reference.size(), map.size());
+      CHECK(std::equal(map.begin(), map.end(), reference.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_no_leaks)
+    {
+      NDC::reset_instance_count();
+
+      {
+        typedef etl::btree_map<int, NDC, 200, 4> NDC_Map;
+
+        NDC_Map map;
+
+        for (int i = 0; i < 200; ++i)
+        {
+          map.insert(std::make_pair((i * 7) % 200, NDC(i)));
+        }
+
+        CHECK_EQUAL(200, NDC::get_instance_count());
+
+        for (int i = 0; i < 200; i += 2)
+        {
+          map.erase(i);
+        }
+
+        CHECK_EQUAL(100, NDC::get_instance_count());
+
+        NDC_Map copy(map);
+        CHECK_EQUAL(200, NDC::get_instance_count());
+
+        copy.clear();
+        CHECK_EQUAL(100, NDC::get_instance_count());
+      }
+
+      CHECK_EQUAL(0, NDC::get_instance_count());
+    }
+  }
+} // namespace
@@ -0,0 +1,185 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/btree_set.h"
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace
+{
+  typedef etl::btree_set<int, 600, 6> Set;
+
+  //***************************************************************************
+  bool matches(const Set& set, const std::set<int>& reference)
+  {
+    return (set.size() == reference.size()) &&
+           std::equal(set.begin(), set.end(), reference.begin()) &&
+           std::equal(set.rbegin(), set.rend(), reference.rbegin());
+  }
+
+  SUITE(test_btree_set)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Set set;
+
+      CHECK(set.empty());
+      CHECK_EQUAL(0U, set.size());
+      CHECK_EQUAL(600U, set.max_size());
+      CHECK(set.begin() == set.end());
+      CHECK_EQUAL(6U, Set::FANOUT);
+    }
+
+    //*************************************************************************
+    TEST(test_matches_std_set)
+    {
+      Set           set;
+      std::set<int> reference;
+
+      std::mt19937                       generator(5);
+      std::uniform_int_distribution<int> key_distribution(-500, 500);
+      std::uniform_int_distribution<int> operation(0, 2);
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        const int key = key_distribution(generator);
+
+        if (operation(generator) == 0)
+        {
+          CHECK_EQUAL(reference.erase(key), set.erase(key));
+        }
+        else if (!set.full())
+        {
+          CHECK_EQUAL(reference.insert(key).second, set.insert(key).second);
+        }
+
+        CHECK_EQUAL(reference.count(key), set.count(key));
+      }
+
+      CHECK(matches(set, reference));
+
+      for (int key = -501; key <= 501; ++key)
+      {
+        Set::const_iterator lower = set.lower_bound(key);
+
+        if (reference.lower_bound(key) == reference.end())
+        {
+          CHECK(lower == set.end());
+        }
+        else
+        {
+          CHECK_EQUAL(*reference.lower_bound(key), *lower);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_bulk_load)
+    {
+      std::vector<int> keys;
+
+      for (int n = 0; n <= 600; n += 7)
+      {
+        keys.clear();
+
+        for (int i = 0; i < n; ++i)
+        {
+          keys.push_back(i * 3);
+        }
+
+        Set           set(keys.begin(), keys.end());
+        std::set<int> reference(keys.begin(), keys.end());
+
+        CHECK(matches(set, reference));
+
+        // Erase everything in a random order.
+        std::mt19937 generator(static_cast<std::mt19937::result_type>(n));
+        std::shuffle(keys.begin(), keys.end(), generator);
+
+        for (size_t i = 0U; i < keys.size(); ++i)
+        {
+          CHECK_EQUAL(1U, set.erase(keys[i]));
+          reference.erase(keys[i]);
+
+          if ((i % 50U) == 0U)
+          {
+            CHECK(matches(set, reference));
+          }
+        }
+
+        CHECK(set.empty());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      Set set;
+
+      for (int i = 0; i < 600; ++i)
+      {
+        set.insert(599 - i);
+      }
+
+      CHECK(set.full());
+      CHECK_THROW(set.insert(600), etl::btree_full);
+      CHECK(!set.insert(0).second);
+
+      Set copy(set);
+      CHECK(copy == set);
+
+      copy.erase(copy.begin());
+      CHECK(copy != set);
+    }
+
+    //*************************************************************************
+    TEST(test_string_keys)
+    {
+      typedef etl::btree_set<std::string, 100> String_Set;
+
+      String_Set set = {"delta", "alpha", "charlie", "bravo"};
+
+      CHECK_EQUAL(4U, set.size());
+      CHECK_EQUAL(std::string("alpha"), *set.begin());
+      CHECK_EQUAL(std::string("delta"), *set.rbegin());
+      CHECK(set.contains("charlie"));
+      CHECK(!set.contains("echo"));
+
+      set.erase("alpha");
+      CHECK_EQUAL(std::string("bravo"), *set.begin());
+    }
+  }
+} // namespace
@@ -34,6 +34,7 @@ SOFTWARE.
 
 #include "etl/chrono.h"
 
+#include <chrono>
 #include <type_traits>
 
 //*****************************************************************************
@@ -66,6 +67,22 @@ extern "C"
 
 namespace
 {
+  //***************************************************************************
+  /// A real clock to calibrate against.
+  //***************************************************************************
+  struct reference_clock
+  {
+    using duration   = etl::chrono::nanoseconds;
+    using time_point = etl::chrono::time_point<reference_clock, duration>;
+
+    static time_point now()
+    {
+      const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch());
+
+      return time_point(duration(ns.count()));
+    }
+  };
+
   SUITE(test_chrono_clocks)
   {
     //*************************************************************************
@@ -171,5 +188,102 @@ namespace
 
       CHECK_EQUAL(sys_clock_count, scaled_steady_lock_count);
     }
+
+    //*************************************************************************
+    TEST(test_tsc_clock_before_calibration)
+    {
+      using Clock = etl::chrono::tsc_clock;
+
+      Clock::reset();
+
+      CHECK_TRUE((std::is_same<etl::chrono::nanoseconds, Clock::duration>::value));
+      CHECK_TRUE((std::is_same<etl::chrono::time_point<Clock, etl::chrono::nanoseconds>, Clock::time_point>::value));
+      CHECK_TRUE(Clock::is_steady);
+
+      // Reads the steady clock, which counts seconds.
+      CHECK_FALSE(Clock::is_using_tsc());
+      CHECK_EQUAL(1U, Clock::frequency());
+
+      seconds = 3;
+      CHECK_EQUAL(3U, Clock::cycles());
+      CHECK_EQUAL(3000000000LL, Clock::now().time_since_epoch().count());
+    }
+
+    //*************************************************************************
+    TEST(test_tsc_clock_conversion)
+    {
+      using namespace etl::chrono::private_chrono;
+
+      // A fixed 2.5GHz calibration, independent of the processor.
+      uint32_t shift      = tsc_shift(1000000000ULL, 2500000000ULL);
+      uint32_t multiplier = tsc_multiplier(1000000000ULL, 2500000000ULL, shift);
+
+      CHECK_EQUAL(32U, shift);
+      CHECK_EQUAL(0U, tsc_convert(0U, multiplier, shift));
+      CHECK_CLOSE(2.0, double(tsc_convert(5U, multiplier, shift)), 1.0);
+      CHECK_CLOSE(1000000000.0, double(tsc_convert(2500000000ULL, multiplier, shift)), 1.0);
+
+      // A year of cycles.
+      const double year = 365.0 * 86400.0 * 1e9;
+      CHECK_CLOSE(year, double(tsc_convert(2500000000ULL * 365U * 86400U, multiplier, shift)), year * 1e-9);
+
+      shift      = tsc_shift(1000000000ULL, 3000000000ULL);
+      multiplier = tsc_multiplier(1000000000ULL, 3000000000ULL, shift);
+      CHECK_CLOSE(1000000000.0, double(tsc_convert(3000000000ULL, multiplier, shift)), 1.0);
+
+      // A slow counter needs a smaller shift to keep the multiplier in 32 bits.
+      shift      = tsc_shift(1000000000ULL, 32768U);
+      multiplier = tsc_multiplier(1000000000ULL, 32768U, shift);
+      CHECK_TRUE(shift < 32U);
+      CHECK_EQUAL(1000000000U, tsc_convert(32768U, multiplier, shift));
+    }
+
+    //*************************************************************************
+    TEST(test_tsc_clock_set_frequency)
+    {
+      using Clock = etl::chrono::tsc_clock;
+
+      CHECK_FALSE(Clock::set_frequency(0U));
+
+      if (Clock::has_invariant_tsc())
+      {
+        CHECK_TRUE(Clock::set_frequency(2500000000ULL));
+        CHECK_TRUE(Clock::is_using_tsc());
+        CHECK_EQUAL(2500000000ULL, Clock::frequency());
+        CHECK_CLOSE(1000000000.0, double(Clock::cycles_to_duration(2500000000ULL).count()), 1.0);
+      }
+      else
+      {
+        CHECK_FALSE(Clock::set_frequency(2500000000ULL));
+        CHECK_FALSE(Clock::is_using_tsc());
+      }
+
+      Clock::reset();
+      CHECK_FALSE(Clock::is_using_tsc());
+      CHECK_EQUAL(1U, Clock::frequency());
+      CHECK_EQUAL(3000000000LL, Clock::cycles_to_duration(3U).count());
+    }
+
+    //*************************************************************************
+    TEST(test_tsc_clock_calibrate)
+    {
+      using Clock = etl::chrono::tsc_clock;
+
+      if (!Clock::has_invariant_tsc())
+      {
+        CHECK_FALSE(Clock::calibrate<reference_clock>());
+        return;
+      }
+
+      CHECK_TRUE(Clock::calibrate<reference_clock>(etl::chrono::milliseconds(20)));
+      CHECK_TRUE(Clock::is_using_tsc());
+      CHECK_TRUE(Clock::frequency() > 100000000ULL);
+
+      const Clock::time_point first = Clock::now();
+      CHECK_TRUE(Clock::now() >= first);
+
+      Clock::reset();
+      CHECK_FALSE(Clock::is_using_tsc());
+    }
   }
 } // namespace
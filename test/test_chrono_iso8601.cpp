@@ -0,0 +1,247 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/chrono.h"
+
+#include <random>
+#include <string>
+
+namespace
+{
+  using sys_milliseconds = etl::chrono::sys_time<etl::chrono::milliseconds>;
+  using sys_microseconds = etl::chrono::sys_time<etl::chrono::microseconds>;
+  using sys_nanoseconds  = etl::chrono::sys_time<etl::chrono::nanoseconds>;
+
+  //***************************************************************************
+  template <typename TDuration>
+  std::string format(const etl::chrono::sys_time<TDuration>& tp)
+  {
+    char buffer[64];
+
+    const size_t length = etl::chrono::format_iso8601(tp, etl::span<char>(buffer, sizeof(buffer)));
+
+    return std::string(buffer, length);
+  }
+
+  //***************************************************************************
+  template <typename TDuration>
+  size_t parse(const std::string& text, etl::chrono::sys_time<TDuration>& tp)
+  {
+    return etl::chrono::parse_iso8601(etl::span<const char>(text.data(), text.size()), tp);
+  }
+
+  SUITE(test_chrono_iso8601)
+  {
+    //*************************************************************************
+    TEST(test_size)
+    {
+      CHECK_EQUAL(20U, etl::chrono::iso8601_size<etl::chrono::seconds>::value);
+      CHECK_EQUAL(20U, etl::chrono::iso8601_size<etl::chrono::days>::value);
+      CHECK_EQUAL(24U, etl::chrono::iso8601_size<etl::chrono::milliseconds>::value);
+      CHECK_EQUAL(27U, etl::chrono::iso8601_size<etl::chrono::microseconds>::value);
+      CHECK_EQUAL(30U, etl::chrono::iso8601_size<etl::chrono::nanoseconds>::value);
+    }
+
+    //*************************************************************************
+    TEST(test_format)
+    {
+      CHECK_EQUAL(std::string("1970-01-01T00:00:00Z"), format(etl::chrono::sys_seconds(etl::chrono::seconds(0))));
+      CHECK_EQUAL(std::string("2024-02-29T13:45:07Z"), format(etl::chrono::sys_seconds(etl::chrono::seconds(1709214307))));
+      CHECK_EQUAL(std::string("2024-02-29T00:00:00Z"), format(etl::chrono::sys_days(etl::chrono::days(19782))));
+      CHECK_EQUAL(std::string("2024-02-29T13:45:07.012Z"), format(sys_milliseconds(etl::chrono::milliseconds(1709214307012))));
+      CHECK_EQUAL(std::string("2024-02-29T13:45:07.000120Z"), format(sys_microseconds(etl::chrono::microseconds(1709214307000120))));
+      CHECK_EQUAL(std::string("2024-02-29T13:45:07.123456789Z"), format(sys_nanoseconds(etl::chrono::nanoseconds(1709214307123456789))));
+      CHECK_EQUAL(std::string("9999-12-31T23:59:59.999Z"), format(sys_milliseconds(etl::chrono::milliseconds(253402300799999))));
+      CHECK_EQUAL(std::string("0000-01-01T00:00:00Z"), format(etl::chrono::sys_seconds(etl::chrono::seconds(-62167219200))));
+    }
+
+    //*************************************************************************
+    TEST(test_format_before_epoch)
+    {
+      CHECK_EQUAL(std::string("1969-12-31T23:59:59.999Z"), format(sys_milliseconds(etl::chrono::milliseconds(-1))));
+      CHECK_EQUAL(std::string("1969-12-31T23:59:59Z"), format(etl::chrono::sys_seconds(etl::chrono::seconds(-1))));
+      CHECK_EQUAL(std::string("1900-01-01T00:00:00.000001Z"), format(sys_microseconds(etl::chrono::microseconds(-2208988799999999))));
+    }
+
+    //*************************************************************************
+    TEST(test_format_failures)
+    {
+      char buffer[30];
+
+      // Too small.
+      const sys_nanoseconds tp(etl::chrono::nanoseconds(1));
+      CHECK_EQUAL(0U, etl::chrono::format_iso8601(tp, etl::span<char>(buffer, 29U)));
+      CHECK_EQUAL(30U, etl::chrono::format_iso8601(tp, etl::span<char>(buffer, 30U)));
+
+      // Out of range years.
+      CHECK_EQUAL(0U, etl::chrono::format_iso8601(etl::chrono::sys_seconds(etl::chrono::seconds(253402300800)), etl::span<char>(buffer)));
+      CHECK_EQUAL(0U, etl::chrono::format_iso8601(etl::chrono::sys_seconds(etl::chrono::seconds(-62167219201)), etl::span<char>(buffer)));
+    }
+
+    //*************************************************************************
+    TEST(test_format_with_cache)
+    {
+      etl::chrono::iso8601_cache cache;
+
+      std::mt19937_64                        generator(1);
+      std::uniform_int_distribution<int64_t> step(0, 400000);
+
+      etl::chrono::microseconds time(1709214307000000);
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        char buffer[27];
+
+        const sys_microseconds tp(time);
+
+        const size_t length = etl::chrono::format_iso8601(tp, etl::span<char>(buffer), cache);
+
+        CHECK_EQUAL(format(tp), std::string(buffer, length));
+
+        time += etl::chrono::microseconds(step(generator));
+      }
+
+      // A failure is not cached as a valid prefix.
+      char buffer[20];
+      CHECK_EQUAL(0U, etl::chrono::format_iso8601(etl::chrono::sys_seconds(etl::chrono::seconds(253402300800)), etl::span<char>(buffer), cache));
+      CHECK_EQUAL(0U, etl::chrono::format_iso8601(etl::chrono::sys_seconds(etl::chrono::seconds(253402300800)), etl::span<char>(buffer), cache));
+      CHECK_EQUAL(20U, etl::chrono::format_iso8601(etl::chrono::sys_seconds(etl::chrono::seconds(0)), etl::span<char>(buffer), cache));
+      CHECK_EQUAL(std::string("1970-01-01T00:00:00Z"), std::string(buffer, 20U));
+
+      cache.clear();
+      CHECK_EQUAL(20U, etl::chrono::format_iso8601(etl::chrono::sys_seconds(etl::chrono::seconds(0)), etl::span<char>(buffer), cache));
+      CHECK_EQUAL(std::string("1970-01-01T00:00:00Z"), std::string(buffer, 20U));
+    }
+
+    //*************************************************************************
+    TEST(test_parse)
+    {
+      sys_milliseconds tp;
+
+      CHECK_EQUAL(24U, parse(std::string("2024-02-29T13:45:07.012Z"), tp));
+      CHECK_EQUAL(1709214307012, tp.time_since_epoch().count());
+
+      // No designator.
+      CHECK_EQUAL(19U, parse(std::string("1970-01-01T00:00:01"), tp));
+      CHECK_EQUAL(1000, tp.time_since_epoch().count());
+
+      // Alternative separators.
+      CHECK_EQUAL(22U, parse(std::string("1970-01-01 00:00:01,5z"), tp));
+      CHECK_EQUAL(1500, tp.time_since_epoch().count());
+      CHECK_EQUAL(21U, parse(std::string("1970-01-01t00:00:01.5"), tp));
+      CHECK_EQUAL(1500, tp.time_since_epoch().count());
+
+      // Extra digits are truncated.
+      CHECK_EQUAL(29U, parse(std::string("1969-12-31T23:59:59.99999999Z"), tp));
+      CHECK_EQUAL(-1, tp.time_since_epoch().count());
+
+      // Offsets.
+      CHECK_EQUAL(25U, parse(std::string("1970-01-01T01:30:00+01:30"), tp));
+      CHECK_EQUAL(0, tp.time_since_epoch().count());
+      CHECK_EQUAL(24U, parse(std::string("1969-12-31T22:00:00-0200"), tp));
+      CHECK_EQUAL(0, tp.time_since_epoch().count());
+
+      // Trailing text is not consumed.
+      CHECK_EQUAL(20U, parse(std::string("2000-01-01T00:00:00Z INFO started"), tp));
+      CHECK_EQUAL(946684800000, tp.time_since_epoch().count());
+    }
+
+    //*************************************************************************
+    TEST(test_parse_coarser_duration)
+    {
+      etl::chrono::sys_seconds seconds_tp;
+
+      CHECK_EQUAL(29U, parse(std::string("2024-02-29T13:45:07.987654321"), seconds_tp));
+      CHECK_EQUAL(1709214307, seconds_tp.time_since_epoch().count());
+
+      sys_nanoseconds nanoseconds_tp;
+
+      CHECK_EQUAL(23U, parse(std::string("2024-02-29T13:45:07.98Z"), nanoseconds_tp));
+      CHECK_EQUAL(1709214307980000000, nanoseconds_tp.time_since_epoch().count());
+    }
+
+    //*************************************************************************
+    TEST(test_parse_failures)
+    {
+      const sys_milliseconds original(etl::chrono::milliseconds(123));
+
+      const char* invalid[] = {"",
+                               "2024-02-29T13:45:0",
+                               "2024-02-29X13:45:07",
+                               "2024/02/29T13:45:07",
+                               "2024-13-01T00:00:00",
+                               "2024-00-01T00:00:00",
+                               "2023-02-29T00:00:00",
+                               "2024-04-31T00:00:00",
+                               "2024-01-00T00:00:00",
+                               "2024-01-01T24:00:00",
+                               "2024-01-01T00:60:00",
+                               "2024-01-01T00:00:60",
+                               "2024-01-01T00:00:0a",
+                               "2024-01-01T00:00:00.Z",
+                               "2024-01-01T00:00:00+01",
+                               "2024-01-01T00:00:00+01:6",
+                               "2024-01-01T00:00:00+24:00",
+                               "2024-01-01T00:00:00+01:60"};
+
+      for (size_t i = 0U; i < (sizeof(invalid) / sizeof(invalid[0])); ++i)
+      {
+        sys_milliseconds tp = original;
+
+        CHECK_EQUAL(0U, parse(std::string(invalid[i]), tp));
+        CHECK_TRUE(tp == original);
+      }
+
+      // Leap years.
+      sys_milliseconds tp;
+      CHECK_EQUAL(19U, parse(std::string("2000-02-29T00:00:00"), tp));
+      CHECK_EQUAL(0U, parse(std::string("1900-02-29T00:00:00"), tp));
+    }
+
+    //*************************************************************************
+    TEST(test_round_trip)
+    {
+      std::mt19937_64                        generator(2);
+      std::uniform_int_distribution<int64_t> distribution(-2208988800000000000, etl::integral_limits<int64_t>::max);
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        const sys_nanoseconds tp(etl::chrono::nanoseconds(distribution(generator)));
+
+        const std::string text = format(tp);
+
+        sys_nanoseconds parsed;
+        CHECK_EQUAL(text.size(), parse(text, parsed));
+        CHECK_EQUAL(tp.time_since_epoch().count(), parsed.time_since_epoch().count());
+      }
+    }
+  }
+} // namespace
@@ -53,6 +53,47 @@ SOFTWARE.
 
 namespace
 {
+  //***************************************************************************
+  int days_of(int y, unsigned m, unsigned d)
+  {
+    return Chrono::sys_days(Chrono::year_month_day{Chrono::year(y), Chrono::month(m), Chrono::day(d)}).time_since_epoch().count();
+  }
+
+  //***************************************************************************
+  // Checks that each day from 'first' to 'last' round trips, and is the day
+  // after the one before it.
+  //***************************************************************************
+  void check_consecutive_days(int first, int last)
+  {
+    Chrono::year_month_day previous{Chrono::sys_days(etl::chrono::days(first))};
+
+    CHECK_EQUAL(first, Chrono::sys_days(previous).time_since_epoch().count());
+
+    for (int days = first + 1; days <= last; ++days)
+    {
+      const Chrono::year_month_day ymd{Chrono::sys_days(etl::chrono::days(days))};
+
+      if (ymd.day() == Chrono::day(1))
+      {
+        CHECK_TRUE(ymd.month() == (previous.month() + Chrono::months(1)));
+        CHECK_TRUE(Chrono::year_month_day_last(previous.year(), Chrono::month_day_last(previous.month())).day() == previous.day());
+
+        if (ymd.month() == Chrono::January)
+        {
+          CHECK_TRUE(ymd.year() == (previous.year() + Chrono::years(1)));
+        }
+      }
+      else
+      {
+        CHECK_TRUE(ymd.day() == (previous.day() + Chrono::days(1)));
+      }
+
+      CHECK_EQUAL(days, Chrono::sys_days(ymd).time_since_epoch().count());
+
+      previous = ymd;
+    }
+  }
+
   SUITE(test_chrono_year_month_day)
   {
     //*************************************************************************
@@ -156,6 +197,57 @@ namespace
       CHECK_EQUAL((unsigned)expected.day(), (unsigned)ymd.day());
     }
 
+    //*************************************************************************
+    TEST(test_sys_days_before_epoch)
+    {
+      Chrono::year_month_day ymd{Chrono::sys_days(etl::chrono::days(-1))};
+      CHECK_TRUE(Chrono::year_month_day(Chrono::year(1969), Chrono::December, Chrono::day(31)) == ymd);
+
+      // The start of the proleptic Gregorian calendar's year 0.
+      ymd = Chrono::year_month_day{Chrono::sys_days(etl::chrono::days(-719528))};
+      CHECK_TRUE(Chrono::year_month_day(Chrono::year(0), Chrono::January, Chrono::day(1)) == ymd);
+
+      CHECK_EQUAL(-141427, Chrono::sys_days(Chrono::year_month_day{Chrono::year(1582), Chrono::October, Chrono::day(15)}).time_since_epoch().count());
+    }
+
+    //*************************************************************************
+    TEST(test_sys_days_round_trip)
+    {
+      const int first = Chrono::sys_days(Chrono::year_month_day{Chrono::year::min(), Chrono::January, Chrono::day(1)}).time_since_epoch().count();
+      const int last  = Chrono::sys_days(Chrono::year_month_day{Chrono::year::max(), Chrono::December, Chrono::day(31)}).time_since_epoch().count();
+
+      CHECK_EQUAL(-12687428, first);
+      CHECK_EQUAL(11248737, last);
+
+      // The ends of the range.
+      check_consecutive_days(first, first + 400);
+      check_consecutive_days(last - 400, last);
+
+      // The conversion works in 400 year eras that start on the 1st of March.
+      for (int y = -32400; y <= 32400; y += 400)
+      {
+        check_consecutive_days(days_of(y, 2, 27), days_of(y, 3, 2));
+      }
+
+      // The leap year rules, including the centuries that are not leap years.
+      const int years[] = {-401, -400, -101, -100, -5, -4, -1, 0, 1, 1899, 1900, 1970, 1999, 2000, 2004, 2023, 2024, 2099, 2100, 32764, 32766};
+
+      for (size_t i = 0U; i < (sizeof(years) / sizeof(years[0])); ++i)
+      {
+        check_consecutive_days(days_of(years[i], 2, 27), days_of(years[i], 3, 2));
+        check_consecutive_days(days_of(years[i], 12, 30), days_of(years[i] + 1, 1, 2));
+      }
+
+      // A coarse stride across the whole range.
+      for (int days = first; days <= last; days += 997)
+      {
+        const Chrono::year_month_day ymd{Chrono::sys_days(etl::chrono::days(days))};
+
+        CHECK_TRUE(ymd.ok());
+        CHECK_EQUAL(days, Chrono::sys_days(ymd).time_since_epoch().count());
+      }
+    }
+
     //*************************************************************************
     TEST(test_year_month_day_member_arithmetic_operators)
     {
@@ -0,0 +1,511 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/concurrent_unordered_map.h"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if ETL_HAS_MUTEX && ETL_HAS_ATOMIC
+
+namespace
+{
+  typedef etl::concurrent_unordered_map<int, std::string, 10, 4> Map;
+  typedef std::pair<int, std::string>                            Pair;
+
+  //***************************************************************************
+  // Puts every key in the same stripe and bucket.
+  //***************************************************************************
+  struct same_hash
+  {
+    size_t operator()(int) const
+    {
+      return 0U;
+    }
+  };
+
+  //***************************************************************************
+  // Counts the live instances, to check that values are destroyed.
+  //***************************************************************************
+  struct Counted
+  {
+    Counted(int value_ = 0)
+      : value(value_)
+    {
+      ++instances;
+    }
+
+    Counted(const Counted& other)
+      : value(other.value)
+    {
+      ++instances;
+    }
+
+    Counted& operator=(const Counted& other)
+    {
+      value = other.value;
+      return *this;
+    }
+
+    ~Counted()
+    {
+      --instances;
+    }
+
+    int value;
+
+    static int instances;
+  };
+
+  int Counted::instances = 0;
+
+  //***************************************************************************
+  // Throws from the copy constructor when asked to.
+  //***************************************************************************
+  struct Throwing
+  {
+    Throwing(int value_ = 0)
+      : value(value_)
+    {
+    }
+
+    Throwing(const Throwing& other)
+      : value(other.value)
+    {
+      if (throw_on_copy)
+      {
+        throw std::runtime_error("copy");
+      }
+    }
+
+    Throwing& operator=(const Throwing& other)
+    {
+      value = other.value;
+      return *this;
+    }
+
+    int value;
+
+    static bool throw_on_copy;
+  };
+
+  bool Throwing::throw_on_copy = false;
+
+  //***************************************************************************
+  std::vector<Pair> sorted_snapshot(const Map& map)
+  {
+    std::vector<Pair> values;
+
+    map.snapshot(std::back_inserter(values));
+    std::sort(values.begin(), values.end());
+
+    return values;
+  }
+
+  SUITE(test_concurrent_unordered_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Map map;
+
+      CHECK(map.empty());
+      CHECK(!map.full());
+      CHECK_EQUAL(0U, map.size());
+      CHECK_EQUAL(10U, map.max_size());
+      CHECK_EQUAL(10U, map.capacity());
+      CHECK_EQUAL(10U, map.available());
+      CHECK_EQUAL(4U, map.stripe_count());
+      CHECK_EQUAL(16U, Map::Bucket_Count);
+      CHECK(!map.contains(1));
+
+      // There is at least one bucket per stripe.
+      CHECK_EQUAL(8U, (etl::concurrent_unordered_map<int, int, 2, 8>::Bucket_Count));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_or_assign_and_find)
+    {
+      Map         map;
+      std::string value;
+
+      CHECK(map.insert_or_assign(1, "one"));
+      CHECK(map.insert_or_assign(2, "two"));
+      CHECK_EQUAL(2U, map.size());
+
+      CHECK(map.find(1, value));
+      CHECK_EQUAL(std::string("one"), value);
+      CHECK(map.find(2, value));
+      CHECK_EQUAL(std::string("two"), value);
+
+      value = "unchanged";
+      CHECK(!map.find(3, value));
+      CHECK_EQUAL(std::string("unchanged"), value);
+
+      // Assigning an existing key does not add it again.
+      CHECK(!map.insert_or_assign(1, "uno"));
+      CHECK_EQUAL(2U, map.size());
+      CHECK(map.find(1, value));
+      CHECK_EQUAL(std::string("uno"), value);
+
+      std::string moved("deux");
+      CHECK(!map.insert_or_assign(2, std::move(moved)));
+      CHECK(map.find(2, value));
+      CHECK_EQUAL(std::string("deux"), value);
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      Map map;
+
+      map.insert_or_assign(1, "one");
+      map.insert_or_assign(2, "two");
+
+      CHECK_EQUAL(1U, map.erase(1));
+      CHECK_EQUAL(0U, map.erase(1));
+      CHECK(!map.contains(1));
+      CHECK(map.contains(2));
+      CHECK_EQUAL(1U, map.size());
+      CHECK_EQUAL(9U, map.available());
+    }
+
+    //*************************************************************************
+    TEST(test_update)
+    {
+      Map map;
+
+      map.insert_or_assign(1, "one");
+
+      CHECK(map.update(1, [](std::string& value) { value += "!"; }));
+      CHECK(!map.update(2, [](std::string& value) { value += "!"; }));
+
+      std::string value;
+      CHECK(map.find(1, value));
+      CHECK_EQUAL(std::string("one!"), value);
+      CHECK(!map.contains(2));
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      Map map;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        CHECK(map.insert_or_assign(i, std::to_string(i)));
+      }
+
+      CHECK(map.full());
+      CHECK_EQUAL(0U, map.available());
+
+      CHECK_THROW(map.insert_or_assign(10, "ten"), etl::concurrent_unordered_map_full);
+
+      // Existing keys may still be assigned.
+      CHECK(!map.insert_or_assign(5, "five"));
+
+      // Erasing makes room.
+      map.erase(3);
+      CHECK(map.insert_or_assign(10, "ten"));
+      CHECK(map.full());
+    }
+
+    //*************************************************************************
+    TEST(test_capacity_shared_by_stripes)
+    {
+      // Every key is in one stripe, but the whole capacity is still usable.
+      etl::concurrent_unordered_map<int, int, 10, 4, same_hash> map;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        CHECK(map.insert_or_assign(i, i * 10));
+      }
+
+      CHECK(map.full());
+
+      for (int i = 0; i < 10; ++i)
+      {
+        int value = 0;
+        CHECK(map.find(i, value));
+        CHECK_EQUAL(i * 10, value);
+      }
+
+      CHECK_EQUAL(1U, map.erase(0));
+      CHECK_EQUAL(1U, map.erase(9));
+      CHECK_EQUAL(1U, map.erase(5));
+      CHECK_EQUAL(7U, map.size());
+      CHECK(!map.contains(5));
+      CHECK(map.contains(4));
+      CHECK(map.contains(6));
+    }
+
+    //*************************************************************************
+    TEST(test_stripes_are_cache_line_aligned)
+    {
+      CHECK(alignof(Map) >= 64U);
+
+      Map map;
+
+      CHECK_EQUAL(0U, reinterpret_cast<uintptr_t>(&map) % 64U);
+    }
+
+    //*************************************************************************
+    TEST(test_node_released_when_value_constructor_throws)
+    {
+      etl::concurrent_unordered_map<int, Throwing, 2, 2> map;
+
+      CHECK(map.insert_or_assign(1, Throwing(1)));
+
+      Throwing value(2);
+      Throwing::throw_on_copy = true;
+      CHECK_THROW(map.insert_or_assign(2, value), std::runtime_error);
+      CHECK_THROW(map.insert_or_assign(3, value), std::runtime_error);
+      Throwing::throw_on_copy = false;
+
+      CHECK_EQUAL(1U, map.size());
+      CHECK_EQUAL(1U, map.available());
+      CHECK(!map.contains(2));
+      CHECK(!map.contains(3));
+
+      // The node that was taken for the failed insert is usable again.
+      CHECK(map.insert_or_assign(2, value));
+      CHECK(map.full());
+    }
+
+    //*************************************************************************
+    TEST(test_clear_and_destroy)
+    {
+      {
+        etl::concurrent_unordered_map<int, Counted, 8, 2> map;
+
+        for (int i = 0; i < 8; ++i)
+        {
+          map.insert_or_assign(i, Counted(i));
+        }
+
+        CHECK_EQUAL(8, Counted::instances);
+
+        map.erase(0);
+        CHECK_EQUAL(7, Counted::instances);
+
+        map.clear();
+        CHECK_EQUAL(0, Counted::instances);
+        CHECK(map.empty());
+
+        // The map is usable after a clear.
+        for (int i = 0; i < 8; ++i)
+        {
+          map.insert_or_assign(i, Counted(i));
+        }
+
+        CHECK(map.full());
+      }
+
+      CHECK_EQUAL(0, Counted::instances);
+    }
+
+    //*************************************************************************
+    TEST(test_snapshot_and_for_each)
+    {
+      Map map;
+
+      map.insert_or_assign(3, "three");
+      map.insert_or_assign(1, "one");
+      map.insert_or_assign(2, "two");
+
+      std::vector<Pair> expected;
+      expected.push_back(Pair(1, "one"));
+      expected.push_back(Pair(2, "two"));
+      expected.push_back(Pair(3, "three"));
+
+      CHECK(expected == sorted_snapshot(map));
+
+      std::vector<Pair> visited;
+      map.for_each([&](const Map::value_type& value) { visited.push_back(Pair(value.first, value.second)); });
+      std::sort(visited.begin(), visited.end());
+
+      CHECK(expected == visited);
+    }
+
+    //*************************************************************************
+    TEST(test_compare_with_std_map)
+    {
+      etl::concurrent_unordered_map<int, int, 64, 8> map;
+      std::map<int, int>                              reference;
+
+      std::mt19937                       generator(1234);
+      std::uniform_int_distribution<int> key(0, 99);
+      std::uniform_int_distribution<int> action(0, 2);
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        const int k = key(generator);
+
+        switch (action(generator))
+        {
+          case 0:
+          {
+            if ((reference.size() < 64U) || (reference.count(k) != 0U))
+            {
+              CHECK_EQUAL(reference.count(k) == 0U, map.insert_or_assign(k, i));
+              reference[k] = i;
+            }
+            break;
+          }
+
+          case 1:
+          {
+            CHECK_EQUAL(reference.erase(k), map.erase(k));
+            break;
+          }
+
+          default:
+          {
+            int        value = -1;
+            const bool found = map.find(k, value);
+
+            CHECK_EQUAL(reference.count(k) != 0U, found);
+
+            if (found)
+            {
+              CHECK_EQUAL(reference[k], value);
+            }
+            break;
+          }
+        }
+
+        CHECK_EQUAL(reference.size(), map.size());
+      }
+
+      std::vector<std::pair<int, int>> values;
+      map.snapshot(std::back_inserter(values));
+      std::sort(values.begin(), values.end());
+
+      const std::vector<std::pair<int, int>> expected(reference.begin(), reference.end());
+      CHECK(expected == values);
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      typedef etl::concurrent_unordered_map<int, int, 512, 8> Shared;
+
+      const int Threads         = 8;
+      const int Keys_Per_Thread = 32;
+      const int Updates         = 2000;
+
+      Shared                   map;
+      std::vector<std::thread> threads;
+      std::atomic<bool>        done(false);
+
+      // Every thread owns some keys, and all of them update key 0.
+      for (int i = 0; i < (Threads * Keys_Per_Thread); ++i)
+      {
+        map.insert_or_assign(i, 0);
+      }
+
+      // Takes snapshots while the map changes. Each must hold all of the
+      // owned keys and no more than one churned key per thread.
+      std::thread observer(
+        [&]()
+        {
+          while (!done.load())
+          {
+            std::vector<std::pair<int, int>> values;
+            map.snapshot(std::back_inserter(values));
+
+            if ((values.size() < 256U) || (values.size() > 264U))
+            {
+              CHECK(false);
+            }
+          }
+        });
+
+      for (int t = 0; t < Threads; ++t)
+      {
+        threads.push_back(std::thread(
+          [&, t]()
+          {
+            map.insert_or_assign(1000 + t, 0);
+
+            for (int i = 0; i < Updates; ++i)
+            {
+              map.update((t * Keys_Per_Thread) + (i % Keys_Per_Thread), [](int& value) { ++value; });
+              map.update(0, [](int& value) { ++value; });
+
+              // Churn a key to exercise the free list.
+              map.erase(1000 + t);
+              map.insert_or_assign(1000 + t, i);
+            }
+          }));
+      }
+
+      for (size_t i = 0U; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      done.store(true);
+      observer.join();
+
+      CHECK_EQUAL(size_t((Threads * Keys_Per_Thread) + Threads), map.size());
+
+      int value = 0;
+
+      // Key 0 was updated by its owner and by every thread.
+      CHECK(map.find(0, value));
+      CHECK_EQUAL((Updates / Keys_Per_Thread) + 1 + (Threads * Updates), value);
+
+      for (int t = 0; t < Threads; ++t)
+      {
+        for (int i = 1; i < Keys_Per_Thread; ++i)
+        {
+          const int expected = (Updates / Keys_Per_Thread) + (((Updates % Keys_Per_Thread) > i) ? 1 : 0);
+
+          CHECK(map.find((t * Keys_Per_Thread) + i, value));
+          CHECK_EQUAL(expected, value);
+        }
+
+        CHECK(map.find(1000 + t, value));
+        CHECK_EQUAL(Updates - 1, value);
+      }
+    }
+  }
+} // namespace
+
+#endif
@@ -0,0 +1,350 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+// Built as its own executable with ETL_CONTAINER_STATISTICS defined, as the
+// profile changes the layout of the instrumented containers.
+#if defined(ETL_CONTAINER_STATISTICS)
+
+#include "etl/container_statistics.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/message.h"
+#include "etl/pool.h"
+#include "etl/queue.h"
+#include "etl/queue_spsc_atomic.h"
+#include "etl/reference_counted_message_pool.h"
+#include "etl/unordered_map.h"
+#include "etl/vector.h"
+
+#include <string.h>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  //***************************************************************************
+  struct Message : public etl::message<1>
+  {
+  };
+
+  //***************************************************************************
+  struct find_by_name
+  {
+    find_by_name(const char* name_)
+      : name(name_)
+      , found(ETL_NULLPTR)
+    {
+    }
+
+    void operator()(etl::container_statistics& statistics)
+    {
+      if ((statistics.name() != ETL_NULLPTR) && (strcmp(statistics.name(), name) == 0))
+      {
+        found = &statistics;
+      }
+    }
+
+    const char*                name;
+    etl::container_statistics* found;
+  };
+
+  SUITE(test_container_statistics)
+  {
+    //*************************************************************************
+    TEST(test_vector_high_water_mark_and_rejections)
+    {
+      etl::vector<int, 4> data;
+
+      CHECK_EQUAL(std::string("vector"), std::string(data.statistics().type_name()));
+      CHECK_EQUAL(4U, data.statistics().capacity());
+      CHECK_EQUAL(0U, data.statistics().high_water_mark());
+
+      data.push_back(1);
+      data.push_back(2);
+      data.push_back(3);
+      data.pop_back();
+      data.pop_back();
+      CHECK_EQUAL(3U, data.statistics().high_water_mark());
+
+      data.resize(4U);
+      CHECK_EQUAL(4U, data.statistics().high_water_mark());
+      CHECK_EQUAL(0U, data.statistics().rejections());
+
+      CHECK_THROW(data.push_back(5), etl::vector_full);
+      CHECK_THROW(data.insert(data.begin(), 5), etl::vector_full);
+      CHECK_EQUAL(2U, data.statistics().rejections());
+
+      data.clear();
+      CHECK_EQUAL(4U, data.statistics().high_water_mark());
+
+      data.statistics().reset();
+      CHECK_EQUAL(0U, data.statistics().high_water_mark());
+      CHECK_EQUAL(0U, data.statistics().rejections());
+    }
+
+    //*************************************************************************
+    TEST(test_pool_high_water_mark_and_rejections)
+    {
+      etl::pool<int, 3> pool;
+
+      CHECK_EQUAL(std::string("pool"), std::string(pool.statistics().type_name()));
+      CHECK_EQUAL(3U, pool.statistics().capacity());
+
+      int* p1 = pool.allocate();
+      int* p2 = pool.allocate();
+      pool.release(p1);
+      int* p3 = pool.allocate();
+      int* p4 = pool.allocate();
+      CHECK_EQUAL(3U, pool.statistics().high_water_mark());
+
+      CHECK_THROW(pool.allocate(), etl::pool_no_allocation);
+      CHECK_EQUAL(1U, pool.statistics().rejections());
+
+      pool.release(p2);
+      pool.release(p3);
+      pool.release(p4);
+      CHECK_EQUAL(3U, pool.statistics().high_water_mark());
+    }
+
+    //*************************************************************************
+    TEST(test_queue_high_water_mark_and_rejections)
+    {
+      etl::queue<int, 2> queue;
+
+      CHECK_EQUAL(std::string("queue"), std::string(queue.statistics().type_name()));
+      CHECK_EQUAL(2U, queue.statistics().capacity());
+
+      queue.push(1);
+      queue.pop();
+      queue.push(2);
+      CHECK_EQUAL(1U, queue.statistics().high_water_mark());
+
+      queue.push(3);
+      CHECK_EQUAL(2U, queue.statistics().high_water_mark());
+
+      CHECK_THROW(queue.push(4), etl::queue_full);
+      CHECK_EQUAL(1U, queue.statistics().rejections());
+    }
+
+    //*************************************************************************
+    TEST(test_queue_spsc_atomic_high_water_mark_and_rejections)
+    {
+      etl::queue_spsc_atomic<int, 3> queue;
+
+      CHECK_EQUAL(std::string("queue_spsc_atomic"), std::string(queue.statistics().type_name()));
+      CHECK_EQUAL(3U, queue.statistics().capacity());
+
+      CHECK(queue.push(1));
+      CHECK(queue.push(2));
+      CHECK_EQUAL(2U, queue.statistics().high_water_mark());
+
+      CHECK(queue.push(3));
+      CHECK(!queue.push(4));
+      CHECK(!queue.emplace(5));
+      CHECK_EQUAL(3U, queue.statistics().high_water_mark());
+      CHECK_EQUAL(2U, queue.statistics().rejections());
+    }
+
+    //*************************************************************************
+    TEST(test_unordered_map_probe_lengths)
+    {
+      // A single bucket, so the probe lengths are the positions in the chain.
+      etl::unordered_map<int, int, 4, 1> map;
+
+      CHECK_EQUAL(std::string("unordered_map"), std::string(map.statistics().type_name()));
+      CHECK_EQUAL(4U, map.statistics().capacity());
+
+      map.insert(etl::make_pair(0, 0)); // Compares 0 nodes
+      map.insert(etl::make_pair(1, 1)); // Compares 1 node
+      map.insert(etl::make_pair(2, 2)); // Compares 2 nodes
+      CHECK_EQUAL(3U, map.statistics().high_water_mark());
+      CHECK_EQUAL(3U, map.statistics().probe_count());
+      CHECK_EQUAL(3U, map.statistics().probe_length_total());
+      CHECK_EQUAL(2U, map.statistics().probe_length_max());
+
+      map.find(1); // Found at the second node
+      CHECK_EQUAL(4U, map.statistics().probe_count());
+      CHECK_EQUAL(5U, map.statistics().probe_length_total());
+      CHECK_EQUAL(2U, map.statistics().probe_length_max());
+
+      map.find(7); // Compares the whole chain
+      CHECK_EQUAL(5U, map.statistics().probe_count());
+      CHECK_EQUAL(8U, map.statistics().probe_length_total());
+      CHECK_EQUAL(3U, map.statistics().probe_length_max());
+
+      CHECK_EQUAL(1U, map.statistics().probe_histogram(0));
+      CHECK_EQUAL(1U, map.statistics().probe_histogram(1));
+      CHECK_EQUAL(2U, map.statistics().probe_histogram(2));
+      CHECK_EQUAL(1U, map.statistics().probe_histogram(3));
+      CHECK_EQUAL(0U, map.statistics().probe_histogram(etl::container_statistics::Probe_Histogram_Size));
+
+      // Const lookups do not write to the statistics.
+      const etl::unordered_map<int, int, 4, 1>& cmap = map;
+      cmap.find(2);
+      CHECK_EQUAL(5U, cmap.statistics().probe_count());
+
+      map.insert(etl::make_pair(3, 3));
+      CHECK_THROW(map.insert(etl::make_pair(4, 4)), etl::unordered_map_full);
+      CHECK_EQUAL(1U, map.statistics().rejections());
+
+      // An existing key does not need a node, so it is not a rejection.
+      CHECK_THROW(map.insert(etl::make_pair(3, 30)), etl::unordered_map_full);
+      CHECK_EQUAL(1U, map.statistics().rejections());
+    }
+
+    //*************************************************************************
+    TEST(test_message_pool_high_water_mark_and_rejections)
+    {
+      typedef etl::reference_counted_message_pool<int>                                                                        Message_Pool;
+      typedef etl::reference_counted_message<Message, int>                                                                    Counted_Message;
+      typedef etl::fixed_sized_memory_block_allocator<sizeof(Counted_Message), etl::alignment_of<Counted_Message>::value, 2U> Allocator;
+
+      Allocator    allocator;
+      Message_Pool message_pool(allocator);
+
+      CHECK_EQUAL(std::string("fixed_sized_memory_block_allocator"), std::string(allocator.statistics().type_name()));
+      CHECK_EQUAL(2U, allocator.statistics().capacity());
+
+      Counted_Message* p1 = message_pool.allocate<Message>();
+      Counted_Message* p2 = message_pool.allocate<Message>();
+      CHECK_EQUAL(2U, allocator.statistics().high_water_mark());
+      CHECK_EQUAL(0U, allocator.statistics().rejections());
+
+      CHECK_THROW(message_pool.allocate<Message>(), etl::reference_counted_message_pool_allocation_failure);
+      CHECK_EQUAL(1U, allocator.statistics().rejections());
+
+      message_pool.release(*p1);
+      message_pool.release(*p2);
+      CHECK_EQUAL(2U, allocator.statistics().high_water_mark());
+    }
+
+    //*************************************************************************
+    TEST(test_probe_histogram_overflow_bin)
+    {
+      etl::container_statistics statistics;
+
+      const size_t last_bin = etl::container_statistics::Probe_Histogram_Size - 1U;
+
+      statistics.record_probe(last_bin - 1U);
+      statistics.record_probe(last_bin);
+      statistics.record_probe(last_bin + 10U);
+
+      CHECK_EQUAL(1U, statistics.probe_histogram(last_bin - 1U));
+      CHECK_EQUAL(2U, statistics.probe_histogram(last_bin));
+      CHECK_EQUAL(last_bin + 10U, statistics.probe_length_max());
+    }
+
+    //*************************************************************************
+    TEST(test_registry)
+    {
+      const size_t initial_size = etl::container_statistics_registry::size();
+
+      {
+        etl::vector<int, 4> vector1;
+        etl::vector<int, 4> vector2;
+        vector1.statistics().set_name("vector1");
+        vector2.statistics().set_name("vector2");
+
+        CHECK_EQUAL(initial_size + 2U, etl::container_statistics_registry::size());
+
+        vector1.push_back(1);
+        vector2.push_back(1);
+        vector2.push_back(2);
+
+        find_by_name finder = etl::container_statistics_registry::for_each(find_by_name("vector2"));
+        CHECK(finder.found == &vector2.statistics());
+        CHECK_EQUAL(2U, finder.found->high_water_mark());
+
+        etl::container_statistics_registry::reset_all();
+        CHECK_EQUAL(0U, vector1.statistics().high_water_mark());
+        CHECK_EQUAL(0U, vector2.statistics().high_water_mark());
+      }
+
+      CHECK_EQUAL(initial_size, etl::container_statistics_registry::size());
+
+      find_by_name finder = etl::container_statistics_registry::for_each(find_by_name("vector2"));
+      CHECK(finder.found == ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    TEST(test_registry_with_threads)
+    {
+      const size_t initial_size = etl::container_statistics_registry::size();
+
+      std::vector<std::thread> threads;
+
+      for (int t = 0; t < 4; ++t)
+      {
+        threads.push_back(std::thread([]()
+        {
+          for (int i = 0; i < 1000; ++i)
+          {
+            etl::vector<int, 4> vector1;
+            etl::queue<int, 4>  queue1;
+            vector1.push_back(i);
+            queue1.push(i);
+          }
+        }));
+      }
+
+      for (size_t t = 0; t < threads.size(); ++t)
+      {
+        threads[t].join();
+      }
+
+      CHECK_EQUAL(initial_size, etl::container_statistics_registry::size());
+    }
+
+    //*************************************************************************
+    TEST(test_copies_have_their_own_statistics)
+    {
+      etl::vector<int, 4> vector1;
+      vector1.statistics().set_name("vector1");
+      vector1.push_back(1);
+      vector1.push_back(2);
+      CHECK_THROW(vector1.resize(5U), etl::vector_full);
+
+      etl::vector<int, 4> vector2(vector1);
+
+      CHECK(vector2.statistics().name() == ETL_NULLPTR);
+      CHECK_EQUAL(2U, vector2.statistics().high_water_mark());
+      CHECK_EQUAL(0U, vector2.statistics().rejections());
+
+      vector2.push_back(3);
+      vector1 = vector2;
+
+      CHECK_EQUAL(std::string("vector1"), std::string(vector1.statistics().name()));
+      CHECK_EQUAL(3U, vector1.statistics().high_water_mark());
+      CHECK_EQUAL(1U, vector1.statistics().rejections());
+    }
+  }
+} // namespace
+
+#endif
@@ -0,0 +1,186 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/count_min_sketch.h"
+
+#include <map>
+#include <random>
+#include <stdint.h>
+
+namespace
+{
+  typedef etl::count_min_sketch<1024, 4> Sketch;
+
+  SUITE(test_count_min_sketch)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Sketch sketch;
+
+      CHECK_EQUAL(1024U, sketch.width());
+      CHECK_EQUAL(4U, sketch.depth());
+      CHECK_EQUAL(0U, sketch.total());
+      CHECK_EQUAL(0U, sketch.estimate(42));
+    }
+
+    //*************************************************************************
+    TEST(test_add_and_estimate)
+    {
+      Sketch sketch;
+
+      CHECK_EQUAL(1U, sketch.add(1));
+      CHECK_EQUAL(2U, sketch.add(1));
+      CHECK_EQUAL(12U, sketch.add(1, 10U));
+      CHECK_EQUAL(5U, sketch.add(2, 5U));
+
+      CHECK_EQUAL(12U, sketch.estimate(1));
+      CHECK_EQUAL(5U, sketch.estimate(2));
+      CHECK_EQUAL(0U, sketch.estimate(3));
+      CHECK_EQUAL(17U, sketch.total());
+
+      sketch.clear();
+      CHECK_EQUAL(0U, sketch.estimate(1));
+      CHECK_EQUAL(0U, sketch.total());
+    }
+
+    //*************************************************************************
+    TEST(test_never_underestimates)
+    {
+      // A small sketch, so that there are plenty of collisions.
+      etl::count_min_sketch<64, 3> sketch;
+      std::map<uint32_t, uint32_t> actual;
+
+      std::mt19937                            generator(42);
+      std::uniform_int_distribution<uint32_t> key(0U, 999U);
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        const uint32_t k = key(generator);
+
+        sketch.add(k);
+        ++actual[k];
+      }
+
+      for (std::map<uint32_t, uint32_t>::const_iterator itr = actual.begin(); itr != actual.end(); ++itr)
+      {
+        CHECK(sketch.estimate(itr->first) >= itr->second);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_conservative_update_accuracy)
+    {
+      // Zipf-like stream: key k occurs about 10000 / (k + 1) times.
+      Sketch                       sketch;
+      std::map<uint32_t, uint32_t> actual;
+      uint64_t                     total = 0U;
+
+      for (uint32_t k = 0U; k < 2000U; ++k)
+      {
+        const uint32_t n = 10000U / (k + 1U);
+
+        for (uint32_t i = 0U; i < n; ++i)
+        {
+          sketch.add(k);
+        }
+
+        actual[k] = n;
+        total += n;
+      }
+
+      CHECK_EQUAL(total, sketch.total());
+
+      // The bound is e / Width of the total, with high probability.
+      const double bound    = (2.718281828 / 1024.0) * static_cast<double>(total);
+      size_t       outliers = 0U;
+
+      for (std::map<uint32_t, uint32_t>::const_iterator itr = actual.begin(); itr != actual.end(); ++itr)
+      {
+        if (static_cast<double>(sketch.estimate(itr->first) - itr->second) > bound)
+        {
+          ++outliers;
+        }
+      }
+
+      CHECK(outliers < 20U);
+
+      // The heaviest keys are close to exact.
+      CHECK_EQUAL(10000U, sketch.estimate(0U));
+      CHECK(sketch.estimate(1U) < 5050U);
+    }
+
+    //*************************************************************************
+    TEST(test_merge)
+    {
+      Sketch a;
+      Sketch b;
+
+      a.add(1, 3U);
+      a.add(2, 4U);
+      b.add(1, 5U);
+      b.add(3, 6U);
+
+      a.merge(b);
+
+      CHECK_EQUAL(8U, a.estimate(1));
+      CHECK_EQUAL(4U, a.estimate(2));
+      CHECK_EQUAL(6U, a.estimate(3));
+      CHECK_EQUAL(18U, a.total());
+    }
+
+    //*************************************************************************
+    TEST(test_saturation)
+    {
+      etl::count_min_sketch<16, 2, uint8_t> sketch;
+
+      sketch.add(7, 200U);
+      CHECK_EQUAL(255U, sketch.add(7, 100U));
+      CHECK_EQUAL(255U, sketch.estimate(7));
+
+      etl::count_min_sketch<16, 2, uint8_t> other;
+      other.add(7, 10U);
+      sketch.merge(other);
+      CHECK_EQUAL(255U, sketch.estimate(7));
+    }
+
+    //*************************************************************************
+    TEST(test_add_hash)
+    {
+      Sketch sketch;
+
+      sketch.add_hash(0x123456789ABCDEF0ULL, 3U);
+
+      CHECK_EQUAL(3U, sketch.estimate_hash(0x123456789ABCDEF0ULL));
+      CHECK_EQUAL(0U, sketch.estimate_hash(0x0FEDCBA987654321ULL));
+    }
+  }
+} // namespace
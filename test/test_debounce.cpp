@@ -30,6 +30,8 @@ SOFTWARE.
 
 #include "etl/debounce.h"
 
+#include <random>
+
 namespace
 {
   SUITE(test_debounce)
@@ -875,5 +877,102 @@ namespace
       CHECK(key_state.add(false));
       CHECK(!key_state.is_set());
     }
+    //*************************************************************************
+    TEST(test_debounce_bank_transitions)
+    {
+      etl::debounce_bank<32, 3> bank;
+
+      CHECK_EQUAL(2U, (etl::debounce_bank<32, 3>::Counter_Bits));
+      CHECK_EQUAL(0U, bank.get_state());
+
+      // Channel 0 steady, channel 1 bouncing.
+      CHECK_EQUAL(0U, bank.add(0x1U));
+      CHECK_EQUAL(0U, bank.add(0x3U));
+      CHECK_EQUAL(0x1U, bank.add(0x1U));
+      CHECK(bank.is_set(0));
+      CHECK(bank.has_changed(0));
+      CHECK(!bank.is_set(1));
+
+      CHECK_EQUAL(0U, bank.add(0x3U));
+      CHECK(!bank.has_changed(0));
+      CHECK_EQUAL(0U, bank.add(0x3U));
+      CHECK_EQUAL(0x2U, bank.add(0x3U));
+      CHECK_EQUAL(0x3U, bank.get_state());
+
+      // Both clear together.
+      CHECK_EQUAL(0U, bank.add(0x0U));
+      CHECK_EQUAL(0U, bank.add(0x0U));
+      CHECK_EQUAL(0x3U, bank.add(0x0U));
+      CHECK_EQUAL(0x3U, bank.get_change());
+      CHECK_EQUAL(0U, bank.get_state());
+    }
+
+    //*************************************************************************
+    TEST(test_debounce_bank_initial_state)
+    {
+      etl::debounce_bank<8, 2> bank(0xFFU);
+
+      CHECK_EQUAL(0xFFU, bank.get_state());
+      CHECK_EQUAL(0U, bank.add(0x0FU));
+      CHECK_EQUAL(0xF0U, bank.add(0x0FU));
+      CHECK_EQUAL(0x0FU, bank.get_state());
+
+      bank.clear(0x01U);
+      CHECK_EQUAL(0x01U, bank.get_state());
+      CHECK_EQUAL(0U, bank.get_change());
+    }
+
+    //*************************************************************************
+    template <size_t Width, uint16_t Valid_Count>
+    void debounce_bank_matches_debounce(uint64_t initial, int bounce_percent)
+    {
+      typedef etl::debounce_bank<Width, Valid_Count> bank_t;
+      typedef typename bank_t::value_type            value_type;
+
+      bank_t                           bank(static_cast<value_type>(initial));
+      etl::debounce<Valid_Count, 0, 0> channels[Width];
+
+      for (size_t c = 0U; c < Width; ++c)
+      {
+        channels[c] = etl::debounce<Valid_Count, 0, 0>(((initial >> c) & 1U) != 0U);
+      }
+
+      std::mt19937                       generator(static_cast<std::mt19937::result_type>(Width * 1000U + Valid_Count));
+      std::uniform_int_distribution<int> percent(0, 99);
+
+      value_type samples = 0U;
+
+      for (int tick = 0; tick < 5000; ++tick)
+      {
+        // Each channel either holds or toggles.
+        for (size_t c = 0U; c < Width; ++c)
+        {
+          if (percent(generator) < bounce_percent)
+          {
+            samples = static_cast<value_type>(samples ^ (value_type(1U) << c));
+          }
+        }
+
+        const value_type change = bank.add(samples);
+
+        for (size_t c = 0U; c < Width; ++c)
+        {
+          const bool changed = channels[c].add(((samples >> c) & 1U) != 0U);
+
+          CHECK_EQUAL(changed, ((change >> c) & 1U) != 0U);
+          CHECK_EQUAL(channels[c].is_set(), bank.is_set(c));
+        }
+      }
+    }
+
+    TEST(test_debounce_bank_matches_debounce)
+    {
+      debounce_bank_matches_debounce<32, 1>(0U, 30);
+      debounce_bank_matches_debounce<32, 4>(0x0F0F0F0FULL, 20);
+      debounce_bank_matches_debounce<64, 5>(0xFFFFFFFF00000000ULL, 15);
+      debounce_bank_matches_debounce<64, 8>(0U, 5);
+      debounce_bank_matches_debounce<16, 300>(0x00FFU, 1);
+      debounce_bank_matches_debounce<7, 2>(0x55U, 40);
+    }
   }
 } // namespace
@@ -0,0 +1,310 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/fast_math.h"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+  //***************************************************************************
+  /// The error of 'actual' in units of the last place of 'expected', when
+  /// rounded to float.
+  //***************************************************************************
+  double ulp_error(float actual, double expected)
+  {
+    int exponent;
+    std::frexp(static_cast<float>(expected), &exponent);
+
+    return std::fabs(double(actual) - expected) / std::ldexp(1.0, exponent - std::numeric_limits<float>::digits);
+  }
+
+  //***************************************************************************
+  std::vector<float> random_values(float lowest, float highest, size_t n, unsigned seed)
+  {
+    std::mt19937                          generator(seed);
+    std::uniform_real_distribution<float> distribution(lowest, highest);
+
+    std::vector<float> values(n);
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      values[i] = distribution(generator);
+    }
+
+    return values;
+  }
+
+  //***************************************************************************
+  /// Positive normal values, spread evenly over the exponents.
+  //***************************************************************************
+  std::vector<float> random_positive_values(size_t n, unsigned seed)
+  {
+    std::mt19937                          generator(seed);
+    std::uniform_real_distribution<float> mantissa(1.0f, 2.0f);
+    std::uniform_int_distribution<int>    exponent(-126, 127);
+
+    std::vector<float> values(n);
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      values[i] = std::ldexp(mantissa(generator), exponent(generator));
+    }
+
+    return values;
+  }
+
+  //***************************************************************************
+  template <typename TApproximation, typename TExact>
+  double max_ulp_error(const std::vector<float>& values, TApproximation approximation, TExact exact)
+  {
+    double result = 0.0;
+
+    for (size_t i = 0U; i < values.size(); ++i)
+    {
+      result = std::max(result, ulp_error(approximation(values[i]), exact(double(values[i]))));
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  template <typename TApproximation, typename TExact>
+  double max_absolute_error(const std::vector<float>& values, TApproximation approximation, TExact exact)
+  {
+    double result = 0.0;
+
+    for (size_t i = 0U; i < values.size(); ++i)
+    {
+      result = std::max(result, std::fabs(double(approximation(values[i])) - exact(double(values[i]))));
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  template <typename TApproximation, typename TExact>
+  double max_relative_error(const std::vector<float>& values, TApproximation approximation, TExact exact)
+  {
+    double result = 0.0;
+
+    for (size_t i = 0U; i < values.size(); ++i)
+    {
+      const double expected = exact(double(values[i]));
+
+      result = std::max(result, std::fabs(double(approximation(values[i])) - expected) / std::fabs(expected));
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Applies a span function and returns the results.
+  //***************************************************************************
+  template <typename TFunction>
+  std::vector<float> batch(const std::vector<float>& values, TFunction function)
+  {
+    std::vector<float> output(values.size());
+
+    CHECK_EQUAL(values.size(), function(etl::span<const float>(values.data(), values.size()), etl::span<float>(output.data(), output.size())));
+
+    return output;
+  }
+
+  SUITE(test_fast_math)
+  {
+    //*************************************************************************
+    TEST(test_log2)
+    {
+      const std::vector<float> values = random_positive_values(200000U, 1U);
+      const std::vector<float> near_1 = random_values(0.5f, 2.0f, 200000U, 2U);
+
+      double (*exact)(double) = std::log2;
+
+      CHECK(max_ulp_error(values, static_cast<float (*)(float)>(etl::fast_math::log2), exact) <= 4.0);
+      CHECK(max_ulp_error(near_1, static_cast<float (*)(float)>(etl::fast_math::log2), exact) <= 4.0);
+
+      // Powers of two are exact.
+      CHECK_EQUAL(0.0f, etl::fast_math::log2(1.0f));
+      CHECK_EQUAL(3.0f, etl::fast_math::log2(8.0f));
+      CHECK_EQUAL(-126.0f, etl::fast_math::log2(std::numeric_limits<float>::min()));
+    }
+
+    //*************************************************************************
+    TEST(test_exp2)
+    {
+      const std::vector<float> values = random_values(-126.0f, 128.0f, 200000U, 3U);
+      const std::vector<float> near_0 = random_values(-1.0f, 1.0f, 200000U, 4U);
+
+      double (*exact)(double) = std::exp2;
+
+      CHECK(max_ulp_error(values, static_cast<float (*)(float)>(etl::fast_math::exp2), exact) <= 2.0);
+      CHECK(max_ulp_error(near_0, static_cast<float (*)(float)>(etl::fast_math::exp2), exact) <= 2.0);
+
+      // Integers are exact.
+      CHECK_EQUAL(1.0f, etl::fast_math::exp2(0.0f));
+      CHECK_EQUAL(0.125f, etl::fast_math::exp2(-3.0f));
+      CHECK_EQUAL(std::ldexp(1.0f, 127), etl::fast_math::exp2(127.0f));
+
+      // Saturates.
+      CHECK_EQUAL(std::numeric_limits<float>::min(), etl::fast_math::exp2(-1000.0f));
+      CHECK(etl::fast_math::exp2(1000.0f) > std::numeric_limits<float>::max());
+    }
+
+    //*************************************************************************
+    TEST(test_pow)
+    {
+      const std::vector<float> values = random_values(0.001f, 100.0f, 200000U, 5U);
+
+      const float exponents[] = {2.2f, 1.0f / 2.2f, -0.5f, 3.0f};
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        const float y = exponents[i];
+
+        double error = 0.0;
+
+        for (size_t j = 0U; j < values.size(); ++j)
+        {
+          const float  x        = values[j];
+          const double expected = std::pow(double(x), double(y));
+          const double bound    = 2.4e-7 * (1.0 + std::fabs(double(y) * std::log2(double(x))));
+
+          error = std::max(error, (std::fabs(double(etl::fast_math::pow(x, y)) - expected) / expected) / bound);
+        }
+
+        CHECK(error <= 1.0);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_inv_sqrt)
+    {
+      const std::vector<float> values = random_positive_values(200000U, 6U);
+
+      CHECK(max_relative_error(values, static_cast<float (*)(float)>(etl::fast_math::inv_sqrt), [](double x) { return 1.0 / std::sqrt(x); }) <= 5e-6);
+    }
+
+    //*************************************************************************
+    TEST(test_atan2)
+    {
+      const std::vector<float> y = random_values(-1000.0f, 1000.0f, 200000U, 7U);
+      const std::vector<float> x = random_values(-1000.0f, 1000.0f, 200000U, 8U);
+
+      double error = 0.0;
+
+      for (size_t i = 0U; i < y.size(); ++i)
+      {
+        // Some nearly on the x axis.
+        const float yi = ((i % 3U) == 0U) ? y[i] * 1e-4f : y[i];
+
+        error = std::max(error, std::fabs(double(etl::fast_math::atan2(yi, x[i])) - std::atan2(double(yi), double(x[i]))));
+      }
+
+      CHECK(error <= 4e-7);
+
+      CHECK_CLOSE(0.0f, etl::fast_math::atan2(0.0f, 1.0f), 0.0f);
+      CHECK_CLOSE(0.0f, etl::fast_math::atan2(0.0f, 0.0f), 0.0f);
+      CHECK_CLOSE(3.14159265f, etl::fast_math::atan2(0.0f, -1.0f), 4e-7f);
+      CHECK_CLOSE(-3.14159265f, etl::fast_math::atan2(-0.0f, -1.0f), 4e-7f);
+      CHECK_CLOSE(1.57079633f, etl::fast_math::atan2(1.0f, 0.0f), 4e-7f);
+      CHECK_CLOSE(-1.57079633f, etl::fast_math::atan2(-1.0f, 0.0f), 4e-7f);
+      CHECK_CLOSE(-2.35619449f, etl::fast_math::atan2(-1.0f, -1.0f), 4e-7f);
+    }
+
+    //*************************************************************************
+    TEST(test_sin_cos)
+    {
+      const std::vector<float> values = random_values(-16384.0f, 16384.0f, 200000U, 9U);
+      const std::vector<float> small  = random_values(-10.0f, 10.0f, 200000U, 10U);
+
+      double (*exact_sin)(double) = std::sin;
+      double (*exact_cos)(double) = std::cos;
+
+      CHECK(max_absolute_error(values, static_cast<float (*)(float)>(etl::fast_math::sin), exact_sin) <= 4e-7);
+      CHECK(max_absolute_error(small, static_cast<float (*)(float)>(etl::fast_math::sin), exact_sin) <= 4e-7);
+      CHECK(max_absolute_error(values, static_cast<float (*)(float)>(etl::fast_math::cos), exact_cos) <= 4e-7);
+      CHECK(max_absolute_error(small, static_cast<float (*)(float)>(etl::fast_math::cos), exact_cos) <= 4e-7);
+
+      CHECK_EQUAL(0.0f, etl::fast_math::sin(0.0f));
+      CHECK_EQUAL(1.0f, etl::fast_math::cos(0.0f));
+    }
+
+    //*************************************************************************
+    TEST(test_span)
+    {
+      const std::vector<float> positive = random_positive_values(1003U, 11U);
+      const std::vector<float> angles   = random_values(-100.0f, 100.0f, 1003U, 12U);
+      const std::vector<float> powers   = random_values(-126.0f, 128.0f, 1003U, 13U);
+
+      size_t (*log2)(etl::span<const float>, etl::span<float>)     = etl::fast_math::log2;
+      size_t (*exp2)(etl::span<const float>, etl::span<float>)     = etl::fast_math::exp2;
+      size_t (*inv_sqrt)(etl::span<const float>, etl::span<float>) = etl::fast_math::inv_sqrt;
+      size_t (*sin)(etl::span<const float>, etl::span<float>)      = etl::fast_math::sin;
+      size_t (*cos)(etl::span<const float>, etl::span<float>)      = etl::fast_math::cos;
+
+      const std::vector<float> log2_output     = batch(positive, log2);
+      const std::vector<float> exp2_output     = batch(powers, exp2);
+      const std::vector<float> inv_sqrt_output = batch(positive, inv_sqrt);
+      const std::vector<float> sin_output      = batch(angles, sin);
+      const std::vector<float> cos_output      = batch(angles, cos);
+
+      std::vector<float> pow_output(positive.size());
+      CHECK_EQUAL(positive.size(), etl::fast_math::pow(positive, 0.5f, pow_output));
+
+      std::vector<float> atan2_output(angles.size() - 1U);
+      CHECK_EQUAL(angles.size() - 1U, etl::fast_math::atan2(angles, powers, atan2_output));
+
+      for (size_t i = 0U; i < positive.size(); ++i)
+      {
+        CHECK(ulp_error(log2_output[i], std::log2(double(positive[i]))) <= 4.0);
+        CHECK(ulp_error(exp2_output[i], std::exp2(double(powers[i]))) <= 2.0);
+        CHECK(std::fabs(inv_sqrt_output[i] * std::sqrt(double(positive[i])) - 1.0) <= 5e-6);
+        CHECK(std::fabs(pow_output[i] / std::sqrt(double(positive[i])) - 1.0) <= 2.4e-7 * (1.0 + std::fabs(0.5 * std::log2(double(positive[i])))));
+        CHECK(std::fabs(sin_output[i] - std::sin(double(angles[i]))) <= 4e-7);
+        CHECK(std::fabs(cos_output[i] - std::cos(double(angles[i]))) <= 4e-7);
+      }
+
+      for (size_t i = 0U; i < atan2_output.size(); ++i)
+      {
+        CHECK(std::fabs(atan2_output[i] - std::atan2(double(angles[i]), double(powers[i]))) <= 4e-7);
+      }
+
+      // In place.
+      std::vector<float> values(positive);
+      etl::fast_math::log2(values, values);
+      CHECK(values == log2_output);
+    }
+  }
+} // namespace
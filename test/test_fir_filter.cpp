@@ -0,0 +1,275 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/fir_filter.h"
+
+#include <random>
+#include <vector>
+
+namespace
+{
+  //***************************************************************************
+  std::vector<double> random_values(size_t n, double amplitude, unsigned seed)
+  {
+    std::mt19937                           generator(seed);
+    std::uniform_real_distribution<double> distribution(-amplitude, amplitude);
+
+    std::vector<double> values(n);
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      values[i] = distribution(generator);
+    }
+
+    return values;
+  }
+
+  //***************************************************************************
+  /// Direct convolution.
+  //***************************************************************************
+  template <typename T, typename TAccumulator>
+  std::vector<TAccumulator> convolve(const std::vector<T>& h, const std::vector<T>& x)
+  {
+    std::vector<TAccumulator> y(x.size(), TAccumulator(0));
+
+    for (size_t n = 0U; n < x.size(); ++n)
+    {
+      for (size_t k = 0U; (k < h.size()) && (k <= n); ++k)
+      {
+        y[n] += TAccumulator(h[k]) * TAccumulator(x[n - k]);
+      }
+    }
+
+    return y;
+  }
+
+  //***************************************************************************
+  /// Rounds and saturates a fixed point accumulator.
+  //***************************************************************************
+  template <typename T>
+  T to_fixed(int64_t value, int shift)
+  {
+    value = (value + (int64_t(1) << (shift - 1))) >> shift;
+
+    if (value > int64_t(std::numeric_limits<T>::max()))
+    {
+      return std::numeric_limits<T>::max();
+    }
+
+    if (value < int64_t(std::numeric_limits<T>::min()))
+    {
+      return std::numeric_limits<T>::min();
+    }
+
+    return T(value);
+  }
+
+  //***************************************************************************
+  template <typename T, size_t Taps>
+  void check_floating_point(double tolerance, unsigned seed)
+  {
+    const std::vector<double> hd = random_values(Taps, 1.0, seed);
+    const std::vector<double> xd = random_values(500U, 1.0, seed + 1U);
+
+    std::vector<T> h(hd.begin(), hd.end());
+    std::vector<T> x(xd.begin(), xd.end());
+
+    const std::vector<double> expected = convolve<T, double>(h, x);
+
+    etl::fir_filter<T, Taps> filter(h.data());
+
+    // Sample by sample for the first half, then as a block.
+    std::vector<T> y(x.size());
+
+    for (size_t i = 0U; i < (x.size() / 2U); ++i)
+    {
+      y[i] = filter(x[i]);
+    }
+
+    const size_t rest = x.size() - (x.size() / 2U);
+    CHECK_EQUAL(rest, filter.apply(etl::span<const T>(&x[x.size() / 2U], rest), etl::span<T>(&y[x.size() / 2U], rest)));
+
+    for (size_t i = 0U; i < x.size(); ++i)
+    {
+      CHECK_CLOSE(expected[i], double(y[i]), tolerance);
+    }
+  }
+
+  //***************************************************************************
+  template <typename T, size_t Taps>
+  void check_fixed_point(unsigned seed)
+  {
+    const int Shift = std::numeric_limits<T>::digits;
+
+    const std::vector<double> hd = random_values(Taps, 1.0 / double(Taps), seed);
+    const std::vector<double> xd = random_values(500U, 1.0, seed + 1U);
+
+    std::vector<T> h(Taps);
+    std::vector<T> x(xd.size());
+
+    for (size_t i = 0U; i < h.size(); ++i)
+    {
+      h[i] = etl::fir_filter<T, Taps>::coefficient(hd[i]);
+    }
+
+    for (size_t i = 0U; i < x.size(); ++i)
+    {
+      x[i] = etl::fir_filter<T, Taps>::coefficient(xd[i]);
+    }
+
+    const std::vector<int64_t> expected = convolve<T, int64_t>(h, x);
+
+    etl::fir_filter<T, Taps> filter(h.data());
+
+    std::vector<T> y(x);
+    CHECK_EQUAL(y.size(), filter.apply(y, y));
+
+    bool exact = true;
+
+    for (size_t i = 0U; i < x.size(); ++i)
+    {
+      exact = exact && (to_fixed<T>(expected[i], Shift) == y[i]);
+    }
+
+    CHECK(exact);
+  }
+
+  SUITE(test_fir_filter)
+  {
+    //*************************************************************************
+    TEST(test_impulse_response)
+    {
+      const double h[] = {0.5, 0.25, -0.125, 0.0625};
+
+      etl::fir_filter<double, 4> filter(h);
+
+      CHECK_EQUAL(4U, (etl::fir_filter<double, 4>::TAPS));
+      CHECK_EQUAL(1U, (etl::fir_filter<double, 4>::CHANNELS));
+
+      CHECK_CLOSE(0.5, filter(1.0), 0.0);
+      CHECK_CLOSE(0.25, filter(0.0), 0.0);
+      CHECK_CLOSE(-0.125, filter(0.0), 0.0);
+      CHECK_CLOSE(0.0625, filter(0.0), 0.0);
+      CHECK_CLOSE(0.0, filter(0.0), 0.0);
+
+      filter(1.0);
+      filter.reset();
+      CHECK_CLOSE(0.0, filter(0.0), 0.0);
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point)
+    {
+      check_floating_point<double, 1>(1e-12, 1U);
+      check_floating_point<double, 7>(1e-12, 2U);
+      check_floating_point<double, 33>(1e-12, 3U);
+      check_floating_point<float, 5>(1e-4, 4U);
+      check_floating_point<float, 64>(1e-4, 5U);
+    }
+
+    //*************************************************************************
+    TEST(test_fixed_point)
+    {
+      check_fixed_point<int16_t, 1>(6U);
+      check_fixed_point<int16_t, 17>(7U);
+      check_fixed_point<int16_t, 64>(8U);
+      check_fixed_point<int32_t, 9>(9U);
+      check_fixed_point<int32_t, 32>(10U);
+    }
+
+    //*************************************************************************
+    TEST(test_coefficient)
+    {
+      CHECK_EQUAL(16384, etl::fir_filter_q15<4>::coefficient(0.5));
+      CHECK_EQUAL(-16384, etl::fir_filter_q15<4>::coefficient(-0.5));
+      CHECK_EQUAL(32767, etl::fir_filter_q15<4>::coefficient(1.0));
+      CHECK_EQUAL(-32768, etl::fir_filter_q15<4>::coefficient(-1.0));
+      CHECK_EQUAL(1073741824, etl::fir_filter_q31<4>::coefficient(0.5));
+      CHECK_EQUAL(2147483647, etl::fir_filter_q31<4>::coefficient(1.0));
+      CHECK_CLOSE(0.25f, (etl::fir_filter<float, 4>::coefficient(0.25)), 0.0f);
+    }
+
+    //*************************************************************************
+    TEST(test_fixed_point_saturates)
+    {
+      const int16_t h[] = {32767, 32767};
+
+      etl::fir_filter_q15<2> filter(h);
+
+      filter(32767);
+      CHECK_EQUAL(32767, filter(32767));
+
+      filter.reset();
+      filter(-32768);
+      CHECK_EQUAL(-32768, filter(-32768));
+    }
+
+    //*************************************************************************
+    TEST(test_fixed_point_accumulator_wraps)
+    {
+      // Each product is 2^62, so the sum exceeds int64_t from the second sample.
+      const int32_t h[] = {INT32_MIN, INT32_MIN, INT32_MIN, INT32_MIN};
+
+      etl::fir_filter_q31<4> filter(h);
+
+      CHECK_EQUAL(INT32_MAX, filter(INT32_MIN)); // 2^62, saturated
+      CHECK_EQUAL(INT32_MIN, filter(INT32_MIN)); // 2^63 wraps to -2^63, saturated
+      CHECK_EQUAL(INT32_MIN, filter(INT32_MIN)); // 3 * 2^62 wraps to -2^62
+      CHECK_EQUAL(0, filter(INT32_MIN));         // 2^64 wraps to 0
+    }
+
+    //*************************************************************************
+    TEST(test_interleaved_channels)
+    {
+      const std::vector<double> hd = random_values(12U, 1.0, 11U);
+      const std::vector<double> xd = random_values(301U, 1.0, 12U);
+
+      std::vector<float> h(hd.begin(), hd.end());
+      std::vector<float> x(xd.begin(), xd.end());
+
+      etl::fir_filter<float, 12, 3> filter(h.data());
+      etl::fir_filter<float, 12>    channels[3] = {etl::fir_filter<float, 12>(h.data()), etl::fir_filter<float, 12>(h.data()),
+                                                   etl::fir_filter<float, 12>(h.data())};
+
+      // Only whole frames are processed.
+      std::vector<float> y(x.size(), 99.0f);
+      CHECK_EQUAL(300U, filter.apply(x, y));
+      CHECK_CLOSE(99.0f, y[300], 0.0f);
+
+      for (size_t i = 0U; i < 300U; ++i)
+      {
+        CHECK_CLOSE(channels[i % 3U](x[i]), y[i], 0.0f);
+      }
+
+      CHECK_THROW(filter.process(1.0f, 3U), etl::filter_channel_out_of_range);
+    }
+  }
+} // namespace
@@ -0,0 +1,241 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/hyperloglog.h"
+#include "etl/string.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  //***************************************************************************
+  // The relative error of an estimate.
+  //***************************************************************************
+  double relative_error(double estimate, double actual)
+  {
+    return fabs(estimate - actual) / actual;
+  }
+
+  SUITE(test_hyperloglog)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      etl::hyperloglog<10> hll;
+
+      CHECK(hll.empty());
+      CHECK_EQUAL(1024U, hll.size());
+      CHECK_EQUAL(1024U, (etl::hyperloglog<10>::Register_Count));
+      CHECK_CLOSE(0.0, hll.estimate(), 1e-9);
+      CHECK_CLOSE(1.04 / 32.0, hll.standard_error(), 1e-9);
+    }
+
+    //*************************************************************************
+    TEST(test_small_counts_are_exact_enough)
+    {
+      etl::hyperloglog<14> hll;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        hll.add(i);
+
+        // Duplicates make no difference.
+        hll.add(i);
+      }
+
+      CHECK(!hll.empty());
+
+      // Linear counting is very accurate while most registers are empty.
+      CHECK_CLOSE(100.0, hll.estimate(), 2.0);
+    }
+
+    //*************************************************************************
+    TEST(test_accuracy)
+    {
+      etl::hyperloglog<12> hll;
+
+      const uint32_t Counts[] = {1000U, 10000U, 100000U, 1000000U};
+      uint32_t       added    = 0U;
+
+      for (size_t c = 0U; c < (sizeof(Counts) / sizeof(Counts[0])); ++c)
+      {
+        for (; added < Counts[c]; ++added)
+        {
+          hll.add(added);
+        }
+
+        // Within four standard errors.
+        CHECK(relative_error(hll.estimate(), Counts[c]) < (4.0 * hll.standard_error()));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_strings)
+    {
+      etl::hyperloglog<10> hll;
+      etl::string<16>      text;
+
+      for (int i = 0; i < 5000; ++i)
+      {
+        text = "key";
+        text.push_back(static_cast<char>('a' + (i % 26)));
+        text.push_back(static_cast<char>('a' + ((i / 26) % 26)));
+        text.push_back(static_cast<char>('a' + ((i / 676) % 26)));
+        hll.add(text);
+      }
+
+      // 26 * 26 * 8 = 5408 possible strings, of which 5000 were made.
+      CHECK(relative_error(hll.estimate(), 5000.0) < (4.0 * hll.standard_error()));
+    }
+
+    //*************************************************************************
+    TEST(test_merge)
+    {
+      etl::hyperloglog<12> a;
+      etl::hyperloglog<12> b;
+      etl::hyperloglog<12> both;
+
+      // Overlapping ranges: 0 to 59999 and 40000 to 99999.
+      for (uint32_t i = 0U; i < 60000U; ++i)
+      {
+        a.add(i);
+        both.add(i);
+      }
+
+      for (uint32_t i = 40000U; i < 100000U; ++i)
+      {
+        b.add(i);
+        both.add(i);
+      }
+
+      a.merge(b);
+
+      // Merging gives exactly the sketch of the combined stream.
+      CHECK_ARRAY_EQUAL(both.data(), a.data(), a.size());
+      CHECK(relative_error(a.estimate(), 100000.0) < (4.0 * a.standard_error()));
+
+      a.clear();
+      CHECK(a.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_merge_across_threads)
+    {
+      const size_t   Threads    = 4U;
+      const uint32_t Per_Thread = 50000U;
+
+      std::vector<etl::hyperloglog<14>> sketches(Threads);
+      std::vector<std::thread>          threads;
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads.push_back(std::thread(
+          [&, t]()
+          {
+            for (uint32_t i = 0U; i < Per_Thread; ++i)
+            {
+              sketches[t].add(static_cast<uint32_t>(t * Per_Thread) + i);
+            }
+          }));
+      }
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads[t].join();
+      }
+
+      etl::hyperloglog<14> total;
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        total.merge(sketches[t]);
+      }
+
+      CHECK(relative_error(total.estimate(), Threads * Per_Thread) < (4.0 * total.standard_error()));
+    }
+
+    //*************************************************************************
+    TEST(test_load)
+    {
+      etl::hyperloglog<10> original;
+
+      for (uint32_t i = 0U; i < 5000U; ++i)
+      {
+        original.add(i);
+      }
+
+      std::vector<uint8_t> stored(original.data(), original.data() + original.size());
+
+      etl::hyperloglog<10> restored;
+      CHECK(restored.load(stored.data(), stored.size()));
+      CHECK_ARRAY_EQUAL(original.data(), restored.data(), original.size());
+      CHECK_CLOSE(original.estimate(), restored.estimate(), 0.0);
+
+      // The wrong length is rejected.
+      etl::hyperloglog<10> other;
+      other.add(1U);
+      std::vector<uint8_t> before(other.data(), other.data() + other.size());
+
+      CHECK(!other.load(stored.data(), stored.size() - 1U));
+      CHECK_ARRAY_EQUAL(before.data(), other.data(), other.size());
+
+      // A register larger than the largest rank is rejected.
+      stored[7] = 64U - 10U + 2U;
+      CHECK(!other.load(stored.data(), stored.size()));
+      CHECK_ARRAY_EQUAL(before.data(), other.data(), other.size());
+
+      stored[7] = 64U - 10U + 1U;
+      CHECK(other.load(stored.data(), stored.size()));
+      CHECK_EQUAL(64U - 10U + 1U, other.data()[7]);
+    }
+
+    //*************************************************************************
+    TEST(test_add_hash)
+    {
+      etl::hyperloglog<4> hll;
+
+      // The top 4 bits select register 15; the next bit set gives a rank of 1.
+      hll.add_hash(0xF800000000000000ULL);
+      CHECK_EQUAL(1U, hll.data()[15]);
+
+      // All zero below the index: the guard bit limits the rank to 61.
+      hll.add_hash(0x0000000000000000ULL);
+      CHECK_EQUAL(61U, hll.data()[0]);
+
+      // A lower rank does not replace a higher one.
+      hll.add_hash(0x0800000000000000ULL);
+      CHECK_EQUAL(61U, hll.data()[0]);
+    }
+  }
+} // namespace
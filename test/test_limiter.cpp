@@ -30,9 +30,12 @@ SOFTWARE.
 
 #include "etl/limiter.h"
 
+#include "random_values.h"
+
 #include <algorithm>
 #include <array>
 #include <math.h>
+#include <vector>
 
 namespace
 {
@@ -86,5 +89,42 @@ namespace
       bool isEqual = std::equal(output2.begin(), output2.end(), result2a.begin(), Compare());
       CHECK(isEqual);
     }
+
+    //*************************************************************************
+    template <typename T>
+    void check_apply(double lowest, double highest)
+    {
+      const etl::limiter<T> limiter(static_cast<T>(lowest / 2.0), static_cast<T>(highest / 2.0));
+
+      const std::vector<T> input = random_values<T>(1003U, lowest, highest, 1U);
+      std::vector<T>       expected(input.size());
+      std::vector<T>       output(input.size());
+
+      std::transform(input.begin(), input.end(), expected.begin(), limiter);
+
+      CHECK_EQUAL(input.size(), limiter.apply(input, output));
+      CHECK(output == expected);
+
+      // In place.
+      std::vector<T> values(input);
+      limiter.apply(values, values);
+      CHECK(values == expected);
+
+      // The shorter span sets the length.
+      std::vector<T> short_output(5U, T(0));
+      CHECK_EQUAL(5U, limiter.apply(input, short_output));
+      CHECK(std::equal(short_output.begin(), short_output.end(), expected.begin()));
+    }
+
+    TEST(test_apply_matches_scalar)
+    {
+      check_apply<int8_t>(-128.0, 127.0);
+      check_apply<uint8_t>(0.0, 255.0);
+      check_apply<int16_t>(-1000.0, 1000.0);
+      check_apply<int32_t>(-100000.0, 100000.0);
+      check_apply<uint32_t>(0.0, 100000.0);
+      check_apply<float>(-100.0, 100.0);
+      check_apply<double>(-100.0, 100.0);
+    }
   }
 } // namespace
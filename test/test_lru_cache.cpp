@@ -0,0 +1,490 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/lru_cache.h"
+
+#include <list>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "data.h"
+
+namespace
+{
+  typedef etl::lru_cache<int, std::string, 3>                           Cache;
+  typedef etl::lru_cache<int, std::string, 3, etl::clock_replacement> Clock_Cache;
+
+  typedef TestDataNDC<std::string> NDC;
+
+  //***************************************************************************
+  // A slow store that records what is read and written.
+  //***************************************************************************
+  struct Store
+  {
+    bool read(const Cache::key_value& item)
+    {
+      ++reads;
+
+      std::map<int, std::string>::const_iterator i_value = values.find(item.key);
+
+      if (i_value == values.end())
+      {
+        return false;
+      }
+
+      item.value = i_value->second;
+      return true;
+    }
+
+    void write(const Cache::const_key_value& item)
+    {
+      values[item.key] = item.value;
+      written.push_back(item.key);
+    }
+
+    std::map<int, std::string> values;
+    std::vector<int>           written;
+    int                        reads = 0;
+  };
+
+  //***************************************************************************
+  // Throws from the copy constructor when asked to.
+  //***************************************************************************
+  struct Throwing
+  {
+    Throwing(int value_ = 0)
+      : value(value_)
+    {
+    }
+
+    Throwing(const Throwing& other)
+      : value(other.value)
+    {
+      if (throw_on_copy)
+      {
+        throw std::runtime_error("copy");
+      }
+    }
+
+    Throwing& operator=(const Throwing& other)
+    {
+      value = other.value;
+      return *this;
+    }
+
+    int value;
+
+    static bool throw_on_copy;
+  };
+
+  bool Throwing::throw_on_copy = false;
+
+  template <typename TCache>
+  void connect(TCache& cache, Store& store)
+  {
+    cache.set_read_function(TCache::read_function_type::template create<Store, &Store::read>(store));
+    cache.set_write_function(TCache::write_function_type::template create<Store, &Store::write>(store));
+  }
+
+  SUITE(test_lru_cache)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Cache cache;
+
+      CHECK(cache.empty());
+      CHECK(!cache.full());
+      CHECK_EQUAL(0U, cache.size());
+      CHECK_EQUAL(3U, cache.max_size());
+      CHECK_EQUAL(3U, cache.available());
+      CHECK_EQUAL(4U, Cache::Bucket_Count);
+      CHECK(cache.is_write_through());
+      CHECK_EQUAL(0U, cache.hits());
+      CHECK_EQUAL(0U, cache.misses());
+      CHECK_EQUAL(0U, cache.evictions());
+      CHECK(cache.get(1) == nullptr);
+      CHECK_EQUAL(1U, cache.misses());
+    }
+
+    //*************************************************************************
+    TEST(test_put_and_get)
+    {
+      Cache cache;
+
+      cache.put(1, "one");
+      cache.put(2, "two");
+
+      CHECK_EQUAL(2U, cache.size());
+      CHECK_EQUAL(std::string("one"), *cache.get(1));
+      CHECK_EQUAL(std::string("two"), *cache.get(2));
+      CHECK(cache.get(3) == nullptr);
+      CHECK_EQUAL(2U, cache.hits());
+      CHECK_EQUAL(1U, cache.misses());
+
+      cache.put(1, "uno");
+      CHECK_EQUAL(std::string("uno"), *cache.peek(1));
+      CHECK_EQUAL(2U, cache.size());
+
+      // peek and contains are not counted.
+      CHECK(cache.contains(2));
+      CHECK(!cache.contains(3));
+      CHECK_EQUAL(2U, cache.hits());
+
+      cache.reset_statistics();
+      CHECK_EQUAL(0U, cache.hits());
+      CHECK_EQUAL(0U, cache.misses());
+
+      CHECK(cache.erase(1));
+      CHECK(!cache.erase(1));
+      CHECK(!cache.contains(1));
+      CHECK_EQUAL(1U, cache.size());
+
+      cache.clear();
+      CHECK(cache.empty());
+      CHECK(cache.peek(2) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_lru_eviction)
+    {
+      Cache cache;
+
+      cache.put(1, "one");
+      cache.put(2, "two");
+      cache.put(3, "three");
+      CHECK(cache.full());
+
+      // 2 is now the least recently used.
+      cache.get(1);
+      cache.put(4, "four");
+
+      CHECK_EQUAL(1U, cache.evictions());
+      CHECK(cache.contains(1));
+      CHECK(!cache.contains(2));
+      CHECK(cache.contains(3));
+      CHECK(cache.contains(4));
+
+      // peek does not change the order.
+      cache.peek(3);
+      cache.put(5, "five");
+      CHECK(!cache.contains(3));
+      CHECK_EQUAL(2U, cache.evictions());
+    }
+
+    //*************************************************************************
+    TEST(test_clock_eviction)
+    {
+      Clock_Cache cache;
+
+      cache.put(1, "one");
+      cache.put(2, "two");
+      cache.put(3, "three");
+
+      // 1 gets a second chance.
+      cache.get(1);
+      cache.put(4, "four");
+
+      CHECK(cache.contains(1));
+      CHECK(!cache.contains(2));
+
+      // The hand continues from 3.
+      cache.put(5, "five");
+      CHECK(!cache.contains(3));
+
+      // 1 has lost its second chance.
+      cache.put(6, "six");
+      CHECK(!cache.contains(1));
+      CHECK(cache.contains(4));
+      CHECK(cache.contains(5));
+      CHECK(cache.contains(6));
+      CHECK_EQUAL(3U, cache.evictions());
+    }
+
+    //*************************************************************************
+    TEST(test_read_through)
+    {
+      Store store;
+      store.values[1] = "one";
+      store.values[2] = "two";
+
+      Cache cache;
+      connect(cache, store);
+
+      CHECK_EQUAL(std::string("one"), *cache.get(1));
+      CHECK_EQUAL(std::string("one"), *cache.get(1));
+      CHECK_EQUAL(1, store.reads);
+      CHECK_EQUAL(1U, cache.hits());
+      CHECK_EQUAL(1U, cache.misses());
+
+      CHECK(cache.get(3) == nullptr);
+      CHECK_EQUAL(2, store.reads);
+      CHECK(!cache.contains(3));
+
+      // Loaded values are not written back.
+      cache.flush();
+      CHECK(store.written.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_write_through)
+    {
+      Store store;
+
+      Cache cache;
+      connect(cache, store);
+
+      cache.put(1, "one");
+      cache.put(1, "uno");
+      cache.put(2, "two");
+
+      CHECK_EQUAL(3U, store.written.size());
+      CHECK_EQUAL(std::string("uno"), store.values[1]);
+
+      cache.put(3, "three");
+      cache.put(4, "four");
+      cache.flush();
+      CHECK_EQUAL(5U, store.written.size());
+    }
+
+    //*************************************************************************
+    TEST(test_write_back)
+    {
+      Store store;
+
+      {
+        Cache cache;
+        connect(cache, store);
+        cache.set_write_through(false);
+        CHECK(!cache.is_write_through());
+
+        cache.put(1, "one");
+        cache.put(1, "uno");
+        cache.put(2, "two");
+        cache.put(3, "three");
+        CHECK(store.written.empty());
+
+        // Evicting 1 writes it back once.
+        cache.put(4, "four");
+        CHECK_EQUAL(1U, store.written.size());
+        CHECK_EQUAL(std::string("uno"), store.values[1]);
+
+        // Reloading it does not make it dirty.
+        CHECK_EQUAL(std::string("uno"), *cache.get(1));
+        CHECK_EQUAL(2U, store.written.size());
+        CHECK_EQUAL(2, store.written.back());
+
+        cache.flush();
+        CHECK_EQUAL(4U, store.written.size());
+
+        cache.flush();
+        CHECK_EQUAL(4U, store.written.size());
+
+        // Erasing writes back.
+        cache.put(4, "quattro");
+        CHECK(cache.erase(4));
+        CHECK_EQUAL(std::string("quattro"), store.values[4]);
+
+        // Destruction writes back.
+        cache.put(5, "five");
+        CHECK_EQUAL(5U, store.written.size());
+      }
+
+      CHECK_EQUAL(6U, store.written.size());
+      CHECK_EQUAL(std::string("five"), store.values[5]);
+
+      // Setting write through writes back what was held.
+      Cache cache;
+      connect(cache, store);
+      cache.set_write_through(false);
+      cache.put(6, "six");
+      cache.set_write_through(true);
+      CHECK_EQUAL(std::string("six"), store.values[6]);
+    }
+
+    //*************************************************************************
+    TEST(test_matches_reference_lru)
+    {
+      etl::lru_cache<int, int, 50> cache;
+
+      // The reference keeps the most recently used at the front.
+      std::list<std::pair<int, int> > reference;
+
+      std::mt19937                       generator(1);
+      std::uniform_int_distribution<int> key_distribution(0, 100);
+      std::uniform_int_distribution<int> operation(0, 3);
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        const int key = key_distribution(generator);
+
+        std::list<std::pair<int, int> >::iterator i_reference = reference.begin();
+
+        while ((i_reference != reference.end()) && (i_reference->first != key))
+        {
+          ++i_reference;
+        }
+
+        switch (operation(generator))
+        {
+          case 0:
+          case 1:
+          {
+            int* p_value = cache.get(key);
+
+            CHECK_EQUAL((i_reference != reference.end()), (p_value != nullptr));
+
+            if (i_reference != reference.end())
+            {
+              CHECK_EQUAL(i_reference->second, (p_value == nullptr) ? -1 : *p_value);
+              reference.splice(reference.begin(), reference, i_reference);
+            }
+            break;
+          }
+
+          case 2:
+          {
+            cache.put(key, i);
+
+            if (i_reference != reference.end())
+            {
+              reference.erase(i_reference);
+            }
+            else if (reference.size() == 50U)
+            {
+              reference.pop_back();
+            }
+
+            reference.push_front(std::make_pair(key, i));
+            break;
+          }
+
+          default:
+          {
+            CHECK_EQUAL((i_reference != reference.end()), cache.erase(key));
+
+            if (i_reference != reference.end())
+            {
+              reference.erase(i_reference);
+            }
+            break;
+          }
+        }
+
+        CHECK_EQUAL(reference.size(), cache.size());
+      }
+
+      for (std::list<std::pair<int, int> >::const_iterator i_reference = reference.begin(); i_reference != reference.end(); ++i_reference)
+      {
+        CHECK_EQUAL(i_reference->second, *cache.peek(i_reference->first));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_clock_hit_ratio)
+    {
+      // A hot set that fits survives a scan of cold keys.
+      etl::lru_cache<int, int, 64, etl::clock_replacement> cache;
+
+      for (int round = 0; round < 100; ++round)
+      {
+        for (int key = 0; key < 32; ++key)
+        {
+          if (cache.get(key) == nullptr)
+          {
+            cache.put(key, key);
+          }
+        }
+
+        for (int key = 0; key < 16; ++key)
+        {
+          const int cold = 1000 + (round * 16) + key;
+          cache.put(cold, cold);
+        }
+      }
+
+      CHECK(cache.hits() > (cache.misses() * 10U));
+    }
+
+    //*************************************************************************
+    TEST(test_value_constructor_throws)
+    {
+      etl::lru_cache<int, Throwing, 2> cache;
+
+      cache.put(1, Throwing(1));
+
+      Throwing value(2);
+      Throwing::throw_on_copy = true;
+      CHECK_THROW(cache.put(2, value), std::runtime_error);
+      CHECK_THROW(cache.put(3, value), std::runtime_error);
+      Throwing::throw_on_copy = false;
+
+      // The slots were freed, not linked.
+      CHECK_EQUAL(1U, cache.size());
+      CHECK(!cache.contains(2));
+      CHECK(!cache.contains(3));
+      CHECK(cache.peek(2) == nullptr);
+
+      cache.put(2, value);
+      cache.put(3, value);
+      CHECK_EQUAL(2U, cache.size());
+      CHECK_EQUAL(2, cache.peek(2)->value);
+      CHECK_EQUAL(2, cache.peek(3)->value);
+      CHECK(!cache.contains(1));
+    }
+
+    //*************************************************************************
+    TEST(test_no_leaks)
+    {
+      NDC::reset_instance_count();
+
+      {
+        etl::lru_cache<int, NDC, 10> cache;
+
+        for (int i = 0; i < 25; ++i)
+        {
+          cache.put(i, NDC(std::to_string(i)));
+        }
+
+        CHECK_EQUAL(10, NDC::get_instance_count());
+
+        cache.erase(24);
+        CHECK_EQUAL(9, NDC::get_instance_count());
+      }
+
+      CHECK_EQUAL(0, NDC::get_instance_count());
+    }
+  }
+} // namespace
@@ -0,0 +1,448 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "etl/message_packet.h"
+#include "etl/message_record_queue.h"
+#include "etl/message_router.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  enum
+  {
+    Heartbeat_Id = 1,
+    Bulk_Id      = 2,
+    Other_Id     = 3
+  };
+
+  //***************************************************************************
+  struct Heartbeat : public etl::message<Heartbeat_Id>
+  {
+    explicit Heartbeat(uint32_t node_)
+      : node(node_)
+    {
+    }
+
+    uint32_t node;
+  };
+
+  //***************************************************************************
+  struct Bulk : public etl::message<Bulk_Id>
+  {
+    Bulk(uint32_t sequence_, uint8_t fill)
+      : sequence(sequence_)
+    {
+      memset(payload, fill, sizeof(payload));
+      ++instances;
+    }
+
+    Bulk(const Bulk& other)
+      : etl::message<Bulk_Id>(other)
+      , sequence(other.sequence)
+    {
+      memcpy(payload, other.payload, sizeof(payload));
+      ++instances;
+    }
+
+    ~Bulk()
+    {
+      --instances;
+    }
+
+    uint32_t sequence;
+    uint8_t  payload[1500];
+
+    static int instances;
+  };
+
+  int Bulk::instances = 0;
+
+  //***************************************************************************
+  struct Other : public etl::message<Other_Id>
+  {
+  };
+
+  typedef etl::message_record_queue<4096, Heartbeat, Bulk> Queue;
+
+  // Just large enough for a Bulk.
+  typedef etl::message_record_queue<2U * Queue::record_size<Bulk>(), Heartbeat, Bulk> Small_Queue;
+
+  //***************************************************************************
+  class Router : public etl::message_router<Router, Heartbeat, Bulk>
+  {
+  public:
+
+    Router()
+      : message_router(1)
+      , bulk_fill(0)
+      , unknown(0)
+    {
+    }
+
+    void on_receive(const Heartbeat& msg)
+    {
+      heartbeats.push_back(msg.node);
+    }
+
+    void on_receive(const Bulk& msg)
+    {
+      bulk.push_back(msg.sequence);
+      bulk_fill = msg.payload[sizeof(msg.payload) - 1U];
+      addresses.push_back(&msg);
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+      ++unknown;
+    }
+
+    std::vector<uint32_t>    heartbeats;
+    std::vector<uint32_t>    bulk;
+    std::vector<const void*> addresses;
+    uint8_t                  bulk_fill;
+    int                      unknown;
+  };
+
+  //***************************************************************************
+  // Throws when it receives a Bulk with the chosen sequence number.
+  //***************************************************************************
+  class Throwing_Router : public etl::message_router<Throwing_Router, Heartbeat, Bulk>
+  {
+  public:
+
+    Throwing_Router()
+      : message_router(2)
+      , throw_on(0U)
+    {
+    }
+
+    void on_receive(const Heartbeat& msg)
+    {
+      heartbeats.push_back(msg.node);
+    }
+
+    void on_receive(const Bulk& msg)
+    {
+      if (msg.sequence == throw_on)
+      {
+        throw std::runtime_error("bulk");
+      }
+
+      bulk.push_back(msg.sequence);
+    }
+
+    void on_receive_unknown(const etl::imessage&) {}
+
+    std::vector<uint32_t> heartbeats;
+    std::vector<uint32_t> bulk;
+    uint32_t              throw_on;
+  };
+
+  SUITE(test_message_record_queue)
+  {
+    //*************************************************************************
+    TEST(test_record_sizes)
+    {
+      const size_t alignment = (etl::alignment_of<Bulk>::value > 4U) ? etl::alignment_of<Bulk>::value : 4U;
+
+      CHECK_EQUAL(alignment, Queue::Alignment);
+      CHECK_EQUAL(alignment, Queue::Id_Size);
+      CHECK_EQUAL(alignment + alignment + (((sizeof(Heartbeat) + alignment - 1U) / alignment) * alignment), Queue::record_size<Heartbeat>());
+
+      // A heartbeat takes a fraction of the space of a packet slot.
+      CHECK(Queue::record_size<Heartbeat>() * 10U < sizeof(etl::message_packet<Heartbeat, Bulk>));
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_and_receive)
+    {
+      Queue  queue;
+      Router router;
+
+      CHECK(queue.empty());
+      CHECK(queue.emplace<Heartbeat>(7U));
+      CHECK(queue.emplace<Bulk>(1U, uint8_t(0xA5U)));
+      CHECK(queue.emplace<Heartbeat>(8U));
+      CHECK_EQUAL(1, Bulk::instances);
+
+      CHECK_EQUAL(2U * Queue::record_size<Heartbeat>() + Queue::record_size<Bulk>(), queue.size_bytes());
+
+      CHECK_EQUAL(3U, queue.receive(router));
+      CHECK(queue.empty());
+      CHECK_EQUAL(0, Bulk::instances);
+
+      CHECK_EQUAL(2U, router.heartbeats.size());
+      CHECK_EQUAL(7U, router.heartbeats[0]);
+      CHECK_EQUAL(8U, router.heartbeats[1]);
+      CHECK_EQUAL(1U, router.bulk.size());
+      CHECK_EQUAL(1U, router.bulk[0]);
+      CHECK_EQUAL(0xA5U, router.bulk_fill);
+    }
+
+    //*************************************************************************
+    TEST(test_received_in_place)
+    {
+      Queue  queue;
+      Router router;
+
+      queue.emplace<Bulk>(1U, uint8_t(0U));
+      queue.receive(router);
+      queue.emplace<Heartbeat>(1U);
+      queue.emplace<Bulk>(2U, uint8_t(0U));
+      queue.receive(router);
+
+      // The second Bulk is after the first Bulk and the Heartbeat in the buffer.
+      const char* first  = static_cast<const char*>(router.addresses[0]);
+      const char* second = static_cast<const char*>(router.addresses[1]);
+      CHECK_EQUAL(ptrdiff_t(Queue::record_size<Bulk>() + Queue::record_size<Heartbeat>()), second - first);
+    }
+
+    //*************************************************************************
+    TEST(test_push)
+    {
+      Queue  queue;
+      Router router;
+
+      Heartbeat heartbeat(3U);
+      Bulk      bulk(4U, 1U);
+
+      CHECK(queue.push(heartbeat));
+      CHECK(queue.push(static_cast<const etl::imessage&>(bulk)));
+      CHECK(queue.push(Heartbeat(5U)));
+      CHECK_EQUAL(2, Bulk::instances);
+
+      CHECK_THROW(queue.push(static_cast<const etl::imessage&>(Other())), etl::unhandled_message_exception);
+
+      CHECK_EQUAL(3U, queue.receive(router));
+      CHECK_EQUAL(3U, router.heartbeats[0]);
+      CHECK_EQUAL(5U, router.heartbeats[1]);
+      CHECK_EQUAL(4U, router.bulk[0]);
+      CHECK_EQUAL(0, router.unknown);
+    }
+
+    //*************************************************************************
+    TEST(test_full_and_batch)
+    {
+      Queue  queue;
+      Router router;
+
+      int pushed = 0;
+
+      while (queue.emplace<Bulk>(uint32_t(pushed), uint8_t(0U)))
+      {
+        ++pushed;
+      }
+
+      CHECK_EQUAL(2, pushed);
+
+      // There is still room for small messages.
+      CHECK(queue.emplace<Heartbeat>(1U));
+
+      CHECK_EQUAL(2U, queue.receive(router, 2U));
+      CHECK_EQUAL(2U, router.bulk.size());
+
+      // The freed space is at the start, so the next Bulk wraps around.
+      CHECK(queue.emplace<Bulk>(2U, uint8_t(0U)));
+
+      CHECK_EQUAL(2U, queue.receive(router));
+      CHECK_EQUAL(3U, router.bulk.size());
+      CHECK_EQUAL(2U, router.bulk[2]);
+      CHECK_EQUAL(1U, router.heartbeats.size());
+      CHECK_EQUAL(0, Bulk::instances);
+    }
+
+    //*************************************************************************
+    TEST(test_clear_and_destruct)
+    {
+      {
+        Queue  queue;
+        Router router;
+
+        queue.emplace<Bulk>(1U, uint8_t(0U));
+        queue.emplace<Heartbeat>(2U);
+        queue.emplace<Bulk>(3U, uint8_t(0U));
+        CHECK_EQUAL(2U, queue.receive(router, 2U));
+
+        // The next Bulk wraps around.
+        CHECK(queue.emplace<Bulk>(4U, uint8_t(0U)));
+        CHECK_EQUAL(2, Bulk::instances);
+
+        queue.clear();
+        CHECK(queue.empty());
+        CHECK_EQUAL(0, Bulk::instances);
+
+        queue.emplace<Bulk>(5U, uint8_t(0U));
+        queue.emplace<Heartbeat>(6U);
+        CHECK_EQUAL(1, Bulk::instances);
+      }
+
+      // The destructor destroys the queued messages.
+      CHECK_EQUAL(0, Bulk::instances);
+    }
+
+    //*************************************************************************
+    TEST(test_largest_message_after_drain)
+    {
+      const size_t positions = Small_Queue().capacity_bytes() / Small_Queue::record_size<Heartbeat>();
+
+      // Leave the indices at every position, then queue the largest message.
+      for (size_t heartbeats = 0U; heartbeats <= positions; ++heartbeats)
+      {
+        Small_Queue queue;
+        Router      router;
+
+        for (int round = 0; round < 3; ++round)
+        {
+          for (size_t i = 0U; i < heartbeats; ++i)
+          {
+            CHECK(queue.emplace<Heartbeat>(uint32_t(i)));
+            CHECK_EQUAL(1U, queue.receive(router));
+          }
+
+          CHECK(queue.emplace<Bulk>(uint32_t(heartbeats), uint8_t(0U)));
+          CHECK_EQUAL(1U, queue.receive(router));
+        }
+      }
+
+      CHECK_EQUAL(0, Bulk::instances);
+    }
+
+    //*************************************************************************
+    TEST(test_router_throws)
+    {
+      Queue           queue;
+      Throwing_Router router;
+
+      queue.emplace<Heartbeat>(1U);
+      queue.emplace<Bulk>(2U, uint8_t(0U));
+      queue.emplace<Heartbeat>(3U);
+
+      router.throw_on = 2U;
+      CHECK_THROW(queue.receive(router), std::runtime_error);
+
+      // The heartbeat before the throw is released, the Bulk is still queued.
+      CHECK_EQUAL(1U, router.heartbeats.size());
+      CHECK_EQUAL(1, Bulk::instances);
+      CHECK_EQUAL(Queue::record_size<Bulk>() + Queue::record_size<Heartbeat>(), queue.size_bytes());
+
+      router.throw_on = 0U;
+      CHECK_EQUAL(2U, queue.receive(router));
+      CHECK(queue.empty());
+      CHECK_EQUAL(0, Bulk::instances);
+
+      CHECK_EQUAL(2U, router.heartbeats.size());
+      CHECK_EQUAL(1U, router.heartbeats[0]);
+      CHECK_EQUAL(3U, router.heartbeats[1]);
+      CHECK_EQUAL(1U, router.bulk.size());
+      CHECK_EQUAL(2U, router.bulk[0]);
+
+      // Clearing after a throw destroys each message once.
+      CHECK(queue.emplace<Bulk>(4U, uint8_t(0U)));
+      CHECK(queue.emplace<Heartbeat>(5U));
+      CHECK(queue.emplace<Bulk>(6U, uint8_t(0U)));
+
+      router.throw_on = 6U;
+      CHECK_THROW(queue.receive(router), std::runtime_error);
+      CHECK_EQUAL(1, Bulk::instances);
+
+      queue.clear();
+      CHECK(queue.empty());
+      CHECK_EQUAL(0, Bulk::instances);
+    }
+
+    //*************************************************************************
+    TEST(test_receive_with_imessage_router)
+    {
+      Queue  queue;
+      Router router;
+
+      etl::imessage_router& irouter = router;
+
+      queue.emplace<Heartbeat>(9U);
+      CHECK_EQUAL(1U, queue.receive(irouter));
+      CHECK_EQUAL(9U, router.heartbeats[0]);
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      static Queue queue;
+
+      const uint32_t Count = 5000U;
+
+      std::thread consumer([Count]() {
+        Router router;
+
+        while ((router.heartbeats.size() + router.bulk.size()) < Count)
+        {
+          queue.receive(router, 4U);
+        }
+
+        bool ok = true;
+
+        for (size_t i = 0U; i < router.heartbeats.size(); ++i)
+        {
+          ok = ok && ((router.heartbeats[i] % 8U) != 0U);
+        }
+
+        for (size_t i = 0U; i < router.bulk.size(); ++i)
+        {
+          ok = ok && ((router.bulk[i] % 8U) == 0U);
+        }
+
+        CHECK(ok);
+        CHECK_EQUAL(Count / 8U, router.bulk.size());
+      });
+
+      for (uint32_t i = 0U; i < Count;)
+      {
+        const bool pushed = ((i % 8U) == 0U) ? queue.emplace<Bulk>(i, uint8_t(i)) : queue.emplace<Heartbeat>(i);
+
+        if (pushed)
+        {
+          ++i;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      consumer.join();
+    }
+  }
+} // namespace
+
+#endif
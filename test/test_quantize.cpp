@@ -30,9 +30,12 @@ SOFTWARE.
 
 #include "etl/quantize.h"
 
+#include "random_values.h"
+
 #include <algorithm>
 #include <array>
 #include <math.h>
+#include <vector>
 
 namespace
 {
@@ -96,5 +99,53 @@ namespace
       bool isEqual = std::equal(output2.begin(), output2.end(), result2a.begin(), Compare());
       CHECK(isEqual);
     }
+
+    //*************************************************************************
+    template <typename T>
+    void check_apply(double lowest, double highest)
+    {
+      const double step = (highest - lowest) / 5.0;
+
+      // Deliberately not in ascending order.
+      const T thresholds[]    = {static_cast<T>(lowest + step), static_cast<T>(lowest + 3.0 * step), static_cast<T>(lowest + 2.0 * step), static_cast<T>(lowest + 4.0 * step)};
+      const T quantizations[] = {T(1), T(2), T(3), T(4), T(5)};
+
+      const etl::quantize<T> quantize(thresholds, quantizations, 5U);
+
+      const std::vector<T> input = random_values<T>(1003U, lowest, highest, 3U);
+      std::vector<T>       expected(input.size());
+      std::vector<T>       output(input.size());
+
+      std::transform(input.begin(), input.end(), expected.begin(), quantize);
+
+      CHECK_EQUAL(input.size(), quantize.apply(input, output));
+      CHECK(output == expected);
+
+      // In place.
+      std::vector<T> values(input);
+      quantize.apply(values, values);
+      CHECK(values == expected);
+    }
+
+    TEST(test_apply_matches_scalar)
+    {
+      check_apply<int8_t>(-128.0, 127.0);
+      check_apply<uint8_t>(0.0, 255.0);
+      check_apply<int16_t>(-1000.0, 1000.0);
+      check_apply<int32_t>(-100000.0, 100000.0);
+      check_apply<float>(-100.0, 100.0);
+      check_apply<double>(-100.0, 100.0);
+    }
+
+    //*************************************************************************
+    TEST(test_apply_single_level)
+    {
+      const int quantization = 7;
+
+      IntQuantize quantize(thresholds1.data(), &quantization, 1U);
+
+      CHECK_EQUAL(Size, quantize.apply(input1, output1));
+      CHECK(std::count(output1.begin(), output1.end(), 7) == int(Size));
+    }
   }
 } // namespace
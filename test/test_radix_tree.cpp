@@ -0,0 +1,525 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/radix_tree.h"
+
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "data.h"
+
+namespace
+{
+  typedef etl::radix_tree<int, 2000, 12> Tree;
+  typedef std::map<std::string, int>     Reference;
+
+  typedef TestDataNDC<int> NDC;
+
+  //***************************************************************************
+  etl::string_view view(const std::string& text)
+  {
+    return etl::string_view(text.data(), text.size());
+  }
+
+  //***************************************************************************
+  std::string text(etl::string_view key)
+  {
+    return std::string(key.data(), key.size());
+  }
+
+  //***************************************************************************
+  // Checks the tree against the reference, forwards and backwards.
+  //***************************************************************************
+  bool matches(const Tree& tree, const Reference& reference)
+  {
+    if (tree.size() != reference.size())
+    {
+      return false;
+    }
+
+    Reference::const_iterator i_reference = reference.begin();
+
+    for (Tree::const_iterator i_tree = tree.begin(); i_tree != tree.end(); ++i_tree, ++i_reference)
+    {
+      if ((text(i_tree.key()) != i_reference->first) || (*i_tree != i_reference->second))
+      {
+        return false;
+      }
+    }
+
+    Reference::const_reverse_iterator i_reverse = reference.rbegin();
+
+    for (Tree::const_reverse_iterator i_tree = tree.rbegin(); i_tree != tree.rend(); ++i_tree, ++i_reverse)
+    {
+      if (*i_tree != i_reverse->second)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  // Random keys from a small alphabet share long prefixes. Keys from all
+  // byte values fill the larger nodes and test the unsigned byte order.
+  //***************************************************************************
+  std::string random_key(std::mt19937& generator, bool all_bytes)
+  {
+    std::uniform_int_distribution<int> length_distribution(0, 12);
+    std::uniform_int_distribution<int> small_distribution('a', 'c');
+    std::uniform_int_distribution<int> byte_distribution(0, 255);
+
+    const int length = all_bytes ? 1 + (length_distribution(generator) % 3) : length_distribution(generator);
+
+    std::string key;
+
+    for (int i = 0; i < length; ++i)
+    {
+      key += static_cast<char>(all_bytes ? byte_distribution(generator) : small_distribution(generator));
+    }
+
+    return key;
+  }
+
+  //***************************************************************************
+  // The longest key in the reference that is a prefix of the key.
+  //***************************************************************************
+  Reference::const_iterator reference_longest_prefix(const Reference& reference, const std::string& key)
+  {
+    for (size_t length = key.size() + 1U; length != 0U; --length)
+    {
+      Reference::const_iterator i_found = reference.find(key.substr(0U, length - 1U));
+
+      if (i_found != reference.end())
+      {
+        return i_found;
+      }
+    }
+
+    return reference.end();
+  }
+
+  SUITE(test_radix_tree)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Tree tree;
+
+      CHECK(tree.empty());
+      CHECK(!tree.full());
+      CHECK_EQUAL(0U, tree.size());
+      CHECK_EQUAL(2000U, tree.max_size());
+      CHECK_EQUAL(2000U, tree.available());
+      CHECK_EQUAL(12U, Tree::MAX_KEY_LENGTH);
+      CHECK(tree.begin() == tree.end());
+      CHECK(tree.find(etl::string_view("a")) == tree.end());
+      CHECK(tree.longest_prefix_match(etl::string_view("a")) == tree.end());
+      CHECK(tree.prefix_range(etl::string_view("")).first == tree.end());
+      CHECK_EQUAL(0U, tree.erase(etl::string_view("a")));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_find_and_erase)
+    {
+      Tree tree;
+
+      const char* keys[] = {"romane", "romanus", "romulus", "rubens", "ruber", "rubicon", "rubicundus", "rom", "r", ""};
+
+      for (int i = 0; i < 10; ++i)
+      {
+        std::pair<Tree::iterator, bool> result = tree.insert(etl::string_view(keys[i]), i);
+
+        CHECK(result.second);
+        CHECK_EQUAL(i, *result.first);
+        CHECK(result.first.key() == etl::string_view(keys[i]));
+      }
+
+      CHECK_EQUAL(10U, tree.size());
+
+      std::pair<Tree::iterator, bool> result = tree.insert(etl::string_view("rubens"), 99);
+      CHECK(!result.second);
+      CHECK_EQUAL(3, *result.first);
+
+      for (int i = 0; i < 10; ++i)
+      {
+        CHECK(tree.contains(etl::string_view(keys[i])));
+        CHECK_EQUAL(i, *tree.find(etl::string_view(keys[i])));
+      }
+
+      CHECK(!tree.contains(etl::string_view("ro")));
+      CHECK(!tree.contains(etl::string_view("roman")));
+      CHECK(!tree.contains(etl::string_view("romanes")));
+      CHECK(!tree.contains(etl::string_view("s")));
+
+      // In order.
+      const char* sorted[] = {"", "r", "rom", "romane", "romanus", "romulus", "rubens", "ruber", "rubicon", "rubicundus"};
+
+      Tree::const_iterator i_tree = tree.cbegin();
+
+      for (int i = 0; i < 10; ++i, ++i_tree)
+      {
+        CHECK(i_tree.key() == etl::string_view(sorted[i]));
+      }
+
+      CHECK(i_tree == tree.cend());
+
+      CHECK_EQUAL(1U, tree.erase(etl::string_view("rom")));
+      CHECK_EQUAL(0U, tree.erase(etl::string_view("rom")));
+      CHECK_EQUAL(1U, tree.erase(etl::string_view("")));
+      CHECK(!tree.contains(etl::string_view("rom")));
+      CHECK(tree.contains(etl::string_view("romane")));
+      CHECK_EQUAL(8U, tree.size());
+
+      // erase(iterator) returns the next value.
+      Tree::iterator i_next = tree.erase(tree.find(etl::string_view("ruber")));
+      CHECK(i_next.key() == etl::string_view("rubicon"));
+
+      tree.clear();
+      CHECK(tree.empty());
+      CHECK(tree.begin() == tree.end());
+    }
+
+    //*************************************************************************
+    TEST(test_longest_prefix_match)
+    {
+      etl::radix_tree<int, 10, 32> tree;
+
+      tree.insert(etl::string_view("sensors"), 1);
+      tree.insert(etl::string_view("sensors/temperature"), 2);
+      tree.insert(etl::string_view("sensors/temperature/room"), 3);
+      tree.insert(etl::string_view("sensors/pressure"), 4);
+
+      CHECK(tree.longest_prefix_match(etl::string_view("actuators")) == tree.end());
+      CHECK(tree.longest_prefix_match(etl::string_view("sensor")) == tree.end());
+      CHECK_EQUAL(1, *tree.longest_prefix_match(etl::string_view("sensors")));
+      CHECK_EQUAL(1, *tree.longest_prefix_match(etl::string_view("sensors/")));
+      CHECK_EQUAL(1, *tree.longest_prefix_match(etl::string_view("sensors/temp")));
+      CHECK_EQUAL(2, *tree.longest_prefix_match(etl::string_view("sensors/temperature")));
+      CHECK_EQUAL(2, *tree.longest_prefix_match(etl::string_view("sensors/temperature/")));
+      CHECK_EQUAL(3, *tree.longest_prefix_match(etl::string_view("sensors/temperature/room/1")));
+      CHECK_EQUAL(4, *tree.longest_prefix_match(etl::string_view("sensors/pressure/x")));
+      CHECK_EQUAL(1, *tree.longest_prefix_match(etl::string_view("sensors/humidity")));
+    }
+
+    //*************************************************************************
+    TEST(test_key_too_long)
+    {
+      typedef etl::radix_tree<int, 100, 24> Topic_Tree;
+      Topic_Tree tree;
+
+      CHECK(tree.insert(etl::string_view("123456789012345678901234"), 1).second);
+      CHECK_THROW(tree.insert(etl::string_view("1234567890123456789012345"), 2), etl::radix_tree_key_length);
+
+      // Longer keys may still be searched for.
+      CHECK(tree.find(etl::string_view("1234567890123456789012345")) == tree.end());
+      CHECK_EQUAL(1, *tree.longest_prefix_match(etl::string_view("1234567890123456789012345")));
+    }
+
+    //*************************************************************************
+    TEST(test_prefix_range)
+    {
+      Tree                   tree;
+      const Tree&            ctree = tree;
+      Reference              reference;
+      std::mt19937           generator(1);
+
+      for (int i = 0; i < 300; ++i)
+      {
+        const std::string key = random_key(generator, false);
+
+        tree.insert(view(key), i);
+        reference.insert(std::make_pair(key, i));
+      }
+
+      for (int i = 0; i < 500; ++i)
+      {
+        const std::string prefix = random_key(generator, false).substr(0U, size_t(i % 5));
+
+        std::pair<Tree::const_iterator, Tree::const_iterator> range = ctree.prefix_range(view(prefix));
+
+        std::vector<std::string> expected;
+
+        for (Reference::const_iterator i_reference = reference.lower_bound(prefix);
+             (i_reference != reference.end()) && (i_reference->first.compare(0U, prefix.size(), prefix) == 0); ++i_reference)
+        {
+          expected.push_back(i_reference->first);
+        }
+
+        std::vector<std::string> actual;
+
+        for (Tree::const_iterator i_tree = range.first; i_tree != range.second; ++i_tree)
+        {
+          actual.push_back(text(i_tree.key()));
+        }
+
+        CHECK(expected == actual);
+      }
+    }
+
+    //*************************************************************************
+    void matches_std_map(bool all_bytes, unsigned seed)
+    {
+      Tree      tree;
+      Reference reference;
+
+      std::mt19937                       generator(seed);
+      std::uniform_int_distribution<int> operation(0, 9);
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        const std::string key = random_key(generator, all_bytes);
+
+        switch (operation(generator))
+        {
+          case 0:
+          case 1:
+          case 2:
+          case 3:
+          {
+            if (!tree.full())
+            {
+              const bool inserted = tree.insert(view(key), i).second;
+              CHECK_EQUAL(reference.insert(std::make_pair(key, i)).second, inserted);
+            }
+            break;
+          }
+
+          case 4:
+          case 5:
+          {
+            CHECK_EQUAL(reference.erase(key), tree.erase(view(key)));
+            break;
+          }
+
+          case 6:
+          {
+            Tree::iterator i_found = tree.find(view(key));
+
+            if (i_found != tree.end())
+            {
+              Reference::iterator i_reference = reference.erase(reference.find(key));
+              Tree::iterator      i_next      = tree.erase(i_found);
+
+              CHECK_EQUAL((i_reference == reference.end()), (i_next == tree.end()));
+            }
+            break;
+          }
+
+          case 7:
+          case 8:
+          {
+            Tree::iterator            i_found     = tree.longest_prefix_match(view(key));
+            Reference::const_iterator i_reference = reference_longest_prefix(reference, key);
+
+            if (i_reference == reference.end())
+            {
+              CHECK(i_found == tree.end());
+            }
+            else
+            {
+              CHECK(i_found != tree.end());
+              CHECK_EQUAL(i_reference->second, (i_found == tree.end()) ? -1 : *i_found);
+            }
+            break;
+          }
+
+          default:
+          {
+            CHECK_EQUAL(reference.count(key), tree.count(view(key)));
+            break;
+          }
+        }
+
+        CHECK_EQUAL(reference.size(), tree.size());
+      }
+
+      CHECK(matches(tree, reference));
+
+      for (Reference::const_iterator i_reference = reference.begin(); i_reference != reference.end(); ++i_reference)
+      {
+        CHECK_EQUAL(i_reference->second, *tree.find(view(i_reference->first)));
+      }
+    }
+
+    TEST(test_matches_std_map)
+    {
+      matches_std_map(false, 2U);
+      matches_std_map(true, 3U);
+    }
+
+    //*************************************************************************
+    TEST(test_node_kinds)
+    {
+      // Grows a node through every kind and back again.
+      Tree      tree;
+      Reference reference;
+
+      for (int i = 0; i < 256; ++i)
+      {
+        const std::string key = std::string("topic/") + static_cast<char>(255 - i) + "/x";
+
+        tree.insert(view(key), i);
+        reference.insert(std::make_pair(key, i));
+        CHECK(matches(tree, reference));
+      }
+
+      tree.insert(etl::string_view("topic/"), 1000);
+      reference.insert(std::make_pair(std::string("topic/"), 1000));
+
+      for (int i = 0; i < 256; ++i)
+      {
+        const std::string key = std::string("topic/") + static_cast<char>((i * 7) % 256) + "/x";
+
+        CHECK_EQUAL(1U, tree.erase(view(key)));
+        reference.erase(key);
+        CHECK(matches(tree, reference));
+        CHECK_EQUAL(1000, *tree.longest_prefix_match(etl::string_view("topic/zz")));
+      }
+
+      CHECK_EQUAL(1U, tree.size());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      // The pools must hold the worst case mix of nodes.
+      typedef etl::radix_tree<int, 600, 10> Small_Tree;
+
+      for (int shape = 0; shape < 3; ++shape)
+      {
+        Small_Tree tree;
+
+        std::mt19937 generator(static_cast<std::mt19937::result_type>(shape));
+        std::uniform_int_distribution<int> byte_distribution(0, (shape == 0) ? 1 : ((shape == 1) ? 15 : 255));
+
+        int i = 0;
+
+        while (!tree.full())
+        {
+          std::string key;
+          const int   length = 1 + (i % ((shape == 0) ? 10 : 3));
+
+          for (int j = 0; j < length; ++j)
+          {
+            key += static_cast<char>(byte_distribution(generator));
+          }
+
+          tree.insert(view(key), i++);
+        }
+
+        CHECK_EQUAL(600U, tree.size());
+
+        std::string missing;
+
+        for (int b = 0; b < 256; ++b)
+        {
+          missing = std::string(1U, static_cast<char>(b)) + "zz";
+
+          if (!tree.contains(view(missing)))
+          {
+            break;
+          }
+        }
+
+        CHECK_THROW(tree.insert(view(missing), 0), etl::radix_tree_full);
+
+        // Existing keys are still found.
+        CHECK(!tree.insert(tree.begin().key(), 0).second);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_move)
+    {
+      Tree tree1;
+
+      tree1.insert(etl::string_view("alpha"), 1);
+      tree1.insert(etl::string_view("alphabet"), 2);
+      tree1.insert(etl::string_view("beta"), 3);
+
+      Tree tree2(tree1);
+      CHECK_EQUAL(3U, tree2.size());
+      CHECK_EQUAL(2, *tree2.find(etl::string_view("alphabet")));
+
+      tree2.erase(etl::string_view("alpha"));
+      CHECK(tree1.contains(etl::string_view("alpha")));
+
+      tree2 = tree1;
+      CHECK(tree2.contains(etl::string_view("alpha")));
+
+      Tree tree3(std::move(tree2));
+      CHECK_EQUAL(3U, tree3.size());
+      CHECK(tree2.empty());
+
+      Tree tree4;
+      tree4 = std::move(tree3);
+      CHECK_EQUAL(3U, tree4.size());
+      CHECK(tree3.empty());
+
+      // Through the base class.
+      etl::iradix_tree<int, 12>& itree = tree4;
+      itree.clear();
+      CHECK(tree4.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_no_leaks)
+    {
+      NDC::reset_instance_count();
+
+      {
+        etl::radix_tree<NDC, 100, 8> tree;
+
+        for (int i = 0; i < 100; ++i)
+        {
+          const std::string key = std::to_string(i * 37);
+          tree.insert(view(key), NDC(i));
+        }
+
+        CHECK_EQUAL(100, NDC::get_instance_count());
+
+        for (int i = 0; i < 100; i += 2)
+        {
+          tree.erase(view(std::to_string(i * 37)));
+        }
+
+        CHECK_EQUAL(50, NDC::get_instance_count());
+      }
+
+      CHECK_EQUAL(0, NDC::get_instance_count());
+    }
+  }
+} // namespace
@@ -30,9 +30,12 @@ SOFTWARE.
 
 #include "etl/rescale.h"
 
+#include "random_values.h"
+
 #include <algorithm>
 #include <array>
 #include <math.h>
+#include <vector>
 
 namespace
 {
@@ -84,5 +87,33 @@ namespace
       bool isEqual = std::equal(output2.begin(), output2.end(), result2.begin(), Compare());
       CHECK(isEqual);
     }
+
+    //*************************************************************************
+    template <typename TInput, typename TOutput>
+    void check_apply(double input_lowest, double input_highest, TOutput output_lowest, TOutput output_highest)
+    {
+      const etl::rescale<TInput, TOutput> rescale(static_cast<TInput>(input_lowest), static_cast<TInput>(input_highest), output_lowest, output_highest);
+
+      const std::vector<TInput> input = random_values<TInput>(1003U, input_lowest, input_highest, 4U);
+      std::vector<TOutput>      expected(input.size());
+      std::vector<TOutput>      output(input.size());
+
+      std::transform(input.begin(), input.end(), expected.begin(), rescale);
+
+      CHECK_EQUAL(input.size(), rescale.apply(input, output));
+      CHECK(output == expected);
+    }
+
+    TEST(test_apply_matches_scalar)
+    {
+      check_apply<int8_t, int>(-128.0, 127.0, 0, 4095);
+      check_apply<uint8_t, int>(0.0, 255.0, -1000, 1000);
+      check_apply<int16_t, int>(-1000.0, 1000.0, 40000, 41900);
+      check_apply<int32_t, int32_t>(-100000.0, 100000.0, -7, 3333);
+      check_apply<int32_t, float>(-100000.0, 100000.0, -1.0f, 1.0f);
+      check_apply<float, double>(-100.0, 100.0, 0.0, 1.0);
+      check_apply<double, int>(-100.0, 100.0, -32768, 32767);
+      check_apply<double, double>(-100.0, 100.0, 3.0, 7.0);
+    }
   }
 } // namespace
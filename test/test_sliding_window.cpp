@@ -0,0 +1,222 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/sliding_window.h"
+
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <vector>
+
+namespace
+{
+  //***************************************************************************
+  // A window that recalculates everything from scratch.
+  //***************************************************************************
+  template <typename T>
+  struct reference_window
+  {
+    explicit reference_window(size_t n_)
+      : n(n_)
+    {
+    }
+
+    void add(T value)
+    {
+      if (values.size() == n)
+      {
+        values.pop_front();
+      }
+
+      values.push_back(value);
+    }
+
+    std::vector<T> sorted() const
+    {
+      std::vector<T> result(values.begin(), values.end());
+      std::sort(result.begin(), result.end());
+      return result;
+    }
+
+    size_t        n;
+    std::deque<T> values;
+  };
+
+  SUITE(test_sliding_window)
+  {
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      etl::sliding_window<int, 4> window;
+
+      CHECK(window.empty());
+      CHECK(!window.full());
+      CHECK_EQUAL(0U, window.size());
+      CHECK_EQUAL(4U, window.max_size());
+      CHECK_EQUAL(0, window.get_min());
+      CHECK_EQUAL(0, window.get_max());
+      CHECK_EQUAL(0, window.get_sum());
+      CHECK_CLOSE(0.0, window.get_mean(), 0.0);
+      CHECK_CLOSE(0.0, window.get_median(), 0.0);
+      CHECK_EQUAL(0, window.get_quantile(0.5));
+      CHECK_EQUAL(0, window.get_kth_smallest(0U));
+    }
+
+    //*************************************************************************
+    TEST(test_window)
+    {
+      etl::sliding_window<int, 4, long> window;
+
+      window.add(5);
+      window.add(1);
+      window.add(9);
+
+      CHECK_EQUAL(3U, window.size());
+      CHECK_EQUAL(1, window.get_min());
+      CHECK_EQUAL(9, window.get_max());
+      CHECK_EQUAL(15L, window.get_sum());
+      CHECK_CLOSE(5.0, window.get_mean(), 1e-12);
+      CHECK_CLOSE(5.0, window.get_median(), 1e-12);
+
+      window.add(3);
+      CHECK(window.full());
+      CHECK_CLOSE(4.0, window.get_median(), 1e-12);
+      CHECK_EQUAL(1, window.get_quantile(0.0));
+      CHECK_EQUAL(3, window.get_quantile(0.5));
+      CHECK_EQUAL(9, window.get_quantile(1.0));
+
+      // 5 drops out.
+      window(2);
+      CHECK_EQUAL(4U, window.size());
+      CHECK_EQUAL(15L, window.get_sum());
+      CHECK_EQUAL(1, window.get_min());
+      CHECK_EQUAL(9, window.get_max());
+      CHECK_CLOSE(2.5, window.get_median(), 1e-12);
+
+      // 1 and 9 drop out.
+      window.add(4);
+      window.add(4);
+      CHECK_EQUAL(2, window.get_min());
+      CHECK_EQUAL(4, window.get_max());
+      CHECK_EQUAL(13L, window.get_sum());
+
+      CHECK_EQUAL(3, window.values().front());
+      CHECK_EQUAL(4, window.values().back());
+
+      window.clear();
+      CHECK(window.empty());
+      CHECK_EQUAL(0L, window.get_sum());
+    }
+
+    //*************************************************************************
+    TEST(test_batch)
+    {
+      const int data[] = {7, 3, 8, 1, 6, 2};
+
+      etl::sliding_window<int, 3> window(data, data + 6);
+
+      CHECK_EQUAL(1, window.get_min());
+      CHECK_EQUAL(6, window.get_max());
+      CHECK_EQUAL(9, window.get_sum());
+
+      window(data, data + 2);
+      CHECK_EQUAL(2, window.get_min());
+      CHECK_EQUAL(7, window.get_max());
+    }
+
+    //*************************************************************************
+    TEST(test_recalculate_sum)
+    {
+      etl::sliding_window<double, 3> window;
+
+      window.add(1e16);
+      window.add(1.0);
+      window.add(1.0);
+      window.add(1.0);
+
+      window.recalculate_sum();
+      CHECK_CLOSE(3.0, window.get_sum(), 1e-12);
+    }
+
+    //*************************************************************************
+    template <size_t N>
+    void matches_reference(int range, int samples)
+    {
+      etl::sliding_window<int, N, long> window;
+      reference_window<int>             reference(N);
+
+      std::mt19937                       generator(static_cast<std::mt19937::result_type>(N + size_t(range)));
+      std::uniform_int_distribution<int> distribution(-range, range);
+
+      for (int i = 0; i < samples; ++i)
+      {
+        const int value = distribution(generator);
+
+        window.add(value);
+        reference.add(value);
+
+        std::vector<int> sorted = reference.sorted();
+
+        long sum = 0;
+
+        for (size_t j = 0U; j < sorted.size(); ++j)
+        {
+          sum += sorted[j];
+        }
+
+        CHECK_EQUAL(sorted.size(), window.size());
+        CHECK_EQUAL(sorted.front(), window.get_min());
+        CHECK_EQUAL(sorted.back(), window.get_max());
+        CHECK_EQUAL(sum, window.get_sum());
+
+        const size_t n      = sorted.size();
+        const double median = ((n & 1U) != 0U) ? double(sorted[n / 2U]) : (double(sorted[(n / 2U) - 1U]) + double(sorted[n / 2U])) / 2.0;
+        CHECK_CLOSE(median, window.get_median(), 1e-12);
+
+        for (size_t k = 0U; k < n; k += 1U + (n / 5U))
+        {
+          CHECK_EQUAL(sorted[k], window.get_kth_smallest(k));
+        }
+
+        CHECK_EQUAL(sorted[size_t(0.9 * double(n - 1U))], window.get_quantile(0.9));
+      }
+    }
+
+    TEST(test_matches_reference)
+    {
+      matches_reference<1>(10, 50);
+      matches_reference<2>(3, 200);
+      matches_reference<7>(5, 1000);     // Many duplicates.
+      matches_reference<64>(1000, 2000);
+      matches_reference<255>(100000, 1000);
+      matches_reference<256>(100000, 1000);
+    }
+  }
+} // namespace
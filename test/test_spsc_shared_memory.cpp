@@ -0,0 +1,417 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <vector>
+
+#include "etl/spsc_shared_memory.h"
+
+#if defined(__linux__)
+  #include <sys/mman.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+#endif
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  struct Sample
+  {
+    uint32_t sequence;
+    uint16_t channel;
+    uint16_t value;
+  };
+
+  //***************************************************************************
+  // Aligned to more than the size of the header.
+  //***************************************************************************
+  struct alignas(512) Wide
+  {
+    uint32_t value;
+  };
+
+  typedef etl::queue_spsc_atomic_shared<Sample> Queue;
+  typedef etl::bip_buffer_spsc_atomic_shared<int> Bip;
+
+  //***************************************************************************
+  // A cache line aligned region.
+  //***************************************************************************
+  struct Region
+  {
+    explicit Region(size_t size_)
+      : storage((size_ + 63U) / 64U + 1U)
+      , size(size_)
+      , memory(storage.data())
+    {
+    }
+
+    struct alignas(64) line
+    {
+      char bytes[64];
+    };
+
+    std::vector<line> storage;
+    size_t            size;
+    void*             memory;
+  };
+
+  SUITE(test_spsc_shared_memory)
+  {
+    //*************************************************************************
+    TEST(test_header_layout)
+    {
+      CHECK_EQUAL(256U, sizeof(etl::spsc_shared_header));
+      CHECK_EQUAL(64U, offsetof(etl::spsc_shared_header, write));
+      CHECK_EQUAL(128U, offsetof(etl::spsc_shared_header, read));
+      CHECK_EQUAL(192U, offsetof(etl::spsc_shared_header, last));
+    }
+
+    //*************************************************************************
+    TEST(test_queue_create_and_attach)
+    {
+      Region region(Queue::required_size(10U));
+
+      Queue producer;
+      Queue consumer;
+
+      CHECK(!producer.is_attached());
+      CHECK_EQUAL(int(etl::spsc_shared_status::Ok), int(producer.create(region.memory, region.size)));
+      CHECK_EQUAL(int(etl::spsc_shared_status::Ok), int(consumer.attach(region.memory, region.size)));
+      CHECK(producer.is_attached());
+      CHECK(consumer.is_attached());
+
+      CHECK_EQUAL(10U, producer.capacity());
+      CHECK_EQUAL(10U, consumer.capacity());
+      CHECK(consumer.empty());
+
+      for (uint32_t i = 0U; i < 10U; ++i)
+      {
+        Sample sample = {i, 1U, uint16_t(i * 2U)};
+        CHECK(producer.push(sample));
+      }
+
+      Sample overflow = {99U, 0U, 0U};
+      CHECK(producer.full());
+      CHECK(!producer.push(overflow));
+      CHECK_EQUAL(10U, consumer.size());
+      CHECK_EQUAL(0U, consumer.available());
+
+      Sample sample;
+      CHECK(consumer.front(sample));
+      CHECK_EQUAL(0U, sample.sequence);
+
+      for (uint32_t i = 0U; i < 10U; ++i)
+      {
+        CHECK(consumer.pop(sample));
+        CHECK_EQUAL(i, sample.sequence);
+        CHECK_EQUAL(i * 2U, sample.value);
+      }
+
+      CHECK(!consumer.pop(sample));
+      CHECK(!consumer.pop());
+      CHECK(producer.empty());
+
+      consumer.detach();
+      CHECK(!consumer.is_attached());
+    }
+
+    //*************************************************************************
+    TEST(test_queue_wraps)
+    {
+      Region region(Queue::required_size(3U));
+
+      Queue queue;
+      queue.create(region.memory, region.size);
+
+      Sample sample = {0U, 0U, 0U};
+
+      for (uint32_t i = 0U; i < 20U; ++i)
+      {
+        sample.sequence = i;
+        CHECK(queue.push(sample));
+        CHECK(queue.pop(sample));
+        CHECK_EQUAL(i, sample.sequence);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_attach_validation)
+    {
+      Region region(Queue::required_size(4U));
+
+      Queue queue;
+      CHECK_EQUAL(int(etl::spsc_shared_status::Null_Memory), int(queue.attach(ETL_NULLPTR, region.size)));
+      CHECK_EQUAL(int(etl::spsc_shared_status::Bad_Magic), int(queue.attach(region.memory, region.size)));
+      CHECK(!queue.is_attached());
+
+      CHECK_EQUAL(int(etl::spsc_shared_status::Ok), int(queue.create(region.memory, region.size)));
+
+      // A different container type.
+      Bip bip;
+      CHECK_EQUAL(int(etl::spsc_shared_status::Bad_Magic), int(bip.attach(region.memory, region.size)));
+
+      // A different element type.
+      etl::queue_spsc_atomic_shared<uint64_t> other;
+      CHECK_EQUAL(int(etl::spsc_shared_status::Bad_Element), int(other.attach(region.memory, region.size)));
+
+      // The region is shorter than the creator's.
+      CHECK_EQUAL(int(etl::spsc_shared_status::Too_Small), int(Queue::validate(region.memory, region.size - sizeof(Sample))));
+      CHECK_EQUAL(int(etl::spsc_shared_status::Too_Small), int(Queue::validate(region.memory, 16U)));
+
+      // Misaligned.
+      CHECK_EQUAL(int(etl::spsc_shared_status::Misaligned), int(Queue::validate(static_cast<char*>(region.memory) + 1, region.size)));
+
+      etl::spsc_shared_header* p_header = static_cast<etl::spsc_shared_header*>(region.memory);
+
+      p_header->version = 2U;
+      CHECK_EQUAL(int(etl::spsc_shared_status::Bad_Version), int(Queue::validate(region.memory, region.size)));
+      p_header->version = etl::spsc_shared_header::Version;
+
+      p_header->data_offset += 8U;
+      CHECK_EQUAL(int(etl::spsc_shared_status::Bad_Layout), int(Queue::validate(region.memory, region.size)));
+      p_header->data_offset -= 8U;
+
+      p_header->write.store(p_header->slots + 1U);
+      CHECK_EQUAL(int(etl::spsc_shared_status::Bad_Layout), int(Queue::validate(region.memory, region.size)));
+      p_header->write.store(0U);
+
+      CHECK_EQUAL(int(etl::spsc_shared_status::Ok), int(queue.attach(region.memory, region.size)));
+    }
+
+    //*************************************************************************
+    TEST(test_attach_validation_over_aligned)
+    {
+      typedef etl::queue_spsc_atomic_shared<Wide> Wide_Queue;
+
+      alignas(512) static unsigned char memory[4U * 512U];
+
+      const size_t size = Wide_Queue::required_size(2U);
+      CHECK(size <= sizeof(memory));
+
+      Wide_Queue queue;
+      CHECK_EQUAL(int(etl::spsc_shared_status::Ok), int(queue.create(memory, size)));
+
+      // The data starts after the header's padding to the element alignment.
+      const etl::spsc_shared_header* p_header = reinterpret_cast<const etl::spsc_shared_header*>(memory);
+      CHECK_EQUAL(512U, p_header->data_offset);
+
+      // Larger than the header, but smaller than the data offset.
+      CHECK_EQUAL(int(etl::spsc_shared_status::Too_Small), int(Wide_Queue::validate(memory, sizeof(etl::spsc_shared_header) + 8U)));
+      CHECK_EQUAL(int(etl::spsc_shared_status::Too_Small), int(Wide_Queue::validate(memory, 511U)));
+      CHECK_EQUAL(int(etl::spsc_shared_status::Too_Small), int(Wide_Queue::validate(memory, size - 1U)));
+      CHECK_EQUAL(int(etl::spsc_shared_status::Ok), int(Wide_Queue::validate(memory, size)));
+    }
+
+    //*************************************************************************
+    TEST(test_create_too_small)
+    {
+      Region region(Queue::required_size(1U));
+
+      Queue queue;
+      CHECK_EQUAL(int(etl::spsc_shared_status::Too_Small), int(queue.create(region.memory, region.size - 1U)));
+      CHECK(!queue.is_attached());
+      CHECK_EQUAL(int(etl::spsc_shared_status::Misaligned), int(queue.create(static_cast<char*>(region.memory) + 2, region.size)));
+      CHECK_EQUAL(int(etl::spsc_shared_status::Ok), int(queue.create(region.memory, region.size)));
+      CHECK_EQUAL(1U, queue.capacity());
+    }
+
+    //*************************************************************************
+    TEST(test_queue_threads)
+    {
+      const uint32_t Count = 20000U;
+
+      Region region(Queue::required_size(64U));
+
+      Queue producer;
+      producer.create(region.memory, region.size);
+
+      std::thread consumer_thread([&region, Count]() {
+        Queue consumer;
+        consumer.attach(region.memory, region.size);
+
+        uint32_t expected = 0U;
+        Sample   sample;
+
+        while (expected < Count)
+        {
+          if (consumer.pop(sample))
+          {
+            if (sample.sequence != expected)
+            {
+              break;
+            }
+
+            ++expected;
+          }
+        }
+
+        CHECK_EQUAL(Count, expected);
+      });
+
+      for (uint32_t i = 0U; i < Count;)
+      {
+        Sample sample = {i, 0U, 0U};
+
+        if (producer.push(sample))
+        {
+          ++i;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      consumer_thread.join();
+    }
+
+    //*************************************************************************
+    TEST(test_bip_create_and_attach)
+    {
+      Region region(Bip::required_size(8U));
+
+      Bip producer;
+      Bip consumer;
+
+      CHECK_EQUAL(int(etl::spsc_shared_status::Ok), int(producer.create(region.memory, region.size)));
+      CHECK_EQUAL(int(etl::spsc_shared_status::Ok), int(consumer.attach(region.memory, region.size)));
+      CHECK_EQUAL(8U, consumer.capacity());
+      CHECK(consumer.empty());
+
+      etl::span<int> writer = producer.write_reserve(5U);
+      CHECK_EQUAL(5U, writer.size());
+
+      for (size_t i = 0U; i < writer.size(); ++i)
+      {
+        writer[i] = int(i);
+      }
+
+      producer.write_commit(writer);
+      CHECK_EQUAL(5U, consumer.size());
+
+      etl::span<int> reader = consumer.read_reserve(3U);
+      CHECK_EQUAL(3U, reader.size());
+      CHECK_EQUAL(0, reader[0]);
+      CHECK_EQUAL(2, reader[2]);
+      consumer.read_commit(reader);
+
+      // 3 forward, 2 after wrapping: the wrapped block is not larger.
+      CHECK_EQUAL(3U, producer.available());
+
+      writer = producer.write_reserve_optimal(3U);
+      CHECK_EQUAL(3U, writer.size());
+      CHECK(writer.data() == static_cast<int*>(static_cast<void*>(static_cast<char*>(region.memory) + etl::spsc_shared_header::Cache_Line_Size * 4U)) + 5);
+      writer[0] = 5;
+      writer[1] = 6;
+      writer[2] = 7;
+      producer.write_commit(writer);
+
+      reader = consumer.read_reserve();
+      CHECK_EQUAL(5U, reader.size());
+      CHECK_EQUAL(3, reader[0]);
+      CHECK_EQUAL(7, reader[4]);
+      consumer.read_commit(reader);
+
+      // Wrap around.
+      writer = producer.write_reserve(4U);
+      CHECK_EQUAL(4U, writer.size());
+      writer[0] = 8;
+      writer[3] = 11;
+      producer.write_commit(writer);
+
+      reader = consumer.read_reserve();
+      CHECK_EQUAL(4U, reader.size());
+      CHECK_EQUAL(8, reader[0]);
+      CHECK_EQUAL(11, reader[3]);
+      consumer.read_commit(reader);
+
+      CHECK(producer.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_bip_invalid_commit)
+    {
+      Region region(Bip::required_size(8U));
+
+      Bip bip;
+      bip.create(region.memory, region.size);
+
+      etl::span<int> writer = bip.write_reserve(4U);
+      etl::span<int> wrong(writer.data() + 1, 2U);
+
+      CHECK_THROW(bip.write_commit(wrong), etl::bip_buffer_reserve_invalid);
+    }
+
+  #if defined(__linux__) && defined(SYS_memfd_create)
+    //*************************************************************************
+    // One shared object mapped at two addresses, as two processes would see it.
+    //*************************************************************************
+    TEST(test_queue_position_independent)
+    {
+      const size_t size = Queue::required_size(16U);
+
+      int fd = static_cast<int>(syscall(SYS_memfd_create, "etl_spsc_shared_memory", 0U));
+      CHECK(fd >= 0);
+
+      if (fd >= 0)
+      {
+        CHECK_EQUAL(0, ftruncate(fd, static_cast<off_t>(size)));
+
+        void* p_producer = mmap(ETL_NULLPTR, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        void* p_consumer = mmap(ETL_NULLPTR, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+        CHECK(p_producer != MAP_FAILED);
+        CHECK(p_consumer != MAP_FAILED);
+        CHECK(p_producer != p_consumer);
+
+        Queue producer;
+        Queue consumer;
+        CHECK_EQUAL(int(etl::spsc_shared_status::Ok), int(producer.create(p_producer, size)));
+        CHECK_EQUAL(int(etl::spsc_shared_status::Ok), int(consumer.attach(p_consumer, size)));
+
+        for (uint32_t i = 0U; i < 40U; ++i)
+        {
+          Sample sample = {i, 2U, 3U};
+          CHECK(producer.push(sample));
+          CHECK(consumer.pop(sample));
+          CHECK_EQUAL(i, sample.sequence);
+        }
+
+        munmap(p_producer, size);
+        munmap(p_consumer, size);
+        close(fd);
+      }
+    }
+  #endif
+  }
+} // namespace
+
+#endif
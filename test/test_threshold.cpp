@@ -30,9 +30,12 @@ SOFTWARE.
 
 #include "etl/threshold.h"
 
+#include "random_values.h"
+
 #include <algorithm>
 #include <array>
 #include <math.h>
+#include <vector>
 
 namespace
 {
@@ -115,5 +118,45 @@ namespace
       bool isEqual = std::equal(output2.begin(), output2.end(), result2b.begin(), Compare());
       CHECK(isEqual);
     }
+
+    //*************************************************************************
+    template <typename T>
+    void check_apply(double lowest, double highest)
+    {
+      const etl::threshold<T> threshold(static_cast<T>((lowest + highest) / 2.0), T(1), T(2));
+
+      const std::vector<T> input = random_values<T>(1003U, lowest, highest, 2U);
+      std::vector<T>       expected(input.size());
+      std::vector<T>       output(input.size());
+
+      std::transform(input.begin(), input.end(), expected.begin(), threshold);
+
+      CHECK_EQUAL(input.size(), threshold.apply(input, output));
+      CHECK(output == expected);
+
+      // In place.
+      std::vector<T> values(input);
+      threshold.apply(values, values);
+      CHECK(values == expected);
+    }
+
+    TEST(test_apply_matches_scalar)
+    {
+      check_apply<int8_t>(-128.0, 127.0);
+      check_apply<uint8_t>(0.0, 255.0);
+      check_apply<int16_t>(-1000.0, 1000.0);
+      check_apply<int32_t>(-100000.0, 100000.0);
+      check_apply<float>(-100.0, 100.0);
+      check_apply<double>(-100.0, 100.0);
+    }
+
+    //*************************************************************************
+    TEST(test_apply_with_compare)
+    {
+      IntThresholdGreater threshold(4, 0, 9);
+
+      CHECK_EQUAL(Size, threshold.apply(input1, output1));
+      CHECK(output1 == result1b);
+    }
   }
 } // namespace
@@ -0,0 +1,326 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include "etl/top_k.h"
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <stdint.h>
+#include <vector>
+
+namespace
+{
+  typedef etl::top_k<int, 4> Top;
+
+  //***************************************************************************
+  std::vector<Top::counter> top_of(const Top& top_k)
+  {
+    std::vector<Top::counter> result;
+    top_k.top(std::back_inserter(result));
+
+    return result;
+  }
+
+  SUITE(test_top_k)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Top top_k;
+
+      CHECK(top_k.empty());
+      CHECK(!top_k.full());
+      CHECK_EQUAL(0U, top_k.size());
+      CHECK_EQUAL(4U, top_k.max_size());
+      CHECK_EQUAL(0U, top_k.total());
+      CHECK_EQUAL(0U, top_k.count(1));
+      CHECK_EQUAL(0U, top_k.minimum_count());
+      CHECK(top_of(top_k).empty());
+    }
+
+    //*************************************************************************
+    TEST(test_exact_while_not_full)
+    {
+      Top top_k;
+
+      top_k.add(1);
+      top_k.add(2, 5U);
+      top_k.add(3, 2U);
+      top_k.add(1);
+
+      CHECK_EQUAL(3U, top_k.size());
+      CHECK(top_k.contains(1));
+      CHECK(!top_k.contains(4));
+      CHECK_EQUAL(2U, top_k.count(1));
+      CHECK_EQUAL(2U, top_k.guaranteed(1));
+      CHECK_EQUAL(9U, top_k.total());
+
+      std::vector<Top::counter> result = top_of(top_k);
+
+      CHECK_EQUAL(3U, result.size());
+      CHECK_EQUAL(2, result[0].key);
+      CHECK_EQUAL(5U, result[0].count);
+      CHECK_EQUAL(0U, result[0].error);
+      CHECK_EQUAL(5U, top_k.count(2));
+
+      // Keys 1 and 3 both have a count of 2.
+      CHECK_EQUAL(2U, result[1].count);
+      CHECK_EQUAL(2U, result[2].count);
+
+      // Only the first 'n' are copied.
+      std::vector<Top::counter> first;
+      top_k.top(std::back_inserter(first), 1U);
+      CHECK_EQUAL(1U, first.size());
+      CHECK_EQUAL(2, first[0].key);
+    }
+
+    //*************************************************************************
+    TEST(test_replace_minimum)
+    {
+      Top top_k;
+
+      top_k.add(1, 10U);
+      top_k.add(2, 20U);
+      top_k.add(3, 30U);
+      top_k.add(4, 40U);
+      CHECK(top_k.full());
+      CHECK_EQUAL(10U, top_k.minimum_count());
+
+      // 5 replaces 1 and inherits its count as the error.
+      top_k.add(5, 3U);
+
+      CHECK(!top_k.contains(1));
+      CHECK(top_k.contains(5));
+      CHECK_EQUAL(13U, top_k.count(5));
+      CHECK_EQUAL(3U, top_k.guaranteed(5));
+      CHECK_EQUAL(13U, top_k.minimum_count());
+
+      // A key that is not counted may have occurred up to the minimum count.
+      CHECK_EQUAL(13U, top_k.count(1));
+      CHECK_EQUAL(0U, top_k.guaranteed(1));
+
+      top_k.clear();
+      CHECK(top_k.empty());
+      CHECK(!top_k.contains(5));
+    }
+
+    //*************************************************************************
+    TEST(test_top_does_not_change_the_sketch)
+    {
+      Top read;
+      Top unread;
+
+      std::mt19937                       generator(1U);
+      std::uniform_int_distribution<int> keys(0, 9);
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        const int key = keys(generator);
+
+        read.add(key);
+        unread.add(key);
+
+        top_of(read);
+
+        CHECK_EQUAL(unread.minimum_count(), read.minimum_count());
+      }
+
+      std::vector<Top::counter> expected = top_of(unread);
+      std::vector<Top::counter> result   = top_of(read);
+
+      CHECK_EQUAL(expected.size(), result.size());
+
+      for (size_t i = 0U; i < expected.size(); ++i)
+      {
+        CHECK_EQUAL(expected[i].key, result[i].key);
+        CHECK_EQUAL(expected[i].count, result[i].count);
+        CHECK_EQUAL(expected[i].error, result[i].error);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_heavy_hitters)
+    {
+      // Three heavy keys in a stream of 10000 distinct light keys.
+      etl::top_k<uint32_t, 50> top_k;
+      std::vector<uint32_t>    stream;
+
+      for (uint32_t i = 0U; i < 10000U; ++i)
+      {
+        stream.push_back(1000000U + i);
+      }
+
+      stream.insert(stream.end(), 3000U, 1U);
+      stream.insert(stream.end(), 2000U, 2U);
+      stream.insert(stream.end(), 1000U, 3U);
+
+      std::mt19937 generator(7);
+      std::shuffle(stream.begin(), stream.end(), generator);
+
+      for (size_t i = 0U; i < stream.size(); ++i)
+      {
+        top_k.add(stream[i]);
+      }
+
+      std::vector<etl::top_k<uint32_t, 50>::counter> result;
+      top_k.top(std::back_inserter(result), 3U);
+
+      CHECK_EQUAL(3U, result.size());
+      CHECK_EQUAL(1U, result[0].key);
+      CHECK_EQUAL(2U, result[1].key);
+      CHECK_EQUAL(3U, result[2].key);
+
+      // The bounds hold.
+      CHECK(top_k.count(1U) >= 3000U);
+      CHECK(top_k.guaranteed(1U) <= 3000U);
+      CHECK(top_k.count(3U) >= 1000U);
+      CHECK(top_k.guaranteed(3U) <= 1000U);
+      CHECK((top_k.count(3U) - 1000U) <= (top_k.total() / 50U));
+    }
+
+    //*************************************************************************
+    TEST(test_bounds_against_exact_counts)
+    {
+      etl::top_k<uint32_t, 32> top_k;
+      std::map<uint32_t, uint32_t> actual;
+
+      std::mt19937                     generator(99);
+      std::geometric_distribution<int> key(0.05);
+
+      for (int i = 0; i < 50000; ++i)
+      {
+        const uint32_t k = static_cast<uint32_t>(key(generator));
+
+        top_k.add(k);
+        ++actual[k];
+
+        // The heap is sorted by top(); it must remain usable.
+        if ((i % 5000) == 0)
+        {
+          std::vector<etl::top_k<uint32_t, 32>::counter> result;
+          top_k.top(std::back_inserter(result));
+        }
+      }
+
+      for (std::map<uint32_t, uint32_t>::const_iterator itr = actual.begin(); itr != actual.end(); ++itr)
+      {
+        CHECK(top_k.count(itr->first) >= itr->second);
+        CHECK(top_k.guaranteed(itr->first) <= itr->second);
+
+        // Any key above total / size is counted.
+        if (itr->second > (top_k.total() / 32U))
+        {
+          CHECK(top_k.contains(itr->first));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_merge)
+    {
+      Top a;
+      Top b;
+
+      a.add(1, 10U);
+      a.add(2, 8U);
+      a.add(3, 6U);
+      a.add(4, 4U);
+
+      b.add(1, 5U);
+      b.add(5, 9U);
+      b.add(6, 1U);
+
+      a.merge(b);
+
+      // b is not full, so its missing keys add nothing.
+      CHECK_EQUAL(15U, a.count(1));
+      CHECK_EQUAL(15U, a.guaranteed(1));
+      CHECK_EQUAL(8U, a.count(2));
+
+      // a is full, so 5 may have occurred up to 4 more times in a's stream,
+      // and replaces the smallest, key 4.
+      CHECK(a.contains(5));
+      CHECK_EQUAL(13U, a.count(5));
+      CHECK_EQUAL(9U, a.guaranteed(5));
+      CHECK(!a.contains(4));
+
+      // 6 is no larger than the smallest, so it is not counted.
+      CHECK(!a.contains(6));
+      CHECK_EQUAL(43U, a.total());
+
+      std::vector<Top::counter> result = top_of(a);
+      CHECK_EQUAL(4U, result.size());
+      CHECK_EQUAL(1, result[0].key);
+      CHECK_EQUAL(5, result[1].key);
+      CHECK_EQUAL(2, result[2].key);
+      CHECK_EQUAL(3, result[3].key);
+    }
+
+    //*************************************************************************
+    TEST(test_merge_bounds)
+    {
+      // Two halves of one stream, counted separately and merged.
+      etl::top_k<uint32_t, 16> a;
+      etl::top_k<uint32_t, 16> b;
+      std::map<uint32_t, uint32_t> actual;
+
+      std::mt19937                     generator(5);
+      std::geometric_distribution<int> key(0.1);
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        const uint32_t k = static_cast<uint32_t>(key(generator));
+
+        ((i % 2) == 0 ? a : b).add(k);
+        ++actual[k];
+      }
+
+      a.merge(b);
+
+      CHECK_EQUAL(20000U, a.total());
+
+      for (std::map<uint32_t, uint32_t>::const_iterator itr = actual.begin(); itr != actual.end(); ++itr)
+      {
+        if (a.contains(itr->first))
+        {
+          CHECK(a.count(itr->first) >= itr->second);
+          CHECK(a.guaranteed(itr->first) <= itr->second);
+        }
+      }
+
+      // The most frequent keys survive the merge.
+      CHECK(a.contains(0U));
+      CHECK(a.contains(1U));
+      CHECK(a.contains(2U));
+    }
+  }
+} // namespace
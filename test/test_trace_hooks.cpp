@@ -0,0 +1,466 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/callback_timer.h"
+#include "etl/fsm.h"
+#include "etl/message_router.h"
+#include "etl/scheduler.h"
+#include "etl/state_chart.h"
+#include "etl/trace_hooks.h"
+#include "etl/vector.h"
+
+#include <string>
+#include <thread>
+
+namespace
+{
+  //***************************************************************************
+  // A clock that advances by 10 ticks on every read.
+  //***************************************************************************
+  uint64_t fake_ticks = 0U;
+
+  uint64_t fake_clock()
+  {
+    fake_ticks += 10U;
+    return fake_ticks;
+  }
+
+  //***************************************************************************
+  struct string_writer
+  {
+    void operator()(const char* text)
+    {
+      output += text;
+    }
+
+    std::string output;
+  };
+
+  //***************************************************************************
+  // Installs the fake clock and a ring for the test, and removes them after.
+  //***************************************************************************
+  struct trace_fixture
+  {
+    trace_fixture()
+      : ring(1U, "main")
+    {
+      fake_ticks = 0U;
+      etl::trace_hooks::set_clock(fake_clock);
+      etl::trace_hooks::set_thread_ring(&ring);
+    }
+
+    ~trace_fixture()
+    {
+      etl::trace_hooks::set_clock(ETL_NULLPTR);
+      etl::trace_hooks::set_thread_ring(ETL_NULLPTR);
+      etl::trace_hooks::set_ring_provider(ETL_NULLPTR);
+    }
+
+    etl::trace_ring<8> ring;
+  };
+
+  //***************************************************************************
+  enum
+  {
+    Message1_Id = 1,
+    Message2_Id = 2
+  };
+
+  struct Message1 : public etl::message<Message1_Id>
+  {
+  };
+
+  struct Message2 : public etl::message<Message2_Id>
+  {
+  };
+
+  //***************************************************************************
+  class Router : public etl::message_router<Router, Message1, Message2>
+  {
+  public:
+
+    Router()
+      : message_router(7)
+      , count(0)
+    {
+    }
+
+    void on_receive(const Message1&)
+    {
+      ++count;
+    }
+
+    void on_receive(const Message2&)
+    {
+      ++count;
+    }
+
+    void on_receive_unknown(const etl::imessage&) {}
+
+    int count;
+  };
+
+  //***************************************************************************
+  class Machine;
+
+  class Only_State : public etl::fsm_state<Machine, Only_State, 0, Message1>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(const Message1&)
+    {
+      return No_State_Change;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(const etl::imessage&)
+    {
+      return No_State_Change;
+    }
+  };
+
+  class Machine : public etl::fsm
+  {
+  public:
+
+    Machine()
+      : fsm(5)
+    {
+      p_states[0] = &only_state;
+      set_states(p_states, 1U);
+    }
+
+    Only_State       only_state;
+    etl::ifsm_state* p_states[1];
+  };
+
+  //***************************************************************************
+  class Chart : public etl::state_chart<Chart>
+  {
+  public:
+
+    Chart()
+      : etl::state_chart<Chart>(*this, transitions, transitions + 1, ETL_NULLPTR, ETL_NULLPTR, 0)
+    {
+    }
+
+    void on_go() {}
+
+    static const transition transitions[1];
+  };
+
+  const Chart::transition Chart::transitions[1] = {Chart::transition(0, 3, 1, &Chart::on_go)};
+
+  //***************************************************************************
+  class Worker : public etl::task
+  {
+  public:
+
+    Worker(etl::task_priority_t priority, uint32_t work_)
+      : task(priority)
+      , work(work_)
+    {
+    }
+
+    uint32_t task_request_work() const ETL_OVERRIDE
+    {
+      return work;
+    }
+
+    void task_process_work() ETL_OVERRIDE
+    {
+      --work;
+    }
+
+    uint32_t work;
+  };
+
+  void timer_callback() {}
+
+  SUITE(test_trace_hooks)
+  {
+    //*************************************************************************
+    TEST(test_no_clock_records_nothing)
+    {
+      etl::trace_ring<8> ring;
+      etl::trace_hooks::set_thread_ring(&ring);
+
+      Router router;
+      router.receive(Message1());
+
+      CHECK_EQUAL(1, router.count);
+      CHECK_EQUAL(0U, ring.size());
+
+      etl::trace_hooks::set_thread_ring(ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(trace_fixture, test_message_router_probe)
+    {
+      Router router;
+      router.receive(Message2());
+
+      CHECK_EQUAL(1U, ring.size());
+      CHECK_EQUAL(int(etl::trace_category::Message_Router), int(ring[0].category));
+      CHECK_EQUAL(7U, ring[0].component_id);
+      CHECK_EQUAL(uint32_t(Message2_Id), ring[0].message_id);
+      CHECK_EQUAL(10U, ring[0].start);
+      CHECK_EQUAL(10U, ring[0].duration);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(trace_fixture, test_fsm_probe)
+    {
+      Machine machine;
+      machine.start(false);
+      machine.receive(Message1());
+
+      CHECK_EQUAL(1U, ring.size());
+      CHECK_EQUAL(int(etl::trace_category::Fsm), int(ring[0].category));
+      CHECK_EQUAL(5U, ring[0].component_id);
+      CHECK_EQUAL(uint32_t(Message1_Id), ring[0].message_id);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(trace_fixture, test_state_chart_probe)
+    {
+      Chart chart;
+      chart.start(false);
+      chart.process_event(3);
+
+      CHECK_EQUAL(1U, chart.get_state_id());
+      CHECK_EQUAL(1U, ring.size());
+      CHECK_EQUAL(int(etl::trace_category::State_Chart), int(ring[0].category));
+      CHECK_EQUAL(0U, ring[0].component_id);
+      CHECK_EQUAL(3U, ring[0].message_id);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(trace_fixture, test_scheduler_probe)
+    {
+      Worker worker1(1, 2U);
+      Worker worker2(2, 1U);
+
+      etl::vector<etl::task*, 2> tasks;
+      tasks.push_back(&worker2);
+      tasks.push_back(&worker1);
+
+      etl::scheduler_policy_sequential_multiple policy;
+      policy.schedule_tasks(tasks);
+
+      CHECK_EQUAL(3U, ring.size());
+      CHECK_EQUAL(int(etl::trace_category::Scheduler), int(ring[0].category));
+      CHECK_EQUAL(2U, ring[0].component_id);
+      CHECK_EQUAL(1U, ring[1].component_id);
+      CHECK_EQUAL(1U, ring[2].component_id);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(trace_fixture, test_timer_probe)
+    {
+      etl::callback_timer<1> timers;
+
+      etl::timer::id::type id = timers.register_timer(timer_callback, 5, etl::timer::mode::Single_Shot);
+      timers.enable(true);
+      timers.start(id);
+      timers.tick(5);
+
+      CHECK_EQUAL(1U, ring.size());
+      CHECK_EQUAL(int(etl::trace_category::Timer), int(ring[0].category));
+      CHECK_EQUAL(uint32_t(id), ring[0].component_id);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(trace_fixture, test_ring_overwrites_oldest)
+    {
+      Router router;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        router.receive((i & 1) ? static_cast<const etl::imessage&>(Message2()) : static_cast<const etl::imessage&>(Message1()));
+      }
+
+      CHECK_EQUAL(8U, ring.size());
+      CHECK_EQUAL(8U, ring.capacity());
+      CHECK_EQUAL(10U, ring.total());
+      CHECK_EQUAL(2U, ring.dropped());
+
+      // The oldest held record is the third.
+      CHECK_EQUAL(uint32_t(Message1_Id), ring[0].message_id);
+      CHECK_EQUAL(50U, ring[0].start);
+      CHECK_EQUAL(uint32_t(Message2_Id), ring[7].message_id);
+
+      ring.clear();
+      CHECK_EQUAL(0U, ring.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(trace_fixture, test_ring_provider_overrides_thread_ring)
+    {
+      static etl::trace_ring<4> other;
+      other.clear();
+
+      struct provider
+      {
+        static etl::itrace_ring* get()
+        {
+          return &other;
+        }
+      };
+
+      etl::trace_hooks::set_ring_provider(provider::get);
+
+      Router router;
+      router.receive(Message1());
+
+      CHECK_EQUAL(0U, ring.size());
+      CHECK_EQUAL(1U, other.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(trace_fixture, test_rings_are_per_thread)
+    {
+      etl::trace_ring<8> thread_ring(2U);
+
+      std::thread t([&thread_ring]() {
+        etl::trace_hooks::set_thread_ring(&thread_ring);
+
+        Router router;
+        router.receive(Message1());
+        router.receive(Message2());
+
+        etl::trace_hooks::set_thread_ring(ETL_NULLPTR);
+      });
+
+      t.join();
+
+      Router router;
+      router.receive(Message1());
+
+      CHECK_EQUAL(2U, thread_ring.size());
+      CHECK_EQUAL(1U, ring.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(trace_fixture, test_chrome_json_export)
+    {
+      Router router;
+      router.receive(Message2());
+
+      string_writer writer;
+
+      {
+        // 1 tick = 1ns.
+        etl::trace_json_writer<string_writer> json(writer, 1000000000ULL);
+        json.write(ring);
+      }
+
+      std::string expected = "[\n"
+                             "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"main\"}},\n"
+                             "{\"name\":\"message_router\",\"cat\":\"etl\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":0.010,\"dur\":0.010,"
+                             "\"args\":{\"component\":7,\"message\":2}}]\n";
+
+      CHECK_EQUAL(expected, writer.output);
+    }
+
+    //*************************************************************************
+    TEST(test_json_export_escapes_thread_names)
+    {
+      etl::trace_ring<4> named_ring(2U, "say \"hi\"\\\n\x01 and a name longer than one buffer");
+
+      string_writer writer;
+
+      {
+        etl::trace_json_writer<string_writer> json(writer, 1000000000ULL);
+        json.write(named_ring);
+      }
+
+      std::string expected = "[\n"
+                             "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":2,"
+                             "\"args\":{\"name\":\"say \\\"hi\\\"\\\\\\u000a\\u0001 and a name longer than one buffer\"}}]\n";
+
+      CHECK_EQUAL(expected, writer.output);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(trace_fixture, test_perfetto_json_export)
+    {
+      etl::trace_record record;
+      record.start        = 123456789ULL;
+      record.duration     = 2500U;
+      record.component_id = 3U;
+      record.message_id   = 4U;
+      record.category     = etl::trace_category::Fsm;
+
+      string_writer writer;
+
+      // 1 tick = 0.1us.
+      etl::trace_json_writer<string_writer> json(writer, 10000000ULL, etl::trace_format::Perfetto, 9U);
+      json.write(record, 6U);
+      json.finish();
+      json.finish();
+
+      std::string expected = "{\"traceEvents\":[\n"
+                             "{\"name\":\"fsm\",\"cat\":\"etl\",\"ph\":\"X\",\"pid\":9,\"tid\":6,\"ts\":12345678.900,\"dur\":250.000,"
+                             "\"args\":{\"component\":3,\"message\":4}}],\"displayTimeUnit\":\"ns\"}\n";
+
+      CHECK_EQUAL(expected, writer.output);
+    }
+
+    //*************************************************************************
+    TEST(test_json_export_high_tick_rate)
+    {
+      // A fraction of a second near the tick rate would overflow part * 10^9.
+      const uint64_t rates[] = {40000000000ULL, 16000000000000000000ULL};
+
+      for (size_t i = 0U; i < (sizeof(rates) / sizeof(rates[0])); ++i)
+      {
+        const uint64_t ticks_per_second = rates[i];
+
+        etl::trace_record record;
+        record.start        = ticks_per_second - 1U;
+        record.duration     = 0U;
+        record.component_id = 1U;
+        record.message_id   = 2U;
+        record.category     = etl::trace_category::Fsm;
+
+        string_writer writer;
+
+        etl::trace_json_writer<string_writer> json(writer, ticks_per_second);
+        json.write(record, 1U);
+
+        record.start = (ticks_per_second / 4U) * 3U;
+        json.write(record, 1U);
+
+        CHECK(writer.output.find("\"ts\":999999.999,\"dur\":0.000,") != std::string::npos);
+        CHECK(writer.output.find("\"ts\":750000.000,\"dur\":0.000,") != std::string::npos);
+      }
+    }
+  }
+} // namespace
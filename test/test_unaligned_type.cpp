@@ -1122,6 +1122,204 @@ namespace
       CHECK_EQUAL(value, uint16_t(be_from_host));
     }
 #endif
+
+    //*************************************************************************
+    TEST(test_unaligned_copy_to_native_big_endian)
+    {
+      // An odd count and an unaligned source exercise the vector body and the tail.
+      const size_t N = 37U;
+
+      unsigned char buffer[(N * sizeof(uint32_t)) + 1U];
+
+      for (size_t i = 0U; i < N; ++i)
+      {
+        const uint32_t value = 0x01020304UL * uint32_t(i + 1U);
+
+        buffer[1U + (i * 4U) + 0U] = static_cast<unsigned char>(value >> 24U);
+        buffer[1U + (i * 4U) + 1U] = static_cast<unsigned char>(value >> 16U);
+        buffer[1U + (i * 4U) + 2U] = static_cast<unsigned char>(value >> 8U);
+        buffer[1U + (i * 4U) + 3U] = static_cast<unsigned char>(value);
+      }
+
+      const etl::be_uint32_t* source = reinterpret_cast<const etl::be_uint32_t*>(buffer + 1U);
+
+      uint32_t native[N];
+      etl::unaligned_copy_to_native(source, N, native);
+
+      for (size_t i = 0U; i < N; ++i)
+      {
+        CHECK_EQUAL(0x01020304UL * uint32_t(i + 1U), native[i]);
+        CHECK_EQUAL(uint32_t(source[i]), native[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_unaligned_copy_round_trip)
+    {
+      const size_t N = 21U;
+
+      uint16_t native16[N];
+      uint64_t native64[N];
+      double   native_double[N];
+
+      for (size_t i = 0U; i < N; ++i)
+      {
+        native16[i]      = static_cast<uint16_t>(0x1234U + (i * 0x0101U));
+        native64[i]      = 0x0102030405060708ULL * (i + 1U);
+        native_double[i] = 1.5 * double(i);
+      }
+
+      etl::be_uint16_t be16[N];
+      etl::le_uint16_t le16[N];
+      etl::be_uint64_t be64[N];
+      etl::be_double_t be_double[N];
+
+      etl::unaligned_copy_from_native(native16, N, be16);
+      etl::unaligned_copy_from_native(native16, N, le16);
+      etl::unaligned_copy_from_native(native64, N, be64);
+      etl::unaligned_copy_from_native(native_double, N, be_double);
+
+      for (size_t i = 0U; i < N; ++i)
+      {
+        CHECK_EQUAL(native16[i], uint16_t(be16[i]));
+        CHECK_EQUAL(native16[i], uint16_t(le16[i]));
+        CHECK_EQUAL(int(native16[i] >> 8U), int(be16[i][0]));
+        CHECK_EQUAL(native64[i], uint64_t(be64[i]));
+        CHECK_CLOSE(native_double[i], double(be_double[i]), 0.0);
+      }
+
+      uint16_t result16[N];
+      uint64_t result64[N];
+      double   result_double[N];
+
+      etl::unaligned_copy_to_native(be16, N, result16);
+      etl::unaligned_copy_to_native(be64, N, result64);
+      etl::unaligned_copy_to_native(be_double, N, result_double);
+
+      CHECK_ARRAY_EQUAL(native16, result16, N);
+      CHECK_ARRAY_EQUAL(native64, result64, N);
+      CHECK_ARRAY_CLOSE(native_double, result_double, N, 0.0);
+    }
+
+    //*************************************************************************
+    TEST(test_unaligned_copy_spans)
+    {
+      const etl::be_uint32_t source[4] = {1U, 2U, 3U, 4U};
+      uint32_t               destination[3];
+
+      size_t n = etl::unaligned_copy_to_native(etl::span<const etl::be_uint32_t>(source), etl::span<uint32_t>(destination));
+
+      CHECK_EQUAL(3U, n);
+      CHECK_EQUAL(1U, destination[0]);
+      CHECK_EQUAL(2U, destination[1]);
+      CHECK_EQUAL(3U, destination[2]);
+
+      const uint32_t   values[2] = {0xAABBCCDDUL, 0x11223344UL};
+      etl::le_uint32_t le[4];
+
+      n = etl::unaligned_copy_from_native(etl::span<const uint32_t>(values), etl::span<etl::le_uint32_t>(le));
+
+      CHECK_EQUAL(2U, n);
+      CHECK_EQUAL(0xAABBCCDDUL, uint32_t(le[0]));
+      CHECK_EQUAL(0xDD, int(le[0][0]));
+      CHECK_EQUAL(0x11223344UL, uint32_t(le[1]));
+    }
+
+    //*************************************************************************
+    TEST(test_unaligned_copy_spans_mutable_and_fixed_extent)
+    {
+      etl::be_uint16_t source[3] = {0x0102U, 0x0304U, 0x0506U};
+      uint16_t         destination[3];
+
+      size_t n = etl::unaligned_copy_to_native(etl::span<etl::be_uint16_t, 3>(source), etl::span<uint16_t, 3>(destination));
+
+      CHECK_EQUAL(3U, n);
+      CHECK_EQUAL(0x0102U, destination[0]);
+      CHECK_EQUAL(0x0506U, destination[2]);
+
+      uint16_t         values[2] = {0xAABBU, 0xCCDDU};
+      etl::le_uint16_t le[2];
+
+      n = etl::unaligned_copy_from_native(etl::span<uint16_t, 2>(values), etl::span<etl::le_uint16_t, 2>(le));
+
+      CHECK_EQUAL(2U, n);
+      CHECK_EQUAL(0xBB, int(le[0][0]));
+      CHECK_EQUAL(0xCCDDU, uint16_t(le[1]));
+    }
+
+    //*************************************************************************
+    TEST(test_unaligned_copy_empty_spans)
+    {
+      uint16_t         destination[1] = {7U};
+      etl::le_uint16_t le[1];
+      le[0] = 9U;
+
+      CHECK_EQUAL(0U, etl::unaligned_copy_to_native(etl::span<const etl::be_uint16_t>(), etl::span<uint16_t>(destination)));
+      CHECK_EQUAL(0U, etl::unaligned_copy_from_native(etl::span<const uint16_t>(), etl::span<etl::le_uint16_t>(le)));
+      CHECK_EQUAL(7U, destination[0]);
+      CHECK_EQUAL(9U, uint16_t(le[0]));
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    TEST(test_unaligned_struct_view)
+    {
+      typedef etl::unaligned_struct_view<etl::be_uint32_t, etl::be_uint16_t, etl::le_uint16_t, etl::be_uchar_t, etl::be_int64_t> header_view;
+
+      CHECK_EQUAL(17U, header_view::Size);
+      CHECK_EQUAL(5U, header_view::Number_Of_Fields);
+      CHECK_EQUAL(0U, header_view::offset<0>());
+      CHECK_EQUAL(4U, header_view::offset<1>());
+      CHECK_EQUAL(6U, header_view::offset<2>());
+      CHECK_EQUAL(8U, header_view::offset<3>());
+      CHECK_EQUAL(9U, header_view::offset<4>());
+
+      unsigned char buffer[18] = {0xFF,                                         // Padding, so that the view is unaligned.
+                                  0xCA, 0xFE, 0xBA, 0xBE,                       // be_uint32_t
+                                  0x00, 0x02,                                   // be_uint16_t
+                                  0x34, 0x12,                                   // le_uint16_t
+                                  0x7F,                                         // be_uchar_t
+                                  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE}; // be_int64_t
+
+      header_view view(buffer + 1, sizeof(buffer) - 1U);
+
+      CHECK_EQUAL(17U, view.size());
+      CHECK_EQUAL(0xCAFEBABEUL, view.get<0>());
+      CHECK_EQUAL(2U, view.get<1>());
+      CHECK_EQUAL(0x1234U, view.get<2>());
+      CHECK_EQUAL(0x7F, int(view.get<3>()));
+      CHECK_EQUAL(-2, view.get<4>());
+
+      uint32_t      magic;
+      uint16_t      version;
+      uint16_t      flags;
+      unsigned char kind;
+      int64_t       length;
+
+      view.decode(magic, version, flags, kind, length);
+
+      CHECK_EQUAL(0xCAFEBABEUL, magic);
+      CHECK_EQUAL(2U, version);
+      CHECK_EQUAL(0x1234U, flags);
+      CHECK_EQUAL(0x7F, int(kind));
+      CHECK_EQUAL(-2, length);
+
+      unsigned char encoded[17];
+      header_view::encode(encoded, sizeof(encoded), magic, version, flags, kind, length);
+
+      CHECK_ARRAY_EQUAL(buffer + 1, encoded, 17U);
+    }
+
+    //*************************************************************************
+    TEST(test_unaligned_struct_view_short_buffer)
+    {
+      typedef etl::unaligned_struct_view<etl::be_uint32_t, etl::be_uint16_t> header_view;
+
+      unsigned char buffer[5] = {0};
+
+      CHECK_THROW(header_view(buffer, sizeof(buffer)), etl::unaligned_type_buffer_size);
+    }
+#endif
   }
 } // namespace
 